@@ -0,0 +1,60 @@
+#include "CD_Driver.H"
+#include "CD_FieldSolverMultigrid.H"
+#include <CD_RodDielectric.H>
+#include <CD_MechanicalShaft.H>
+#include <CD_ElectrodeArray.H>
+#include "CD_FieldStepper.H"
+#include "ParmParse.H"
+
+using namespace ChomboDischarge;
+using namespace Physics::Electrostatics;
+
+int
+main(int argc, char* argv[])
+{
+
+#ifdef CH_MPI
+  MPI_Init(&argc, &argv);
+#endif
+
+  // Build class options from input script and command line options
+  const std::string input_file = argv[1];
+  ParmParse         pp(argc - 2, argv + 2, NULL, input_file.c_str());
+
+  // Get the geometry that will be benchmarked
+  std::string geometry;
+
+  ParmParse bench("Benchmark");
+  bench.get("geometry", geometry);
+
+  RefCountedPtr<ComputationalGeometry> compgeom;
+  if (geometry == "RodDielectric") {
+    compgeom = RefCountedPtr<ComputationalGeometry>(new RodDielectric());
+  }
+  else if (geometry == "MechanicalShaft") {
+    compgeom = RefCountedPtr<ComputationalGeometry>(new MechanicalShaft());
+  }
+  else if (geometry == "ElectrodeArray") {
+    compgeom = RefCountedPtr<ComputationalGeometry>(new ElectrodeArray());
+  }
+  else {
+    MayDay::Error("program.cpp - unknown geometry requested for 'Benchmark.geometry'");
+  }
+
+  // Set up AMR
+  RefCountedPtr<AmrMesh>      amr        = RefCountedPtr<AmrMesh>(new AmrMesh());
+  RefCountedPtr<GeoCoarsener> geocoarsen = RefCountedPtr<GeoCoarsener>(new GeoCoarsener());
+  RefCountedPtr<CellTagger>   tagger     = RefCountedPtr<CellTagger>(NULL);
+
+  // Set up basic Poisson, potential = 1. The benchmark is run by FieldStepper (FieldStepper.benchmark = true)
+  auto timestepper = RefCountedPtr<FieldStepper<FieldSolverMultigrid>>(new FieldStepper<FieldSolverMultigrid>());
+
+  // Set up the Driver and run it
+  RefCountedPtr<Driver> engine = RefCountedPtr<Driver>(new Driver(compgeom, timestepper, amr, tagger, geocoarsen));
+  engine->setupAndRun(input_file);
+
+#ifdef CH_MPI
+  CH_TIMER_REPORT();
+  MPI_Finalize();
+#endif
+}
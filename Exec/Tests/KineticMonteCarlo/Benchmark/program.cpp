@@ -0,0 +1,240 @@
+#include <map>
+#include <random>
+
+#include <CD_Driver.H>
+#include <CD_Timer.H>
+#include <CD_KMCSolver.H>
+#include <CD_KMCSingleStateReaction.H>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// TLDR: This program measures the throughput (firings per second) of the KMCSolver algorithms on synthetic reaction
+//       networks. A network with N species and population scale S contains, for each species X_i, the reactions
+//
+//       0         -> X_i      (rate S)
+//       X_i       -> 0        (rate 1)
+//       X_i       -> X_(i+1)  (rate 1)
+//       X_i + X_j -> X_k      (rate 1/S, with j and k drawn randomly)
+//
+//       so that all populations stay on the order of S. Each measurement advances the state with one algorithm for at
+//       least Benchmark.min_time seconds. With OpenMP, each thread advances its own copy of the state with its own
+//       solver (similar to how KMC is run per cell in the physics modules), and the firings are summed over the
+//       threads.
+
+using namespace ChomboDischarge;
+
+using FPR           = Real;
+using KMCState      = KMCSingleState<FPR>;
+using KMCReaction   = KMCSingleStateReaction<KMCState, FPR>;
+using KMCSolverType = KMCSolver<KMCReaction, KMCState, FPR>;
+using ReactionList  = std::vector<std::shared_ptr<const KMCReaction>>;
+
+// Algorithm types that are benchmarked
+enum class Algorithm
+{
+  SSA,
+  Tau,
+  Hybrid
+};
+
+// Build the synthetic reaction network
+ReactionList
+makeNetwork(const int a_numSpecies, const Real a_scale, const int a_seed)
+{
+  std::mt19937_64                    rng(a_seed);
+  std::uniform_int_distribution<int> species(0, a_numSpecies - 1);
+
+  ReactionList reactions;
+
+  for (int i = 0; i < a_numSpecies; i++) {
+    const size_t X  = i;
+    const size_t Xn = (i + 1) % a_numSpecies;
+    const size_t Xj = species(rng);
+    const size_t Xk = species(rng);
+
+    auto production = std::make_shared<KMCReaction>(std::list<size_t>{}, std::list<size_t>{X});
+    auto decay      = std::make_shared<KMCReaction>(std::list<size_t>{X}, std::list<size_t>{});
+    auto conversion = std::make_shared<KMCReaction>(std::list<size_t>{X}, std::list<size_t>{Xn});
+    auto binary     = std::make_shared<KMCReaction>(std::list<size_t>{X, Xj}, std::list<size_t>{Xk});
+
+    production->rate() = a_scale;
+    decay->rate()      = 1.0;
+    conversion->rate() = 1.0;
+    binary->rate()     = 1.0 / a_scale;
+
+    reactions.emplace_back(production);
+    reactions.emplace_back(decay);
+    reactions.emplace_back(conversion);
+    reactions.emplace_back(binary);
+  }
+
+  return reactions;
+}
+
+int
+main(int argc, char* argv[])
+{
+#ifdef CH_MPI
+  MPI_Init(&argc, &argv);
+#endif
+
+  // Read input file
+  ParmParse pp(argc - 2, argv + 2, NULL, argv[1]);
+
+  Random::seed();
+
+  // Benchmark settings
+  std::vector<int>         networkSizes;
+  std::vector<Real>        populationScales;
+  std::vector<int>         threadCounts;
+  std::vector<std::string> algorithms;
+
+  Real minTime = 0.5;
+  Real dt      = 1.E-3;
+  int  seed    = 0;
+
+  ParmParse bench("Benchmark");
+
+  bench.getarr("network_sizes", networkSizes, 0, bench.countval("network_sizes"));
+  bench.getarr("population_scales", populationScales, 0, bench.countval("population_scales"));
+  bench.getarr("threads", threadCounts, 0, bench.countval("threads"));
+  bench.getarr("algorithms", algorithms, 0, bench.countval("algorithms"));
+  bench.get("min_time", minTime);
+  bench.get("dt", dt);
+  bench.get("seed", seed);
+
+  // Solver settings for the tau-leaping and hybrid algorithms
+  Real SSAlim  = 5.0;
+  Real eps     = 0.03;
+  Real exitTol = 1.E-6;
+  int  numCrit = 5;
+  int  numSSA  = 10;
+  int  maxIter = 15;
+
+  bench.get("num_crit", numCrit);
+  bench.get("num_ssa", numSSA);
+  bench.get("eps", eps);
+  bench.get("ssa_lim", SSAlim);
+  bench.get("max_iter", maxIter);
+  bench.get("exit_tol", exitTol);
+
+  // Translate the algorithm names.
+  const std::map<std::string, std::pair<Algorithm, KMCLeapPropagator>> algorithmMap = {
+    {"ssa", {Algorithm::SSA, KMCLeapPropagator::ExplicitEuler}},
+    {"explicit_euler", {Algorithm::Tau, KMCLeapPropagator::ExplicitEuler}},
+    {"midpoint", {Algorithm::Tau, KMCLeapPropagator::Midpoint}},
+    {"prc", {Algorithm::Tau, KMCLeapPropagator::PRC}},
+    {"implicit_euler", {Algorithm::Tau, KMCLeapPropagator::ImplicitEuler}},
+    {"hybrid_explicit_euler", {Algorithm::Hybrid, KMCLeapPropagator::ExplicitEuler}},
+    {"hybrid_midpoint", {Algorithm::Hybrid, KMCLeapPropagator::Midpoint}},
+    {"hybrid_prc", {Algorithm::Hybrid, KMCLeapPropagator::PRC}},
+    {"hybrid_implicit_euler", {Algorithm::Hybrid, KMCLeapPropagator::ImplicitEuler}}};
+
+  for (const auto& alg : algorithms) {
+    if (algorithmMap.find(alg) == algorithmMap.end()) {
+      const std::string err = "program.cpp - algorithm '" + alg + "' is not supported";
+
+      MayDay::Error(err.c_str());
+    }
+  }
+
+  char line[256];
+
+  sprintf(line,
+          "%-24s %8s %10s %8s %14s %14s %12s",
+          "# Algorithm",
+          "Species",
+          "Scale",
+          "Threads",
+          "Firings",
+          "Firings/s",
+          "Calls/s");
+  pout() << line << endl;
+
+  for (const auto& alg : algorithms) {
+    const Algorithm         algorithm  = algorithmMap.at(alg).first;
+    const KMCLeapPropagator propagator = algorithmMap.at(alg).second;
+
+    // Batch the SSA steps so we don't check the clock after every firing.
+    const int batchSize = (algorithm == Algorithm::SSA) ? 64 : 1;
+
+    for (const auto& numSpecies : networkSizes) {
+      for (const auto& scale : populationScales) {
+        const ReactionList reactions = makeNetwork(numSpecies, scale, seed);
+
+        for (const auto& threads : threadCounts) {
+#ifdef _OPENMP
+          const int numThreads = (threads > 0) ? threads : omp_get_max_threads();
+#else
+          const int numThreads = 1;
+#endif
+
+          long long numFirings = 0LL;
+          long long numCalls   = 0LL;
+
+          const Real t0 = Timer::wallClock();
+
+#pragma omp parallel num_threads(numThreads) reduction(+ : numFirings, numCalls)
+          {
+            KMCSolverType solver(reactions);
+
+            solver.setSolverParameters(numCrit, numSSA, maxIter, eps, SSAlim, exitTol);
+            solver.setProfiling(true);
+
+            KMCState state(numSpecies);
+            for (int i = 0; i < numSpecies; i++) {
+              state[i] = std::round(scale);
+            }
+
+            while (Timer::wallClock() - t0 < minTime) {
+              for (int i = 0; i < batchSize; i++) {
+                switch (algorithm) {
+                case Algorithm::SSA: {
+                  solver.stepSSA(state);
+
+                  break;
+                }
+                case Algorithm::Tau: {
+                  solver.advanceTau(state, dt, propagator);
+
+                  break;
+                }
+                case Algorithm::Hybrid: {
+                  solver.advanceHybrid(state, dt, propagator);
+
+                  break;
+                }
+                }
+              }
+
+              numCalls += batchSize;
+            }
+
+            for (const auto& firings : solver.getNumFirings()) {
+              numFirings += firings;
+            }
+          }
+
+          const Real elapsed = Timer::wallClock() - t0;
+
+          sprintf(line,
+                  "%-24s %8d %10.2E %8d %14lld %14.4E %12.4E",
+                  alg.c_str(),
+                  numSpecies,
+                  scale,
+                  numThreads,
+                  numFirings,
+                  numFirings / elapsed,
+                  numCalls / elapsed);
+          pout() << line << endl;
+        }
+      }
+    }
+  }
+
+#ifdef CH_MPI
+  MPI_Finalize();
+#endif
+}
@@ -1,10 +1,13 @@
 import os
+import re
+import json
 import glob
 import argparse
 import sys
 import configparser
 import subprocess
 import time
+import statistics
 from subprocess import DEVNULL
 
 # This script requires Python3.5 to work properly
@@ -24,6 +27,8 @@ parser.add_argument('--clean',     help="Do a clean compile.",            action
 parser.add_argument('--benchmark', help="Generate benchmark files only.", action='store_true')
 parser.add_argument('--no_exec',   help="Do not run executables.",        action='store_true')
 parser.add_argument('--compare',   help="Turn off HDF5 comparisons",      action='store_true')
+parser.add_argument('--performance', help="Run performance regression tests.",             action='store_true')
+parser.add_argument('--perf_baseline', help="Store performance timings as the new baselines.", action='store_true')
 parser.add_argument('-mpi',        help="Use MPI or not",         type=str, default="FALSE",  required=False)
 parser.add_argument('-hdf',        help="Use HDF5 or not",        type=str, default="FALSE",  required=False)
 parser.add_argument('-openmp',     help="Use OpenMP or not",      type=str, default="FALSE",  required=False)
@@ -32,6 +37,9 @@ parser.add_argument('-cores',      help="Number of cores to use", type=int, defa
 parser.add_argument('-exec_mpi',   help="MPI run command.",       type=str, default="mpirun", required=False)
 parser.add_argument('-suites',     help="Test suite (e.g. 'geometry' or 'field')", nargs='+', default="all")
 parser.add_argument('-tests',      help="Individual tests in test suite.", nargs='+', required=False)
+parser.add_argument('-perf_tol',    help="Relative slowdown that fails a performance test", type=float, default=0.2, required=False)
+parser.add_argument('-perf_min',    help="Ignore timings shorter than this (seconds)",      type=float, default=0.1, required=False)
+parser.add_argument('-perf_repeat', help="Number of runs per performance test (fastest is used)", type=int, default=1, required=False)
 
 
 args = parser.parse_args()
@@ -117,6 +125,86 @@ def compile_test(silent, build_procs, dim, mpi, omp, hdf, clean, main):
         exit_code = subprocess.call(makeCommand, shell=True)
     return exit_code
 
+# --------------------------------------------------
+# Get the step times from the Driver step reports
+# --------------------------------------------------
+def parse_step_times(log_file):
+    """ Get the wall-clock time of each time step from the 'Last time step' lines in a pout/log file. """
+    pattern = re.compile(r"Last time step\s*:\s*(\d+)h\s*(\d+)m\s*(\d+)s\s*(\d+)ms")
+    times   = []
+
+    if os.path.exists(log_file):
+        with open(log_file, errors="replace") as f:
+            for line in f:
+                match = pattern.search(line)
+                if match:
+                    hrs, mins, secs, ms = [int(x) for x in match.groups()]
+                    times.append(3600.0 * hrs + 60.0 * mins + secs + 0.001 * ms)
+
+    return times
+
+# --------------------------------------------------
+# Read a Timer report (e.g. the Driver setup report)
+# --------------------------------------------------
+def parse_timer_report(report_file):
+    """ Read a file written by Timer::writeReportToFile and return the maximum time over the MPI ranks for each event. """
+    events = {}
+
+    if os.path.exists(report_file):
+        with open(report_file) as f:
+            names = [name.strip() for name in f.readline().rstrip("\n").split("\t")[1:]]
+            for line in f:
+                cols = [col.strip() for col in line.rstrip("\n").split("\t")[1:]]
+                for name, col in zip(names, cols):
+                    if name and col:
+                        events[name] = max(events.get(name, 0.0), float(col))
+
+    return events
+
+# --------------------------------------------------
+# Collect the timings of a performance run
+# --------------------------------------------------
+def collect_timings(wall_time, log_file, report_file):
+    """ Gather the total run time, step times, and setup timers of a performance run into a dictionary. """
+    timings = {"total": wall_time}
+
+    steps = parse_step_times(log_file)
+    if steps:
+        timings["step_median"] = statistics.median(steps)
+        timings["step_total"]  = sum(steps)
+
+    for name, value in parse_timer_report(report_file).items():
+        timings["setup: " + name] = value
+
+    return timings
+
+# --------------------------------------------------
+# Compare timings with a stored baseline
+# --------------------------------------------------
+def compare_timings(timings, baseline, tolerance, min_time):
+    """ Print the timings next to the baseline and return False if any timing is slower than the baseline by more than
+        the tolerance. Timings where both values are shorter than min_time are reported but not checked. """
+    passed = True
+
+    print("\t {:<40s} {:>12s} {:>12s} {:>8s}".format("Timer", "Baseline (s)", "Current (s)", "Ratio"))
+    for name in sorted(baseline.keys()):
+        if name not in timings:
+            print("\t {:<40s} {:>12.3f} {:>12s}".format(name, baseline[name], "missing"))
+            continue
+
+        ref   = baseline[name]
+        cur   = timings[name]
+        ratio = cur / ref if ref > 0.0 else float("inf")
+        flag  = ""
+
+        if max(ref, cur) >= min_time and ratio > 1.0 + tolerance:
+            flag   = "  <-- SLOWDOWN"
+            passed = False
+
+        print("\t {:<40s} {:>12.3f} {:>12.3f} {:>8.2f}{}".format(name, ref, cur, ratio, flag))
+
+    return passed
+
 # --------------------------------------------------
 # Do a sanity check before trying tests.
 # --------------------------------------------------
@@ -174,6 +262,14 @@ for test in config.sections():
         do_test = False
         if str(test) in args.tests:
             do_test = True
+
+    # --------------------------------------------------
+    # Performance runs only include the tests marked with
+    # 'performance = true', unless tests were specified
+    # --------------------------------------------------
+    if args.performance and not args.tests:
+        if not config.getboolean(str(test), 'performance', fallback=False):
+            do_test = False
         
     # --------------------------------------------------
     # If moron check passed, try to run the test
@@ -272,18 +368,47 @@ for test in config.sections():
                 runCommand = runCommand + " Driver.checkpoint_interval=" + str(nplot)
                 runCommand = runCommand + " Driver.max_steps="     + str(nsteps)
                     
-                if args.benchmark:
+                if args.benchmark or args.performance:
                     runCommand = runCommand + " Driver.restart=0"
                 else:
                     runCommand = runCommand + " Driver.restart="     + str(restart)
 
+                # --------------------------------------------------
+                # Performance runs use fixed seeds and write the
+                # setup timers to mpi/<output>.setup.dat
+                # --------------------------------------------------
+                if args.performance:
+                    runCommand = runCommand + " Random.seed=0 Driver.profile_setup=true"
+
                 print("\t Executing with   = '" + str(runCommand) + "'")
 
                 # --------------------------------------------------
                 # Run the executable and print the exit code
                 # --------------------------------------------------
                 #        exit_code = os.system(runCommand)
-                if args.silent:
+                if args.performance:
+                    os.makedirs("perf", exist_ok=True)
+
+                    perfLog   = "perf/" + str(output) + ".log"
+                    timings   = None
+                    exit_code = 0
+
+                    for r in range(max(1, args.perf_repeat)):
+                        runStart = time.time()
+                        with open(perfLog, "w") as log:
+                            exit_code = subprocess.call(runCommand, shell=True, stdout=log, stderr=subprocess.STDOUT)
+                        runTime = time.time() - runStart
+
+                        if exit_code != 0:
+                            break
+
+                        # With MPI the step reports are in pout.0, otherwise they are on stdout.
+                        stepLog    = "pout.0" if str(args.mpi).upper() == "TRUE" else perfLog
+                        newTimings = collect_timings(runTime, stepLog, "mpi/" + str(output) + ".setup.dat")
+
+                        if timings is None or newTimings["total"] < timings["total"]:
+                            timings = newTimings
+                elif args.silent:
                     exit_code = subprocess.call(runCommand, shell=True, stdout=DEVNULL, stderr=DEVNULL)
                 else:
                     exit_code = subprocess.call(runCommand, shell=True)
@@ -297,7 +422,29 @@ for test in config.sections():
                     # --------------------------------------------------
                     # Do file comparison if the test ran successfully
                     # --------------------------------------------------
-                    if args.benchmark:
+                    if args.performance:
+                        # --------------------------------------------------
+                        # Baselines are stored per test and configuration
+                        # since the timings depend on the build and cores
+                        # --------------------------------------------------
+                        baselineFile = "perf/" + str(config[str(test)]['benchmark']) + "." + executable + ".np" + str(args.cores) + ".json"
+
+                        if args.perf_baseline:
+                            with open(baselineFile, "w") as f:
+                                json.dump(timings, f, indent=2, sort_keys=True)
+                            print("\t Stored performance baseline in " + baselineFile)
+                        elif not os.path.exists(baselineFile):
+                            print("\t Performance baseline " + baselineFile + " not found, generate it with --perf_baseline")
+                        else:
+                            with open(baselineFile) as f:
+                                baseline = json.load(f)
+
+                            if compare_timings(timings, baseline, args.perf_tol, args.perf_min):
+                                print("\t Performance test '" + str(test) + "' passed")
+                            else:
+                                print("\t PERFORMANCE TEST '" + str(test) + "' FAILED - SLOWDOWN LARGER THAN " + str(100 * args.perf_tol) + "%")
+                                ret_code = 3
+                    elif args.benchmark:
                         print("\t Regression test '" + str(test) + "' has generated benchmark files.")
                     elif not args.benchmark and args.compare and str(args.hdf).upper == "TRUE":
                         # --------------------------------------------------
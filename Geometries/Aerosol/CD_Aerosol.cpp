@@ -60,7 +60,11 @@ Aerosol::Aerosol()
 
     char* cstr = new char[ndigits];
 
-    std::vector<std::shared_ptr<EBGeometry::ImplicitFunction<Real>>> spheres;
+    using AABB   = EBGeometry::BoundingVolumes::AABBT<Real>;
+    using Sphere = EBGeometry::SphereSDF<Real>;
+
+    std::vector<std::shared_ptr<Sphere>> spheres;
+    std::vector<AABB>                    boundingVolumes;
 
     for (int i = 0; i < numSpheres; i++) {
 
@@ -77,10 +81,16 @@ Aerosol::Aerosol()
         c[dir] = v[dir];
       }
 
-      spheres.emplace_back(std::make_shared<EBGeometry::SphereSDF<Real>>(c, radius));
+      spheres.emplace_back(std::make_shared<Sphere>(c, radius));
+      boundingVolumes.emplace_back(AABB(c - radius * EBGeometry::Vec3T<Real>::one(),
+                                        c + radius * EBGeometry::Vec3T<Real>::one()));
     }
 
-    const auto unionChombo = RefCountedPtr<BaseIF>(new EBGeometryIF<>(EBGeometry::Union<Real>(spheres), !invert, 0.0));
+    // Use a BVH-accelerated union so that only spheres close to the query point are evaluated.
+    constexpr size_t K = 4;
+
+    const auto sphereUnion = EBGeometry::FastUnion<Real, Sphere, AABB, K>(spheres, boundingVolumes);
+    const auto unionChombo = RefCountedPtr<BaseIF>(new EBGeometryIF<>(sphereUnion, !invert, 0.0));
 
     m_dielectrics.push_back(Dielectric(unionChombo, solidPermittivity));
 
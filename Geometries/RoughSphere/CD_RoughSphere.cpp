@@ -39,6 +39,7 @@ RoughSphere::RoughSphere()
     bool         reseed, live;
     RealVect     f, c;
     Real         r, persist, amp, eps;
+    Real         latticeDx = -1.0;
     int          octaves;
     Vector<Real> v;
 
@@ -49,14 +50,20 @@ RoughSphere::RoughSphere()
     pp.get("noise_amplitude", amp);
     pp.get("noise_octaves", octaves);
     pp.get("noise_persistence", persist);
+    pp.query("noise_lattice_dx", latticeDx);
 
     pp.getarr("noise_frequency", v, 0, SpaceDim);
     f = RealVect(D_DECL(v[0], v[1], v[2]));
     pp.getarr("center", v, 0, SpaceDim);
     c = RealVect(D_DECL(v[0], v[1], v[2]));
 
-    RefCountedPtr<BaseIF> sph = RefCountedPtr<BaseIF>(
-      new PerlinSphereSdf(r, c, false, amp, f, persist, octaves, reseed));
+    PerlinSphereSdf* perlinSphere = new PerlinSphereSdf(r, c, false, amp, f, persist, octaves, reseed);
+
+    if (latticeDx > 0.0) {
+      perlinSphere->tabulateNoise(latticeDx);
+    }
+
+    RefCountedPtr<BaseIF> sph = RefCountedPtr<BaseIF>(perlinSphere);
 
     if (whichMaterial == "electrode")
       m_electrodes.push_back(Electrode(sph, live));
@@ -32,11 +32,21 @@ BrownianWalkerSpecies::BrownianWalkerSpecies()
   Vector<Real> v;
 
   int seed;
+  int numParticles;
 
   pp.get("seed", seed);
   pp.get("diffusion", m_isDiffusive);
   pp.get("advection", m_isMobile);
-  pp.get("num_particles", m_numParticles);
+  pp.get("num_particles", numParticles);
+
+  m_numParticles = numParticles;
+
+  // With weak scaling benchmarks the number of particles is per rank.
+  bool weakScaling = false;
+  pp.query("benchmark_weak", weakScaling);
+  if (weakScaling) {
+    m_numParticles *= numProc();
+  }
   pp.get("blob_radius", m_blobRadius);
 
   pp.getarr("blob_center", v, 0, SpaceDim);
@@ -9,6 +9,13 @@
   @author Robert Marskar
 */
 
+// Std includes
+#include <fstream>
+#include <iomanip>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 // Chombo includes
 #include <ParmParse.H>
 #include <CH_Timer.H>
@@ -19,6 +26,7 @@
 #include <CD_Random.H>
 #include <CD_ParallelOps.H>
 #include <CD_EBCoarseToFineInterp.H>
+#include <CD_Timer.H>
 #include <CD_NamespaceHeader.H>
 
 using namespace Physics::BrownianWalker;
@@ -42,6 +50,25 @@ BrownianWalkerStepper::BrownianWalkerStepper()
   pp.get("load_balance", m_loadBalance);
   pp.get("which_balance", str);
 
+  // Benchmark settings.
+  m_benchmark       = false;
+  m_benchmarkWarmup = 10;
+  m_benchmarkSteps  = 100;
+  m_benchmarkFile   = "benchmark.dat";
+
+  pp.query("benchmark", m_benchmark);
+  pp.query("benchmark_warmup", m_benchmarkWarmup);
+  pp.query("benchmark_steps", m_benchmarkSteps);
+  pp.query("benchmark_file", m_benchmarkFile);
+
+  m_benchmarkStep        = 0;
+  m_benchmarkAdvanced    = 0LL;
+  m_benchmarkDeposited   = 0LL;
+  m_benchmarkKernelTime  = 0.0;
+  m_benchmarkRemapTime   = 0.0;
+  m_benchmarkDepositTime = 0.0;
+  m_benchmarkTotalTime   = 0.0;
+
   if (str == "mesh") {
     m_whichLoadBalance = LoadBalancingMethod::Mesh;
   }
@@ -464,6 +491,20 @@ BrownianWalkerStepper::advance(const Real a_dt)
   //          5. Update the particle velocities and diffusion coefficients.
   //          6. Deposit particles on mesh.
   //
+  //       In benchmark mode we also time the kernel, remap, and deposition, and count the particles that went through them.
+
+  const bool measure = m_benchmark && m_benchmarkStep >= m_benchmarkWarmup &&
+                       m_benchmarkStep < m_benchmarkWarmup + m_benchmarkSteps;
+
+  Real startTime = 0.0;
+  Real phaseTime = 0.0;
+
+  if (measure) {
+    m_benchmarkAdvanced += (long long)m_solver->getNumParticles(ItoSolver::WhichContainer::Bulk, false);
+
+    startTime = Timer::wallClock();
+    phaseTime = startTime;
+  }
 
   // 1. Euler-Maruayma kernel on each patch.
   for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
@@ -502,9 +543,19 @@ BrownianWalkerStepper::advance(const Real a_dt)
     }
   }
 
+  if (measure) {
+    m_benchmarkKernelTime += Timer::wallClock() - phaseTime;
+
+    phaseTime = Timer::wallClock();
+  }
+
   // 2. Remap particles and assign them to correct patches. This discards particles outside the simulation domain.
   m_solver->remap();
 
+  if (measure) {
+    m_benchmarkRemapTime += Timer::wallClock() - phaseTime;
+  }
+
   // 3. Particles that strike the EB are absorbed on it, and removed from the simulation.
   m_solver->removeCoveredParticles(EBRepresentation::ImplicitFunction, 0.0);
 
@@ -517,11 +568,94 @@ BrownianWalkerStepper::advance(const Real a_dt)
   m_solver->interpolateVelocities();
 
   // Deposit onto mesh.
+  if (measure) {
+    phaseTime = Timer::wallClock();
+  }
+
   m_solver->depositParticles();
 
+  if (measure) {
+    const Real stopTime = Timer::wallClock();
+
+    m_benchmarkDepositTime += stopTime - phaseTime;
+    m_benchmarkTotalTime += stopTime - startTime;
+
+    // Not included in the timings.
+    m_benchmarkDeposited += (long long)m_solver->getNumParticles(ItoSolver::WhichContainer::Bulk, false);
+  }
+
+  if (m_benchmark) {
+    m_benchmarkStep++;
+
+    if (m_benchmarkStep == m_benchmarkWarmup + m_benchmarkSteps) {
+      this->writeBenchmarkReport();
+    }
+  }
+
   return a_dt;
 }
 
+void
+BrownianWalkerStepper::writeBenchmarkReport() const
+{
+  CH_TIME("BrownianWalkerStepper::writeBenchmarkReport");
+  if (m_verbosity > 5) {
+    pout() << "BrownianWalkerStepper::writeBenchmarkReport" << endl;
+  }
+
+#ifdef _OPENMP
+  const int numThreads = omp_get_max_threads();
+#else
+  const int numThreads = 1;
+#endif
+
+  const int numRanks = numProc();
+  const int numCores = numRanks * numThreads;
+
+  // The slowest rank determines the time for each phase.
+  const Real kernelTime  = ParallelOps::max(m_benchmarkKernelTime);
+  const Real remapTime   = ParallelOps::max(m_benchmarkRemapTime);
+  const Real depositTime = ParallelOps::max(m_benchmarkDepositTime);
+  const Real totalTime   = ParallelOps::max(m_benchmarkTotalTime);
+
+  const Real particlesPerStep = Real(m_benchmarkAdvanced) / std::max(1, m_benchmarkSteps);
+
+  auto rate = [numCores](const long long a_particles, const Real a_time) -> Real {
+    return (a_time > 0.0) ? a_particles / (a_time * numCores) : 0.0;
+  };
+
+  const Real advanceRate = rate(m_benchmarkAdvanced, kernelTime);
+  const Real remapRate   = rate(m_benchmarkAdvanced, remapTime);
+  const Real depositRate = rate(m_benchmarkDeposited, depositTime);
+  const Real totalRate   = rate(m_benchmarkAdvanced, totalTime);
+
+  pout() << endl;
+  pout() << "BrownianWalkerStepper benchmark" << endl;
+  pout() << "  ranks x threads     = " << numRanks << " x " << numThreads << endl;
+  pout() << "  measured steps      = " << m_benchmarkSteps << " (after " << m_benchmarkWarmup << " warmup steps)" << endl;
+  pout() << "  particles per step  = " << particlesPerStep << endl;
+  pout() << "  advanced/s/core     = " << advanceRate << " (" << kernelTime << " s)" << endl;
+  pout() << "  remapped/s/core     = " << remapRate << " (" << remapTime << " s)" << endl;
+  pout() << "  deposited/s/core    = " << depositRate << " (" << depositTime << " s)" << endl;
+  pout() << "  full step/s/core    = " << totalRate << " (" << totalTime << " s)" << endl;
+  pout() << endl;
+
+  // Append a row to the benchmark file. Rows from runs with different core counts make up the scaling tables.
+  if (procID() == 0 && !m_benchmarkFile.empty()) {
+    std::ofstream output(m_benchmarkFile, std::ios::app);
+
+    if (output.tellp() == 0) {
+      output << "# ranks threads steps particles_per_step t_advance t_remap t_deposit t_step advanced/s/core "
+                "remapped/s/core deposited/s/core step/s/core"
+             << "\n";
+    }
+
+    output << numRanks << " " << numThreads << " " << m_benchmarkSteps << " " << std::scientific << std::setprecision(6)
+           << particlesPerStep << " " << kernelTime << " " << remapTime << " " << depositTime << " " << totalTime << " "
+           << advanceRate << " " << remapRate << " " << depositRate << " " << totalRate << "\n";
+  }
+}
+
 void
 BrownianWalkerStepper::regrid(const int a_lmin, const int a_oldFinestLevel, const int a_newFinestLevel)
 {
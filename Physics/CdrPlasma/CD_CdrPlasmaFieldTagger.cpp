@@ -196,12 +196,12 @@ CdrPlasmaFieldTagger::computeTracers() const
 
         // Put the tracer field where it belongs.
         for (int i = 0; i < m_numTracers; i++) {
-          (*tr[i])(vof, comp);
+          (*tr[i])(vof, comp) = tracers[i];
         }
       };
 
       // Irregular kernel region
-      VoFIterator vofit = (*m_amr->getVofIterator(m_realm, m_phase)[lvl])[din];
+      VoFIterator& vofit = (*m_amr->getVofIterator(m_realm, m_phase)[lvl])[din];
 
       // Execute the kernels
       BoxLoops::loop(box, regularKernel);
@@ -36,6 +36,13 @@ CdrPlasmaStepper::CdrPlasmaStepper()
   m_solverVerbosity = -1;
   m_phase           = phase::gas;
   m_realm           = Realm::Primal;
+
+  m_fastPoissonTol    = 0.0;
+  m_fastRTETol        = 0.0;
+  m_stepsSincePoisson = 0;
+  m_stepsSinceRTE     = 0;
+  m_numPoissonStates  = 0;
+  m_hasRTEState       = false;
 }
 
 CdrPlasmaStepper::CdrPlasmaStepper(RefCountedPtr<CdrPlasmaPhysics>& a_physics) : CdrPlasmaStepper()
@@ -200,21 +207,26 @@ CdrPlasmaStepper::computeCellConductivity(EBAMRCellData& a_cellConductivity) con
 
       const int Z = species->getChargeNumber();
 
-      // In the below comments, f = speciesConductivity. The loop just adds to the total conductivity.
+      // Compute f = |v| where f = speciesConductivity, and then add e*|Z|*|v|/|E|*n = e*|Z|*mu*n to the total
+      // conductivity in a single pass.
       if (Z != 0) {
-        DataOps::vectorLength(speciesConductivity, cellVel);          // Compute f = |v|
-        DataOps::divideByScalar(speciesConductivity, fieldMagnitude); // Compute f = |v|/|E| = |mu|
-        DataOps::multiply(speciesConductivity, phi);                  // Compute f = mu*n
-
-        // Add to total conductivity.
-        DataOps::incr(a_cellConductivity, speciesConductivity, 1.0 * std::abs(Z));
+        const Real factor = Units::Qe * std::abs(Z);
+
+        DataOps::vectorLength(speciesConductivity, cellVel);
+
+        DataOps::compute(
+          a_cellConductivity,
+          [factor](const Real sigma, const Real v, const Real E, const Real n) -> Real {
+            return sigma + factor * (v / E) * n;
+          },
+          a_cellConductivity,
+          speciesConductivity,
+          fieldMagnitude,
+          phi);
       }
     }
   }
 
-  // Need to scale by electron charge.
-  DataOps::scale(a_cellConductivity, Units::Qe);
-
   // Fill ghost cells.
   m_amr->arithmeticAverage(a_cellConductivity, m_realm, phase::gas);
   m_amr->interpGhostPwl(a_cellConductivity, m_realm, phase::gas);
@@ -384,6 +396,198 @@ CdrPlasmaStepper::solvePoisson(MFAMRCellData&               a_potential,
   return converged;
 }
 
+bool
+CdrPlasmaStepper::updatePotential(const Real a_time)
+{
+  CH_TIME("CdrPlasmaStepper::updatePotential(Real)");
+  if (m_verbosity > 5) {
+    pout() << "CdrPlasmaStepper::updatePotential(Real)" << endl;
+  }
+
+  // Regular "fast poisson" -- solve every m_fastPoisson steps.
+  if (m_fastPoissonTol <= 0.0) {
+    if ((m_timeStep + 1) % m_fastPoisson == 0) {
+      this->solvePoisson();
+
+      return true;
+    }
+
+    return false;
+  }
+
+  // Adaptive version. We solve if there is no history (e.g., after regrids), if we have skipped the maximum number of
+  // steps, or if the voltage or the space charge has changed too much since the last solve.
+  m_stepsSincePoisson++;
+
+  bool solve = (m_numPoissonStates == 0) || (m_stepsSincePoisson >= m_fastPoisson);
+
+  if (!solve) {
+    const Real voltage = m_voltage(a_time);
+
+    solve = std::abs(voltage - m_fastPoissonVoltage) > m_fastPoissonTol * std::abs(m_fastPoissonVoltage);
+  }
+
+  if (!solve) {
+    EBAMRCellScratch deltaRho;
+    m_amr->allocateScratch(deltaRho, m_realm, phase::gas, 1);
+
+    this->computeCellSpaceChargeDensity(*deltaRho);
+
+    DataOps::incr(*deltaRho, m_fastPoissonRho, -1.0);
+
+    Real maxRho;
+    Real minRho;
+    Real maxDelta;
+    Real minDelta;
+
+    DataOps::getMaxMinNorm(maxRho, minRho, m_fastPoissonRho);
+    DataOps::getMaxMinNorm(maxDelta, minDelta, *deltaRho);
+
+    solve = maxDelta > m_fastPoissonTol * maxRho;
+  }
+
+  if (solve) {
+    this->solvePoisson();
+    this->storePoissonState(a_time);
+  }
+  else if (m_numPoissonStates > 1 && m_lastPoissonTime > m_prevPoissonTime) {
+
+    // Linear extrapolation phi = phi_n + alpha * (phi_n - phi_(n-1)) from the last two solutions.
+    const Real alpha = (a_time - m_lastPoissonTime) / (m_lastPoissonTime - m_prevPoissonTime);
+
+    MFAMRCellData& potential = m_fieldSolver->getPotential();
+
+    DataOps::copy(potential, m_lastPotential);
+    DataOps::scale(potential, 1.0 + alpha);
+    DataOps::incr(potential, m_prevPotential, -alpha);
+  }
+
+  if (m_verbosity > 2) {
+    pout() << "CdrPlasmaStepper::updatePotential - " << (solve ? "solved" : "extrapolated") << " the potential at t = "
+           << a_time << endl;
+  }
+
+  return solve;
+}
+
+bool
+CdrPlasmaStepper::needsRadiativeTransferSolve()
+{
+  CH_TIME("CdrPlasmaStepper::needsRadiativeTransferSolve()");
+  if (m_verbosity > 5) {
+    pout() << "CdrPlasmaStepper::needsRadiativeTransferSolve()" << endl;
+  }
+
+  // Regular "fast rte" -- solve every m_fastRTE steps.
+  if (m_fastRTETol <= 0.0) {
+    return (m_timeStep + 1) % m_fastRTE == 0;
+  }
+
+  // Adaptive version. We solve if there is no history, if we have skipped the maximum number of steps, or if any of the
+  // source terms have changed too much since the last solve.
+  m_stepsSinceRTE++;
+
+  bool solve = !m_hasRTEState || (m_stepsSinceRTE >= m_fastRTE);
+
+  for (auto solverIt = m_rte->iterator(); solverIt.ok() && !solve; ++solverIt) {
+    const RefCountedPtr<RtSolver>& solver = solverIt();
+    const int                      idx    = solverIt.index();
+
+    EBAMRCellScratch deltaSource;
+    m_amr->allocateScratch(deltaSource, solver->getRealm(), solver->getPhase(), 1);
+
+    DataOps::copy(*deltaSource, solver->getSource());
+    DataOps::incr(*deltaSource, m_fastRTESources[idx], -1.0);
+
+    Real maxSource;
+    Real minSource;
+    Real maxDelta;
+    Real minDelta;
+
+    DataOps::getMaxMinNorm(maxSource, minSource, m_fastRTESources[idx]);
+    DataOps::getMaxMinNorm(maxDelta, minDelta, *deltaSource);
+
+    solve = maxDelta > m_fastRTETol * maxSource;
+  }
+
+  // Store the source terms that will be used in this solve.
+  if (solve) {
+    if (!m_hasRTEState) {
+      m_fastRTESources.resize(m_rte->getSolvers().size());
+    }
+
+    for (auto solverIt = m_rte->iterator(); solverIt.ok(); ++solverIt) {
+      const RefCountedPtr<RtSolver>& solver = solverIt();
+      const int                      idx    = solverIt.index();
+
+      if (!m_hasRTEState) {
+        m_amr->allocate(m_fastRTESources[idx], solver->getRealm(), solver->getPhase(), 1);
+      }
+
+      DataOps::copy(m_fastRTESources[idx], solver->getSource());
+    }
+
+    m_hasRTEState   = true;
+    m_stepsSinceRTE = 0;
+  }
+
+  return solve;
+}
+
+void
+CdrPlasmaStepper::computeCellSpaceChargeDensity(EBAMRCellData& a_rho) const
+{
+  CH_TIME("CdrPlasmaStepper::computeCellSpaceChargeDensity(EBAMRCellData)");
+  if (m_verbosity > 5) {
+    pout() << "CdrPlasmaStepper::computeCellSpaceChargeDensity(EBAMRCellData)" << endl;
+  }
+
+  CH_assert(a_rho[0]->nComp() == 1);
+
+  DataOps::setValue(a_rho, 0.0);
+
+  for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
+    const RefCountedPtr<CdrSolver>&  solver = solverIt();
+    const RefCountedPtr<CdrSpecies>& spec   = solverIt.getSpecies();
+    const int                        Z      = spec->getChargeNumber();
+
+    if (Z != 0) {
+      DataOps::incr(a_rho, solver->getPhi(), Z * Units::Qe);
+    }
+  }
+
+  DataOps::setCoveredValue(a_rho, 0, 0.0);
+}
+
+void
+CdrPlasmaStepper::storePoissonState(const Real a_time)
+{
+  CH_TIME("CdrPlasmaStepper::storePoissonState(Real)");
+  if (m_verbosity > 5) {
+    pout() << "CdrPlasmaStepper::storePoissonState(Real)" << endl;
+  }
+
+  if (m_numPoissonStates == 0) {
+    m_amr->allocate(m_lastPotential, m_realm, 1);
+    m_amr->allocate(m_prevPotential, m_realm, 1);
+    m_amr->allocate(m_fastPoissonRho, m_realm, phase::gas, 1);
+  }
+  else {
+    DataOps::copy(m_prevPotential, m_lastPotential);
+
+    m_prevPoissonTime = m_lastPoissonTime;
+  }
+
+  DataOps::copy(m_lastPotential, m_fieldSolver->getPotential());
+
+  this->computeCellSpaceChargeDensity(m_fastPoissonRho);
+
+  m_lastPoissonTime    = a_time;
+  m_fastPoissonVoltage = m_voltage(a_time);
+  m_numPoissonStates   = std::min(m_numPoissonStates + 1, 2);
+  m_stepsSincePoisson  = 0;
+}
+
 void
 CdrPlasmaStepper::allocateInternals()
 {
@@ -395,6 +599,10 @@ CdrPlasmaStepper::allocateInternals()
   m_amr->allocate(m_currentDensity, m_realm, phase::gas, SpaceDim);
   DataOps::setValue(m_currentDensity, 0.0);
 
+  // The stored states for the adaptive "fast poisson" and "fast rte" modes are invalidated by regrids.
+  m_numPoissonStates = 0;
+  m_hasRTEState      = false;
+
   const int numPhysPlotVars = m_physics->getNumberOfPlotVariables();
 
   if (numPhysPlotVars > 0) {
@@ -809,11 +1017,6 @@ CdrPlasmaStepper::advanceReactionNetworkRegularCells(Vector<FArrayBox*>&       a
   CH_assert(a_dx >= 0.0);
   CH_assert(a_cellBox.cellCentered());
 
-  constexpr int comp = 0;
-
-  constexpr Real zero  = 0.0;
-  constexpr Real kappa = 1.0;
-
   // Number of CDR and RTE solvers.
   const int numCdrSpecies = m_physics->getNumCdrSpecies();
   const int numRteSpecies = m_physics->getNumRtSpecies();
@@ -827,92 +1030,19 @@ CdrPlasmaStepper::advanceReactionNetworkRegularCells(Vector<FArrayBox*>&       a
   // Lower-left corner -- physical coordinates.
   const RealVect probLo = m_amr->getProbLo();
 
-  // Create some transient storage on which we store the source terms for this grid patch.
-  FArrayBox cdrSrc(a_cellBox, numCdrSpecies);
-  FArrayBox rteSrc(a_cellBox, numRteSpecies);
-
-  cdrSrc.setVal(0.0);
-  rteSrc.setVal(0.0);
-
-  // These things that are passed into CdrPlasmaPhysics
-  Vector<Real>     cdrSources(numCdrSpecies, 0.0);
-  Vector<Real>     rteSources(numRteSpecies, 0.0);
-  Vector<Real>     cdrDensities(numCdrSpecies, 0.0);
-  Vector<RealVect> cdrGradients(numCdrSpecies, RealVect::Zero);
-  Vector<Real>     rteDensities(numRteSpecies, 0.0);
-
-  // Regular kernel. We reconstructor the various cell-centered quantities and put them in the data structure required
-  // by CdrPlasmaPhysics.
-  auto regularKernel = [&](const IntVect& iv) -> void {
-    // Create the position and electric field.
-    const RealVect pos = probLo + (0.5 * RealVect::Unit + RealVect(iv)) * a_dx;
-    const RealVect E   = RealVect(D_DECL(a_E(iv, 0), a_E(iv, 1), a_E(iv, 2)));
-
-    // Get the cell-centered CDR density and gradient.
-    for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
-      const int  idx = solverIt.index();
-      const Real phi = (*a_cdrDensities[idx])(iv, comp);
-
-      cdrDensities[idx] = std::max(zero, phi);
-      cdrGradients[idx] = RealVect(
-        D_DECL((*a_cdrGradients[idx])(iv, 0), (*a_cdrGradients[idx])(iv, 1), (*a_cdrGradients[idx])(iv, 2)));
-    }
-
-    // Get the cell-centered radiative transfer densities.
-    for (RtIterator<RtSolver> solverIt = m_rte->iterator(); solverIt.ok(); ++solverIt) {
-      const int  idx = solverIt.index();
-      const Real phi = (*a_rteDensities[idx])(iv, comp);
-
-      rteDensities[idx] = std::max(zero, phi);
-    }
-
-    // Physics now solves for the source terms.
-    m_physics->advanceReactionNetwork(cdrSources,
-                                      rteSources,
-                                      cdrDensities,
-                                      cdrGradients,
-                                      rteDensities,
-                                      E,
-                                      pos,
-                                      a_dx,
-                                      a_dt,
-                                      a_time,
-                                      kappa);
-
-    // Put CDR source terms into temporary data holders.
-    for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
-      const int idx = solverIt.index();
-
-      cdrSrc(iv, idx) = cdrSources[idx];
-    }
-
-    // Put RTE source terms into temporary dataholders.
-    for (auto solverIt = m_rte->iterator(); solverIt.ok(); ++solverIt) {
-      const int idx = solverIt.index();
-
-      rteSrc(iv, idx) = rteSources[idx];
-    }
-  };
-
-  // Execute the kernel. This puts the source terms in cdrSrc and rteSrc, but our target data holders are the input data holders
-  // with single components. So, copy the result back to these.
-  BoxLoops::loop(a_cellBox, regularKernel);
-
-  // Do it for the CDR solvers.
-  for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
-    const int idx = solverIt.index();
-
-    (*a_cdrSources[idx]).setVal(0.0);
-    (*a_cdrSources[idx]).plus(cdrSrc, idx, comp);
-  }
-
-  // Do it for the RTE solvers.
-  for (auto solverIt = m_rte->iterator(); solverIt.ok(); ++solverIt) {
-    const int idx = solverIt.index();
-
-    (*a_rteSources[idx]).setVal(0.0);
-    (*a_rteSources[idx]).plus(rteSrc, idx, comp);
-  }
+  // Physics advances the whole patch. The default implementation loops through the cells and calls the per-cell
+  // version of the reaction network.
+  m_physics->advanceReactionNetworkRegularCells(a_cdrSources,
+                                                a_rteSources,
+                                                a_cdrDensities,
+                                                a_cdrGradients,
+                                                a_rteDensities,
+                                                a_E,
+                                                probLo,
+                                                a_dx,
+                                                a_dt,
+                                                a_time,
+                                                a_cellBox);
 }
 
 void
@@ -1265,12 +1395,6 @@ CdrPlasmaStepper::computeCdrDiffusion(const EBAMRCellData& a_electricFieldCell,
   CH_assert(a_electricFieldCell[0]->nComp() == SpaceDim);
   CH_assert(a_electricFieldEB[0]->nComp() == SpaceDim);
 
-  constexpr int numComp = 1;
-
-  // First, compute the diffusion coefficients on face centers.
-
-  const int numCdrSpecies = m_physics->getNumCdrSpecies();
-
   // We will fill cdrDcoFace (face-centered diffusion coefficients) and cdrDcoEB. cdrDensities are the cell-centered densities from
   // the CDR solver.
   Vector<EBAMRFluxData*>       cdrDcoFace   = m_cdr->getFaceCenteredDiffusionCoefficient();
@@ -1280,8 +1404,33 @@ CdrPlasmaStepper::computeCdrDiffusion(const EBAMRCellData& a_electricFieldCell,
   // 1. Compute the diffusion coefficients on faces.
   this->computeCdrDiffusionFace(cdrDcoFace, cdrDensities, a_electricFieldCell, m_time);
 
-  // 2a. Allocate some storage that allows us to extrapolate the CDR densities to the EB so we can call the same physics on the EB instead of the
-  //     grid faces.
+  // 2. Compute the diffusion coefficients on the EB.
+  this->computeCdrDiffusionEb(cdrDcoEB, cdrDensities, a_electricFieldEB, m_time);
+}
+
+void
+CdrPlasmaStepper::computeCdrDiffusionEb(Vector<EBAMRIVData*>&         a_cdrDcoEB,
+                                        const Vector<EBAMRCellData*>& a_cdrDensities,
+                                        const EBAMRIVData&            a_electricFieldEB,
+                                        const Real&                   a_time)
+{
+  CH_TIME("CdrPlasmaStepper::computeCdrDiffusionEb(Vector<EBAMRIVData*>, Vector<EBAMRCellData*>, EBAMRIVData, Real)");
+  if (m_verbosity > 5) {
+    pout() << "CdrPlasmaStepper::computeCdrDiffusionEb(Vector<EBAMRIVData*>, Vector<EBAMRCellData*>, EBAMRIVData, Real)"
+           << endl;
+  }
+
+  CH_assert(a_electricFieldEB[0]->nComp() == SpaceDim);
+
+  constexpr int numComp = 1;
+
+  const int numCdrSpecies = m_physics->getNumCdrSpecies();
+
+  CH_assert(a_cdrDcoEB.size() == numCdrSpecies);
+  CH_assert(a_cdrDensities.size() == numCdrSpecies);
+
+  // 1. Allocate some storage that allows us to extrapolate the CDR densities to the EB so we can call the same physics
+  //    on the EB instead of the grid faces.
   Vector<EBAMRIVData*> cdrDensitiesExtrap(numCdrSpecies, nullptr);
 
   for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
@@ -1292,13 +1441,13 @@ CdrPlasmaStepper::computeCdrDiffusion(const EBAMRCellData& a_electricFieldCell,
     m_amr->allocate(*cdrDensitiesExtrap[idx], m_realm, m_cdr->getPhase(), numComp);
 
     // Extrapolate the cell-centered densities to the EB.
-    m_amr->interpToEB(*cdrDensitiesExtrap[idx], *cdrDensities[idx], m_realm, m_cdr->getPhase());
+    m_amr->interpToEB(*cdrDensitiesExtrap[idx], *a_cdrDensities[idx], m_realm, m_cdr->getPhase());
   }
 
-  // 2b. Compute the diffusion coefficeints on the EB.
-  this->computeCdrDiffusionEb(cdrDcoEB, cdrDensitiesExtrap, a_electricFieldEB, m_time);
+  // 2. Compute the diffusion coefficeints on the EB.
+  this->computeCdrDiffusionEb(a_cdrDcoEB, cdrDensitiesExtrap, a_electricFieldEB, a_time);
 
-  // 2c. Release the extra storage allocate in 2a.
+  // 3. Release the extra storage allocate in 1.
   for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
     const int idx = solverIt.index();
 
@@ -1645,8 +1794,24 @@ CdrPlasmaStepper::computeCdrDiffusionFace(Vector<EBAMRFluxData*>&       a_cdrDco
   // Compute the diffusion coefficients on cell centers.
   this->computeCdrDiffusionCell(cdrDcoCell, a_cdrDensities, a_electricFieldCell, a_time);
 
-  // Now compute face-centered things by taking the average of cell-centered things. Note that this will include
-  // one ghost face because the CDR solvers will interpolate the face-centered diffusion coefficients to face centroids.
+  // Now compute face-centered things by taking the average of cell-centered things.
+  this->averageCdrDiffusionCellToFace(a_cdrDcoFace, cdrDcoCell);
+}
+
+void
+CdrPlasmaStepper::averageCdrDiffusionCellToFace(Vector<EBAMRFluxData*>& a_cdrDcoFace,
+                                                Vector<EBAMRCellData>&  a_cdrDcoCell)
+{
+  CH_TIME("CdrPlasmaStepper::averageCdrDiffusionCellToFace(Vector<EBAMRFluxData*>, Vector<EBAMRCellData>)");
+  if (m_verbosity > 5) {
+    pout() << "CdrPlasmaStepper::averageCdrDiffusionCellToFace(Vector<EBAMRFluxData*>, Vector<EBAMRCellData>)" << endl;
+  }
+
+  CH_assert(a_cdrDcoFace.size() == m_physics->getNumCdrSpecies());
+  CH_assert(a_cdrDcoCell.size() == m_physics->getNumCdrSpecies());
+
+  // Note that this will include one ghost face because the CDR solvers will interpolate the face-centered diffusion
+  // coefficients to face centroids.
   for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
     const RefCountedPtr<CdrSolver>& solver = solverIt();
 
@@ -1658,8 +1823,8 @@ CdrPlasmaStepper::computeCdrDiffusionFace(Vector<EBAMRFluxData*>&       a_cdrDco
       DataOps::setValue(*a_cdrDcoFace[idx], std::numeric_limits<Real>::max());
 
       // Coarsen the cell-centered diffusion coefficient before averaging to faces.
-      m_amr->arithmeticAverage(cdrDcoCell[idx], m_realm, m_cdr->getPhase());
-      m_amr->interpGhostPwl(cdrDcoCell[idx], m_realm, m_cdr->getPhase());
+      m_amr->arithmeticAverage(a_cdrDcoCell[idx], m_realm, m_cdr->getPhase());
+      m_amr->interpGhostPwl(a_cdrDcoCell[idx], m_realm, m_cdr->getPhase());
 
       // Average to cell faces. Note that this call also includes one ghost face.
       const int      tanGhost = 1;
@@ -1667,7 +1832,7 @@ CdrPlasmaStepper::computeCdrDiffusionFace(Vector<EBAMRFluxData*>&       a_cdrDco
       const Average  average  = Average::Arithmetic;
 
       DataOps::averageCellToFace(*a_cdrDcoFace[idx],
-                                 cdrDcoCell[idx],
+                                 a_cdrDcoCell[idx],
                                  m_amr->getDomains(),
                                  tanGhost,
                                  interv,
@@ -2119,6 +2284,375 @@ CdrPlasmaStepper::computeCdrDriftVelocitiesIrregular(Vector<EBCellFAB*>&       a
   }
 }
 
+void
+CdrPlasmaStepper::computeCdrTransportCoefficients()
+{
+  CH_TIME("CdrPlasmaStepper::computeCdrTransportCoefficients()");
+  if (m_verbosity > 5) {
+    pout() << "CdrPlasmaStepper::computeCdrTransportCoefficients()" << endl;
+  }
+
+  // Allocate storage for the electric field.
+  EBAMRCellData electricFieldCell;
+  EBAMRIVData   electricFieldEB;
+
+  m_amr->allocate(electricFieldCell, m_realm, m_cdr->getPhase(), SpaceDim);
+  m_amr->allocate(electricFieldEB, m_realm, m_cdr->getPhase(), SpaceDim);
+
+  // Compute field on cell center and on EB centroid.
+  this->computeElectricField(electricFieldCell, m_cdr->getPhase(), m_fieldSolver->getPotential());
+  this->computeElectricField(electricFieldEB, m_cdr->getPhase(), electricFieldCell);
+
+  // Get handles to the CDR transport coefficients and densities.
+  Vector<EBAMRCellData*>       cdrVelocities = m_cdr->getVelocities();
+  Vector<EBAMRFluxData*>       cdrDcoFace    = m_cdr->getFaceCenteredDiffusionCoefficient();
+  Vector<EBAMRIVData*>         cdrDcoEB      = m_cdr->getEbCenteredDiffusionCoefficient();
+  const Vector<EBAMRCellData*> cdrDensities  = m_cdr->getPhis();
+
+  // Call the other version.
+  this->computeCdrTransportCoefficients(cdrVelocities,
+                                        cdrDcoFace,
+                                        cdrDcoEB,
+                                        cdrDensities,
+                                        electricFieldCell,
+                                        electricFieldEB,
+                                        m_time);
+}
+
+void
+CdrPlasmaStepper::computeCdrTransportCoefficients(Vector<EBAMRCellData*>&       a_cdrVelocities,
+                                                  Vector<EBAMRFluxData*>&       a_cdrDcoFace,
+                                                  Vector<EBAMRIVData*>&         a_cdrDcoEB,
+                                                  const Vector<EBAMRCellData*>& a_cdrDensities,
+                                                  const EBAMRCellData&          a_electricFieldCell,
+                                                  const EBAMRIVData&            a_electricFieldEB,
+                                                  const Real&                   a_time)
+{
+  CH_TIME("CdrPlasmaStepper::computeCdrTransportCoefficients(Vector<EBAMRCellData*>, ...)");
+  if (m_verbosity > 5) {
+    pout() << "CdrPlasmaStepper::computeCdrTransportCoefficients(Vector<EBAMRCellData*>, ...)" << endl;
+  }
+
+  // TLDR: This does the same as computeCdrDriftVelocities and computeCdrDiffusion, but the drift velocities and the
+  //       cell-centered diffusion coefficients are computed in the same pass over the grid patches. This way we only
+  //       fetch the electric field and the densities (and interpolate them to cell centroids) once, and the physics
+  //       can share E/N and table lookups between the two coefficients. The diffusion coefficients are then averaged
+  //       to faces and computed on the EB exactly like in computeCdrDiffusion.
+
+  CH_assert(a_electricFieldCell[0]->nComp() == SpaceDim);
+  CH_assert(a_electricFieldEB[0]->nComp() == SpaceDim);
+
+  constexpr int numComp = 1;
+
+  const int numCdrSpecies = m_physics->getNumCdrSpecies();
+
+  CH_assert(a_cdrVelocities.size() == numCdrSpecies);
+  CH_assert(a_cdrDcoFace.size() == numCdrSpecies);
+  CH_assert(a_cdrDcoEB.size() == numCdrSpecies);
+  CH_assert(a_cdrDensities.size() == numCdrSpecies);
+
+  // Allocate data for cell-centered diffusion coefficients.
+  Vector<EBAMRCellData> cdrDcoCell(numCdrSpecies);
+  for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
+    const int idx = solverIt.index();
+
+    m_amr->allocate(cdrDcoCell[idx], m_realm, m_cdr->getPhase(), numComp);
+  }
+
+  // 1. Compute the cell-centered velocities and diffusion coefficients on each level.
+  for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
+    Vector<LevelData<EBCellFAB>*> cdrVelocities(numCdrSpecies, nullptr);
+    Vector<LevelData<EBCellFAB>*> cdrDcoCellLevel(numCdrSpecies, nullptr);
+    Vector<LevelData<EBCellFAB>*> cdrDensities(numCdrSpecies, nullptr);
+
+    for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
+      const int idx = solverIt.index();
+
+      cdrVelocities[idx]   = (*a_cdrVelocities[idx])[lvl];
+      cdrDcoCellLevel[idx] = cdrDcoCell[idx][lvl];
+      cdrDensities[idx]    = (*a_cdrDensities[idx])[lvl];
+    }
+
+    this->computeCdrTransportCoefficientsCell(cdrVelocities,
+                                              cdrDcoCellLevel,
+                                              cdrDensities,
+                                              *a_electricFieldCell[lvl],
+                                              lvl,
+                                              a_time);
+  }
+
+  // 2. Coarsen the velocities and update their ghost cells.
+  for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
+    const int idx = solverIt.index();
+
+    if (solverIt()->isMobile()) {
+      m_amr->arithmeticAverage(*a_cdrVelocities[idx], m_realm, m_cdr->getPhase());
+      m_amr->interpGhostPwl(*a_cdrVelocities[idx], m_realm, m_cdr->getPhase());
+    }
+  }
+
+  // 3. Average the diffusion coefficients to faces.
+  this->averageCdrDiffusionCellToFace(a_cdrDcoFace, cdrDcoCell);
+
+  // 4. Compute the diffusion coefficients on the EB.
+  this->computeCdrDiffusionEb(a_cdrDcoEB, a_cdrDensities, a_electricFieldEB, a_time);
+}
+
+void
+CdrPlasmaStepper::computeCdrTransportCoefficientsCell(Vector<LevelData<EBCellFAB>*>&       a_cdrVelocities,
+                                                      Vector<LevelData<EBCellFAB>*>&       a_cdrDcoCell,
+                                                      const Vector<LevelData<EBCellFAB>*>& a_cdrDensities,
+                                                      const LevelData<EBCellFAB>&          a_electricFieldCell,
+                                                      const int                            a_lvl,
+                                                      const Real&                          a_time)
+{
+  CH_TIME("CdrPlasmaStepper::computeCdrTransportCoefficientsCell(Vector<LD<EBCellFAB>*>x3, LD<EBCellFAB>, int, Real)");
+  if (m_verbosity > 5) {
+    pout()
+      << "CdrPlasmaStepper::computeCdrTransportCoefficientsCell(Vector<LD<EBCellFAB>*>x3, LD<EBCellFAB>, int, Real)"
+      << endl;
+  }
+
+  constexpr int comp = 0;
+
+  const int numCdrSpecies = m_physics->getNumCdrSpecies();
+
+  CH_assert(a_electricFieldCell.nComp() == SpaceDim);
+  CH_assert(a_cdrVelocities.size() == numCdrSpecies);
+  CH_assert(a_cdrDcoCell.size() == numCdrSpecies);
+  CH_assert(a_cdrDensities.size() == numCdrSpecies);
+
+  // Grid level and resolution
+  const DisjointBoxLayout& dbl = m_amr->getGrids(m_realm)[a_lvl];
+  const DataIterator&      dit = dbl.dataIterator();
+  const Real               dx  = m_amr->getDx()[a_lvl];
+
+  const int nbox = dit.size();
+
+#pragma omp parallel for schedule(runtime)
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex& din = dit[mybox];
+
+    const Box cellBox = dbl[din];
+
+    // Handle to the electric field.
+    const EBCellFAB& electricField    = a_electricFieldCell[din];
+    const FArrayBox& electricFieldFAB = electricField.getFArrayBox();
+
+    // Data holding velocities, diffusion coefficients, and densities on this patch.
+    Vector<EBCellFAB*> cdrVelocities(numCdrSpecies, nullptr);
+    Vector<EBCellFAB*> cdrDcoCell(numCdrSpecies, nullptr);
+    Vector<EBCellFAB*> cdrDensities(numCdrSpecies, nullptr);
+
+    Vector<FArrayBox*> cdrVelocitiesFAB(numCdrSpecies, nullptr);
+    Vector<FArrayBox*> cdrDcoCellFAB(numCdrSpecies, nullptr);
+    Vector<FArrayBox*> cdrDensitiesFAB(numCdrSpecies, nullptr);
+
+    for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
+      const int idx = solverIt.index();
+
+      // The velocity data holder is nullptr if the species is not mobile.
+      if (solverIt()->isMobile()) {
+        cdrVelocities[idx]    = &(*a_cdrVelocities[idx])[din];
+        cdrVelocitiesFAB[idx] = &(cdrVelocities[idx]->getFArrayBox());
+      }
+
+      cdrDcoCell[idx]   = &(*a_cdrDcoCell[idx])[din];
+      cdrDensities[idx] = &(*a_cdrDensities[idx])[din];
+
+      cdrDcoCellFAB[idx]   = &(cdrDcoCell[idx]->getFArrayBox());
+      cdrDensitiesFAB[idx] = &(cdrDensities[idx]->getFArrayBox());
+    }
+
+    // Do the regular cells. This will also do irregular cells but we re-do those below.
+    this->computeCdrTransportCoefficientsRegular(cdrVelocitiesFAB,
+                                                 cdrDcoCellFAB,
+                                                 cdrDensitiesFAB,
+                                                 electricFieldFAB,
+                                                 cellBox,
+                                                 a_time,
+                                                 dx);
+
+    // Re-do the irregular and multi-valued cells.
+    this->computeCdrTransportCoefficientsIrregular(cdrVelocities,
+                                                   cdrDcoCell,
+                                                   cdrDensities,
+                                                   electricField,
+                                                   a_time,
+                                                   dx,
+                                                   a_lvl,
+                                                   din);
+
+    // Covered data is bogus.
+    for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
+      const int idx = solverIt.index();
+
+      if (solverIt()->isMobile()) {
+        for (int dir = 0; dir < SpaceDim; dir++) {
+          cdrVelocities[idx]->setCoveredCellVal(0.0, dir);
+        }
+      }
+
+      cdrDcoCell[idx]->setCoveredCellVal(0.0, comp);
+    }
+  }
+}
+
+void
+CdrPlasmaStepper::computeCdrTransportCoefficientsRegular(Vector<FArrayBox*>&       a_cdrVelocities,
+                                                         Vector<FArrayBox*>&       a_cdrDcoCell,
+                                                         const Vector<FArrayBox*>& a_cdrDensities,
+                                                         const FArrayBox&          a_electricFieldCell,
+                                                         const Box&                a_cellBox,
+                                                         const Real&               a_time,
+                                                         const Real&               a_dx)
+{
+  CH_TIME("CdrPlasmaStepper::computeCdrTransportCoefficientsRegular(Vector<FArrayBox*>x3, FArrayBox, Box, Real, Real)");
+  if (m_verbosity > 5) {
+    pout()
+      << "CdrPlasmaStepper::computeCdrTransportCoefficientsRegular(Vector<FArrayBox*>x3, FArrayBox, Box, Real, Real)"
+      << endl;
+  }
+
+  CH_assert(a_electricFieldCell.nComp() == SpaceDim);
+  CH_assert(a_cellBox.cellCentered());
+
+  constexpr int  comp = 0;
+  constexpr Real zero = 0.0;
+
+  const int numCdrSpecies = m_physics->getNumCdrSpecies();
+
+  CH_assert(a_cdrVelocities.size() == numCdrSpecies);
+  CH_assert(a_cdrDcoCell.size() == numCdrSpecies);
+  CH_assert(a_cdrDensities.size() == numCdrSpecies);
+
+  // Lower-left corner in physical coordinates.
+  const RealVect probLo = m_amr->getProbLo();
+
+  // Populated in each grid cell, and by m_physics.
+  Vector<Real>     cdrDensities(numCdrSpecies, 0.0);
+  Vector<RealVect> velocities(numCdrSpecies, RealVect::Zero);
+  Vector<Real>     diffusionCoefficients(numCdrSpecies, 0.0);
+
+  // Regular kernel. Both coefficients come out of the same physics call.
+  auto regularKernel = [&](const IntVect& iv) -> void {
+    const RealVect pos = probLo + (0.5 * RealVect::Unit + RealVect(iv)) * a_dx;
+    const RealVect E   = RealVect(
+      D_DECL(a_electricFieldCell(iv, 0), a_electricFieldCell(iv, 1), a_electricFieldCell(iv, 2)));
+
+    for (int idx = 0; idx < numCdrSpecies; idx++) {
+      cdrDensities[idx] = std::max(zero, (*a_cdrDensities[idx])(iv, comp));
+    }
+
+    m_physics->computeCdrTransportCoefficients(velocities, diffusionCoefficients, a_time, pos, E, cdrDensities);
+
+    for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
+      const int idx = solverIt.index();
+
+      if (solverIt()->isMobile()) {
+        for (int dir = 0; dir < SpaceDim; dir++) {
+          (*a_cdrVelocities[idx])(iv, dir) = velocities[idx][dir];
+        }
+      }
+
+      (*a_cdrDcoCell[idx])(iv, comp) = solverIt()->isDiffusive() ? diffusionCoefficients[idx] : zero;
+    }
+  };
+
+  // Launch the kernel.
+  BoxLoops::loop(a_cellBox, regularKernel);
+}
+
+void
+CdrPlasmaStepper::computeCdrTransportCoefficientsIrregular(Vector<EBCellFAB*>&       a_cdrVelocities,
+                                                           Vector<EBCellFAB*>&       a_cdrDcoCell,
+                                                           const Vector<EBCellFAB*>& a_cdrDensities,
+                                                           const EBCellFAB&          a_electricFieldCell,
+                                                           const Real&               a_time,
+                                                           const Real&               a_dx,
+                                                           const int                 a_lvl,
+                                                           const DataIndex&          a_dit)
+{
+  CH_TIME("CdrPlasmaStepper::computeCdrTransportCoefficientsIrregular(Vector<EBCellFAB*>x3, EBCellFAB, Real, Real, "
+          "int, DataIndex)");
+  if (m_verbosity > 5) {
+    pout() << "CdrPlasmaStepper::computeCdrTransportCoefficientsIrregular(Vector<EBCellFAB*>x3, EBCellFAB, Real, Real, "
+              "int, DataIndex)"
+           << endl;
+  }
+
+  CH_assert(a_electricFieldCell.nComp() == SpaceDim);
+
+  constexpr int  comp = 0;
+  constexpr Real zero = 0.0;
+
+  const int numCdrSpecies = m_physics->getNumCdrSpecies();
+
+  CH_assert(a_cdrVelocities.size() == numCdrSpecies);
+  CH_assert(a_cdrDcoCell.size() == numCdrSpecies);
+  CH_assert(a_cdrDensities.size() == numCdrSpecies);
+
+  // Lower-left corner in physical coordinates.
+  const RealVect probLo = m_amr->getProbLo();
+
+  const EBISBox& ebisBox = a_electricFieldCell.getEBISBox();
+
+  // Populated in each grid cell, and by m_physics.
+  Vector<Real>     cdrDensities(numCdrSpecies, 0.0);
+  Vector<RealVect> velocities(numCdrSpecies, RealVect::Zero);
+  Vector<Real>     diffusionCoefficients(numCdrSpecies, 0.0);
+
+  // Electric field -- will be populated on the cell centroid
+  EBCellFAB Efield;
+  Efield.clone(a_electricFieldCell);
+  m_amr->interpToCentroids(Efield, a_electricFieldCell, m_realm, m_phase, a_lvl, a_dit);
+
+  // Some copies of the CDR densities so we can put them on the centroid. These are shared by the velocities and the
+  // diffusion coefficients.
+  Vector<EBCellFAB*> tmp(numCdrSpecies, nullptr);
+  for (int idx = 0; idx < numCdrSpecies; idx++) {
+    tmp[idx] = new EBCellFAB();
+    tmp[idx]->clone(*a_cdrDensities[idx]);
+
+    m_amr->interpToCentroids(*tmp[idx], *a_cdrDensities[idx], m_realm, m_phase, a_lvl, a_dit);
+  }
+
+  // Irregular kernel.
+  auto irregularKernel = [&](const VolIndex& vof) -> void {
+    const RealVect pos = probLo + Location::position(Location::Cell::Center, vof, ebisBox, a_dx);
+    const RealVect E   = RealVect(D_DECL(Efield(vof, 0), Efield(vof, 1), Efield(vof, 2)));
+
+    for (int idx = 0; idx < numCdrSpecies; idx++) {
+      cdrDensities[idx] = std::max(zero, (*tmp[idx])(vof, comp));
+    }
+
+    m_physics->computeCdrTransportCoefficients(velocities, diffusionCoefficients, a_time, pos, E, cdrDensities);
+
+    for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
+      const int idx = solverIt.index();
+
+      if (solverIt()->isMobile()) {
+        for (int dir = 0; dir < SpaceDim; dir++) {
+          (*a_cdrVelocities[idx])(vof, dir) = velocities[idx][dir];
+        }
+      }
+
+      (*a_cdrDcoCell[idx])(vof, comp) = solverIt()->isDiffusive() ? diffusionCoefficients[idx] : zero;
+    }
+  };
+
+  // Kernel region
+  VoFIterator& vofit = (*m_amr->getVofIterator(m_realm, m_phase)[a_lvl])[a_dit];
+
+  // Launch the kernel
+  BoxLoops::loop(vofit, irregularKernel);
+
+  // Delete storage
+  for (int idx = 0; idx < numCdrSpecies; idx++) {
+    delete tmp[idx];
+  }
+}
+
 void
 CdrPlasmaStepper::computeCdrFluxes(Vector<EBAMRIVData*>&       a_cdrFluxesEB,
                                    const Vector<EBAMRIVData*>& a_extrapCdrFluxes,
@@ -2565,14 +3099,18 @@ CdrPlasmaStepper::computeExtrapolatedFluxes(Vector<EBAMRIVData*>&        a_extra
   // extrapolation stencils may have negative weights, and v*n may therefore nonphysically change sign. Better to compute
   // F = v_extrap*Max(0.0, phi_extrap) since we expect v to be "smooth" and phi_extrap to be a noisy bastard
 
-  // Allocate some data holders we can use for holding the fluxes.
-  EBAMRIVData ebFlux;
-  EBAMRIVData ebVel;
-  EBAMRIVData ebPhi;
+  // Borrow some data holders we can use for holding the fluxes.
+  EBAMRIVScratch ebFluxScratch;
+  EBAMRIVScratch ebVelScratch;
+  EBAMRIVScratch ebPhiScratch;
 
-  m_amr->allocate(ebFlux, m_realm, a_phase, SpaceDim);
-  m_amr->allocate(ebVel, m_realm, a_phase, SpaceDim);
-  m_amr->allocate(ebPhi, m_realm, a_phase, 1);
+  m_amr->allocateScratch(ebFluxScratch, m_realm, a_phase, SpaceDim);
+  m_amr->allocateScratch(ebVelScratch, m_realm, a_phase, SpaceDim);
+  m_amr->allocateScratch(ebPhiScratch, m_realm, a_phase, 1);
+
+  EBAMRIVData& ebFlux = *ebFluxScratch;
+  EBAMRIVData& ebVel  = *ebVelScratch;
+  EBAMRIVData& ebPhi  = *ebPhiScratch;
 
   // Go through the CDR solvers.
   for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
@@ -2812,11 +3350,14 @@ CdrPlasmaStepper::computeJ(EBAMRCellData& a_J) const
 
   // Allocate scratch storage for holding the cell-centered diffusion coefficient and
   // D * grad(phi)
-  EBAMRCellData scratchONE;
-  EBAMRCellData scratchDIM;
+  EBAMRCellScratch scratchONEHandle;
+  EBAMRCellScratch scratchDIMHandle;
+
+  m_amr->allocateScratch(scratchONEHandle, m_realm, m_phase, 1);
+  m_amr->allocateScratch(scratchDIMHandle, m_realm, m_phase, SpaceDim);
 
-  m_amr->allocate(scratchONE, m_realm, m_phase, 1);
-  m_amr->allocate(scratchDIM, m_realm, m_phase, SpaceDim);
+  EBAMRCellData& scratchONE = *scratchONEHandle;
+  EBAMRCellData& scratchDIM = *scratchDIMHandle;
 
   for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
     const RefCountedPtr<CdrSolver>&  solver  = solverIt();
@@ -3315,8 +3856,7 @@ CdrPlasmaStepper::initialData()
   this->solvePoisson();
 
   // Fill solvers with velocity and diffusion
-  this->computeCdrDriftVelocities();
-  this->computeCdrDiffusion();
+  this->computeCdrTransportCoefficients();
 }
 
 void
@@ -3527,9 +4067,13 @@ CdrPlasmaStepper::regrid(const int a_lmin, const int a_oldFinestLevel, const int
       }
     }
 
+    // Restart the history for the adaptive "fast poisson" mode.
+    if (m_fastPoissonTol > 0.0) {
+      this->storePoissonState(m_time);
+    }
+
     // Compute stuff that is important for the CDR solvers.
-    this->computeCdrDriftVelocities();
-    this->computeCdrDiffusion();
+    this->computeCdrTransportCoefficients();
 
     // If we're doing a stationary RTE, we should update the elliptic equations. The RTE solvers should
     // have regridded the source term in that case.
@@ -3728,6 +4272,9 @@ CdrPlasmaStepper::parseFastRadiativeTransfer()
   if (m_fastRTE <= 0) {
     MayDay::Error("CdrPlasmaStepper::parseFastRadiativeTransfer - value must be non-negative");
   }
+
+  m_fastRTETol = 0.0;
+  pp.query("fast_rte_tol", m_fastRTETol);
 }
 
 void
@@ -3744,6 +4291,9 @@ CdrPlasmaStepper::parseFastPoisson()
   if (m_fastPoisson <= 0) {
     MayDay::Abort("CdrPlasmaStepper::parseFastPoisson - value must be non-negative");
   }
+
+  m_fastPoissonTol = 0.0;
+  pp.query("fast_poisson_tol", m_fastPoissonTol);
 }
 
 void
@@ -4236,11 +4786,11 @@ CdrPlasmaStepper::computeOhmicInductionCurrent()
 }
 
 Real
-CdrPlasmaStepper::computeRelaxationTime()
+CdrPlasmaStepper::computeRelaxationTime(const bool a_localOnly)
 {
-  CH_TIME("CdrPlasmaStepper::computeRelaxationTime()");
+  CH_TIME("CdrPlasmaStepper::computeRelaxationTime(bool)");
   if (m_verbosity > 5) {
-    pout() << "CdrPlasmaStepper::computeRelaxationTime()" << endl;
+    pout() << "CdrPlasmaStepper::computeRelaxationTime(bool)" << endl;
   }
 
   // TLDR: This computes the relaxation time as t = eps0/conductivity. Simple as that.
@@ -4269,7 +4819,7 @@ CdrPlasmaStepper::computeRelaxationTime()
   Real maxVal = -std::numeric_limits<Real>::max();
   Real minVal = std::numeric_limits<Real>::max();
 
-  DataOps::getMaxMinNorm(maxVal, minVal, relaxTime);
+  DataOps::getMaxMinNorm(maxVal, minVal, relaxTime, a_localOnly);
 
   return minVal;
 }
@@ -4758,8 +5308,7 @@ CdrPlasmaStepper::postCheckpointSetup()
   this->allocateInternals();
 
   // Fill solvers with important stuff
-  this->computeCdrDriftVelocities();
-  this->computeCdrDiffusion();
+  this->computeCdrTransportCoefficients();
 }
 
 void
@@ -4812,6 +5361,20 @@ CdrPlasmaStepper::printStepReport()
          << "                                   cfl   = " << m_dt / dtCFL << endl
          << "                                   Emax  = " << Emax << endl
          << "                                   n_max = " << cdrMax << "(" + solverMax + ")" << endl;
+
+  // Radiative transfer solvers that reuse their solutions report how many solves they have skipped.
+  for (auto solverIt = m_rte->iterator(); solverIt.ok(); ++solverIt) {
+    const RefCountedPtr<RtSolver>& solver = solverIt();
+
+    const int numSkipped = solver->getNumSkippedSolves();
+
+    if (numSkipped > 0) {
+      pout() << "                                   rte   = " << numSkipped << " of "
+             << numSkipped + solver->getNumSolves() << " solves skipped (" + solver->getName() + ")" << endl;
+    }
+
+    solver->printStepReport();
+  }
 }
 
 #include <CD_NamespaceFooter.H>
@@ -238,9 +238,8 @@ CdrPlasmaTagger::tagCells(EBAMRTags& a_tags)
         // Current cell flags. If we add a tag, the cell will be refined. Remove one, and it will be coarsened.
         DenseIntVectSet& tags = (*a_tags[lvl])[din];
 
-        // Calls the patch versions which figure out which tags will be refined in each grid patch.
-        this->refineCellsBox(refineTags, tracers, gtracers, lvl, din, box, ebisbox, time, dx, probLo);
-        this->coarsenCellsBox(coarsenTags, tracers, gtracers, lvl, din, box, ebisbox, time, dx, probLo);
+        // Calls the patch version which figures out which cells will be refined and coarsened in each grid patch.
+        this->tagCellsBox(refineTags, coarsenTags, tracers, gtracers, lvl, din, box, ebisbox, time, dx, probLo);
 
         // Check if we got any new tags, or we are just recycling old tags. If we did not get new tags then
         // we will ask the Driver to skip the regrid completely. Basically we will check if (current_tags + refined_tags - coarsenTags) == current_tags
@@ -265,103 +264,32 @@ CdrPlasmaTagger::tagCells(EBAMRTags& a_tags)
 }
 
 void
-CdrPlasmaTagger::refineCellsBox(DenseIntVectSet&          a_refinedCells,
-                                const Vector<EBCellFAB*>& a_tracers,
-                                const Vector<EBCellFAB*>& a_gradTracers,
-                                const int                 a_lvl,
-                                const DataIndex           a_dit,
-                                const Box                 a_box,
-                                const EBISBox&            a_ebisbox,
-                                const Real                a_time,
-                                const Real                a_dx,
-                                const RealVect            a_probLo)
+CdrPlasmaTagger::tagCellsBox(DenseIntVectSet&          a_refinedCells,
+                             DenseIntVectSet&          a_coarsenedCells,
+                             const Vector<EBCellFAB*>& a_tracers,
+                             const Vector<EBCellFAB*>& a_gradTracers,
+                             const int                 a_lvl,
+                             const DataIndex           a_dit,
+                             const Box                 a_box,
+                             const EBISBox&            a_ebisbox,
+                             const Real                a_time,
+                             const Real                a_dx,
+                             const RealVect            a_probLo)
 {
-  CH_TIME("CdrPlasmaTagger::refineCellsBox(...)");
+  CH_TIME("CdrPlasmaTagger::tagCellsBox(...)");
   if (m_verbosity > 5) {
-    pout() << m_name + "::refineCellsBox(...)" << endl;
+    pout() << m_name + "::tagCellsBox(...)" << endl;
   }
 
-  // Get a handle to the single-valued data.
-  Vector<FArrayBox*> tracersReg;
-  Vector<FArrayBox*> gradientsReg;
+  // Cells outside the tag boxes are always coarsened and never refined. If the patch lies outside all of the tag
+  // boxes we don't need to look at the individual cells.
+  const RealVect boxLo = a_probLo + (0.5 * RealVect::Unit + RealVect(a_box.smallEnd())) * a_dx;
+  const RealVect boxHi = a_probLo + (0.5 * RealVect::Unit + RealVect(a_box.bigEnd())) * a_dx;
 
-  for (int i = 0; i < m_numTracers; i++) {
-    tracersReg.push_back(&(a_tracers[i]->getFArrayBox()));
-    gradientsReg.push_back(&(a_gradTracers[i]->getFArrayBox()));
-  }
+  if (!(this->intersectsTagBox(boxLo, boxHi))) {
+    a_coarsenedCells |= a_box;
 
-  // Cell-wise tracer fields. Used in the kernels.
-  Vector<Real>     tr(m_numTracers);
-  Vector<RealVect> gt(m_numTracers);
-
-  // Regular kernel.
-  auto regularKernel = [&](const IntVect& iv) -> void {
-    const RealVect pos = a_probLo + (0.5 * RealVect::Unit + RealVect(iv)) * a_dx;
-
-    // If position is inside any of the tagging boxes, we can refine
-    if (this->insideTagBox(pos) && a_ebisbox.isRegular(iv)) {
-
-      // Get the tracer fields and the gradients of them.
-      for (int i = 0; i < m_numTracers; i++) {
-        tr[i] = (*tracersReg[i])(iv, 0);
-        gt[i] = RealVect(D_DECL((*gradientsReg[i])(iv, 0), (*gradientsReg[i])(iv, 1), (*gradientsReg[i])(iv, 2)));
-      }
-
-      // Call the per-cell-refinement method.
-      const bool refine = this->refineCell(pos, a_time, a_dx, a_lvl, tr, gt);
-
-      // If we refine, grow with buffer and increment to a_refinedCells
-      if (refine) {
-        a_refinedCells |= iv;
-      }
-    }
-  };
-
-  // Irregular kernel
-  auto irregularKernel = [&](const VolIndex& vof) -> void {
-    const RealVect pos = a_probLo + Location::position(Location::Cell::Center, vof, a_ebisbox, a_dx);
-
-    // If position is inside any of the tagging boxes, we can refine
-    if (this->insideTagBox(pos)) {
-
-      // Get the tracer fields and the gradients of them.
-      for (int i = 0; i < m_numTracers; i++) {
-        tr[i] = (*a_tracers[i])(vof, 0);
-        gt[i] = RealVect(D_DECL((*a_gradTracers[i])(vof, 0), (*a_gradTracers[i])(vof, 1), (*a_gradTracers[i])(vof, 2)));
-      }
-
-      // Call the per-cell-refinement method.
-      const bool refine = this->refineCell(pos, a_time, a_dx, a_lvl, tr, gt);
-
-      if (refine) {
-        a_refinedCells |= vof.gridIndex();
-      }
-    }
-  };
-
-  // Irregular kernel region. Should probably be stored in its own VoFIterator but I'm lazy so let's define it right here.
-  VoFIterator vofit = (*m_amr->getVofIterator(m_realm, m_phase)[a_lvl])[a_dit];
-
-  // Execute the kernels.
-  BoxLoops::loop(a_box, regularKernel);
-  BoxLoops::loop(vofit, irregularKernel);
-}
-
-void
-CdrPlasmaTagger::coarsenCellsBox(DenseIntVectSet&          a_coarsenedCells,
-                                 const Vector<EBCellFAB*>& a_tracers,
-                                 const Vector<EBCellFAB*>& a_gradTracers,
-                                 const int                 a_lvl,
-                                 const DataIndex           a_dit,
-                                 const Box                 a_box,
-                                 const EBISBox&            a_ebisbox,
-                                 const Real                a_time,
-                                 const Real                a_dx,
-                                 const RealVect            a_probLo)
-{
-  CH_TIME("CdrPlasmaTagger::coarsenCellsBox(...)");
-  if (m_verbosity > 5) {
-    pout() << m_name + "::coarsenCellsBox(...)" << endl;
+    return;
   }
 
   // Get a handle to the single-valued data.
@@ -373,65 +301,68 @@ CdrPlasmaTagger::coarsenCellsBox(DenseIntVectSet&          a_coarsenedCells,
     gradientsReg.push_back(&(a_gradTracers[i]->getFArrayBox()));
   }
 
-  // Tracer field and gradient of tracer fields. Used in the kernels.
+  // Cell-wise tracer fields. Used in the kernels.
   Vector<Real>     tr(m_numTracers);
   Vector<RealVect> gt(m_numTracers);
 
-  // Regular box loop
+  // Regular kernel. The refinement and coarsening criteria are evaluated in the same pass.
   auto regularKernel = [&](const IntVect& iv) -> void {
     const RealVect pos = a_probLo + (0.5 * RealVect::Unit + RealVect(iv)) * a_dx;
 
-    // If position is inside any of the tagging boxes, we can refine
-    const bool isPointInside = this->insideTagBox(pos);
-    if (!isPointInside) {
-      a_coarsenedCells |= iv; // Always coarsen outside the refinement boxes.
+    // If position is inside any of the tagging boxes, we can refine. Always coarsen outside the tag boxes.
+    if (!(this->insideTagBox(pos))) {
+      a_coarsenedCells |= iv;
     }
-    else if (isPointInside && a_ebisbox.isRegular(iv)) {
+    else if (a_ebisbox.isRegular(iv)) {
 
-      // Reconstruct the tracer fields and tracer field gradients
+      // Get the tracer fields and the gradients of them.
       for (int i = 0; i < m_numTracers; i++) {
         tr[i] = (*tracersReg[i])(iv, 0);
         gt[i] = RealVect(D_DECL((*gradientsReg[i])(iv, 0), (*gradientsReg[i])(iv, 1), (*gradientsReg[i])(iv, 2)));
       }
 
-      // Call the per-cell-coarsening method and see if we should coarsen this cell.
-      const bool coarsen = this->coarsenCell(pos, a_time, a_dx, a_lvl, tr, gt);
+      // Call the per-cell refinement and coarsening methods.
+      if (this->refineCell(pos, a_time, a_dx, a_lvl, tr, gt)) {
+        a_refinedCells |= iv;
+      }
 
-      // If we refine, grow with buffer and increment to a_refinedCells
-      if (coarsen) {
+      if (this->coarsenCell(pos, a_time, a_dx, a_lvl, tr, gt)) {
         a_coarsenedCells |= iv;
       }
     }
   };
 
-  // Irregular box loop
+  // Irregular kernel
   auto irregularKernel = [&](const VolIndex& vof) -> void {
     const RealVect pos = a_probLo + Location::position(Location::Cell::Center, vof, a_ebisbox, a_dx);
 
-    // If position is inside any of the tagging boxes, we can refine
-    const bool isPointInside = this->insideTagBox(pos);
-    if (!isPointInside) {
+    // If position is inside any of the tagging boxes, we can refine. Always coarsen outside the tag boxes.
+    if (!(this->insideTagBox(pos))) {
       a_coarsenedCells |= vof.gridIndex();
     }
-    else
-      // Reconstruct the tracer fields and gradients again.
+    else {
+
+      // Get the tracer fields and the gradients of them.
       for (int i = 0; i < m_numTracers; i++) {
         tr[i] = (*a_tracers[i])(vof, 0);
         gt[i] = RealVect(D_DECL((*a_gradTracers[i])(vof, 0), (*a_gradTracers[i])(vof, 1), (*a_gradTracers[i])(vof, 2)));
       }
 
-    // Call the per-cell refinement method.
-    const bool coarsen = this->coarsenCell(pos, a_time, a_dx, a_lvl, tr, gt);
+      // Call the per-cell refinement and coarsening methods.
+      if (this->refineCell(pos, a_time, a_dx, a_lvl, tr, gt)) {
+        a_refinedCells |= vof.gridIndex();
+      }
 
-    if (coarsen) {
-      a_coarsenedCells |= vof.gridIndex();
+      if (this->coarsenCell(pos, a_time, a_dx, a_lvl, tr, gt)) {
+        a_coarsenedCells |= vof.gridIndex();
+      }
     }
   };
 
-  // Kernel region for the irregular kernel.
-  VoFIterator vofit = (*m_amr->getVofIterator(m_realm, m_phase)[a_lvl])[a_dit];
+  // Irregular kernel region.
+  VoFIterator& vofit = (*m_amr->getVofIterator(m_realm, m_phase)[a_lvl])[a_dit];
 
-  // Execute the kernels
+  // Execute the kernels.
   BoxLoops::loop(a_box, regularKernel);
   BoxLoops::loop(vofit, irregularKernel);
 }
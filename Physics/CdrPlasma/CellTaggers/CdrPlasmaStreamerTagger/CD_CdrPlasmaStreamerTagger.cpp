@@ -101,12 +101,12 @@ CdrPlasmaStreamerTagger::tracer(const RealVect a_pos,
 }
 
 bool
-CdrPlasmaStreamerTagger::coarsenCell(const RealVect         a_pos,
-                                     const Real             a_time,
-                                     const Real             a_dx,
-                                     const int              a_lvl,
-                                     const Vector<Real>     a_tracers,
-                                     const Vector<RealVect> a_gradTracers) const
+CdrPlasmaStreamerTagger::coarsenCell(const RealVect          a_pos,
+                                     const Real              a_time,
+                                     const Real              a_dx,
+                                     const int               a_lvl,
+                                     const Vector<Real>&     a_tracers,
+                                     const Vector<RealVect>& a_gradTracers) const
 {
   bool coarsen = false;
 
@@ -123,12 +123,12 @@ CdrPlasmaStreamerTagger::coarsenCell(const RealVect         a_pos,
 }
 
 bool
-CdrPlasmaStreamerTagger::refineCell(const RealVect         a_pos,
-                                    const Real             a_time,
-                                    const Real             a_dx,
-                                    const int              a_lvl,
-                                    const Vector<Real>     a_tracers,
-                                    const Vector<RealVect> a_gradTracers) const
+CdrPlasmaStreamerTagger::refineCell(const RealVect          a_pos,
+                                    const Real              a_time,
+                                    const Real              a_dx,
+                                    const int               a_lvl,
+                                    const Vector<Real>&     a_tracers,
+                                    const Vector<RealVect>& a_gradTracers) const
 {
   // TLDR: Refine if either criterion are met.
 
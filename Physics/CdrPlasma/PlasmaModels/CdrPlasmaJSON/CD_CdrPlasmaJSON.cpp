@@ -16,6 +16,7 @@
 #include <fstream>
 #include <sstream>
 #include <algorithm>
+#include <limits>
 
 // Chombo includes
 #include <ParmParse.H>
@@ -27,10 +28,13 @@
 #include <CD_DataParser.H>
 #include <CD_Random.H>
 #include <CD_Units.H>
+#include <CD_BoxLoops.H>
 #include <CD_NamespaceHeader.H>
 
 using namespace Physics::CdrPlasma;
 
+thread_local CdrPlasmaJSON::ReactionWorkspace CdrPlasmaJSON::s_reactionWorkspace;
+
 CdrPlasmaJSON::CdrPlasmaJSON()
 {
   CH_TIME("CdrPlasmaJSON::CdrPlasmaJSON()");
@@ -61,6 +65,12 @@ CdrPlasmaJSON::CdrPlasmaJSON()
   this->parsePlasmaReactions();
   this->parsePhotoReactions();
 
+  // Group the E/N tables that share a grid.
+  this->initializeGridsEN();
+
+  // Compile the plasma reactions into flat arrays that are used when filling source terms.
+  this->compilePlasmaReactions();
+
   // Parse secondary emission on electrodes and dielectrics
   this->parseElectrodeReactions();
   this->parseDielectricReactions();
@@ -68,6 +78,9 @@ CdrPlasmaJSON::CdrPlasmaJSON()
 
   m_numCdrSpecies = m_cdrSpecies.size();
   m_numRtSpecies  = m_rtSpecies.size();
+
+  // Size the reaction workspace. Other threads size their workspace on first use.
+  this->getReactionWorkspace();
 }
 
 CdrPlasmaJSON::CdrPlasmaJSON(const int a_dummy)
@@ -112,13 +125,22 @@ CdrPlasmaJSON::parseIntegrator()
 
   std::string str;
 
+  m_newtonIterations = 10;
+  m_newtonTolerance  = 1.E-6;
+
   pp.get("integrator", str);
   pp.get("chemistry_dt", m_chemistryDt);
+  pp.query("newton_iterations", m_newtonIterations);
+  pp.query("newton_tolerance", m_newtonTolerance);
 
   if (m_chemistryDt <= 0.0) {
     this->throwParserError("CdrPlasmaJSON::parseIntegrator -- substeps must be >= 1");
   }
 
+  if (m_newtonIterations < 1) {
+    this->throwParserError("CdrPlasmaJSON::parseIntegrator -- 'newton_iterations' must be >= 1");
+  }
+
   if (str == "none") {
     m_reactionIntegrator = ReactionIntegrator::None;
   }
@@ -134,6 +156,9 @@ CdrPlasmaJSON::parseIntegrator()
   else if (str == "explicit_rk4") {
     m_reactionIntegrator = ReactionIntegrator::ExplicitRK4;
   }
+  else if (str == "implicit_euler") {
+    m_reactionIntegrator = ReactionIntegrator::ImplicitEuler;
+  }
   else {
     this->throwParserError("CdrPlasmaJSON::parseIntegrator -- I do not know the integrator '" + str + "'");
   }
@@ -150,9 +175,8 @@ CdrPlasmaJSON::parseJSON()
   if (!(this->doesFileExist(m_jsonFile)))
     this->throwParserError("CdrPlasmaJSON::parseJSON -- file '" + m_jsonFile + "' does not exist");
 
-  // Parse the JSON file
-  std::ifstream f(m_jsonFile);
-  m_json = json::parse(f, nullptr, true, true);
+  // Parse the JSON file. The file was read on the master rank and broadcast in doesFileExist.
+  m_json = json::parse(DataParser::getFileContents(m_jsonFile), nullptr, true, true);
 }
 
 void
@@ -2671,6 +2695,7 @@ CdrPlasmaJSON::parsePlasmaReactionRate(const int a_reactionIndex, const json& a_
       
     }
     m_plasmaReactionFunctionsT.emplace(a_reactionIndex, std::make_pair(index, functionT));
+    m_plasmaReactionCoefficients.emplace(a_reactionIndex, std::vector<Real>{c1, c2});
     m_plasmaReactionLookup.emplace(a_reactionIndex, LookupMethod::FunctionT);
     
   }
@@ -2727,6 +2752,7 @@ CdrPlasmaJSON::parsePlasmaReactionRate(const int a_reactionIndex, const json& a_
     };
 
     m_plasmaReactionFunctionsTT.emplace(a_reactionIndex, std::make_tuple(firstIndex, secondIndex, functionT1T2));
+    m_plasmaReactionCoefficients.emplace(a_reactionIndex, std::vector<Real>{c1, c2});
     m_plasmaReactionLookup.emplace(a_reactionIndex, LookupMethod::FunctionTT);
   }
   else if (lookup == "table E/N") {
@@ -2925,6 +2951,7 @@ CdrPlasmaJSON::parsePlasmaReactionRate(const int a_reactionIndex, const json& a_
     // Add the function and identifier.
     m_plasmaReactionLookup.emplace(std::make_pair(a_reactionIndex, LookupMethod::FunctionEN));
     m_plasmaReactionFunctionsEN.emplace(std::make_pair(a_reactionIndex, func));
+    m_plasmaReactionCoefficients.emplace(a_reactionIndex, std::vector<Real>{c1, c2, c3, c4, c5});
   }
   else {
     this->throwParserError(baseError + "but lookup = '" + lookup + "' is not recognized");
@@ -3019,6 +3046,9 @@ CdrPlasmaJSON::parsePlasmaReactionScaling(const int a_index, const json& a_R)
   // This is the scaling function. It will be stored in m_plasmaReactionEfficiencies.
   FunctionEX func;
 
+  // Same function, but as coefficients (s, a, b, cp, cN) in f = s * a/(b + cp * p + cN * N).
+  std::array<Real, 5> coeffs = {scale, 1.0, 1.0, 0.0, 0.0};
+
   // Now make ourselves a lambda that we can use for scaling the reactions.
   if (doPhotoIonization && doPressureQuenching) {
     this->throwParserError(baseError + "- cannot specify both 'photoionization' and 'quenching pressure'");
@@ -3027,6 +3057,8 @@ CdrPlasmaJSON::parsePlasmaReactionScaling(const int a_index, const json& a_R)
     func = [scale, pq, p = this->m_gasPressure](const Real E, const RealVect x) {
       return scale * pq / (pq + p(x));
     };
+
+    coeffs = {scale, pq, pq, 1.0, 0.0};
   }
   else if (!doPressureQuenching && doPhotoIonization) {
     func = [scale, kr, kp, kqN, photoiEff, exciteEff, &N = this->m_gasDensity](const Real E, const RealVect x) -> Real {
@@ -3034,6 +3066,8 @@ CdrPlasmaJSON::parsePlasmaReactionScaling(const int a_index, const json& a_R)
 
       return scale * kr / (kr + kp + kq) * photoiEff * exciteEff;
     };
+
+    coeffs = {scale * photoiEff * exciteEff, kr, kr + kp, 0.0, kqN};
   }
   else {
     func = [scale](const Real E, const RealVect x) -> Real {
@@ -3043,6 +3077,7 @@ CdrPlasmaJSON::parsePlasmaReactionScaling(const int a_index, const json& a_R)
 
   // Add it to the pile.
   m_plasmaReactionEfficiencies.emplace(a_index, func);
+  m_plasmaReactionEfficiencyCoefficients.emplace(a_index, coeffs);
 }
 
 void
@@ -4234,6 +4269,9 @@ CdrPlasmaJSON::getPlotVariables(const Vector<Real>     a_cdrDensities,
   const Real N   = m_gasDensity(a_pos);
   const Real Etd = (E / (N * Units::Td));
 
+  // Interpolation index and weight into the E/N tables. These are shared by all the tabulated reaction rates.
+  const std::vector<std::pair<size_t, Real>> weightsEN = this->computeInterpolationWeightsEN(Etd);
+
   // Townsend ionization and attachment coefficients. May or may not be used.
   const Real alpha = this->computeAlpha(E, a_pos);
   const Real eta   = this->computeEta(E, a_pos);
@@ -4271,6 +4309,7 @@ CdrPlasmaJSON::getPlotVariables(const Vector<Real>     a_cdrDensities,
                                                      a_E,
                                                      E,
                                                      Etd,
+                                                     weightsEN,
                                                      N,
                                                      alpha,
                                                      eta,
@@ -4339,14 +4378,251 @@ CdrPlasmaJSON::isPhotonSpecies(const std::string& a_name) const
 bool
 CdrPlasmaJSON::doesFileExist(const std::string a_filename) const
 {
-  std::ifstream istream(a_filename);
+  // The file is read on the master rank and cached on all ranks, so that the tables are parsed from memory.
+  return DataParser::cacheFile(a_filename);
+}
+
+void
+CdrPlasmaJSON::initializeGridsEN()
+{
+  CH_TIME("CdrPlasmaJSON::initializeGridsEN");
+  if (m_verbose) {
+    pout() << "CdrPlasmaJSON::initializeGridsEN" << endl;
+  }
+
+  m_gridsEN.clear();
+
+  m_mobilityGridsEN.clear();
+  m_diffusionGridsEN.clear();
+  m_temperatureGridsEN.clear();
+  m_plasmaReactionGridsEN.clear();
+
+  for (const auto& t : m_mobilityTablesEN) {
+    m_mobilityGridsEN.emplace(t.first, this->addGridEN(t.second));
+  }
+  for (const auto& t : m_diffusionTablesEN) {
+    m_diffusionGridsEN.emplace(t.first, this->addGridEN(t.second));
+  }
+  for (const auto& t : m_temperatureTablesEN) {
+    m_temperatureGridsEN.emplace(t.first, this->addGridEN(t.second));
+  }
+  for (const auto& t : m_plasmaReactionTablesEN) {
+    m_plasmaReactionGridsEN.emplace(t.first, this->addGridEN(t.second));
+  }
+}
+
+int
+CdrPlasmaJSON::addGridEN(const LookupTable1D<Real, 1>& a_table)
+{
+  CH_TIME("CdrPlasmaJSON::addGridEN");
 
-  bool exists = false;
-  if (istream.good()) {
-    exists = true;
+  for (int i = 0; i < m_gridsEN.size(); i++) {
+    if (m_gridsEN[i].hasSameGrid(a_table)) {
+      return i;
+    }
   }
 
-  return exists;
+  m_gridsEN.emplace_back(a_table);
+
+  return m_gridsEN.size() - 1;
+}
+
+void
+CdrPlasmaJSON::compilePlasmaReactions()
+{
+  CH_TIME("CdrPlasmaJSON::compilePlasmaReactions");
+  if (m_verbose) {
+    pout() << "CdrPlasmaJSON::compilePlasmaReactions" << endl;
+  }
+
+  CompiledPlasmaReactions& program = m_compiledPlasmaReactions;
+
+  program = CompiledPlasmaReactions();
+
+  program.neutralOffsets.emplace_back(0);
+  program.plasmaOffsets.emplace_back(0);
+  program.plasmaProductOffsets.emplace_back(0);
+  program.photonProductOffsets.emplace_back(0);
+
+  for (int i = 0; i < m_plasmaReactions.size(); i++) {
+    const CdrPlasmaReactionJSON& reaction = m_plasmaReactions[i];
+
+    const LookupMethod method = m_plasmaReactionLookup.at(i);
+
+    // The alpha*v and eta*v rates are not multiplied by the neutral densities.
+    bool multiplyNeutrals = true;
+
+    switch (method) {
+    case LookupMethod::Constant: {
+      program.constantReactions.emplace_back(i);
+      program.constantRates.emplace_back(m_plasmaReactionConstants.at(i));
+
+      break;
+    }
+    case LookupMethod::TableEN: {
+      program.tableENReactions.emplace_back(i);
+      program.tableENTables.emplace_back(&(m_plasmaReactionTablesEN.at(i)));
+      program.tableENGrids.emplace_back(m_plasmaReactionGridsEN.at(i));
+
+      break;
+    }
+    case LookupMethod::TableEnergy: {
+      program.tableEnergyReactions.emplace_back(i);
+      program.tableEnergyTables.emplace_back(&(m_plasmaReactionTablesEnergy.at(i).second));
+      program.tableEnergySpecies.emplace_back(m_plasmaReactionTablesEnergy.at(i).first);
+
+      break;
+    }
+    case LookupMethod::AlphaV: {
+      program.alphaVReactions.emplace_back(i);
+      program.alphaVSpecies.emplace_back(m_plasmaReactionAlphaV.at(i));
+
+      multiplyNeutrals = false;
+
+      break;
+    }
+    case LookupMethod::EtaV: {
+      program.etaVReactions.emplace_back(i);
+      program.etaVSpecies.emplace_back(m_plasmaReactionEtaV.at(i));
+
+      multiplyNeutrals = false;
+
+      break;
+    }
+    case LookupMethod::FunctionEN: {
+      const std::vector<Real>& c = m_plasmaReactionCoefficients.at(i);
+
+      program.expENReactions.emplace_back(i);
+      program.expENCoefficients.emplace_back(std::array<Real, 5>{c[0], c[1], c[2], c[3], c[4]});
+
+      break;
+    }
+    case LookupMethod::FunctionT: {
+      const std::vector<Real>& c = m_plasmaReactionCoefficients.at(i);
+
+      program.powerTReactions.emplace_back(i);
+      program.powerTSpecies.emplace_back(m_plasmaReactionFunctionsT.at(i).first);
+      program.powerTCoefficients.emplace_back(std::array<Real, 2>{c[0], c[1]});
+
+      break;
+    }
+    case LookupMethod::FunctionTT: {
+      const std::vector<Real>& c = m_plasmaReactionCoefficients.at(i);
+
+      const auto& tup = m_plasmaReactionFunctionsTT.at(i);
+
+      program.powerTTReactions.emplace_back(i);
+      program.powerTTSpecies.emplace_back(std::array<int, 2>{std::get<0>(tup), std::get<1>(tup)});
+      program.powerTTCoefficients.emplace_back(std::array<Real, 2>{c[0], c[1]});
+
+      break;
+    }
+    default: {
+      MayDay::Error("CdrPlasmaJSON::compilePlasmaReactions -- logic bust");
+
+      break;
+    }
+    }
+
+    // Reactants and products.
+    if (multiplyNeutrals) {
+      for (const auto& n : reaction.getNeutralReactants()) {
+        program.neutralReactants.emplace_back(n);
+      }
+    }
+    for (const auto& r : reaction.getPlasmaReactants()) {
+      program.plasmaReactants.emplace_back(r);
+    }
+    for (const auto& p : reaction.getPlasmaProducts()) {
+      program.plasmaProducts.emplace_back(p);
+    }
+    for (const auto& p : reaction.getPhotonProducts()) {
+      program.photonProducts.emplace_back(p);
+    }
+
+    program.neutralOffsets.emplace_back(program.neutralReactants.size());
+    program.plasmaOffsets.emplace_back(program.plasmaReactants.size());
+    program.plasmaProductOffsets.emplace_back(program.plasmaProducts.size());
+    program.photonProductOffsets.emplace_back(program.photonProducts.size());
+
+    // Efficiency.
+    program.efficiencies.emplace_back(m_plasmaReactionEfficiencyCoefficients.at(i));
+
+    // Soloviev correction.
+    const std::pair<bool, int>& soloviev = m_plasmaReactionSolovievCorrection.at(i);
+
+    if (soloviev.first) {
+      program.solovievReactions.emplace_back(i);
+      program.solovievSpecies.emplace_back(soloviev.second);
+    }
+
+    // Energy losses.
+    if (m_plasmaReactionHasEnergyLoss.at(i)) {
+      for (const auto& curReactionLoss : m_plasmaReactionEnergyLosses.at(i)) {
+        const int transportIndex = curReactionLoss.first;
+
+        program.energyLossReactions.emplace_back(i);
+        program.energyLossSpecies.emplace_back(transportIndex);
+        program.energyLossTargets.emplace_back(m_cdrTransportEnergyMap.at(transportIndex));
+        program.energyLossMethods.emplace_back(curReactionLoss.second.first);
+        program.energyLossFactors.emplace_back(curReactionLoss.second.second);
+      }
+    }
+  }
+}
+
+std::vector<std::pair<size_t, Real>>
+CdrPlasmaJSON::computeInterpolationWeightsEN(const Real a_Etd) const
+{
+  std::vector<std::pair<size_t, Real>> weights(m_gridsEN.size());
+
+  this->computeInterpolationWeightsEN(weights, a_Etd);
+
+  return weights;
+}
+
+void
+CdrPlasmaJSON::computeInterpolationWeightsEN(std::vector<std::pair<size_t, Real>>& a_weights, const Real a_Etd) const
+{
+  a_weights.resize(m_gridsEN.size());
+
+  for (int i = 0; i < m_gridsEN.size(); i++) {
+    m_gridsEN[i].getInterpolationWeight(a_Etd, a_weights[i].first, a_weights[i].second);
+  }
+}
+
+CdrPlasmaJSON::ReactionWorkspace&
+CdrPlasmaJSON::getReactionWorkspace() const
+{
+  ReactionWorkspace& workspace = s_reactionWorkspace;
+
+  const bool resize = workspace.finalCdrDensities.size() != m_numCdrSpecies ||
+                      workspace.photonProduction.size() != m_numRtSpecies ||
+                      workspace.weightsEN.size() != m_gridsEN.size() ||
+                      workspace.reactionRates.size() != m_plasmaReactions.size();
+
+  if (resize) {
+    workspace.finalCdrDensities.assign(m_numCdrSpecies, 0.0);
+    workspace.photonProduction.assign(m_numRtSpecies, 0.0);
+    workspace.weightsEN.assign(m_gridsEN.size(), std::make_pair(size_t(0), 0.0));
+    workspace.mobilities.assign(m_numCdrSpecies, 0.0);
+    workspace.diffusionCoefficients.assign(m_numCdrSpecies, 0.0);
+    workspace.temperatures.assign(m_numCdrSpecies, 0.0);
+    workspace.energies.assign(m_numCdrSpecies, 0.0);
+    workspace.neutralDensities.assign(m_neutralSpeciesDensities.size(), 0.0);
+    workspace.reactionRates.assign(m_plasmaReactions.size(), 0.0);
+    workspace.cdrY0.assign(m_numCdrSpecies, 0.0);
+    workspace.cdrY.assign(m_numCdrSpecies, 0.0);
+    workspace.newtonDelta.assign(m_numCdrSpecies, 0.0);
+    workspace.jacobian.assign(m_numCdrSpecies * m_numCdrSpecies, 0.0);
+
+    for (int k = 0; k < 4; k++) {
+      workspace.cdrK[k].assign(m_numCdrSpecies, 0.0);
+      workspace.rteK[k].assign(m_numRtSpecies, 0.0);
+    }
+  }
+
+  return workspace;
 }
 
 std::vector<Real>
@@ -4365,11 +4641,31 @@ CdrPlasmaJSON::computePlasmaSpeciesMobilities(const RealVect&          a_positio
 
   const std::vector<Real> energies = this->computePlasmaSpeciesEnergies(a_position, a_E, a_cdrDensities);
 
+  // Interpolation index and weight into the E/N tables.
+  const std::vector<std::pair<size_t, Real>> weightsEN = this->computeInterpolationWeightsEN(Etd);
+
   // vector of mobilities
   std::vector<Real> mu(m_numCdrSpecies, 0.0);
 
+  this->computePlasmaSpeciesMobilities(mu, a_position, a_E, energies, weightsEN);
+
+  return mu;
+}
+
+void
+CdrPlasmaJSON::computePlasmaSpeciesMobilities(std::vector<Real>&                          a_mobilities,
+                                              const RealVect&                             a_position,
+                                              const RealVect&                             a_E,
+                                              const std::vector<Real>&                    a_cdrEnergies,
+                                              const std::vector<std::pair<size_t, Real>>& a_weightsEN) const
+{
+  const Real E = a_E.vectorLength();
+  const Real N = m_gasDensity(a_position);
+
+  a_mobilities.assign(m_numCdrSpecies, 0.0);
+
   // Go through each species and compute mobilities.
-  for (int i = 0; i < a_cdrDensities.size(); i++) {
+  for (int i = 0; i < m_numCdrSpecies; i++) {
     const bool isMobile       = m_cdrSpecies[i]->isMobile();
     const bool isEnergySolver = m_cdrIsEnergySolver.at(i);
 
@@ -4379,34 +4675,35 @@ CdrPlasmaJSON::computePlasmaSpeciesMobilities(const RealVect&          a_positio
 
       switch (method) {
       case LookupMethod::Constant: {
-        mu[i] = m_mobilityConstants.at(i);
+        a_mobilities[i] = m_mobilityConstants.at(i);
 
         break;
       }
       case LookupMethod::FunctionEN: {
-        mu[i] = m_mobilityFunctionsEN.at(i)(E, N);
+        a_mobilities[i] = m_mobilityFunctionsEN.at(i)(E, N);
 
         break;
       }
       case LookupMethod::FunctionEX: {
-        mu[i] = m_mobilityFunctionsEX.at(i)(E, a_position);
+        a_mobilities[i] = m_mobilityFunctionsEX.at(i)(E, a_position);
 
         break;
       }
       case LookupMethod::TableEN: {
         // Recall; the mobility tables are stored as (E/N, mu*N) so we need to extract mu from that.
-        const LookupTable1D<Real,1>& mobilityTable = m_mobilityTablesEN.at(i);
+        const LookupTable1D<Real, 1>& mobilityTable = m_mobilityTablesEN.at(i);
+        const auto&                   w             = a_weightsEN[m_mobilityGridsEN.at(i)];
 
-        mu[i] = mobilityTable.interpolate<1>(Etd); // Get mu*N
-        mu[i] /= N;                             // Get mu
+        a_mobilities[i] = mobilityTable.interpolate<1>(w.first, w.second); // Get mu*N
+        a_mobilities[i] /= N;                                       // Get mu
 
         break;
       }
       case LookupMethod::TableEnergy: {
         const LookupTable1D<Real, 1>& mobilityTable = m_mobilityTablesEnergy.at(i);
 
-        mu[i] = mobilityTable.interpolate<1>(energies[i]);
-        mu[i] /= N;
+        a_mobilities[i] = mobilityTable.interpolate<1>(a_cdrEnergies[i]);
+        a_mobilities[i] /= N;
 
         break;
       }
@@ -4422,16 +4719,14 @@ CdrPlasmaJSON::computePlasmaSpeciesMobilities(const RealVect&          a_positio
     const int transportIdx = m.first;
     const int energyIdx    = m.second;
 
-    mu[energyIdx] = 5. / 3. * mu[transportIdx];
+    a_mobilities[energyIdx] = 5. / 3. * a_mobilities[transportIdx];
   }
-
-  return mu;
 }
 
 std::vector<Real>
-CdrPlasmaJSON::computePlasmaSpeciesDiffusion(const RealVect          a_pos,
-                                             const RealVect          a_E,
-                                             const std::vector<Real> a_cdrDensities) const
+CdrPlasmaJSON::computePlasmaSpeciesDiffusion(const RealVect           a_pos,
+                                             const RealVect           a_E,
+                                             const std::vector<Real>& a_cdrDensities) const
 {
   if (m_verbose) {
     pout() << "CdrPlasmaJSON::computePlasmaSpeciesDiffusion" << endl;
@@ -4446,7 +4741,27 @@ CdrPlasmaJSON::computePlasmaSpeciesDiffusion(const RealVect          a_pos,
   // Compute the species energies. We might need them.
   const std::vector<Real> energies = this->computePlasmaSpeciesEnergies(a_pos, a_E, a_cdrDensities);
 
-  for (int i = 0; i < a_cdrDensities.size(); i++) {
+  // Interpolation index and weight into the E/N tables.
+  const std::vector<std::pair<size_t, Real>> weightsEN = this->computeInterpolationWeightsEN(Etd);
+
+  this->computePlasmaSpeciesDiffusion(diffusionCoefficients, a_pos, a_E, energies, weightsEN);
+
+  return diffusionCoefficients;
+}
+
+void
+CdrPlasmaJSON::computePlasmaSpeciesDiffusion(std::vector<Real>&                          a_diffusionCoefficients,
+                                             const RealVect&                             a_position,
+                                             const RealVect&                             a_E,
+                                             const std::vector<Real>&                    a_cdrEnergies,
+                                             const std::vector<std::pair<size_t, Real>>& a_weightsEN) const
+{
+  const Real E = a_E.vectorLength();
+  const Real N = m_gasDensity(a_position);
+
+  a_diffusionCoefficients.assign(m_numCdrSpecies, 0.0);
+
+  for (int i = 0; i < m_numCdrSpecies; i++) {
     const bool isDiffusive    = m_cdrSpecies[i]->isDiffusive();
     const bool isEnergySolver = m_cdrIsEnergySolver.at(i);
 
@@ -4471,8 +4786,9 @@ CdrPlasmaJSON::computePlasmaSpeciesDiffusion(const RealVect          a_pos,
       case LookupMethod::TableEN: {
         // Recall; the diffusion tables are stored as (E/N, D*N) so we need to extract D from that.
         const LookupTable1D<Real, 1>& diffusionTable = m_diffusionTablesEN.at(i);
+        const auto&                   w              = a_weightsEN[m_diffusionGridsEN.at(i)];
 
-        Dco = diffusionTable.interpolate<1>(Etd); // Get D*N
+        Dco = diffusionTable.interpolate<1>(w.first, w.second); // Get D*N
         Dco /= N;                              // Get D
 
         break;
@@ -4481,7 +4797,7 @@ CdrPlasmaJSON::computePlasmaSpeciesDiffusion(const RealVect          a_pos,
         // Recall: The diffusion tables are stored as (eV, D*N) so we just get D from that.
         const LookupTable1D<Real, 1>& diffusionTable = m_diffusionTablesEnergy.at(i);
 
-        Dco = diffusionTable.interpolate<1>(energies[i]);
+        Dco = diffusionTable.interpolate<1>(a_cdrEnergies[i]);
         Dco /= N;
 
         break;
@@ -4491,7 +4807,7 @@ CdrPlasmaJSON::computePlasmaSpeciesDiffusion(const RealVect          a_pos,
       }
       }
 
-      diffusionCoefficients[i] = Dco;
+      a_diffusionCoefficients[i] = Dco;
     }
   }
 
@@ -4500,10 +4816,8 @@ CdrPlasmaJSON::computePlasmaSpeciesDiffusion(const RealVect          a_pos,
     const int transportIdx = m.first;
     const int energyIdx    = m.second;
 
-    diffusionCoefficients[energyIdx] = 5. / 3. * diffusionCoefficients[transportIdx];
+    a_diffusionCoefficients[energyIdx] = 5. / 3. * a_diffusionCoefficients[transportIdx];
   }
-
-  return diffusionCoefficients;
 }
 
 std::vector<Real>
@@ -4542,9 +4856,25 @@ CdrPlasmaJSON::computePlasmaSpeciesEnergies(const RealVect&          a_position,
   const Real E   = a_E.vectorLength();
   const Real Etd = (E / (N * Units::Td));
 
+  // Interpolation index and weight into the E/N tables.
+  const std::vector<std::pair<size_t, Real>> weightsEN = this->computeInterpolationWeightsEN(Etd);
+
   // Return vector of temperatures.
   std::vector<Real> energies(m_numCdrSpecies, 0.0);
 
+  this->computePlasmaSpeciesEnergies(energies, a_position, a_cdrDensities, weightsEN);
+
+  return energies;
+}
+
+void
+CdrPlasmaJSON::computePlasmaSpeciesEnergies(std::vector<Real>&                          a_energies,
+                                            const RealVect&                             a_position,
+                                            const std::vector<Real>&                    a_cdrDensities,
+                                            const std::vector<std::pair<size_t, Real>>& a_weightsEN) const
+{
+  a_energies.assign(m_numCdrSpecies, 0.0);
+
   for (int i = 0; i < m_numCdrSpecies; i++) {
     const bool isEnergySolver = m_cdrIsEnergySolver.at(i);
 
@@ -4566,7 +4896,7 @@ CdrPlasmaJSON::computePlasmaSpeciesEnergies(const RealVect&          a_position,
 
         const Real safeEnergy = std::max(a_cdrDensities[energyIdx], (Real)0.0) / (std::max(a_cdrDensities[i], safety));
 
-        energies[i] = std::max(minEnergy, std::min(maxEnergy, safeEnergy));
+        a_energies[i] = std::max(minEnergy, std::min(maxEnergy, safeEnergy));
       }
       else {
         // Otherwise -- we need to look up the
@@ -4583,8 +4913,9 @@ CdrPlasmaJSON::computePlasmaSpeciesEnergies(const RealVect&          a_position,
         case LookupMethod::TableEN: {
           // Recall; the temperature tables are stored as (E/N, K) so we can fetch the temperature immediately.
           const LookupTable1D<Real, 1>& temperatureTable = m_temperatureTablesEN.at(i);
+          const auto&                   w                = a_weightsEN[m_temperatureGridsEN.at(i)];
 
-          T = temperatureTable.interpolate<1>(Etd);
+          T = temperatureTable.interpolate<1>(w.first, w.second);
 
           break;
         }
@@ -4597,7 +4928,7 @@ CdrPlasmaJSON::computePlasmaSpeciesEnergies(const RealVect&          a_position,
         }
 
         // Convert to energy in electron-volts. We assume energy = 3/2 * kB*T but we also want it in electron-volts.
-        energies[i] = 1.5 * Units::kb * T / Units::Qe;
+        a_energies[i] = 1.5 * Units::kb * T / Units::Qe;
       }
     }
   }
@@ -4607,28 +4938,27 @@ CdrPlasmaJSON::computePlasmaSpeciesEnergies(const RealVect&          a_position,
     const int transportIdx = m.first;
     const int energyIdx    = m.second;
 
-    energies[energyIdx] = energies[transportIdx];
+    a_energies[energyIdx] = a_energies[transportIdx];
   }
-
-  return energies;
 }
 
 Real
-CdrPlasmaJSON::computePlasmaReactionRate(const int&                   a_reactionIndex,
-                                         const std::vector<Real>&     a_cdrDensities,
-                                         const std::vector<Real>&     a_cdrMobilities,
-                                         const std::vector<Real>&     a_cdrDiffusionCoefficients,
-                                         const std::vector<Real>&     a_cdrTemperatures,
-                                         const std::vector<Real>&     a_cdrEnergies,
-                                         const std::vector<RealVect>& a_cdrGradients,
-                                         const RealVect&              a_pos,
-                                         const RealVect&              a_vectorE,
-                                         const Real&                  a_E,
-                                         const Real&                  a_Etd,
-                                         const Real&                  a_N,
-                                         const Real&                  a_alpha,
-                                         const Real&                  a_eta,
-                                         const Real&                  a_time) const
+CdrPlasmaJSON::computePlasmaReactionRate(const int&                                  a_reactionIndex,
+                                         const std::vector<Real>&                    a_cdrDensities,
+                                         const std::vector<Real>&                    a_cdrMobilities,
+                                         const std::vector<Real>&                    a_cdrDiffusionCoefficients,
+                                         const std::vector<Real>&                    a_cdrTemperatures,
+                                         const std::vector<Real>&                    a_cdrEnergies,
+                                         const std::vector<RealVect>&                a_cdrGradients,
+                                         const RealVect&                             a_pos,
+                                         const RealVect&                             a_vectorE,
+                                         const Real&                                 a_E,
+                                         const Real&                                 a_Etd,
+                                         const std::vector<std::pair<size_t, Real>>& a_weightsEN,
+                                         const Real&                                 a_N,
+                                         const Real&                                 a_alpha,
+                                         const Real&                                 a_eta,
+                                         const Real&                                 a_time) const
 {
   const LookupMethod&          method   = m_plasmaReactionLookup.at(a_reactionIndex);
   const CdrPlasmaReactionJSON& reaction = m_plasmaReactions[a_reactionIndex];
@@ -4663,9 +4993,10 @@ CdrPlasmaJSON::computePlasmaReactionRate(const int&                   a_reaction
   case LookupMethod::TableEN: {
     // Recall; the reaction tables are stored as (E/N, rate/N) so we need to extract mu from that.
     const LookupTable1D<Real, 1>& reactionTable = m_plasmaReactionTablesEN.at(a_reactionIndex);
+    const auto&                   w             = a_weightsEN[m_plasmaReactionGridsEN.at(a_reactionIndex)];
 
     // Get the reaction rate.
-    k = reactionTable.interpolate<1>(a_Etd);
+    k = reactionTable.interpolate<1>(w.first, w.second);
 
     // Multiply by neutral species densities.
     for (const auto& n : neutralReactants) {
@@ -4778,6 +5109,130 @@ CdrPlasmaJSON::computePlasmaReactionRate(const int&                   a_reaction
   return k;
 }
 
+void
+CdrPlasmaJSON::computePlasmaReactionRates(std::vector<Real>&                          a_rates,
+                                          const std::vector<Real>&                    a_cdrDensities,
+                                          const std::vector<Real>&                    a_cdrMobilities,
+                                          const std::vector<Real>&                    a_cdrDiffusionCoefficients,
+                                          const std::vector<Real>&                    a_cdrTemperatures,
+                                          const std::vector<Real>&                    a_cdrEnergies,
+                                          const std::vector<RealVect>&                a_cdrGradients,
+                                          const RealVect&                             a_pos,
+                                          const RealVect&                             a_vectorE,
+                                          const Real&                                 a_E,
+                                          const Real&                                 a_Etd,
+                                          const std::vector<std::pair<size_t, Real>>& a_weightsEN,
+                                          const Real&                                 a_N,
+                                          const Real&                                 a_alpha,
+                                          const Real&                                 a_eta,
+                                          const Real&                                 a_time) const
+{
+  CH_assert(a_rates.size() == m_plasmaReactions.size());
+
+  const CompiledPlasmaReactions& program = m_compiledPlasmaReactions;
+
+  const int numReactions = m_plasmaReactions.size();
+
+  // Gas data is evaluated once and shared by all reactions.
+  ReactionWorkspace& workspace = this->getReactionWorkspace();
+
+  std::vector<Real>& neutralDensities = workspace.neutralDensities;
+
+  for (int n = 0; n < m_neutralSpeciesDensities.size(); n++) {
+    neutralDensities[n] = m_neutralSpeciesDensities[n](a_pos);
+  }
+
+  const Real p = m_gasPressure(a_pos);
+  const Real T = m_gasTemperature(a_pos);
+
+  // Base rates, one group at a time.
+  for (int j = 0; j < program.constantReactions.size(); j++) {
+    a_rates[program.constantReactions[j]] = program.constantRates[j];
+  }
+
+  for (int j = 0; j < program.tableENReactions.size(); j++) {
+    const auto& w = a_weightsEN[program.tableENGrids[j]];
+
+    a_rates[program.tableENReactions[j]] = program.tableENTables[j]->interpolate<1>(w.first, w.second);
+  }
+
+  for (int j = 0; j < program.tableEnergyReactions.size(); j++) {
+    const Real energy = a_cdrEnergies[program.tableEnergySpecies[j]];
+
+    a_rates[program.tableEnergyReactions[j]] = program.tableEnergyTables[j]->interpolate<1>(energy);
+  }
+
+  for (int j = 0; j < program.alphaVReactions.size(); j++) {
+    a_rates[program.alphaVReactions[j]] = a_alpha * a_E * a_cdrMobilities[program.alphaVSpecies[j]];
+  }
+
+  for (int j = 0; j < program.etaVReactions.size(); j++) {
+    a_rates[program.etaVReactions[j]] = a_eta * a_E * a_cdrMobilities[program.etaVSpecies[j]];
+  }
+
+  for (int j = 0; j < program.expENReactions.size(); j++) {
+    const std::array<Real, 5>& c = program.expENCoefficients[j];
+
+    a_rates[program.expENReactions[j]] = c[0] * exp(-std::pow(c[1] / (c[2] + c[3] * (a_E / (Units::Td * a_N))), c[4]));
+  }
+
+  for (int j = 0; j < program.powerTReactions.size(); j++) {
+    const std::array<Real, 2>& c   = program.powerTCoefficients[j];
+    const int                  idx = program.powerTSpecies[j];
+
+    const Real T1 = (idx < 0) ? T : a_cdrTemperatures[idx];
+
+    a_rates[program.powerTReactions[j]] = c[0] * std::pow(T1, c[1]);
+  }
+
+  for (int j = 0; j < program.powerTTReactions.size(); j++) {
+    const std::array<Real, 2>& c    = program.powerTTCoefficients[j];
+    const int                  idx1 = program.powerTTSpecies[j][0];
+    const int                  idx2 = program.powerTTSpecies[j][1];
+
+    const Real T1 = (idx1 < 0) ? T : a_cdrTemperatures[idx1];
+    const Real T2 = (idx2 < 0) ? T : a_cdrTemperatures[idx2];
+
+    a_rates[program.powerTTReactions[j]] = c[0] * std::pow(T1 / T2, c[1]);
+  }
+
+  // Multiply by the reactants and the efficiencies. After this, the reaction is k -> k * n[A] * n[B] * ... as it should be.
+  for (int i = 0; i < numReactions; i++) {
+    Real k = a_rates[i];
+
+    for (int j = program.neutralOffsets[i]; j < program.neutralOffsets[i + 1]; j++) {
+      k *= neutralDensities[program.neutralReactants[j]];
+    }
+
+    for (int j = program.plasmaOffsets[i]; j < program.plasmaOffsets[i + 1]; j++) {
+      k *= a_cdrDensities[program.plasmaReactants[j]];
+    }
+
+    const std::array<Real, 5>& eff = program.efficiencies[i];
+
+    a_rates[i] = k * eff[0] * eff[1] / (eff[2] + eff[3] * p + eff[4] * a_N);
+  }
+
+  // Soloviev correction k = k * (1 + (E.D*grad(n))/(K * n * E^2).
+  for (int j = 0; j < program.solovievReactions.size(); j++) {
+    const int species = program.solovievSpecies[j];
+
+    const Real&     n  = a_cdrDensities[species];
+    const Real&     mu = a_cdrMobilities[species];
+    const Real&     D  = a_cdrDiffusionCoefficients[species];
+    const RealVect& g  = a_cdrGradients[species];
+
+    constexpr Real safety = 1.0;
+
+    Real fcorr = 1.0 + (a_vectorE.dotProduct(D * g)) / (safety + n * mu * a_E * a_E);
+
+    fcorr = std::max(fcorr, (Real)0.0);
+    fcorr = std::min(fcorr, (Real)1.0);
+
+    a_rates[program.solovievReactions[j]] *= fcorr;
+  }
+}
+
 Real
 CdrPlasmaJSON::computeAlpha(const Real a_E, const RealVect a_position) const
 {
@@ -4864,31 +5319,148 @@ CdrPlasmaJSON::advanceReactionNetwork(Vector<Real>&          a_cdrSources,
   std::vector<Real>& cdrSources = a_cdrSources.stdVector();
   std::vector<Real>& rteSources = a_rteSources.stdVector();
 
+  const std::vector<Real>&     cdrDensities = ((Vector<Real>&)a_cdrDensities).stdVector();
+  const std::vector<Real>&     rteDensities = ((Vector<Real>&)a_rteDensities).stdVector();
+  const std::vector<RealVect>& cdrGradients = ((Vector<RealVect>&)a_cdrGradients).stdVector();
+
+  ReactionWorkspace& workspace = this->getReactionWorkspace();
+
+  this->advanceReactionNetworkCell(cdrSources,
+                                   rteSources,
+                                   cdrDensities,
+                                   cdrGradients,
+                                   rteDensities,
+                                   a_E,
+                                   a_pos,
+                                   a_dx,
+                                   a_dt,
+                                   a_time,
+                                   a_kappa,
+                                   workspace.finalCdrDensities,
+                                   workspace.photonProduction);
+}
+
+void
+CdrPlasmaJSON::advanceReactionNetworkRegularCells(Vector<FArrayBox*>&       a_cdrSources,
+                                                  Vector<FArrayBox*>&       a_rteSources,
+                                                  const Vector<FArrayBox*>& a_cdrDensities,
+                                                  const Vector<FArrayBox*>& a_cdrGradients,
+                                                  const Vector<FArrayBox*>& a_rteDensities,
+                                                  const FArrayBox&          a_E,
+                                                  const RealVect            a_probLo,
+                                                  const Real                a_dx,
+                                                  const Real                a_dt,
+                                                  const Real                a_time,
+                                                  const Box                 a_cellBox) const
+{
+  CH_TIME("CdrPlasmaJSON::advanceReactionNetworkRegularCells");
+  if (m_verbose) {
+    pout() << "CdrPlasmaJSON::advanceReactionNetworkRegularCells" << endl;
+  }
+
+  CH_assert(a_cdrSources.size() == m_numCdrSpecies);
+  CH_assert(a_rteSources.size() == m_numRtSpecies);
+
+  constexpr int  comp  = 0;
+  constexpr Real zero  = 0.0;
+  constexpr Real kappa = 1.0;
+
+  // Buffers that are reused for all cells in the patch.
+  std::vector<Real>     cdrSources(m_numCdrSpecies, 0.0);
+  std::vector<Real>     rteSources(m_numRtSpecies, 0.0);
+  std::vector<Real>     cdrDensities(m_numCdrSpecies, 0.0);
+  std::vector<RealVect> cdrGradients(m_numCdrSpecies, RealVect::Zero);
+  std::vector<Real>     rteDensities(m_numRtSpecies, 0.0);
+  std::vector<Real>     finalCdrDensities(m_numCdrSpecies, 0.0);
+  std::vector<Real>     photonProduction(m_numRtSpecies, 0.0);
+
+  for (int i = 0; i < m_numCdrSpecies; i++) {
+    a_cdrSources[i]->setVal(0.0);
+  }
+
+  for (int i = 0; i < m_numRtSpecies; i++) {
+    a_rteSources[i]->setVal(0.0);
+  }
+
+  auto regularKernel = [&](const IntVect& iv) -> void {
+    const RealVect pos = a_probLo + (0.5 * RealVect::Unit + RealVect(iv)) * a_dx;
+    const RealVect E   = RealVect(D_DECL(a_E(iv, 0), a_E(iv, 1), a_E(iv, 2)));
+
+    for (int i = 0; i < m_numCdrSpecies; i++) {
+      cdrDensities[i] = std::max(zero, (*a_cdrDensities[i])(iv, comp));
+      cdrGradients[i] = RealVect(
+        D_DECL((*a_cdrGradients[i])(iv, 0), (*a_cdrGradients[i])(iv, 1), (*a_cdrGradients[i])(iv, 2)));
+    }
+
+    for (int i = 0; i < m_numRtSpecies; i++) {
+      rteDensities[i] = std::max(zero, (*a_rteDensities[i])(iv, comp));
+    }
+
+    this->advanceReactionNetworkCell(cdrSources,
+                                     rteSources,
+                                     cdrDensities,
+                                     cdrGradients,
+                                     rteDensities,
+                                     E,
+                                     pos,
+                                     a_dx,
+                                     a_dt,
+                                     a_time,
+                                     kappa,
+                                     finalCdrDensities,
+                                     photonProduction);
+
+    for (int i = 0; i < m_numCdrSpecies; i++) {
+      (*a_cdrSources[i])(iv, comp) = cdrSources[i];
+    }
+
+    for (int i = 0; i < m_numRtSpecies; i++) {
+      (*a_rteSources[i])(iv, comp) = rteSources[i];
+    }
+  };
+
+  BoxLoops::loop(a_cellBox, regularKernel);
+}
+
+void
+CdrPlasmaJSON::advanceReactionNetworkCell(std::vector<Real>&           a_cdrSources,
+                                          std::vector<Real>&           a_rteSources,
+                                          const std::vector<Real>&     a_cdrDensities,
+                                          const std::vector<RealVect>& a_cdrGradients,
+                                          const std::vector<Real>&     a_rteDensities,
+                                          const RealVect               a_E,
+                                          const RealVect               a_pos,
+                                          const Real                   a_dx,
+                                          const Real                   a_dt,
+                                          const Real                   a_time,
+                                          const Real                   a_kappa,
+                                          std::vector<Real>&           a_finalCdrDensities,
+                                          std::vector<Real>&           a_photonProduction) const
+{
   // Set all sources to zero.
-  for (auto& S : cdrSources) {
+  for (auto& S : a_cdrSources) {
     S = 0.0;
   }
 
-  for (auto& S : rteSources) {
+  for (auto& S : a_rteSources) {
     S = 0.0;
   }
 
-  const std::vector<Real>&     cdrDensities = ((Vector<Real>&)a_cdrDensities).stdVector();
-  const std::vector<Real>&     rteDensities = ((Vector<Real>&)a_rteDensities).stdVector();
-  const std::vector<RealVect>& cdrGradients = ((Vector<RealVect>&)a_cdrGradients).stdVector();
-
   // Hook for turning off all reactions.
   if (!m_skipReactions) {
 
     // Solve the reactive problem. The first hook will INTEGRATE the reactive problem (and then linearize the source terms). The other hook
     // will just fill the source terms.
     if (m_reactionIntegrator != ReactionIntegrator::None) {
-      std::vector<Real> finalCdrDensities = cdrDensities;
-      std::vector<Real> photonProduction(m_numRtSpecies, 0.0);
+      a_finalCdrDensities = a_cdrDensities;
+
+      for (auto& P : a_photonProduction) {
+        P = 0.0;
+      }
 
-      this->integrateReactions(finalCdrDensities,
-                               photonProduction,
-                               cdrGradients,
+      this->integrateReactions(a_finalCdrDensities,
+                               a_photonProduction,
+                               a_cdrGradients,
                                a_E,
                                a_pos,
                                a_dx,
@@ -4898,21 +5470,21 @@ CdrPlasmaJSON::advanceReactionNetwork(Vector<Real>&          a_cdrSources,
 
       // Linearize the source terms.
       for (int i = 0; i < m_numCdrSpecies; i++) {
-        cdrSources[i] = (finalCdrDensities[i] - cdrDensities[i]) / a_dt;
+        a_cdrSources[i] = (a_finalCdrDensities[i] - a_cdrDensities[i]) / a_dt;
       }
 
       for (int i = 0; i < m_numRtSpecies; i++) {
-        rteSources[i] = photonProduction[i] / a_dt;
+        a_rteSources[i] = a_photonProduction[i] / a_dt;
       }
     }
     else {
-      this->fillSourceTerms(cdrSources, rteSources, cdrDensities, cdrGradients, a_E, a_pos, a_dx, a_dt, a_kappa);
+      this->fillSourceTerms(a_cdrSources, a_rteSources, a_cdrDensities, a_cdrGradients, a_E, a_pos, a_dx, a_dt, a_kappa);
     }
 
     // Add the photoionization products
     const Real E = a_E.vectorLength();
 
-    this->addPhotoIonization(cdrSources, rteDensities, a_pos, E, a_dt, a_dx);
+    this->addPhotoIonization(a_cdrSources, a_rteDensities, a_pos, E, a_dt, a_dx);
   }
 
   // If using stochastic photons -- then we need to run Poisson sampling of the photons.
@@ -4920,7 +5492,7 @@ CdrPlasmaJSON::advanceReactionNetwork(Vector<Real>&          a_cdrSources,
     // Grid cell volume
     const Real vol = std::pow(a_dx, SpaceDim);
 
-    for (auto& S : rteSources) {
+    for (auto& S : a_rteSources) {
       const auto poissonSample = Random::getPoisson<unsigned long long>(S * vol * a_dt);
 
       S = Real(poissonSample);
@@ -4996,6 +5568,69 @@ CdrPlasmaJSON::computeCdrDiffusionCoefficients(const Real         a_time,
   return Vector<Real>(diffusionCoefficients);
 }
 
+void
+CdrPlasmaJSON::computeCdrTransportCoefficients(Vector<RealVect>&   a_cdrVelocities,
+                                               Vector<Real>&       a_cdrDiffusionCoefficients,
+                                               const Real          a_time,
+                                               const RealVect      a_position,
+                                               const RealVect      a_E,
+                                               const Vector<Real>& a_cdrDensities) const
+{
+  CH_TIME("CdrPlasmaJSON::computeCdrTransportCoefficients");
+  if (m_verbose) {
+    pout() << "CdrPlasmaJSON::computeCdrTransportCoefficients" << endl;
+  }
+
+  // TLDR: This does the same as computeCdrDriftVelocities and computeCdrDiffusionCoefficients, but the species energies
+  //       and the interpolation weights into the E/N tables are only computed once.
+
+  const std::vector<Real>& cdrDensities = ((Vector<Real>&)a_cdrDensities).stdVector();
+
+  // Get E/N.
+  const Real E   = a_E.vectorLength();
+  const Real N   = m_gasDensity(a_position);
+  const Real Etd = (E / (N * Units::Td));
+
+  // Interpolation index and weight into the E/N tables. Shared by the energies, mobilities, and diffusion coefficients.
+  const std::vector<std::pair<size_t, Real>> weightsEN = this->computeInterpolationWeightsEN(Etd);
+
+  std::vector<Real> energies;
+  this->computePlasmaSpeciesEnergies(energies, a_position, cdrDensities, weightsEN);
+
+  std::vector<Real> mu(m_numCdrSpecies, 0.0);
+  std::vector<Real> diffusionCoefficients(m_numCdrSpecies, 0.0);
+
+  this->computePlasmaSpeciesMobilities(mu, a_position, a_E, energies, weightsEN);
+  this->computePlasmaSpeciesDiffusion(diffusionCoefficients, a_position, a_E, energies, weightsEN);
+
+  // Make sure v = +/- mu*E depending on the sign charge. This is the same as in computeCdrDriftVelocities.
+  a_cdrVelocities.resize(m_numCdrSpecies);
+
+  for (int i = 0; i < m_numCdrSpecies; i++) {
+    const int Z = m_cdrSpecies[i]->getChargeNumber();
+
+    a_cdrVelocities[i] = RealVect::Zero;
+
+    if (!(m_cdrIsEnergySolver.at(i))) {
+      if (Z > 0) {
+        a_cdrVelocities[i] = +mu[i] * a_E;
+      }
+      else if (Z < 0) {
+        a_cdrVelocities[i] = -mu[i] * a_E;
+      }
+    }
+  }
+
+  for (const auto& m : m_cdrTransportEnergyMap) {
+    const int transportIdx = m.first;
+    const int energyIdx    = m.second;
+
+    a_cdrVelocities[energyIdx] = 5. / 3. * a_cdrVelocities[transportIdx];
+  }
+
+  a_cdrDiffusionCoefficients = Vector<Real>(diffusionCoefficients);
+}
+
 Vector<Real>
 CdrPlasmaJSON::computeCdrElectrodeFluxes(const Real         a_time,
                                          const RealVect     a_pos,
@@ -5457,15 +6092,15 @@ CdrPlasmaJSON::addPhotoIonization(std::vector<Real>&       a_cdrSources,
 }
 
 void
-CdrPlasmaJSON::integrateReactions(std::vector<Real>&          a_cdrDensities,
-                                  std::vector<Real>&          a_photonProduction,
-                                  const std::vector<RealVect> a_cdrGradients,
-                                  const RealVect              a_E,
-                                  const RealVect              a_pos,
-                                  const Real                  a_dx,
-                                  const Real                  a_dt,
-                                  const Real                  a_time,
-                                  const Real                  a_kappa) const
+CdrPlasmaJSON::integrateReactions(std::vector<Real>&           a_cdrDensities,
+                                  std::vector<Real>&           a_photonProduction,
+                                  const std::vector<RealVect>& a_cdrGradients,
+                                  const RealVect               a_E,
+                                  const RealVect               a_pos,
+                                  const Real                   a_dx,
+                                  const Real                   a_dt,
+                                  const Real                   a_time,
+                                  const Real                   a_kappa) const
 {
   // Do substeps. We happen to know that we have m_reactionIntegrator.second substeps for the whole integration interval.
   const int numSteps = std::ceil(a_dt / m_chemistryDt);
@@ -5529,6 +6164,19 @@ CdrPlasmaJSON::integrateReactions(std::vector<Real>&          a_cdrDensities,
 
       break;
     }
+    case ReactionIntegrator::ImplicitEuler: {
+      this->integrateReactionsImplicitEuler(a_cdrDensities,
+                                            a_photonProduction,
+                                            a_cdrGradients,
+                                            a_E,
+                                            a_pos,
+                                            a_dx,
+                                            dt,
+                                            time,
+                                            a_kappa);
+
+      break;
+    }
     default: {
       MayDay::Error("CdrPlasmaJSON::integrateReactions - logic bust");
     }
@@ -5537,31 +6185,49 @@ CdrPlasmaJSON::integrateReactions(std::vector<Real>&          a_cdrDensities,
 }
 
 void
-CdrPlasmaJSON::fillSourceTerms(std::vector<Real>&          a_cdrSources,
-                               std::vector<Real>&          a_rteSources,
-                               const std::vector<Real>     a_cdrDensities,
-                               const std::vector<RealVect> a_cdrGradients,
-                               const RealVect              a_E,
-                               const RealVect              a_pos,
-                               const Real                  a_dx,
-                               const Real                  a_time,
-                               const Real                  a_kappa) const
+CdrPlasmaJSON::fillSourceTerms(std::vector<Real>&           a_cdrSources,
+                               std::vector<Real>&           a_rteSources,
+                               const std::vector<Real>&     a_cdrDensities,
+                               const std::vector<RealVect>& a_cdrGradients,
+                               const RealVect               a_E,
+                               const RealVect               a_pos,
+                               const Real                   a_dx,
+                               const Real                   a_time,
+                               const Real                   a_kappa) const
 {
   if (m_verbose) {
     pout() << "CdrPlasmaJSON::fillSourceTerms" << endl;
   }
 
-  // These may or may not be needed.
-  const std::vector<Real> cdrMobilities            = this->computePlasmaSpeciesMobilities(a_pos, a_E, a_cdrDensities);
-  const std::vector<Real> cdrDiffusionCoefficients = this->computePlasmaSpeciesDiffusion(a_pos, a_E, a_cdrDensities);
-  const std::vector<Real> cdrTemperatures          = this->computePlasmaSpeciesTemperatures(a_pos, a_E, a_cdrDensities);
-  const std::vector<Real> cdrEnergies              = this->computePlasmaSpeciesEnergies(a_pos, a_E, a_cdrDensities);
+  ReactionWorkspace& workspace = this->getReactionWorkspace();
 
   // Electric field and reduce electric field.
   const Real E   = a_E.vectorLength();
   const Real N   = m_gasDensity(a_pos);
   const Real Etd = (E / (N * Units::Td));
 
+  // Interpolation index and weight into the E/N tables. These are shared by all the tabulated transport data and reaction rates.
+  std::vector<std::pair<size_t, Real>>& weightsEN = workspace.weightsEN;
+
+  this->computeInterpolationWeightsEN(weightsEN, Etd);
+
+  // These may or may not be needed. The energies are computed once and used for the other transport data.
+  std::vector<Real>& cdrMobilities            = workspace.mobilities;
+  std::vector<Real>& cdrDiffusionCoefficients = workspace.diffusionCoefficients;
+  std::vector<Real>& cdrTemperatures          = workspace.temperatures;
+  std::vector<Real>& cdrEnergies              = workspace.energies;
+
+  this->computePlasmaSpeciesEnergies(cdrEnergies, a_pos, a_cdrDensities, weightsEN);
+  this->computePlasmaSpeciesMobilities(cdrMobilities, a_pos, a_E, cdrEnergies, weightsEN);
+  this->computePlasmaSpeciesDiffusion(cdrDiffusionCoefficients, a_pos, a_E, cdrEnergies, weightsEN);
+
+  // Temperatures in Kelvin, from e = 3/2 * kB * T.
+  constexpr Real temperatureFactor = 2.0 * Units::Qe / (3.0 * Units::kb);
+
+  for (int i = 0; i < m_numCdrSpecies; i++) {
+    cdrTemperatures[i] = temperatureFactor * cdrEnergies[i];
+  }
+
   // Townsend ionization and attachment coefficients. May or may not be used.
   const Real alpha = this->computeAlpha(E, a_pos);
   const Real eta   = this->computeEta(E, a_pos);
@@ -5576,87 +6242,80 @@ CdrPlasmaJSON::fillSourceTerms(std::vector<Real>&          a_cdrSources,
     S = 0.0;
   }
 
+  // Compute the rates for all plasma reactions. This returns volumetric rates in units of #/(m^3 * s) (or #/(m^2 * s) for Cartesian 2D).
+  const CompiledPlasmaReactions& program = m_compiledPlasmaReactions;
+
+  std::vector<Real>& rates = workspace.reactionRates;
+
+  this->computePlasmaReactionRates(rates,
+                                   a_cdrDensities,
+                                   cdrMobilities,
+                                   cdrDiffusionCoefficients,
+                                   cdrTemperatures,
+                                   cdrEnergies,
+                                   a_cdrGradients,
+                                   a_pos,
+                                   a_E,
+                                   E,
+                                   Etd,
+                                   weightsEN,
+                                   N,
+                                   alpha,
+                                   eta,
+                                   a_time);
+
   // Plasma reactions loop
   for (int i = 0; i < m_plasmaReactions.size(); i++) {
-
-    // Reaction and species involved in the reaction.
-    const CdrPlasmaReactionJSON& reaction = m_plasmaReactions[i];
-
-    const std::list<int>& plasmaReactants = reaction.getPlasmaReactants();
-    const std::list<int>& plasmaProducts  = reaction.getPlasmaProducts();
-    const std::list<int>& photonProducts  = reaction.getPhotonProducts();
-
-    // Compute the rate. This returns a volumetric rate in units of #/(m^3 * s) (or #/(m^2 * s) for Cartesian 2D).
-    const Real k = this->computePlasmaReactionRate(i,
-                                                   a_cdrDensities,
-                                                   cdrMobilities,
-                                                   cdrDiffusionCoefficients,
-                                                   cdrTemperatures,
-                                                   cdrEnergies,
-                                                   a_cdrGradients,
-                                                   a_pos,
-                                                   a_E,
-                                                   E,
-                                                   Etd,
-                                                   N,
-                                                   alpha,
-                                                   eta,
-                                                   a_time);
+    const Real k = rates[i];
 
     // Remove consumption on the left-hand side.
-    for (const auto& r : plasmaReactants) {
-      a_cdrSources[r] -= k;
+    for (int j = program.plasmaOffsets[i]; j < program.plasmaOffsets[i + 1]; j++) {
+      a_cdrSources[program.plasmaReactants[j]] -= k;
     }
 
     // Add mass on the right-hand side.
-    for (const auto& p : plasmaProducts) {
-      a_cdrSources[p] += k;
+    for (int j = program.plasmaProductOffsets[i]; j < program.plasmaProductOffsets[i + 1]; j++) {
+      a_cdrSources[program.plasmaProducts[j]] += k;
     }
 
     // Add photons on the right-hand side.
-    for (const auto& p : photonProducts) {
-      a_rteSources[p] += k;
+    for (int j = program.photonProductOffsets[i]; j < program.photonProductOffsets[i + 1]; j++) {
+      a_rteSources[program.photonProducts[j]] += k;
     }
+  }
 
-    // If there is an energy loss associated with this reaction, we need to add the losses to the corresponding energy transport solvers.
-    if (m_plasmaReactionHasEnergyLoss.at(i)) {
-      const auto& energyLosses = m_plasmaReactionEnergyLosses.at(i);
-
-      for (const auto& curReactionLoss : energyLosses) {
-        const int& transportIndex = curReactionLoss.first;
-        const int& energyIndex    = m_cdrTransportEnergyMap.at(transportIndex);
-
-        const auto& lossMethod = (curReactionLoss.second).first;
-        const auto& lossFactor = (curReactionLoss.second).second;
+  // If there is an energy loss associated with a reaction, we need to add the losses to the corresponding energy transport solvers.
+  for (int j = 0; j < program.energyLossReactions.size(); j++) {
+    const Real& k           = rates[program.energyLossReactions[j]];
+    const int   energyIndex = program.energyLossTargets[j];
+    const Real& lossFactor  = program.energyLossFactors[j];
 
-        switch (lossMethod) {
-        case ReactiveEnergyLoss::AddMean: {
-          a_cdrSources[energyIndex] += lossFactor * cdrEnergies[transportIndex] * k;
+    switch (program.energyLossMethods[j]) {
+    case ReactiveEnergyLoss::AddMean: {
+      a_cdrSources[energyIndex] += lossFactor * cdrEnergies[program.energyLossSpecies[j]] * k;
 
-          break;
-        }
-        case ReactiveEnergyLoss::SubtractMean: {
-          a_cdrSources[energyIndex] -= lossFactor * cdrEnergies[transportIndex] * k;
+      break;
+    }
+    case ReactiveEnergyLoss::SubtractMean: {
+      a_cdrSources[energyIndex] -= lossFactor * cdrEnergies[program.energyLossSpecies[j]] * k;
 
-          break;
-        }
-        case ReactiveEnergyLoss::AddDirect: {
-          a_cdrSources[energyIndex] += k;
+      break;
+    }
+    case ReactiveEnergyLoss::AddDirect: {
+      a_cdrSources[energyIndex] += k;
 
-          break;
-        }
-        case ReactiveEnergyLoss::SubtractDirect: {
-          a_cdrSources[energyIndex] -= k;
+      break;
+    }
+    case ReactiveEnergyLoss::SubtractDirect: {
+      a_cdrSources[energyIndex] -= k;
 
-          break;
-        }
-        case ReactiveEnergyLoss::External: {
-          a_cdrSources[energyIndex] += lossFactor * k;
+      break;
+    }
+    case ReactiveEnergyLoss::External: {
+      a_cdrSources[energyIndex] += lossFactor * k;
 
-          break;
-        }
-        }
-      }
+      break;
+    }
     }
   }
 
@@ -5688,22 +6347,24 @@ CdrPlasmaJSON::fillSourceTerms(std::vector<Real>&          a_cdrSources,
 }
 
 void
-CdrPlasmaJSON::integrateReactionsExplicitEuler(std::vector<Real>&          a_cdrDensities,
-                                               std::vector<Real>&          a_photonProduction,
-                                               const std::vector<RealVect> a_cdrGradients,
-                                               const RealVect              a_E,
-                                               const RealVect              a_pos,
-                                               const Real                  a_dx,
-                                               const Real                  a_dt,
-                                               const Real                  a_time,
-                                               const Real                  a_kappa) const
+CdrPlasmaJSON::integrateReactionsExplicitEuler(std::vector<Real>&           a_cdrDensities,
+                                               std::vector<Real>&           a_photonProduction,
+                                               const std::vector<RealVect>& a_cdrGradients,
+                                               const RealVect               a_E,
+                                               const RealVect               a_pos,
+                                               const Real                   a_dx,
+                                               const Real                   a_dt,
+                                               const Real                   a_time,
+                                               const Real                   a_kappa) const
 {
   if (m_verbose) {
     pout() << "CdrPlasmaJSON::integrateReactionsExplicitEuler" << endl;
   }
 
-  std::vector<Real> cdrSources(m_numCdrSpecies, 0.0);
-  std::vector<Real> rteSources(m_numRtSpecies, 0.0);
+  ReactionWorkspace& workspace = this->getReactionWorkspace();
+
+  std::vector<Real>& cdrSources = workspace.cdrK[0];
+  std::vector<Real>& rteSources = workspace.rteK[0];
 
   this->fillSourceTerms(cdrSources, rteSources, a_cdrDensities, a_cdrGradients, a_E, a_pos, a_dx, a_time, a_kappa);
 
@@ -5718,16 +6379,155 @@ CdrPlasmaJSON::integrateReactionsExplicitEuler(std::vector<Real>&          a_cdr
 }
 
 void
-CdrPlasmaJSON::integrateReactionsExplicitRK2(std::vector<Real>&          a_cdrDensities,
-                                             std::vector<Real>&          a_photonProduction,
-                                             const std::vector<RealVect> a_cdrGradients,
-                                             const RealVect              a_E,
-                                             const RealVect              a_pos,
-                                             const Real                  a_dx,
-                                             const Real                  a_dt,
-                                             const Real                  a_time,
-                                             const Real                  a_kappa,
-                                             const Real                  a_tableuAlpha) const
+CdrPlasmaJSON::integrateReactionsImplicitEuler(std::vector<Real>&           a_cdrDensities,
+                                               std::vector<Real>&           a_photonProduction,
+                                               const std::vector<RealVect>& a_cdrGradients,
+                                               const RealVect               a_E,
+                                               const RealVect               a_pos,
+                                               const Real                   a_dx,
+                                               const Real                   a_dt,
+                                               const Real                   a_time,
+                                               const Real                   a_kappa) const
+{
+  if (m_verbose) {
+    pout() << "CdrPlasmaJSON::integrateReactionsImplicitEuler" << endl;
+  }
+
+  // TLDR: We solve G(y) = y - y0 - dt * f(y) = 0 using Newton iterations, where y0 = n(t) and f are the reactive source
+  //       terms. The Jacobian dG/dy = I - dt * df/dy is computed with one-sided finite differences because the reaction
+  //       rates can depend on the densities in non-trivial ways (e.g., through the mean energy in LEA models). The linear
+  //       system has one row per plasma species and is solved with Gaussian elimination with partial pivoting.
+  const int N = m_numCdrSpecies;
+
+  const Real sqrtEps = std::sqrt(std::numeric_limits<Real>::epsilon());
+  const Real tiny    = std::numeric_limits<Real>::min();
+  const Real time    = a_time + a_dt;
+
+  ReactionWorkspace& workspace = this->getReactionWorkspace();
+
+  std::vector<Real>& y0 = workspace.cdrY0;
+  std::vector<Real>& y  = a_cdrDensities;
+
+  y0 = a_cdrDensities;
+
+  std::vector<Real>& yh          = workspace.cdrY;
+  std::vector<Real>& cdrSources  = workspace.cdrK[0];
+  std::vector<Real>& cdrSourcesH = workspace.cdrK[1];
+  std::vector<Real>& rteSources  = workspace.rteK[0];
+  std::vector<Real>& rteSourcesH = workspace.rteK[1];
+  std::vector<Real>& delta       = workspace.newtonDelta;
+  std::vector<Real>& jacobian    = workspace.jacobian;
+
+  for (int iter = 0; iter < m_newtonIterations; iter++) {
+    this->fillSourceTerms(cdrSources, rteSources, y, a_cdrGradients, a_E, a_pos, a_dx, time, a_kappa);
+
+    // Right-hand side of the Newton update, J * delta = -G(y).
+    for (int i = 0; i < N; i++) {
+      delta[i] = y0[i] + a_dt * cdrSources[i] - y[i];
+    }
+
+    // Fill the Jacobian, one column at a time.
+    yh = y;
+    for (int j = 0; j < N; j++) {
+      const Real h = sqrtEps * std::max(std::abs(y[j]), 1.0);
+
+      yh[j] = y[j] + h;
+
+      this->fillSourceTerms(cdrSourcesH, rteSourcesH, yh, a_cdrGradients, a_E, a_pos, a_dx, time, a_kappa);
+
+      yh[j] = y[j];
+
+      for (int i = 0; i < N; i++) {
+        jacobian[i * N + j] = ((i == j) ? 1.0 : 0.0) - a_dt * (cdrSourcesH[i] - cdrSources[i]) / h;
+      }
+    }
+
+    // Forward elimination with partial pivoting.
+    bool singular = false;
+
+    for (int k = 0; k < N; k++) {
+      int pivot = k;
+      for (int i = k + 1; i < N; i++) {
+        if (std::abs(jacobian[i * N + k]) > std::abs(jacobian[pivot * N + k])) {
+          pivot = i;
+        }
+      }
+
+      if (std::abs(jacobian[pivot * N + k]) <= tiny) {
+        singular = true;
+
+        break;
+      }
+
+      if (pivot != k) {
+        for (int j = 0; j < N; j++) {
+          std::swap(jacobian[k * N + j], jacobian[pivot * N + j]);
+        }
+
+        std::swap(delta[k], delta[pivot]);
+      }
+
+      for (int i = k + 1; i < N; i++) {
+        const Real factor = jacobian[i * N + k] / jacobian[k * N + k];
+
+        for (int j = k; j < N; j++) {
+          jacobian[i * N + j] -= factor * jacobian[k * N + j];
+        }
+
+        delta[i] -= factor * delta[k];
+      }
+    }
+
+    // Keep the current iterate if the Jacobian is singular.
+    if (singular) {
+      break;
+    }
+
+    // Back substitution.
+    for (int k = N - 1; k >= 0; k--) {
+      Real sum = delta[k];
+      for (int j = k + 1; j < N; j++) {
+        sum -= jacobian[k * N + j] * delta[j];
+      }
+
+      delta[k] = sum / jacobian[k * N + k];
+    }
+
+    // Update the solution and check for convergence.
+    bool converged = true;
+
+    for (int i = 0; i < N; i++) {
+      y[i] += delta[i];
+
+      if (std::abs(delta[i]) > m_newtonTolerance * std::max(std::abs(y[i]), 1.0)) {
+        converged = false;
+      }
+    }
+
+    if (converged) {
+      break;
+    }
+  }
+
+  // Photon production is evaluated at the end state.
+  this->fillSourceTerms(cdrSources, rteSources, y, a_cdrGradients, a_E, a_pos, a_dx, time, a_kappa);
+
+  for (int i = 0; i < m_numRtSpecies; i++) {
+    a_photonProduction[i] = rteSources[i] * a_dt;
+  }
+}
+
+void
+CdrPlasmaJSON::integrateReactionsExplicitRK2(std::vector<Real>&           a_cdrDensities,
+                                             std::vector<Real>&           a_photonProduction,
+                                             const std::vector<RealVect>& a_cdrGradients,
+                                             const RealVect               a_E,
+                                             const RealVect               a_pos,
+                                             const Real                   a_dx,
+                                             const Real                   a_dt,
+                                             const Real                   a_time,
+                                             const Real                   a_kappa,
+                                             const Real                   a_tableuAlpha) const
 {
   if (m_verbose) {
     pout() << "CdrPlasmaJSON::integrateReactionsRK2" << endl;
@@ -5737,12 +6537,14 @@ CdrPlasmaJSON::integrateReactionsExplicitRK2(std::vector<Real>&          a_cdrDe
   const Real c2 = 1.0 / (2.0 * a_tableuAlpha);
 
   // Storage for k1- and k2- coefficients, and intermediate states.
-  std::vector<Real> cdrK1(m_numCdrSpecies, 0.0);
-  std::vector<Real> cdrK2(m_numCdrSpecies, 0.0);
-  std::vector<Real> cdrY1(m_numCdrSpecies, 0.0);
+  ReactionWorkspace& workspace = this->getReactionWorkspace();
+
+  std::vector<Real>& cdrK1 = workspace.cdrK[0];
+  std::vector<Real>& cdrK2 = workspace.cdrK[1];
+  std::vector<Real>& cdrY1 = workspace.cdrY;
 
-  std::vector<Real> rteK1(m_numRtSpecies, 0.0);
-  std::vector<Real> rteK2(m_numRtSpecies, 0.0);
+  std::vector<Real>& rteK1 = workspace.rteK[0];
+  std::vector<Real>& rteK2 = workspace.rteK[1];
 
   // Compute k1 coefficient and fill intermediate states.
   this->fillSourceTerms(cdrK1, rteK1, a_cdrDensities, a_cdrGradients, a_E, a_pos, a_dx, a_time, a_kappa);
@@ -5763,15 +6565,15 @@ CdrPlasmaJSON::integrateReactionsExplicitRK2(std::vector<Real>&          a_cdrDe
 }
 
 void
-CdrPlasmaJSON::integrateReactionsExplicitRK4(std::vector<Real>&          a_cdrDensities,
-                                             std::vector<Real>&          a_photonProduction,
-                                             const std::vector<RealVect> a_cdrGradients,
-                                             const RealVect              a_E,
-                                             const RealVect              a_pos,
-                                             const Real                  a_dx,
-                                             const Real                  a_dt,
-                                             const Real                  a_time,
-                                             const Real                  a_kappa) const
+CdrPlasmaJSON::integrateReactionsExplicitRK4(std::vector<Real>&           a_cdrDensities,
+                                             std::vector<Real>&           a_photonProduction,
+                                             const std::vector<RealVect>& a_cdrGradients,
+                                             const RealVect               a_E,
+                                             const RealVect               a_pos,
+                                             const Real                   a_dx,
+                                             const Real                   a_dt,
+                                             const Real                   a_time,
+                                             const Real                   a_kappa) const
 {
   if (m_verbose) {
     pout() << "CdrPlasmaJSON::integrateReactionsRK4" << endl;
@@ -5789,16 +6591,18 @@ CdrPlasmaJSON::integrateReactionsExplicitRK4(std::vector<Real>&          a_cdrDe
   //          k4 = f(t+dt  , y(t) +     dt*k3)
 
   // Storage for Runge-Kutta k-coefficients and intermediate states.
-  std::vector<Real> cdrK1(m_numCdrSpecies, 0.0);
-  std::vector<Real> cdrK2(m_numCdrSpecies, 0.0);
-  std::vector<Real> cdrK3(m_numCdrSpecies, 0.0);
-  std::vector<Real> cdrK4(m_numCdrSpecies, 0.0);
-  std::vector<Real> cdrY1(m_numCdrSpecies, 0.0);
-
-  std::vector<Real> rteK1(m_numRtSpecies, 0.0);
-  std::vector<Real> rteK2(m_numRtSpecies, 0.0);
-  std::vector<Real> rteK3(m_numRtSpecies, 0.0);
-  std::vector<Real> rteK4(m_numRtSpecies, 0.0);
+  ReactionWorkspace& workspace = this->getReactionWorkspace();
+
+  std::vector<Real>& cdrK1 = workspace.cdrK[0];
+  std::vector<Real>& cdrK2 = workspace.cdrK[1];
+  std::vector<Real>& cdrK3 = workspace.cdrK[2];
+  std::vector<Real>& cdrK4 = workspace.cdrK[3];
+  std::vector<Real>& cdrY1 = workspace.cdrY;
+
+  std::vector<Real>& rteK1 = workspace.rteK[0];
+  std::vector<Real>& rteK2 = workspace.rteK[1];
+  std::vector<Real>& rteK3 = workspace.rteK[2];
+  std::vector<Real>& rteK4 = workspace.rteK[3];
 
   // Compute k1-coefficients and intermediate states
   this->fillSourceTerms(cdrK1, rteK1, a_cdrDensities, a_cdrGradients, a_E, a_pos, a_dx, a_time, a_kappa);
@@ -20,6 +20,7 @@
 #include <CD_CdrPlasmaGodunovStorage.H>
 #include <CD_DischargeIO.H>
 #include <CD_DataOps.H>
+#include <CD_ParallelOps.H>
 #include <CD_Units.H>
 #include <CD_NamespaceHeader.H>
 
@@ -208,6 +209,9 @@ CdrPlasmaGodunovStepper::parseAdvection()
   else {
     MayDay::Error("CdrPlasmaGodunovStepper::parseAdvection - unknown argument");
   }
+
+  m_fusedAdvection = false;
+  pp.query("fused_advection", m_fusedAdvection);
 }
 
 void
@@ -332,17 +336,17 @@ CdrPlasmaGodunovStepper::advance(const Real a_dt)
   // 2. Solve the Poisson equation and compute the electric field. If we did a semi-implicit solve then the field has already been computed.
   if (m_fieldCoupling != FieldCoupling::SemiImplicit) {
     m_timer->startEvent("Poisson");
-    if ((m_timeStep + 1) % m_fastPoisson == 0) {
-      CdrPlasmaStepper::solvePoisson();
-    }
+    CdrPlasmaStepper::updatePotential(m_time + a_dt);
     CdrPlasmaGodunovStepper::computeElectricFieldIntoScratch();
     m_timer->stopEvent("Poisson");
   }
 
   // 3. Solve the reactive problem.
   m_timer->startEvent("Reactions");
+  this->allocateStageScratch(ScratchStage::Reactions);
   CdrPlasmaGodunovStepper::computeCdrGradients();
   CdrPlasmaGodunovStepper::computeSourceTerms(a_dt);
+  this->deallocateStageScratch(ScratchStage::Reactions);
   m_timer->stopEvent("Reactions");
 
   // 3. Advance CDR equations with reactive terms.
@@ -352,7 +356,7 @@ CdrPlasmaGodunovStepper::advance(const Real a_dt)
 
   // 4. Solve the radiative transfer problem.
   m_timer->startEvent("Radiation");
-  if ((m_timeStep + 1) % m_fastRTE == 0) {
+  if (CdrPlasmaStepper::needsRadiativeTransferSolve()) {
     CdrPlasmaGodunovStepper::advanceRadiativeTransfer(a_dt);
   }
   m_timer->stopEvent("Radiation");
@@ -363,13 +367,9 @@ CdrPlasmaGodunovStepper::advance(const Real a_dt)
   m_timer->stopEvent("Post-step");
 
   // 5. Update velocities and diffusion coefficients in order to prepare for the next time step.
-  m_timer->startEvent("Velocities");
-  CdrPlasmaGodunovStepper::computeCdrDriftVelocities(m_time + a_dt);
-  m_timer->stopEvent("Velocities");
-
-  m_timer->startEvent("Diffu-coeffs");
-  CdrPlasmaGodunovStepper::computeCdrDiffusionCoefficients(m_time + a_dt);
-  m_timer->stopEvent("Diffu-coeffs");
+  m_timer->startEvent("Transport coefficients");
+  CdrPlasmaGodunovStepper::computeCdrTransportCoefficients(m_time + a_dt);
+  m_timer->stopEvent("Transport coefficients");
 
   m_timer->startEvent("Compute J");
   this->computeJ(m_currentDensity);
@@ -488,8 +488,7 @@ CdrPlasmaGodunovStepper::regrid(const int a_lmin, const int a_oldFinestLevel, co
     }
 
     // Now compute drift velocities and diffusion -- using the electric field from last time step on the new mesh.
-    CdrPlasmaStepper::computeCdrDriftVelocities();
-    CdrPlasmaStepper::computeCdrDiffusion();
+    CdrPlasmaStepper::computeCdrTransportCoefficients();
 
     // If we're doing a stationary RTE solve, we also have to recompute source terms
     if (this->stationaryRTE()) { // Solve RTE equations by using data that exists inside solvers
@@ -554,8 +553,7 @@ CdrPlasmaGodunovStepper::postCheckpointSetup()
 
     // Now compute the drift and diffusion velocities and update the source terms. This will be OK because the
     // CdrPlasmaStepper functions fetch the electric field from the solver, but it already has the correct potential.
-    CdrPlasmaStepper::computeCdrDriftVelocities();
-    CdrPlasmaStepper::computeCdrDiffusion();
+    CdrPlasmaStepper::computeCdrTransportCoefficients();
 
     // If we are doing a stationary RTE then we probably have to update the elliptic equations.
     if (this->stationaryRTE()) {
@@ -769,6 +767,32 @@ CdrPlasmaGodunovStepper::deallocateScratch()
   m_sigmaScratch = RefCountedPtr<SigmaStorage>(0);
 }
 
+void
+CdrPlasmaGodunovStepper::allocateStageScratch(const ScratchStage a_stage)
+{
+  CH_TIME("CdrPlasmaGodunovStepper::allocateStageScratch(ScratchStage)");
+  if (m_verbosity > 5) {
+    pout() << "CdrPlasmaGodunovStepper::allocateStageScratch(ScratchStage)" << endl;
+  }
+
+  for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
+    CdrPlasmaGodunovStepper::getCdrStorage(solverIt)->allocateStage(a_stage);
+  }
+}
+
+void
+CdrPlasmaGodunovStepper::deallocateStageScratch(const ScratchStage a_stage)
+{
+  CH_TIME("CdrPlasmaGodunovStepper::deallocateStageScratch(ScratchStage)");
+  if (m_verbosity > 5) {
+    pout() << "CdrPlasmaGodunovStepper::deallocateStageScratch(ScratchStage)" << endl;
+  }
+
+  for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
+    CdrPlasmaGodunovStepper::getCdrStorage(solverIt)->deallocateStage(a_stage);
+  }
+}
+
 void
 CdrPlasmaGodunovStepper::computeElectricFieldIntoScratch()
 {
@@ -1168,6 +1192,91 @@ CdrPlasmaGodunovStepper::advanceTransport(const Real a_dt)
   }
 }
 
+void
+CdrPlasmaGodunovStepper::advanceAdvectionFused(const Real a_dt)
+{
+  CH_TIME("CdrPlasmaGodunovStepper::advanceAdvectionFused(Real)");
+  if (m_verbosity > 5) {
+    pout() << "CdrPlasmaGodunovStepper::advanceAdvectionFused(Real)" << endl;
+  }
+
+  // TLDR: This is the same advective advance as in advanceTransportExplicitField, but the divergences for all species are
+  //       computed together so that the ghost cells are filled once for all species.
+  Vector<EBAMRCellData*> phis = m_cdr->getPhis();
+  Vector<EBAMRCellData*> scratch;
+  Vector<EBAMRCellData*> scratch2;
+
+  for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
+    RefCountedPtr<CdrStorage>& storage = CdrPlasmaGodunovStepper::getCdrStorage(solverIt);
+
+    scratch.push_back(&(storage->getScratch()));
+    scratch2.push_back(&(storage->getScratch2()));
+  }
+
+  switch (m_advectionSolver) {
+  case AdvectionSolver::Euler: {
+    m_cdr->computeDivF(scratch, phis, 0.0, false, true, true);
+
+    for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
+      const int idx = solverIt.index();
+
+      DataOps::incr(*phis[idx], *scratch[idx], -a_dt);
+    }
+
+    break;
+  }
+  case AdvectionSolver::RK2: {
+    m_cdr->computeDivF(scratch, phis, 0.0, false, true, true);
+
+    for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
+      const int idx = solverIt.index();
+
+      DataOps::incr(*phis[idx], *scratch[idx], -a_dt);
+    }
+
+    m_cdr->computeDivF(scratch2, phis, 0.0, false, true, true);
+
+    for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
+      const int idx = solverIt.index();
+
+      DataOps::incr(*phis[idx], *scratch[idx], 0.5 * a_dt);
+      DataOps::incr(*phis[idx], *scratch2[idx], -0.5 * a_dt);
+    }
+
+    break;
+  }
+  case AdvectionSolver::MUSCL: {
+    m_cdr->computeDivF(scratch, phis, a_dt, false, true, true);
+
+    for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
+      const int idx = solverIt.index();
+
+      DataOps::incr(*phis[idx], *scratch[idx], -a_dt);
+    }
+
+    break;
+  }
+  default: {
+    MayDay::Error("CdrPlasmaGodunovStepper::advanceAdvectionFused -- logic bust");
+  }
+  }
+
+  for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
+    RefCountedPtr<CdrSolver>& solver = solverIt();
+
+    if (solver->isMobile()) {
+      EBAMRCellData& phi = solver->getPhi();
+
+      if (m_floor) {
+        this->floorMass(phi, "CdrPlasmaGodunovStepper::advanceAdvectionFused", solver);
+      }
+
+      m_amr->arithmeticAverage(phi, m_realm, m_cdr->getPhase());
+      m_amr->interpGhost(phi, m_realm, m_cdr->getPhase());
+    }
+  }
+}
+
 void
 CdrPlasmaGodunovStepper::advanceTransportExplicitField(const Real a_dt)
 {
@@ -1183,6 +1292,7 @@ CdrPlasmaGodunovStepper::advanceTransportExplicitField(const Real a_dt)
   // First, update everything we need for consistently computing boundary conditions on the EBs and
   // domain faces.
   m_timer->startEvent("Gradients and BCs");
+  this->allocateStageScratch(ScratchStage::Boundary);
   CdrPlasmaGodunovStepper::computeElectricFieldIntoScratch(); // Compute the electric field
   CdrPlasmaGodunovStepper::computeCdrGradients();             // Compute CDR gradients
   CdrPlasmaGodunovStepper::extrapolateWithSourceTerm(a_dt);   // If we used advective extrapolation, BCs are more work.
@@ -1191,6 +1301,7 @@ CdrPlasmaGodunovStepper::advanceTransportExplicitField(const Real a_dt)
   CdrPlasmaGodunovStepper::computeCdrFluxesEB();              // Extrapolate cell-centered fluxes to EB centroids
   CdrPlasmaGodunovStepper::computeCdrDomainFluxes();          // Extrapolate cell-centered fluxes to domain edges
   CdrPlasmaGodunovStepper::computeSigmaFlux();                // Update charge flux for sigma solver
+  this->deallocateStageScratch(ScratchStage::Boundary);       // The BCs now live in the solvers.
   m_timer->stopEvent("Gradients and BCs");
 
   // Run through the CDR solvers and update them as
@@ -1202,6 +1313,11 @@ CdrPlasmaGodunovStepper::advanceTransportExplicitField(const Real a_dt)
   // phi^(k+1) = phi^k - dt*div(F) + dt*div(
 
   m_timer->startEvent("Transport advance");
+  this->allocateStageScratch(ScratchStage::Transport);
+  if (m_fusedAdvection) {
+    this->advanceAdvectionFused(a_dt);
+  }
+
   for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
     const int idx = solverIt.index();
 
@@ -1213,8 +1329,8 @@ CdrPlasmaGodunovStepper::advanceTransportExplicitField(const Real a_dt)
     EBAMRCellData& scratch  = storage->getScratch();
     EBAMRCellData& scratch2 = storage->getScratch2();
 
-    // Do the advective advance.
-    if (solver->isMobile()) {
+    // Do the advective advance (unless it was done above for all species).
+    if (solver->isMobile() && !m_fusedAdvection) {
       switch (m_advectionSolver) {
       case AdvectionSolver::Euler: {
         // Advance is just phi^(k+1) = phi^k - dt*div(F)
@@ -1304,6 +1420,7 @@ CdrPlasmaGodunovStepper::advanceTransportExplicitField(const Real a_dt)
     m_amr->arithmeticAverage(phi, m_realm, m_cdr->getPhase());
     m_amr->interpGhost(phi, m_realm, m_cdr->getPhase());
   }
+  this->deallocateStageScratch(ScratchStage::Transport);
   m_timer->stopEvent("Transport advance");
 
   // Advance the sigma equation. This may seem weird but we've kept the flux through the EB constant during the transport step, so it
@@ -1382,8 +1499,7 @@ CdrPlasmaGodunovStepper::advanceTransportSemiImplicit(const Real a_dt)
   CdrPlasmaGodunovStepper::computeElectricFieldIntoScratch();
 
   // Recompute velocities and diffusion coefficient using the electric field after the semi-implicit field solve.
-  CdrPlasmaGodunovStepper::computeCdrDriftVelocities(m_time + a_dt);
-  CdrPlasmaGodunovStepper::computeCdrDiffusionCoefficients(m_time + a_dt);
+  CdrPlasmaGodunovStepper::computeCdrTransportCoefficients(m_time + a_dt);
   m_timer->stopEvent("Field and velocities");
 
   // Now call the Euler transport method -- it will know what to do.
@@ -1443,33 +1559,26 @@ CdrPlasmaGodunovStepper::advanceRadiativeTransfer(const Real a_dt)
 }
 
 void
-CdrPlasmaGodunovStepper::computeCdrDriftVelocities(const Real a_time)
+CdrPlasmaGodunovStepper::computeCdrTransportCoefficients(const Real a_time)
 {
-  CH_TIME("CdrPlasmaGodunovStepper::computeCdrDriftVelocities(Real)");
+  CH_TIME("CdrPlasmaGodunovStepper::computeCdrTransportCoefficients(Real)");
   if (m_verbosity > 5) {
-    pout() << "CdrPlasmaGodunovStepper::computeCdrDriftVelocities(Real)" << endl;
+    pout() << "CdrPlasmaGodunovStepper::computeCdrTransportCoefficients(Real)" << endl;
   }
 
   // TLDR: We call the parent method, but using the scratch storage that holds the electric field.
 
   Vector<EBAMRCellData*> velocities = m_cdr->getVelocities();
-  CdrPlasmaStepper::computeCdrDriftVelocities(velocities,
-                                              m_cdr->getPhis(),
-                                              m_fieldScratch->getElectricFieldCell(),
-                                              a_time);
-}
-
-void
-CdrPlasmaGodunovStepper::computeCdrDiffusionCoefficients(const Real a_time)
-{
-  CH_TIME("CdrPlasmaGodunovStepper::computeCdrDiffusionCoefficients(Real)");
-  if (m_verbosity > 5) {
-    pout() << "CdrPlasmaGodunovStepper::computeCdrDiffusionCoefficients(Real)" << endl;
-  }
-
-  // TLDR: We call the parent method, but using the scratch storage that holds the electric field.
-
-  CdrPlasmaStepper::computeCdrDiffusion(m_fieldScratch->getElectricFieldCell(), m_fieldScratch->getElectricFieldEB());
+  Vector<EBAMRFluxData*> dcoFace    = m_cdr->getFaceCenteredDiffusionCoefficient();
+  Vector<EBAMRIVData*>   dcoEB      = m_cdr->getEbCenteredDiffusionCoefficient();
+
+  CdrPlasmaStepper::computeCdrTransportCoefficients(velocities,
+                                                    dcoFace,
+                                                    dcoEB,
+                                                    m_cdr->getPhis(),
+                                                    m_fieldScratch->getElectricFieldCell(),
+                                                    m_fieldScratch->getElectricFieldEB(),
+                                                    a_time);
 }
 
 void
@@ -1519,6 +1628,62 @@ CdrPlasmaGodunovStepper::computeDt()
     pout() << "CdrPlasmaGodunovStepper::computeDt()" << endl;
   }
 
+  this->computeDtBegin();
+
+  return this->computeDtEnd();
+}
+
+void
+CdrPlasmaGodunovStepper::computeDtBegin()
+{
+  CH_TIME("CdrPlasmaGodunovStepper::computeDtBegin()");
+  if (m_verbosity > 5) {
+    pout() << "CdrPlasmaGodunovStepper::computeDtBegin()" << endl;
+  }
+
+  // TLDR: Compute the time step restrictions that the diffusion algorithm needs on this rank and start the reduction
+  //       over the ranks. The time step is selected in computeDtEnd. We store the diffusion algorithm so that a change
+  //       in the run-time options between the two calls does not mix up the restrictions.
+  m_dtDiffusionAlgorithm = m_diffusionAlgorithm;
+
+  m_advectionDt.resize(0);
+  m_diffusionDt.resize(0);
+  m_advectionDiffusionDt.resize(0);
+
+  const bool explicitDiffusion  = m_dtDiffusionAlgorithm == DiffusionAlgorithm::Explicit;
+  const bool automaticDiffusion = m_dtDiffusionAlgorithm == DiffusionAlgorithm::Automatic;
+
+  for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
+    const RefCountedPtr<CdrSolver>& solver = solverIt();
+
+    m_advectionDt.emplace_back(solver->computeAdvectionDt(true));
+    m_diffusionDt.emplace_back((explicitDiffusion || automaticDiffusion) ? solver->computeDiffusionDt(true)
+                                                                         : std::numeric_limits<Real>::max());
+    m_advectionDiffusionDt.emplace_back(automaticDiffusion ? solver->computeAdvectionDiffusionDt(true)
+                                                           : std::numeric_limits<Real>::max());
+  }
+
+  m_relaxationDt = this->computeRelaxationTime(true);
+
+  // Reduce all restrictions at once.
+  for (int idx = 0; idx < m_advectionDt.size(); idx++) {
+    m_dtReduction.min(m_advectionDt[idx]);
+    m_dtReduction.min(m_diffusionDt[idx]);
+    m_dtReduction.min(m_advectionDiffusionDt[idx]);
+  }
+  m_dtReduction.min(m_relaxationDt);
+
+  m_dtReduction.begin();
+}
+
+Real
+CdrPlasmaGodunovStepper::computeDtEnd()
+{
+  CH_TIME("CdrPlasmaGodunovStepper::computeDtEnd()");
+  if (m_verbosity > 5) {
+    pout() << "CdrPlasmaGodunovStepper::computeDtEnd()" << endl;
+  }
+
   // TLDR: This routine really depends on what algorithms we use:
   //
   //       Explicit or semi-implicit -> restrict by advection, diffusion, and relaxation time
@@ -1527,12 +1692,19 @@ CdrPlasmaGodunovStepper::computeDt()
   // Note that the semi-implicit scheme does not require restriction by the relaxation time, but users will take
   // care of that through the input script.
 
+  m_dtReduction.end();
+
   Real dt = std::numeric_limits<Real>::max();
 
   // First, figure out what the transport time step must be for explicit and explicit-implicit methods.
-  if (m_diffusionAlgorithm == DiffusionAlgorithm::Explicit) {
-    const Real advectionDt = m_cdr->computeAdvectionDt();
-    const Real diffusionDt = m_cdr->computeDiffusionDt();
+  if (m_dtDiffusionAlgorithm == DiffusionAlgorithm::Explicit) {
+    Real advectionDt = std::numeric_limits<Real>::max();
+    Real diffusionDt = std::numeric_limits<Real>::max();
+
+    for (int idx = 0; idx < m_advectionDt.size(); idx++) {
+      advectionDt = std::min(advectionDt, m_advectionDt[idx]);
+      diffusionDt = std::min(diffusionDt, m_diffusionDt[idx]);
+    }
 
     m_dtCFL = std::min(advectionDt, diffusionDt);
     dt      = m_cfl * m_dtCFL;
@@ -1549,8 +1721,12 @@ CdrPlasmaGodunovStepper::computeDt()
       m_useImplicitDiffusion[i] = false;
     }
   }
-  else if (m_diffusionAlgorithm == DiffusionAlgorithm::Implicit) {
-    m_dtCFL    = m_cdr->computeAdvectionDt();
+  else if (m_dtDiffusionAlgorithm == DiffusionAlgorithm::Implicit) {
+    m_dtCFL = std::numeric_limits<Real>::max();
+    for (const auto& advectionDt : m_advectionDt) {
+      m_dtCFL = std::min(m_dtCFL, advectionDt);
+    }
+
     m_timeCode = TimeCode::Advection;
 
     dt = m_cfl * m_dtCFL;
@@ -1560,31 +1736,18 @@ CdrPlasmaGodunovStepper::computeDt()
       m_useImplicitDiffusion[i] = true;
     }
   }
-  else if (m_diffusionAlgorithm == DiffusionAlgorithm::Automatic) {
+  else if (m_dtDiffusionAlgorithm == DiffusionAlgorithm::Automatic) {
 
     // When we run with auto-diffusion, we check which species can be done using explicit diffusion and which ones
     // that should use implicit diffusion (based on a user threshold).
+    std::vector<Real> solverDt(m_advectionDt.size(), std::numeric_limits<Real>::max());
 
-    // First. Store the various time step restrictions for the CDR solvers
-    std::vector<Real> solverDt;
-    std::vector<Real> advectionDt;
-    std::vector<Real> diffusionDt;
-    std::vector<Real> advectionDiffusionDt;
-
-    for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
-      solverDt.emplace_back(std::numeric_limits<Real>::max());
-
-      advectionDt.emplace_back(solverIt()->computeAdvectionDt());
-      diffusionDt.emplace_back(solverIt()->computeDiffusionDt());
-      advectionDiffusionDt.emplace_back(solverIt()->computeAdvectionDiffusionDt());
-    }
-
-    // Next, run through the CDR solvers and switch to implicit diffusion for the solvers that satisfy the threshold.
+    // Run through the CDR solvers and switch to implicit diffusion for the solvers that satisfy the threshold.
     for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
       const int idx = solverIt.index();
 
-      const Real dtA  = advectionDt[idx];
-      const Real dtAD = advectionDiffusionDt[idx];
+      const Real dtA  = m_advectionDt[idx];
+      const Real dtAD = m_advectionDiffusionDt[idx];
 
       // Check if this solver should use implicit or explicit diffusion.
       if (dtA / dtAD > m_implicitDiffusionThreshold) {
@@ -1610,7 +1773,7 @@ CdrPlasmaGodunovStepper::computeDt()
     for (auto solverIt = m_cdr->iterator(); solverIt.ok(); ++solverIt) {
       const int idx = solverIt.index();
 
-      const Real dtAD = advectionDiffusionDt[idx];
+      const Real dtAD = m_advectionDiffusionDt[idx];
 
       // Switch to explicit diffusion if we can.
       if (dtAD > minDt) {
@@ -1633,7 +1796,7 @@ CdrPlasmaGodunovStepper::computeDt()
   }
 
   // Next, limit by the relaxation time.
-  const Real dtRelax = m_relaxTime * this->computeRelaxationTime();
+  const Real dtRelax = m_relaxTime * m_relaxationDt;
   if (dtRelax < dt) {
     dt         = dtRelax;
     m_timeCode = TimeCode::RelaxationTime;
@@ -1651,9 +1814,46 @@ CdrPlasmaGodunovStepper::computeDt()
     m_timeCode = TimeCode::Hardcap;
   }
 
+  if (m_profile) {
+    this->printLevelAdvectionDt(dt);
+  }
+
   return dt;
 }
 
+void
+CdrPlasmaGodunovStepper::printLevelAdvectionDt(const Real a_dt) const
+{
+  CH_TIME("CdrPlasmaGodunovStepper::printLevelAdvectionDt(Real)");
+  if (m_verbosity > 5) {
+    pout() << "CdrPlasmaGodunovStepper::printLevelAdvectionDt(Real)" << endl;
+  }
+
+  const Vector<Real> levelDt = m_cdr->computeLevelAdvectionDt();
+  const Vector<int>& refRat  = m_amr->getRefinementRatios();
+
+  // With subcycling, level l would use the level-0 time step divided by the product of the refinement ratios below it. Each
+  // level's CFL restriction then restricts the level-0 time step by that factor.
+  Real subcycledDt = std::numeric_limits<Real>::max();
+  Real factor      = 1.0;
+
+  pout() << "CdrPlasmaGodunovStepper -- advective time step restrictions" << endl;
+
+  for (int lvl = 0; lvl < levelDt.size(); lvl++) {
+    const Real dt = m_cfl * levelDt[lvl];
+
+    subcycledDt = std::min(subcycledDt, factor * dt);
+
+    pout() << "\tLevel " << lvl << ": dt = " << dt << " (" << dt / a_dt << " x global dt)" << endl;
+
+    if (lvl < levelDt.size() - 1) {
+      factor *= refRat[lvl];
+    }
+  }
+
+  pout() << "\tSubcycled level-0 dt = " << subcycledDt << " (" << subcycledDt / a_dt << " x global dt)" << endl;
+}
+
 void
 CdrPlasmaGodunovStepper::floorMass(EBAMRCellData&                  a_data,
                                    const std::string               a_message,
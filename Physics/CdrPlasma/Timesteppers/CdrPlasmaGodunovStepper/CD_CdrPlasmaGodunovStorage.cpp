@@ -35,26 +35,10 @@ void
 CdrPlasmaGodunovStepper::CdrStorage::allocateStorage()
 {
 
-  // Allocate all storage.
+  // Only the general-purpose scratch data lives through the whole time step. The rest is allocated in allocateStage.
   constexpr int nComp = 1;
 
-  // Allocate EBAMRCellData data holders
   m_amr->allocate(m_scratch, m_realm, m_phase, nComp);
-  m_amr->allocate(m_scratch2, m_realm, m_phase, nComp);
-  m_amr->allocate(m_cellExtr, m_realm, m_phase, nComp);
-  m_amr->allocate(m_gradient, m_realm, m_phase, SpaceDim);
-
-  // Allocate EBAMRIVData data holders
-  m_amr->allocate(m_scratchIV1, m_realm, m_phase, nComp);
-  m_amr->allocate(m_scratchIV2, m_realm, m_phase, nComp);
-  m_amr->allocate(m_scratchIV3, m_realm, m_phase, nComp);
-  m_amr->allocate(m_scratchIV4, m_realm, m_phase, nComp);
-
-  // Allocate EBAMRIFData data holders
-  m_amr->allocate(m_scratchIF1, m_realm, m_phase, nComp);
-  m_amr->allocate(m_scratchIF2, m_realm, m_phase, nComp);
-  m_amr->allocate(m_scratchIF3, m_realm, m_phase, nComp);
-  m_amr->allocate(m_scratchIF4, m_realm, m_phase, nComp);
 }
 
 void
@@ -80,6 +64,84 @@ CdrPlasmaGodunovStepper::CdrStorage::deallocateStorage()
   m_amr->deallocate(m_scratchIF4);
 }
 
+void
+CdrPlasmaGodunovStepper::CdrStorage::allocateStage(const ScratchStage a_stage)
+{
+  constexpr int nComp = 1;
+
+  switch (a_stage) {
+  case ScratchStage::Boundary: {
+    m_amr->allocate(m_cellExtr, m_realm, m_phase, nComp);
+    m_amr->allocate(m_gradient, m_realm, m_phase, SpaceDim);
+
+    m_amr->allocate(m_scratchIV1, m_realm, m_phase, nComp);
+    m_amr->allocate(m_scratchIV2, m_realm, m_phase, nComp);
+    m_amr->allocate(m_scratchIV3, m_realm, m_phase, nComp);
+    m_amr->allocate(m_scratchIV4, m_realm, m_phase, nComp);
+
+    m_amr->allocate(m_scratchIF1, m_realm, m_phase, nComp);
+    m_amr->allocate(m_scratchIF2, m_realm, m_phase, nComp);
+    m_amr->allocate(m_scratchIF3, m_realm, m_phase, nComp);
+    m_amr->allocate(m_scratchIF4, m_realm, m_phase, nComp);
+
+    break;
+  }
+  case ScratchStage::Transport: {
+    m_amr->allocate(m_scratch2, m_realm, m_phase, nComp);
+
+    break;
+  }
+  case ScratchStage::Reactions: {
+    m_amr->allocate(m_gradient, m_realm, m_phase, SpaceDim);
+
+    break;
+  }
+  default: {
+    MayDay::Error("CdrPlasmaGodunovStepper::CdrStorage::allocateStage -- logic bust");
+
+    break;
+  }
+  }
+}
+
+void
+CdrPlasmaGodunovStepper::CdrStorage::deallocateStage(const ScratchStage a_stage)
+{
+  switch (a_stage) {
+  case ScratchStage::Boundary: {
+    m_amr->deallocate(m_cellExtr);
+    m_amr->deallocate(m_gradient);
+
+    m_amr->deallocate(m_scratchIV1);
+    m_amr->deallocate(m_scratchIV2);
+    m_amr->deallocate(m_scratchIV3);
+    m_amr->deallocate(m_scratchIV4);
+
+    m_amr->deallocate(m_scratchIF1);
+    m_amr->deallocate(m_scratchIF2);
+    m_amr->deallocate(m_scratchIF3);
+    m_amr->deallocate(m_scratchIF4);
+
+    break;
+  }
+  case ScratchStage::Transport: {
+    m_amr->deallocate(m_scratch2);
+
+    break;
+  }
+  case ScratchStage::Reactions: {
+    m_amr->deallocate(m_gradient);
+
+    break;
+  }
+  default: {
+    MayDay::Error("CdrPlasmaGodunovStepper::CdrStorage::deallocateStage -- logic bust");
+
+    break;
+  }
+  }
+}
+
 CdrPlasmaGodunovStepper::FieldStorage::FieldStorage(const RefCountedPtr<AmrMesh>& a_amr,
                                                     const std::string             a_realm,
                                                     const phase::which_phase      a_phase)
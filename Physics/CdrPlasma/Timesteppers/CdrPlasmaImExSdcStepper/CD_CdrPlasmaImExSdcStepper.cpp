@@ -192,6 +192,15 @@ CdrPlasmaImExSdcStepper::parseAdaptiveOptions()
   pp.get("print_report", m_printReport);
   pp.get("adaptive_dt", m_adaptiveDt);
 
+  m_freezeError = -1.0;
+  pp.query("freeze_error", m_freezeError);
+
+  m_speciesCorrections.resize(0);
+  if (pp.contains("species_corr_iter")) {
+    m_speciesCorrections.resize(pp.countval("species_corr_iter"));
+    pp.getarr("species_corr_iter", m_speciesCorrections, 0, m_speciesCorrections.size());
+  }
+
   m_minCorr = (!m_adaptiveDt) ? 0 : m_minCorr;
 }
 
@@ -577,11 +586,22 @@ CdrPlasmaImExSdcStepper::advance(const Real a_dt)
     num_corrections = 0;
     CdrPlasmaImExSdcStepper::setupSubintervals(m_time, actual_dt);
 
-    // First SDC sweep. No lagged slopes here.
+    // First SDC sweep. No lagged slopes here. All species are integrated.
+    m_frozenSpecies.assign(m_physics->getNumCdrSpecies(), false);
+    for (int i = 0; i < m_cdrError.size(); i++) {
+      m_cdrError[i] = 0.0;
+    }
+
     CdrPlasmaImExSdcStepper::integrate(actual_dt, m_time, false);
 
     // SDC correction sweeps. Need to take care of lagged terms.
     for (int icorr = 0; icorr < Max(m_k, m_minCorr); icorr++) {
+
+      // Nothing to do if all species have converged or used up their corrections.
+      if (CdrPlasmaImExSdcStepper::freezeSpecies(icorr)) {
+        break;
+      }
+
       num_corrections++;
 
       // Initialize error and reconcile integrands (i.e. make them quadrature-ready)
@@ -611,9 +631,7 @@ CdrPlasmaImExSdcStepper::advance(const Real a_dt)
           CdrPlasmaImExSdcStepper::restoreSolvers();
           CdrPlasmaImExSdcStepper::computeElectricFieldIntoScratch();
           CdrPlasmaImExSdcStepper::computeCdrGradients();
-          CdrPlasmaImExSdcStepper::computeCdrVelo(m_time);
-          CdrPlasmaStepper::computeCdrDiffusion(m_fieldScratch->getElectricFieldCell(),
-                                                m_fieldScratch->getElectricFieldEb());
+          CdrPlasmaImExSdcStepper::computeCdrTransportCoefficients(m_time);
         }
       }
     }
@@ -629,8 +647,7 @@ CdrPlasmaImExSdcStepper::advance(const Real a_dt)
 
   // Always recompute velocities and diffusion coefficients before the next time step. The Poisson and RTE equations
   // have been updated when we come in here.
-  CdrPlasmaImExSdcStepper::computeCdrVelo(m_time + actual_dt);
-  CdrPlasmaStepper::computeCdrDiffusion(m_fieldScratch->getElectricFieldCell(), m_fieldScratch->getElectricFieldEb());
+  CdrPlasmaImExSdcStepper::computeCdrTransportCoefficients(m_time + actual_dt);
 
   // Profile step
   if (m_printReport)
@@ -849,6 +866,11 @@ CdrPlasmaImExSdcStepper::integrateAdvectionReaction(const Real a_dt, const int a
     RefCountedPtr<CdrSolver>&  solver  = solver_it();
     RefCountedPtr<CdrStorage>& storage = getCdrStorage(solver_it);
 
+    // Frozen species keep the solution from the previous sweep.
+    if (m_frozenSpecies[solver_it.index()]) {
+      continue;
+    }
+
     // phi_(m+1) = phi_M
     EBAMRCellData&       phi_m1  = storage->getPhi()[a_m + 1];
     EBAMRCellData&       scratch = storage->getScratch();
@@ -956,6 +978,11 @@ CdrPlasmaImExSdcStepper::integrateAdvection(const Real a_dt, const int a_m, cons
     RefCountedPtr<CdrSolver>&  solver  = solver_it();
     RefCountedPtr<CdrStorage>& storage = getCdrStorage(solver_it);
 
+    // Frozen species keep the solution from the previous sweep.
+    if (m_frozenSpecies[solver_it.index()]) {
+      continue;
+    }
+
     EBAMRCellData& phi_m1  = storage->getPhi()[a_m + 1];
     EBAMRCellData& scratch = storage->getScratch();
     EBAMRCellData& phi_m   = storage->getPhi()[a_m];
@@ -1005,6 +1032,11 @@ CdrPlasmaImExSdcStepper::integrateDiffusion(const Real a_dt, const int a_m, cons
     RefCountedPtr<CdrSolver>&  solver  = solver_it();
     RefCountedPtr<CdrStorage>& storage = CdrPlasmaImExSdcStepper::getCdrStorage(solver_it);
 
+    // Frozen species keep the solution from the previous sweep.
+    if (m_frozenSpecies[solver_it.index()]) {
+      continue;
+    }
+
     if (solver->isDiffusive()) {
       EBAMRCellData&       phi_m1 = storage->getPhi()[a_m + 1]; // Advected solution. Possibly with lagged terms.
       const EBAMRCellData& phi_m  = storage->getPhi()[a_m];
@@ -1079,6 +1111,11 @@ CdrPlasmaImExSdcStepper::reconcileIntegrands()
     RefCountedPtr<CdrStorage>& storage = CdrPlasmaImExSdcStepper::getCdrStorage(solver_it);
     const int                  idx     = solver_it.index();
 
+    // Frozen species are not integrated in the next sweep, so we don't need their integrands.
+    if (m_frozenSpecies[idx]) {
+      continue;
+    }
+
     // This has not been computed yet. Do it.
     EBAMRCellData&       FAR_p = storage->getFAR()[m_p];
     EBAMRCellData&       phi_p = *cdr_densities_p[idx];
@@ -1139,8 +1176,8 @@ CdrPlasmaImExSdcStepper::initializeErrors()
     RefCountedPtr<CdrStorage>& storage = CdrPlasmaImExSdcStepper::getCdrStorage(solver_it);
     const int                  idx     = solver_it.index();
 
-    // These should be zero
-    if (idx == m_errorIdx || m_errorIdx < 0) {
+    // These should be zero. Frozen species keep their error from the previous sweep.
+    if ((idx == m_errorIdx || m_errorIdx < 0 || m_freezeError > 0.0) && !m_frozenSpecies[idx]) {
       EBAMRCellData&       error     = storage->getError();
       const EBAMRCellData& phi_final = storage->getPhi()[m_p];
 
@@ -1171,8 +1208,15 @@ CdrPlasmaImExSdcStepper::finalizeErrors()
     RefCountedPtr<CdrStorage>& storage = CdrPlasmaImExSdcStepper::getCdrStorage(solver_it);
     const int                  idx     = solver_it.index();
 
-    // Compute error
-    if (idx == m_errorIdx || m_errorIdx < 0) {
+    // Compute error. We need it for all species if we freeze species by their error.
+    const bool useError = idx == m_errorIdx || m_errorIdx < 0;
+
+    if (m_frozenSpecies[idx]) {
+      if (useError) {
+        m_maxError = Max(m_cdrError[idx], m_maxError);
+      }
+    }
+    else if (useError || m_freezeError > 0.0) {
       EBAMRCellData&       error = storage->getError();
       const EBAMRCellData& phi_p = storage->getPhi()[m_p];
       DataOps::incr(error, phi_p, 1.0);
@@ -1186,7 +1230,9 @@ CdrPlasmaImExSdcStepper::finalizeErrors()
       if (Lphi > 0.0) {
         m_cdrError[idx] = Lerr / Lphi;
 
-        m_maxError = Max(m_cdrError[idx], m_maxError);
+        if (useError) {
+          m_maxError = Max(m_cdrError[idx], m_maxError);
+        }
       }
 #if 0 // Debug
       if(procID() == 0){
@@ -1208,6 +1254,41 @@ CdrPlasmaImExSdcStepper::finalizeErrors()
   m_sigmaError = 0.0; // I don't think this is ever used...
 }
 
+bool
+CdrPlasmaImExSdcStepper::freezeSpecies(const int a_corr)
+{
+  CH_TIME("CdrPlasmaImExSdcStepper::freezeSpecies");
+  if (m_verbosity > 5) {
+    pout() << "CdrPlasmaImExSdcStepper::freezeSpecies" << endl;
+  }
+
+  const int numCdrSpecies = m_physics->getNumCdrSpecies();
+
+  if (m_speciesCorrections.size() > 0 && m_speciesCorrections.size() != numCdrSpecies) {
+    MayDay::Error("CdrPlasmaImExSdcStepper::freezeSpecies - 'species_corr_iter' must have one entry per CDR species");
+  }
+
+  bool allFrozen = true;
+
+  for (int idx = 0; idx < numCdrSpecies; idx++) {
+    const int maxCorr = (m_speciesCorrections.size() > 0) ? m_speciesCorrections[idx] : m_k;
+
+    // The errors are only available after the first correction in this step.
+    const bool converged = m_freezeError > 0.0 && a_corr > 0 && m_cdrError[idx] < m_freezeError;
+
+    m_frozenSpecies[idx] = m_frozenSpecies[idx] || a_corr >= maxCorr || converged;
+
+    allFrozen = allFrozen && m_frozenSpecies[idx];
+  }
+
+  // Need at least m_minCorr corrections for the adaptive time stepping.
+  if (a_corr < m_minCorr) {
+    allFrozen = false;
+  }
+
+  return allFrozen;
+}
+
 void
 CdrPlasmaImExSdcStepper::computeNewDt(bool& a_accept_step, const Real a_dt, const int a_num_corrections)
 {
@@ -1553,6 +1634,27 @@ CdrPlasmaImExSdcStepper::computeCdrVelo(const Vector<EBAMRCellData*>& a_phis, co
                                                      a_time);
 }
 
+void
+CdrPlasmaImExSdcStepper::computeCdrTransportCoefficients(const Real a_time)
+{
+  CH_TIME("CdrPlasmaImExSdcStepper::computeCdrTransportCoefficients(Real)");
+  if (m_verbosity > 5) {
+    pout() << "CdrPlasmaImExSdcStepper::computeCdrTransportCoefficients(Real)" << endl;
+  }
+
+  Vector<EBAMRCellData*> velocities = m_cdr->getVelocities();
+  Vector<EBAMRFluxData*> dcoFace    = m_cdr->getFaceCenteredDiffusionCoefficient();
+  Vector<EBAMRIVData*>   dcoEB      = m_cdr->getEbCenteredDiffusionCoefficient();
+
+  CdrPlasmaStepper::computeCdrTransportCoefficients(velocities,
+                                                    dcoFace,
+                                                    dcoEB,
+                                                    m_cdr->getPhis(),
+                                                    m_fieldScratch->getElectricFieldCell(),
+                                                    m_fieldScratch->getElectricFieldEb(),
+                                                    a_time);
+}
+
 void
 CdrPlasmaImExSdcStepper::computeCdrEbStates()
 {
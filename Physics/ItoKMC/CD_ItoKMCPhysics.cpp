@@ -22,6 +22,9 @@ thread_local bool                                            ItoKMCPhysics::m_ha
 thread_local KMCSolverType                                   ItoKMCPhysics::m_kmcSolver;
 thread_local KMCState                                        ItoKMCPhysics::m_kmcState;
 thread_local std::vector<std::shared_ptr<const KMCReaction>> ItoKMCPhysics::m_kmcReactionsThreadLocal;
+thread_local std::array<long long, 3>                        ItoKMCPhysics::m_algorithmHistogramThreadLocal;
+thread_local Real                                            ItoKMCPhysics::m_maxCriticalPropensityThreadLocal;
+thread_local std::vector<Real>                               ItoKMCPhysics::m_reactionRateTimeThreadLocal;
 
 Vector<std::string>
 ItoKMCPhysics::getPlotVariableNames() const noexcept
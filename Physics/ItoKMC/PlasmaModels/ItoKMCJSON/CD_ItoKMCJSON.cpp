@@ -19,8 +19,10 @@
 #include <CD_ItoKMCPhotonSpecies.H>
 #include <CD_Units.H>
 #include <CD_DataParser.H>
+#include <CD_DischargeIO.H>
 #include <CD_ParticleManagement.H>
 #include <CD_DataOps.H>
+#include <CD_Timer.H>
 #include <CD_NamespaceHeader.H>
 
 using namespace Physics::ItoKMC;
@@ -29,15 +31,18 @@ ItoKMCJSON::ItoKMCJSON()
 {
   CH_TIME("ItoKMCJSON::ItoKMCJSON");
 
-  m_verbose      = false;
-  m_previewRates = false;
-  m_className    = "ItoKMCJSON";
-  m_hasKMCSolver = false;
+  m_verbose            = false;
+  m_previewRates       = false;
+  m_className          = "ItoKMCJSON";
+  m_hasKMCSolver       = false;
+  m_tabulateRates      = false;
+  m_rateTableNumPoints = 1000;
 
   this->parseVerbose();
   this->parsePPC();
   this->parseDebug();
   this->parseAlgorithm();
+  this->parseRateTables();
   this->parseJSON();
 
   // Initialize the gas law and background species
@@ -62,6 +67,7 @@ ItoKMCJSON::ItoKMCJSON()
   this->initializeTownsendCoefficient("alpha");
   this->initializeTownsendCoefficient("eta");
   this->initializePlasmaReactions();
+  this->initializeRateTables();
   this->initializePhotoReactions();
   this->initializeSurfaceEmission("dielectric");
   this->initializeSurfaceEmission("electrode");
@@ -158,9 +164,8 @@ ItoKMCJSON::doesFileExist(const std::string a_filename) const noexcept
     pout() << m_className + "::doesFileExist" << endl;
   }
 
-  std::ifstream istream(a_filename);
-
-  return istream.good();
+  // The file is read on the master rank and cached on all ranks, so that the tables are parsed from memory.
+  return DataParser::cacheFile(a_filename);
 }
 
 bool
@@ -267,6 +272,28 @@ ItoKMCJSON::parseVerbose() noexcept
   pp.get("verbose", m_verbose);
 }
 
+void
+ItoKMCJSON::parseRateTables() noexcept
+{
+  CH_TIME("ItoKMCJSON::parseRateTables");
+  if (m_verbose) {
+    pout() << m_className + "::parseRateTables" << endl;
+  }
+
+  ParmParse pp(m_className.c_str());
+
+  int numPoints = (int)m_rateTableNumPoints;
+
+  pp.query("tabulate_rates", m_tabulateRates);
+  pp.query("rate_table_points", numPoints);
+
+  if (numPoints < 2) {
+    MayDay::Error("ItoKMCJSON::parseRateTables - 'rate_table_points' must be >= 2");
+  }
+
+  m_rateTableNumPoints = (size_t)numPoints;
+}
+
 void
 ItoKMCJSON::parseJSON()
 {
@@ -287,8 +314,8 @@ ItoKMCJSON::parseJSON()
     this->throwParserError(parseError.c_str());
   }
   else {
-    // Parse the JSON file.
-    std::ifstream f(m_jsonFile);
+    // Parse the JSON file. The file was read on the master rank and broadcast in doesFileExist.
+    const std::string f = DataParser::getFileContents(m_jsonFile);
 
     constexpr auto callback        = nullptr;
     constexpr auto allowExceptions = true;
@@ -1256,6 +1283,30 @@ ItoKMCJSON::initializeParticles()
           initialParticles.catenate(particles);
 #endif
         }
+        else if (whichField == "h5part") {
+          const nlohmann::json& jsonEntry = initField["h5part"];
+
+          if (!(jsonEntry.contains("file"))) {
+            this->throwParserError(baseError + "but 'h5part' does not contain 'file'");
+          }
+
+          const std::string f = this->trim(jsonEntry["file"].get<std::string>());
+
+          std::string weightVariable = "weight";
+          if (jsonEntry.contains("weight variable")) {
+            weightVariable = this->trim(jsonEntry["weight variable"].get<std::string>());
+          }
+
+          // Each rank reads its own slice of the file, so unlike 'list' we keep the particles on all ranks. The
+          // particles are sent to the ranks that own them when they are added to the solver.
+          List<GenericParticle<1, 0>> particles;
+
+          DischargeIO::readH5Part<1, 0>(particles, f, {weightVariable});
+
+          for (ListIterator<GenericParticle<1, 0>> lit(particles); lit.ok(); ++lit) {
+            initialParticles.add(PointParticle(lit().position(), lit().getReals()[0]));
+          }
+        }
         else {
           this->throwParserError(baseError + " but specification '" + whichField + "' is not supported");
         }
@@ -1813,10 +1864,20 @@ ItoKMCJSON::initializePlasmaReactions()
       const auto gradientCorrection = this->parsePlasmaReactionGradientCorrection(reactionJSON);
 
       m_kmcReactions.emplace_back(KMCReaction(plasmaReactants, plasmaProducts, photonProducts));
-      m_kmcReactionRates.emplace_back(reactionRates.first);
+      m_kmcReactionRates.emplace_back(std::get<0>(reactionRates));
       m_kmcReactionRatePlots.emplace_back(reactionPlot);
       m_kmcReactionGradientCorrections.emplace_back(gradientCorrection);
-      m_fluidRates.emplace_back(reactionRates.second);
+      m_fluidRates.emplace_back(std::get<1>(reactionRates));
+      m_kmcReactionRateFactors.emplace_back(std::get<2>(reactionRates));
+
+      // Keep the input table for reactions that are tabulated vs E/N. These are later resampled onto the shared rate table.
+      if (m_tabulateRates && this->trim(reactionJSON["type"].get<std::string>()) == "table vs E/N") {
+        m_kmcRateTableColumns.emplace_back((int)m_kmcReactionTables.size());
+        m_kmcReactionTables.emplace_back(this->parseTableEByN(reactionJSON, "rate/N"));
+      }
+      else {
+        m_kmcRateTableColumns.emplace_back(-1);
+      }
 
       // Store the list of reactants/products.
       m_plasmaReactionPlasmaReactants.emplace_back(plasmaReactants);
@@ -1827,6 +1888,52 @@ ItoKMCJSON::initializePlasmaReactions()
   }
 }
 
+void
+ItoKMCJSON::initializeRateTables()
+{
+  CH_TIME("ItoKMCJSON::initializeRateTables");
+  if (m_verbose) {
+    pout() << m_className + "::initializeRateTables" << endl;
+  }
+
+  m_rateTable.clear();
+
+  if (!m_tabulateRates || m_kmcReactionTables.size() == 0) {
+    m_tabulateRates = false;
+
+    return;
+  }
+
+  // Find an E/N range that spans all the input tables.
+  Real minEbyN = +std::numeric_limits<Real>::max();
+  Real maxEbyN = -std::numeric_limits<Real>::max();
+
+  for (const auto& table : m_kmcReactionTables) {
+    const auto& data = table.getStructuredData();
+
+    if (data.size() < 2) {
+      MayDay::Error("ItoKMCJSON::initializeRateTables - input table has too few points");
+    }
+
+    minEbyN = std::min(minEbyN, data.front()[0]);
+    maxEbyN = std::max(maxEbyN, data.back()[0]);
+  }
+
+  // Resample the tables onto the shared grid. Outside the range of an input table we use the table's own out-of-range strategy.
+  m_rateTableMinEbyN   = minEbyN;
+  m_rateTableDeltaEbyN = (maxEbyN - minEbyN) / (m_rateTableNumPoints - 1);
+
+  m_rateTable.resize(m_kmcReactionTables.size() * m_rateTableNumPoints);
+
+  for (size_t t = 0; t < m_kmcReactionTables.size(); t++) {
+    for (size_t j = 0; j < m_rateTableNumPoints; j++) {
+      const Real EbyN = m_rateTableMinEbyN + j * m_rateTableDeltaEbyN;
+
+      m_rateTable[t * m_rateTableNumPoints + j] = m_kmcReactionTables[t].interpolate<1>(EbyN);
+    }
+  }
+}
+
 void
 ItoKMCJSON::initializePhotoReactions()
 {
@@ -2362,8 +2469,9 @@ ItoKMCJSON::getReactionSpecies(std::list<size_t>&              a_backgroundReact
   }
 }
 
-std::pair<std::function<Real(const Real E, const Real V, const Real dx, const RealVect x, const Vector<Real>& phi)>,
-          std::function<Real(const Real E, const RealVect x)>>
+std::tuple<std::function<Real(const Real E, const Real V, const Real dx, const RealVect x, const Vector<Real>& phi)>,
+           std::function<Real(const Real E, const RealVect x)>,
+           std::function<Real(const Real E, const Real V, const Real dx, const RealVect x, const Vector<Real>& phi)>>
 ItoKMCJSON::parsePlasmaReactionRate(const nlohmann::json&    a_reactionJSON,
                                     const std::list<size_t>& a_backgroundReactants,
                                     const std::list<size_t>& a_plasmaReactants) const
@@ -2619,54 +2727,67 @@ ItoKMCJSON::parsePlasmaReactionRate(const nlohmann::json&    a_reactionJSON,
     this->throwParserError(baseError + " but 'type' specifier '" + type + "' is not supported");
   }
 
-  // Scale the reaction according to various input variables.
+  // Scale the reaction according to various input variables. These factors are kept separate from the base rate so that
+  // the base rate can be tabulated on its own.
+  FunctionEX rateModifier = [](const Real E, const RealVect x) -> Real {
+    return 1.0;
+  };
+
   if (a_reactionJSON.contains("scale")) {
     const Real scale = a_reactionJSON["scale"].get<Real>();
 
-    fluidRate = [fluidRate, scale](const Real E, const RealVect x) {
-      return fluidRate(E, x) * scale;
+    rateModifier = [rateModifier, scale](const Real E, const RealVect x) {
+      return rateModifier(E, x) * scale;
     };
   }
   if (a_reactionJSON.contains("efficiency")) {
     const Real efficiency = a_reactionJSON["efficiency"].get<Real>();
 
-    fluidRate = [fluidRate, efficiency](const Real E, const RealVect x) {
-      return fluidRate(E, x) * efficiency;
+    rateModifier = [rateModifier, efficiency](const Real E, const RealVect x) {
+      return rateModifier(E, x) * efficiency;
     };
   }
   if (a_reactionJSON.contains("efficiency vs E/N")) {
     const std::string file = a_reactionJSON["efficiency vs E/N"].get<std::string>();
 
+    if (!(this->doesFileExist(file))) {
+      this->throwParserError(baseError + " and got 'efficiency vs E/N' but file '" + file + "' does not exist");
+    }
+
     LookupTable1D<Real, 1> tabulatedEfficiency = DataParser::simpleFileReadASCII(file);
 
     tabulatedEfficiency.prepareTable(0, 500, LookupTable::Spacing::Uniform);
 
-    fluidRate = [fluidRate, tabulatedEfficiency, &N = this->m_gasNumberDensity](const Real E, const RealVect x) {
+    rateModifier = [rateModifier, tabulatedEfficiency, &N = this->m_gasNumberDensity](const Real E, const RealVect x) {
       const Real ETd = E / (N(x) * Units::Td);
 
       const Real eff = tabulatedEfficiency.interpolate<1>(ETd);
 
-      return eff * fluidRate(E, x);
+      return eff * rateModifier(E, x);
     };
   }
   if (a_reactionJSON.contains("efficiency vs E")) {
     const std::string file = a_reactionJSON["efficiency vs E"].get<std::string>();
 
+    if (!(this->doesFileExist(file))) {
+      this->throwParserError(baseError + " and got 'efficiency vs E' but file '" + file + "' does not exist");
+    }
+
     LookupTable1D<Real, 1> tabulatedEfficiency = DataParser::simpleFileReadASCII(file);
 
     tabulatedEfficiency.prepareTable(0, 500, LookupTable::Spacing::Uniform);
 
-    fluidRate = [fluidRate, tabulatedEfficiency](const Real E, const RealVect x) {
+    rateModifier = [rateModifier, tabulatedEfficiency](const Real E, const RealVect x) {
       const Real eff = tabulatedEfficiency.interpolate<1>(E);
 
-      return eff * fluidRate(E, x);
+      return eff * rateModifier(E, x);
     };
   }
   if (a_reactionJSON.contains("quenching pressure")) {
     const Real pq = a_reactionJSON["quenching pressure"].get<Real>();
 
-    fluidRate = [fluidRate, pq, &p = this->m_gasPressure](const Real E, const RealVect x) {
-      return fluidRate(E, x) * pq / (pq + p(x));
+    rateModifier = [rateModifier, pq, &p = this->m_gasPressure](const Real E, const RealVect x) {
+      return rateModifier(E, x) * pq / (pq + p(x));
     };
   }
   if (a_reactionJSON.contains("quenching rates")) {
@@ -2686,10 +2807,10 @@ ItoKMCJSON::parsePlasmaReactionRate(const nlohmann::json&    a_reactionJSON,
     const Real kp    = a_reactionJSON["quenching rates"]["kp"].get<Real>();
     const Real kqByN = a_reactionJSON["quenching rates"]["kq/N"].get<Real>();
 
-    fluidRate = [fluidRate, kr, kp, kqByN, &N = this->m_gasNumberDensity](const Real E, const RealVect x) -> Real {
+    rateModifier = [rateModifier, kr, kp, kqByN, &N = this->m_gasNumberDensity](const Real E, const RealVect x) -> Real {
       const Real kq = kqByN * N(x);
 
-      return fluidRate(E, x) * (kr / (kr + kp + kq));
+      return rateModifier(E, x) * (kr / (kr + kp + kq));
     };
   }
   if (a_reactionJSON.contains("ppc threshold")) {
@@ -2755,19 +2876,19 @@ ItoKMCJSON::parsePlasmaReactionRate(const nlohmann::json&    a_reactionJSON,
     }
   }
 
-  // This is the KMC rate -- note that it absorbs the background species.
-  FunctionEVXP kmcRate = [fluidRate,
-                          volumeFactor,
-                          propensityFactor,
-                          gridFactor,
-                          a_backgroundReactants,
-                          &S = this->m_backgroundSpecies,
-                          &N = this->m_gasNumberDensity](const Real          E,
-                                                         const Real          V,
-                                                         const Real          dx,
-                                                         const RealVect      x,
-                                                         const Vector<Real>& phi) -> Real {
-    Real k = fluidRate(E, x);
+  // This is the ratio between the KMC rate and the base rate -- note that it absorbs the background species.
+  FunctionEVXP kmcFactor = [rateModifier,
+                            volumeFactor,
+                            propensityFactor,
+                            gridFactor,
+                            a_backgroundReactants,
+                            &S = this->m_backgroundSpecies,
+                            &N = this->m_gasNumberDensity](const Real          E,
+                                                           const Real          V,
+                                                           const Real          dx,
+                                                           const RealVect      x,
+                                                           const Vector<Real>& phi) -> Real {
+    Real k = rateModifier(E, x);
 
     // Multiply by neutral densities
     for (const auto& idx : a_backgroundReactants) {
@@ -2790,7 +2911,21 @@ ItoKMCJSON::parsePlasmaReactionRate(const nlohmann::json&    a_reactionJSON,
     return k;
   };
 
-  return std::make_pair(kmcRate, fluidRate);
+  // This is the KMC rate.
+  FunctionEVXP kmcRate = [fluidRate, kmcFactor](const Real          E,
+                                                const Real          V,
+                                                const Real          dx,
+                                                const RealVect      x,
+                                                const Vector<Real>& phi) -> Real {
+    return fluidRate(E, x) * kmcFactor(E, V, dx, x, phi);
+  };
+
+  // This is the fluid rate, including the scaling factors.
+  fluidRate = [fluidRate, rateModifier](const Real E, const RealVect x) -> Real {
+    return fluidRate(E, x) * rateModifier(E, x);
+  };
+
+  return std::make_tuple(kmcRate, fluidRate, kmcFactor);
 }
 
 std::pair<bool, std::string>
@@ -3157,6 +3292,135 @@ ItoKMCJSON::updateReactionRates(std::vector<std::shared_ptr<const KMCReaction>>&
   }
 }
 
+void
+ItoKMCJSON::updateReactionRatesBatch(std::vector<Real>&           a_rates,
+                                     const std::vector<RealVect>& a_E,
+                                     const std::vector<RealVect>& a_pos,
+                                     const std::vector<Real>&     a_phi,
+                                     const std::vector<RealVect>& a_gradPhi,
+                                     const std::vector<Real>&     a_kappa,
+                                     const Real                   a_dx,
+                                     const size_t                 a_numCells) const noexcept
+{
+  CH_TIME("ItoKMCJSON::updateReactionRatesBatch");
+  if (m_verbose) {
+    pout() << m_className + "::updateReactionRatesBatch" << endl;
+  }
+
+  const size_t numReactions = m_kmcReactionRates.size();
+
+  CH_assert(a_rates.size() == numReactions * a_numCells);
+
+#ifndef NDEBUG
+  for (size_t c = 0; c < a_numCells; c++) {
+    this->checkMolarFraction(a_pos[c]);
+  }
+#endif
+
+  const Real V = std::pow(a_dx, SpaceDim);
+
+  // The rate functions take the densities in a cell as a Vector<Real>, so gather these once for the batch.
+  std::vector<Real>         E(a_numCells);
+  std::vector<Vector<Real>> phi(a_numCells, Vector<Real>(m_numPlasmaSpecies));
+
+  for (size_t c = 0; c < a_numCells; c++) {
+    E[c] = a_E[c].vectorLength();
+
+    for (int i = 0; i < m_numPlasmaSpecies; i++) {
+      phi[c][i] = a_phi[i * a_numCells + c];
+    }
+  }
+
+  // If we use the shared rate table, compute the table index and interpolation weight in each cell once. These are
+  // then reused by all the tabulated reactions.
+  std::vector<size_t> tableIndex;
+  std::vector<Real>   tableWeight;
+
+  if (m_tabulateRates) {
+    tableIndex.resize(a_numCells);
+    tableWeight.resize(a_numCells);
+
+    const Real maxPos = (Real)(m_rateTableNumPoints - 1);
+
+    for (size_t c = 0; c < a_numCells; c++) {
+      const Real EbyN = E[c] / (m_gasNumberDensity(a_pos[c]) * Units::Td);
+
+      Real pos = (EbyN - m_rateTableMinEbyN) / m_rateTableDeltaEbyN;
+
+      pos = std::max(pos, 0.0);
+      pos = std::min(pos, maxPos);
+
+      const size_t idx = std::min((size_t)pos, m_rateTableNumPoints - 2);
+
+      tableIndex[c]  = idx;
+      tableWeight[c] = pos - idx;
+    }
+  }
+
+  for (size_t r = 0; r < numReactions; r++) {
+    const Real startTime = m_profileReactions ? Timer::wallClock() : 0.0;
+
+    const FunctionEVXP& rateFunction = m_kmcReactionRates[r];
+
+    Real* rates = &a_rates[r * a_numCells];
+
+    // Update basic reaction rates.
+    const int column = m_tabulateRates ? m_kmcRateTableColumns[r] : -1;
+
+    if (column >= 0) {
+      const FunctionEVXP& rateFactor = m_kmcReactionRateFactors[r];
+
+      const Real* table = &m_rateTable[column * m_rateTableNumPoints];
+
+      for (size_t c = 0; c < a_numCells; c++) {
+        const size_t idx = tableIndex[c];
+        const Real   w   = tableWeight[c];
+
+        rates[c] = (1.0 - w) * table[idx] + w * table[idx + 1];
+      }
+
+      for (size_t c = 0; c < a_numCells; c++) {
+        rates[c] *= rateFactor(E[c], V, a_dx, a_pos[c], phi[c]);
+      }
+    }
+    else {
+      for (size_t c = 0; c < a_numCells; c++) {
+        rates[c] = rateFunction(E[c], V, a_dx, a_pos[c], phi[c]);
+      }
+    }
+
+    // Add gradient correction if the user has asked for it.
+    const std::pair<bool, std::string>& gradientCorrection = m_kmcReactionGradientCorrections[r];
+
+    if (std::get<0>(gradientCorrection)) {
+      const int idx = m_plasmaIndexMap.at(std::get<1>(gradientCorrection));
+
+      const FunctionEX& mobility  = m_mobilityFunctions[idx];
+      const FunctionEX& diffusion = m_diffusionCoefficients[idx];
+
+      constexpr Real safety = std::numeric_limits<Real>::epsilon();
+
+      for (size_t c = 0; c < a_numCells; c++) {
+        const Real     n  = phi[c][idx];
+        const Real     mu = mobility(E[c], a_pos[c]);
+        const Real     D  = diffusion(E[c], a_pos[c]);
+        const RealVect g  = a_gradPhi[idx * a_numCells + c];
+
+        Real fcorr = 1.0 + a_E[c].dotProduct(D * g) / (safety + n * mu * E[c] * E[c]);
+
+        fcorr = std::max(fcorr, 0.0);
+        fcorr = std::min(fcorr, 1.0);
+
+        rates[c] *= fcorr;
+      }
+    }
+
+    if (m_profileReactions) {
+      this->addReactionRateTime(r, Timer::wallClock() - startTime);
+    }
+  }
+}
+
 void
 ItoKMCJSON::secondaryEmissionEB(Vector<List<ItoParticle>>&       a_secondaryParticles,
                                 Vector<Real>&                    a_secondaryCDRFluxes,
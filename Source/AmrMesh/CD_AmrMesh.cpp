@@ -9,6 +9,10 @@
   @author Robert Marskar
 */
 
+// Std includes
+#include <algorithm>
+#include <limits>
+
 // Chombo includes
 #include <BRMeshRefine.H>
 #include <ParmParse.H>
@@ -21,6 +25,7 @@
 #include <CD_AmrMesh.H>
 #include <CD_MultifluidAlias.H>
 #include <CD_LoadBalancing.H>
+#include <CD_EBCellGraphFactory.H>
 #include <CD_Timer.H>
 #include <CD_Loads.H>
 #include <CD_DomainFluxIFFABFactory.H>
@@ -255,6 +260,9 @@ AmrMesh::allocate(EBAMRCellData&           a_data,
   }
 
   a_data.setRealm(a_realm);
+
+  this->firstTouch(a_data);
+  this->trackMemory(a_data, "EBAMRCellData");
 }
 
 void
@@ -285,6 +293,10 @@ AmrMesh::allocate(LevelData<EBCellFAB>&    a_data,
   const EBISLayout&        ebisl = m_realms[a_realm]->getEBISLayout(a_phase)[a_level];
 
   a_data.define(dbl, a_nComp, ghost * IntVect::Unit, EBCellFactory(ebisl));
+
+  if (m_firstTouch) {
+    DataOps::setValue(a_data, 0.0);
+  }
 }
 
 void
@@ -324,6 +336,9 @@ AmrMesh::allocate(EBAMRFluxData&           a_data,
   }
 
   a_data.setRealm(a_realm);
+
+  this->firstTouch(a_data);
+  this->trackMemory(a_data, "EBAMRFluxData");
 }
 
 void
@@ -376,6 +391,9 @@ AmrMesh::allocate(EBAMRIVData&             a_data,
   }
 
   a_data.setRealm(a_realm);
+
+  this->firstTouch(a_data);
+  this->trackMemory(a_data, "EBAMRIVData");
 }
 
 void
@@ -488,6 +506,9 @@ AmrMesh::allocate(MFAMRCellData& a_data, const std::string a_realm, const int a_
   }
 
   a_data.setRealm(a_realm);
+
+  this->firstTouch(a_data);
+  this->trackMemory(a_data, "MFAMRCellData");
 }
 
 void
@@ -578,6 +599,65 @@ AmrMesh::allocate(MFAMRIVData& a_data, const std::string a_realm, const int a_nC
   a_data.setRealm(a_realm);
 }
 
+void
+AmrMesh::allocateScratch(EBAMRCellScratch&        a_scratch,
+                         const std::string        a_realm,
+                         const phase::which_phase a_phase,
+                         const int                a_nComp,
+                         const int                a_nGhost) const
+{
+  CH_TIME("AmrMesh::allocateScratch(EBAMRCellScratch, string, phase::which_phase, int, int)");
+  if (m_verbosity > 5) {
+    pout() << "AmrMesh::allocateScratch(EBAMRCellScratch, string, phase::which_phase, int, int)" << endl;
+  }
+
+  this->borrowScratch(a_scratch, m_scratchCellData, a_realm, a_phase, a_nComp, a_nGhost);
+}
+
+void
+AmrMesh::allocateScratch(EBAMRFluxScratch&        a_scratch,
+                         const std::string        a_realm,
+                         const phase::which_phase a_phase,
+                         const int                a_nComp,
+                         const int                a_nGhost) const
+{
+  CH_TIME("AmrMesh::allocateScratch(EBAMRFluxScratch, string, phase::which_phase, int, int)");
+  if (m_verbosity > 5) {
+    pout() << "AmrMesh::allocateScratch(EBAMRFluxScratch, string, phase::which_phase, int, int)" << endl;
+  }
+
+  this->borrowScratch(a_scratch, m_scratchFluxData, a_realm, a_phase, a_nComp, a_nGhost);
+}
+
+void
+AmrMesh::allocateScratch(EBAMRIVScratch&          a_scratch,
+                         const std::string        a_realm,
+                         const phase::which_phase a_phase,
+                         const int                a_nComp,
+                         const int                a_nGhost) const
+{
+  CH_TIME("AmrMesh::allocateScratch(EBAMRIVScratch, string, phase::which_phase, int, int)");
+  if (m_verbosity > 5) {
+    pout() << "AmrMesh::allocateScratch(EBAMRIVScratch, string, phase::which_phase, int, int)" << endl;
+  }
+
+  this->borrowScratch(a_scratch, m_scratchIVData, a_realm, a_phase, a_nComp, a_nGhost);
+}
+
+void
+AmrMesh::clearScratch() const noexcept
+{
+  CH_TIME("AmrMesh::clearScratch()");
+  if (m_verbosity > 5) {
+    pout() << "AmrMesh::clearScratch()" << endl;
+  }
+
+  // Borrowed data is also owned by the handles so it is freed when the handles are released.
+  m_scratchCellData.clear();
+  m_scratchFluxData.clear();
+  m_scratchIVData.clear();
+}
+
 void
 AmrMesh::reallocate(EBAMRCellData& a_data, const phase::which_phase a_phase, const int a_lmin) const
 {
@@ -930,7 +1010,7 @@ AmrMesh::parseOptions()
   this->parseBrBufferSize();
   this->parseBrFillRatio();
   this->parseRedistributionRadius();
-  ;
+  this->parseFirstTouch();
   this->parseNumGhostCells();
   this->parseEbGhostCells();
   this->parseProbLoHiCorners();
@@ -958,6 +1038,7 @@ AmrMesh::parseRuntimeOptions()
   this->parseBrBufferSize();
   this->parseBrFillRatio();
   this->parseMultigridInterpolator();
+  this->parseFirstTouch();
 }
 
 void
@@ -1091,6 +1172,30 @@ AmrMesh::regridAmr(const Vector<IntVectSet>& a_tags, const int a_lmin, const int
   for (auto& r : m_realms) {
     r.second->regridBase(a_lmin);
   }
+
+  // Pooled scratch data is defined over the old grids.
+  this->clearScratch();
+}
+
+void
+AmrMesh::regridAmr(const Vector<Vector<Box>>& a_newBoxes, const int a_newFinestLevel, const int a_lmin)
+{
+  CH_TIME("AmrMesh::regridAmr(Vector<Vector<Box>>, int, int)");
+  if (m_verbosity > 1) {
+    pout() << "AmrMesh::regridAmr(Vector<Vector<Box>>, int, int)" << endl;
+  }
+
+  CH_assert(a_lmin >= 0);
+
+  this->defineGrids(a_newBoxes, a_newFinestLevel, a_lmin);
+  this->defineRealms();
+
+  for (auto& r : m_realms) {
+    r.second->regridBase(a_lmin);
+  }
+
+  // Pooled scratch data is defined over the old grids.
+  this->clearScratch();
 }
 
 void
@@ -1132,6 +1237,24 @@ AmrMesh::buildGrids(const Vector<IntVectSet>& a_tags, const int a_lmin, const in
     pout() << "AmrMesh::buildGrids" << endl;
   }
 
+  Vector<Vector<Box>> newBoxes;
+
+  const int newFinestLevel = this->makeGridBoxes(newBoxes, a_tags, a_lmin, a_hardcap);
+
+  this->defineGrids(newBoxes, newFinestLevel, a_lmin);
+}
+
+int
+AmrMesh::makeGridBoxes(Vector<Vector<Box>>&      a_newBoxes,
+                       const Vector<IntVectSet>& a_tags,
+                       const int                 a_lmin,
+                       const int                 a_hardcap) const
+{
+  CH_TIME("AmrMesh::makeGridBoxes");
+  if (m_verbosity > 2) {
+    pout() << "AmrMesh::makeGridBoxes" << endl;
+  }
+
   // TLDR: a_lmin is the coarsest level that changes and a_hardcap is a hardcap for the maximum grid level that can
   //       be generated. If a_hardcap < 0 the restriction is m_maxAmrDepth.
 
@@ -1141,8 +1264,12 @@ AmrMesh::buildGrids(const Vector<IntVectSet>& a_tags, const int a_lmin, const in
   const int topLevel  = (m_finestLevel == m_maxAmrDepth) ? m_finestLevel - 1 : a_tags.size() - 1;
 
   // New and old grid boxes
-  Vector<Vector<Box>> newBoxes(1 + topLevel);
-  Vector<Vector<Box>> oldBoxes(1 + topLevel);
+  Vector<Vector<Box>>& newBoxes = a_newBoxes;
+  Vector<Vector<Box>>  oldBoxes(1 + topLevel);
+
+  newBoxes.resize(1 + topLevel);
+
+  int finestLevel = 0;
 
   // Enforce potential hardcap.
   const int hardcap = (a_hardcap < 0) ? m_maxAmrDepth : a_hardcap;
@@ -1199,15 +1326,15 @@ AmrMesh::buildGrids(const Vector<IntVectSet>& a_tags, const int a_lmin, const in
     }
 
     // Identify the new finest grid level.
-    m_finestLevel = std::min(newFinestLevel, m_maxAmrDepth);       // Don't exceed m_maxAmrDepth
-    m_finestLevel = std::min(m_finestLevel, m_maxSimulationDepth); // Don't exceed maximum simulation depth
-    m_finestLevel = std::min(m_finestLevel, hardcap);              // Don't exceed hardcap
+    finestLevel = std::min(newFinestLevel, m_maxAmrDepth);     // Don't exceed m_maxAmrDepth
+    finestLevel = std::min(finestLevel, m_maxSimulationDepth); // Don't exceed maximum simulation depth
+    finestLevel = std::min(finestLevel, hardcap);              // Don't exceed hardcap
   }
   else { // Only end up here if we have a single grid level, i.e. just single-level grid decomposition.
     newBoxes.resize(1);
     domainSplit(m_domains[0], newBoxes[0], m_maxBoxSize, m_blockingFactor);
 
-    m_finestLevel = 0;
+    finestLevel = 0;
   }
 
   // Coarsest level also changes in this case, but that's not actually caught by the regridders. We have to do this because the blocking
@@ -1216,6 +1343,68 @@ AmrMesh::buildGrids(const Vector<IntVectSet>& a_tags, const int a_lmin, const in
     domainSplit(m_domains[0], newBoxes[0], m_maxBoxSize, m_blockingFactor);
   }
 
+  return finestLevel;
+}
+
+int
+AmrMesh::getCoarsestChangedLevel(const Vector<Vector<Box>>& a_newBoxes,
+                                 const int                  a_newFinestLevel,
+                                 const int                  a_lmin) const
+{
+  CH_TIME("AmrMesh::getCoarsestChangedLevel");
+  if (m_verbosity > 2) {
+    pout() << "AmrMesh::getCoarsestChangedLevel" << endl;
+  }
+
+  if (!m_hasGrids) {
+    return a_lmin;
+  }
+
+  // Box order is set by the load balancing, so compare sorted copies.
+  for (int lvl = a_lmin; lvl <= std::max(a_newFinestLevel, m_finestLevel); lvl++) {
+    if (lvl > a_newFinestLevel || lvl > m_finestLevel) {
+      return lvl;
+    }
+
+    const Vector<Box> oldLevelBoxes = m_grids[lvl].boxArray();
+
+    if (a_newBoxes[lvl].size() != oldLevelBoxes.size()) {
+      return lvl;
+    }
+
+    std::vector<Box> newBoxes;
+    std::vector<Box> oldBoxes;
+
+    for (int ibox = 0; ibox < oldLevelBoxes.size(); ibox++) {
+      newBoxes.emplace_back(a_newBoxes[lvl][ibox]);
+      oldBoxes.emplace_back(oldLevelBoxes[ibox]);
+    }
+
+    std::sort(newBoxes.begin(), newBoxes.end());
+    std::sort(oldBoxes.begin(), oldBoxes.end());
+
+    if (newBoxes != oldBoxes) {
+      return lvl;
+    }
+  }
+
+  return -1;
+}
+
+void
+AmrMesh::defineGrids(const Vector<Vector<Box>>& a_newBoxes, const int a_newFinestLevel, const int a_lmin)
+{
+  CH_TIME("AmrMesh::defineGrids");
+  if (m_verbosity > 2) {
+    pout() << "AmrMesh::defineGrids" << endl;
+  }
+
+  CH_assert(a_newBoxes.size() >= 1 + a_newFinestLevel);
+
+  Vector<Vector<Box>> newBoxes = a_newBoxes;
+
+  m_finestLevel = a_newFinestLevel;
+
   // Sort the boxes and then load balance them, using the patch volume as a proxy for the computational load.
   Vector<Vector<int>> processorIDs(1 + m_finestLevel);
 
@@ -1236,8 +1425,66 @@ AmrMesh::buildGrids(const Vector<IntVectSet>& a_tags, const int a_lmin, const in
       boxLoads[ibox] = levelBoxes[ibox].numPts();
     }
 
-    // Load balance this grid -- assign grid subsets to the least loaded rank.
-    LoadBalancing::makeBalance(processorIDs[lvl], rankLoads, boxLoads, newBoxes[lvl]);
+    // Load balance this grid -- assign grid subsets to the least loaded rank. With incremental load balancing we start
+    // from the old box-to-rank mapping instead, in order to limit data migration.
+    const bool incrementalBalance = m_incrementalBalance >= 0.0 && m_hasGrids && lvl < (int)m_grids.size();
+
+    if (incrementalBalance) {
+      const Vector<Box> oldLevelBoxes = m_grids[lvl].boxArray();
+      const Vector<int> oldLevelRanks = m_grids[lvl].procIDs();
+
+      LoadBalancing::makeIncrementalBalance(processorIDs[lvl],
+                                            rankLoads,
+                                            boxLoads,
+                                            newBoxes[lvl],
+                                            oldLevelBoxes,
+                                            oldLevelRanks,
+                                            m_incrementalBalance);
+
+      if (lvl >= a_lmin) {
+        const long long numCells = LoadBalancing::migratedCells(newBoxes[lvl],
+                                                                processorIDs[lvl],
+                                                                oldLevelBoxes,
+                                                                oldLevelRanks);
+
+        pout() << "AmrMesh::defineGrids -- level = " << lvl << ", migrated cells = " << numCells << " ("
+               << numCells * sizeof(Real) << " bytes per component)" << endl;
+      }
+    }
+    else if (m_nodeBalance) {
+      LoadBalancing::makeNodeBalance(processorIDs[lvl], rankLoads, boxLoads, newBoxes[lvl]);
+    }
+    else {
+      LoadBalancing::makeBalance(processorIDs[lvl], rankLoads, boxLoads, newBoxes[lvl]);
+    }
+
+    if (m_boxSortReport) {
+      const std::vector<Real> surfToVol = LoadBalancing::surfaceToVolume(newBoxes[lvl], processorIDs[lvl]);
+
+      Real minRatio = std::numeric_limits<Real>::max();
+      Real maxRatio = 0.0;
+      Real avgRatio = 0.0;
+      int  numRanks = 0;
+
+      for (const auto& r : surfToVol) {
+        if (r > 0.0) {
+          minRatio = std::min(minRatio, r);
+          maxRatio = std::max(maxRatio, r);
+          avgRatio += r;
+          numRanks++;
+        }
+      }
+
+      if (numRanks > 0) {
+        avgRatio /= numRanks;
+      }
+      else {
+        minRatio = 0.0;
+      }
+
+      pout() << "AmrMesh::defineGrids -- level = " << lvl << ", surface-to-volume per rank (min/avg/max) = " << minRatio
+             << "/" << avgRatio << "/" << maxRatio << endl;
+    }
   }
 
   // Now we define the grids. If a_lmin=0 every grid is new, otherwise keep old grids up to but not including a_lmin
@@ -1341,8 +1588,7 @@ AmrMesh::computeGradient(EBAMRCellData&           a_gradient,
     pout() << "AmrMesh::computeGradient(EBAMRCellData, EBAMRCellData, string, phase::which_phase)" << endl;
   }
 
-  CH_assert(a_gradient[0]->nComp() == SpaceDim);
-  CH_assert(a_phi[0]->nComp() == 1);
+  CH_assert(a_gradient[0]->nComp() == SpaceDim * a_phi[0]->nComp());
 
   for (int lvl = 0; lvl <= m_finestLevel; lvl++) {
 
@@ -2179,6 +2425,131 @@ AmrMesh::interpToNewGrids(EBAMRCellData&                   a_newData,
   }
 }
 
+void
+AmrMesh::interpToNewGrids(const Vector<EBAMRCellData*>&    a_newData,
+                          const Vector<EBAMRCellData*>&    a_oldData,
+                          const phase::which_phase         a_phase,
+                          const int                        a_lmin,
+                          const int                        a_oldFinestLevel,
+                          const int                        a_newFinestLevel,
+                          const EBCoarseToFineInterp::Type a_type)
+{
+  CH_TIME("AmrMesh::interpToNewGrids(Vector<EBAMRCellData*>)");
+  if (m_verbosity > 3) {
+    pout() << "AmrMesh::interpToNewGrids(Vector<EBAMRCellData*>)" << endl;
+  }
+
+  CH_assert(a_newData.size() == a_oldData.size());
+
+  const int numFields = a_newData.size();
+
+  // Check if we can use aggregated copies. This requires that all fields live on the same realm and that the old and new
+  // data have the same number of ghost cells.
+  bool aggregate = numFields > 1;
+  for (int i = 0; i < numFields && aggregate; i++) {
+    CH_assert(a_newData[i]->getRealm() == a_oldData[i]->getRealm());
+    CH_assert((*a_newData[i])[0]->nComp() == (*a_oldData[i])[0]->nComp());
+
+    aggregate = aggregate && a_newData[i]->getRealm() == a_newData[0]->getRealm();
+    aggregate = aggregate && (*a_newData[i])[0]->ghostVect() == (*a_newData[0])[0]->ghostVect();
+    aggregate = aggregate && (*a_oldData[i])[0]->ghostVect() == (*a_newData[0])[0]->ghostVect();
+  }
+
+  if (!aggregate) {
+    for (int i = 0; i < numFields; i++) {
+      this->interpToNewGrids(*a_newData[i], *a_oldData[i], a_phase, a_lmin, a_oldFinestLevel, a_newFinestLevel, a_type);
+    }
+
+    return;
+  }
+
+  const std::string realm = a_newData[0]->getRealm();
+  const IntVect     ghost = (*a_newData[0])[0]->ghostVect();
+
+  // Component ranges for each field in the aggregated data.
+  Vector<Interval> fieldIntervals(numFields);
+  Vector<Interval> aggregateIntervals(numFields);
+
+  int numComp = 0;
+  for (int i = 0; i < numFields; i++) {
+    const int nComp = (*a_newData[i])[0]->nComp();
+
+    fieldIntervals[i]     = Interval(0, nComp - 1);
+    aggregateIntervals[i] = Interval(numComp, numComp + nComp - 1);
+
+    numComp += nComp;
+  }
+
+  // Copy between a field and the aggregated data, including ghost cells.
+  auto localCopy = [](LevelData<EBCellFAB>&       a_dst,
+                      const Interval&             a_dstInterv,
+                      const LevelData<EBCellFAB>& a_src,
+                      const Interval&             a_srcInterv) -> void {
+    const DataIterator& dit = a_dst.dataIterator();
+
+    const int nbox = dit.size();
+#pragma omp parallel for schedule(runtime)
+    for (int mybox = 0; mybox < nbox; mybox++) {
+      const DataIndex& din    = dit[mybox];
+      const Box        region = a_dst[din].box();
+
+      a_dst[din].copy(region, a_dstInterv, region, a_src[din], a_srcInterv);
+    }
+  };
+
+  for (int lvl = 0; lvl <= a_newFinestLevel; lvl++) {
+    const bool interpolate = lvl >= std::max(1, a_lmin);
+    const bool copyOldData = lvl <= std::max(0, a_lmin - 1) || lvl <= std::min(a_oldFinestLevel, a_newFinestLevel);
+
+    // Interpolate all fields from the coarse level. There could be parts of the new grid that overlapped with the old
+    // grid (on level lvl) and that data is overwritten by the copy below.
+    if (interpolate) {
+      RefCountedPtr<EBCoarseToFineInterp>& interpolator = this->getFineInterp(realm, a_phase)[lvl];
+
+      for (int i = 0; i < numFields; i++) {
+        interpolator->interpolate(*(*a_newData[i])[lvl], *(*a_newData[i])[lvl - 1], fieldIntervals[i], a_type);
+      }
+    }
+
+    if (copyOldData) {
+      const LevelData<EBCellFAB>& oldFirst = *(*a_oldData[0])[lvl];
+      const LevelData<EBCellFAB>& newFirst = *(*a_newData[0])[lvl];
+      const EBISLayout&           ebisl    = this->getEBISLayout(realm, a_phase)[lvl];
+
+      // Aggregate the fields on the old and new grids. The old grids no longer have an EBISLayout, so we use the EB
+      // graphs of the old data.
+      LevelData<EBCellFAB> oldAggregate(oldFirst.disjointBoxLayout(), numComp, ghost, EBCellGraphFactory(oldFirst));
+      LevelData<EBCellFAB> newAggregate(newFirst.disjointBoxLayout(), numComp, ghost, EBCellFactory(ebisl));
+
+      for (int i = 0; i < numFields; i++) {
+        localCopy(oldAggregate, aggregateIntervals[i], *(*a_oldData[i])[lvl], fieldIntervals[i]);
+        localCopy(newAggregate, aggregateIntervals[i], *(*a_newData[i])[lvl], fieldIntervals[i]);
+      }
+
+      // Single copy with all components.
+      const Interval allComps(0, numComp - 1);
+
+      if (m_hasRegridCopiers && ghost == m_numGhostCells * IntVect::Unit) {
+        Copier copier(m_oldToNewCellCopiers.at(realm)[lvl]);
+
+        CH_assert(copier.isDefined());
+
+        oldAggregate.copyTo(allComps, newAggregate, allComps, copier);
+      }
+      else {
+        pout() << "AmrMesh::interpToNewGrids - using on-the-fly copier (performance hit expected)" << endl;
+        Copier copier(oldAggregate.disjointBoxLayout(), newAggregate.disjointBoxLayout(), ghost);
+
+        oldAggregate.copyTo(allComps, newAggregate, allComps, copier);
+      }
+
+      for (int i = 0; i < numFields; i++) {
+        localCopy(*(*a_newData[i])[lvl], fieldIntervals[i], newAggregate, aggregateIntervals[i]);
+      }
+    }
+  }
+}
+
 void
 AmrMesh::interpToNewGrids(EBAMRIVData&                     a_newData,
                           const EBAMRIVData&               a_oldData,
@@ -2437,6 +2808,25 @@ AmrMesh::setCoarsestGrid(const IntVect& a_nCells)
   m_numCells = a_nCells;
 }
 
+void
+AmrMesh::setGridParameters(const int a_maxBoxSize, const int a_blockingFactor)
+{
+  CH_TIME("AmrMesh::setGridParameters(int, int)");
+  if (m_verbosity > 3) {
+    pout() << "AmrMesh::setGridParameters(int, int)" << endl;
+  }
+
+  if (a_blockingFactor < 4 || a_blockingFactor % 2 != 0) {
+    MayDay::Error("AmrMesh::setGridParameters - must have blocking factor >= 4 and divisible by 2");
+  }
+  if (a_maxBoxSize < a_blockingFactor || a_maxBoxSize % a_blockingFactor != 0) {
+    MayDay::Error("AmrMesh::setGridParameters - max box size must be a multiple of the blocking factor");
+  }
+
+  m_maxBoxSize     = a_maxBoxSize;
+  m_blockingFactor = a_blockingFactor;
+}
+
 void
 AmrMesh::parseVerbosity()
 {
@@ -2582,7 +2972,12 @@ AmrMesh::setGrids(const Vector<Vector<Box>>&                             a_boxes
     rankLoads.resetLoads();
 
     for (int lvl = 0; lvl <= m_finestLevel; lvl++) {
-      LoadBalancing::makeBalance(processorIDs[lvl], rankLoads, curLoads[lvl], a_boxes[lvl]);
+      if (m_nodeBalance) {
+        LoadBalancing::makeNodeBalance(processorIDs[lvl], rankLoads, curLoads[lvl], a_boxes[lvl]);
+      }
+      else {
+        LoadBalancing::makeBalance(processorIDs[lvl], rankLoads, curLoads[lvl], a_boxes[lvl]);
+      }
     }
 
     this->regridRealm(curRealm, processorIDs, a_boxes, lmin);
@@ -2591,6 +2986,33 @@ AmrMesh::setGrids(const Vector<Vector<Box>>&                             a_boxes
   // Set the proxy grids, too.
   m_grids    = m_realms[Realm::Primal]->getGrids();
   m_hasGrids = true;
+
+  this->clearScratch();
+}
+
+void
+AmrMesh::setGrids(const Vector<Vector<Box>>& a_boxes, const std::map<std::string, Vector<Vector<int>>>& a_realmsAndRanks)
+{
+  CH_TIME("AmrMesh::setGrids(Vector<Vector<Box> >, std::map<string, Vector<Vector<int> >)");
+  if (m_verbosity > 3) {
+    pout() << "AmrMesh::setGrids(Vector<Vector<Box> >, std::map<string, Vector<Vector<int> >)" << endl;
+  }
+
+  const int lmin = 0;
+
+  for (const auto& r : a_realmsAndRanks) {
+    for (int lvl = 0; lvl <= m_finestLevel; lvl++) {
+      CH_assert(r.second[lvl].size() == a_boxes[lvl].size());
+    }
+
+    this->regridRealm(r.first, r.second, a_boxes, lmin);
+  }
+
+  // Set the proxy grids, too.
+  m_grids    = m_realms[Realm::Primal]->getGrids();
+  m_hasGrids = true;
+
+  this->clearScratch();
 }
 
 void
@@ -2684,9 +3106,20 @@ AmrMesh::parseGridGeneration()
   else if (str == "morton") {
     m_boxSort = BoxSorting::Morton;
   }
+  else if (str == "hilbert") {
+    m_boxSort = BoxSorting::Hilbert;
+  }
   else {
     MayDay::Abort("AmrMesh::parseGridGeneration - unknown box sorting method requested");
   }
+
+  m_boxSortReport      = false;
+  m_nodeBalance        = false;
+  m_incrementalBalance = -1.0;
+
+  pp.query("box_sorting_report", m_boxSortReport);
+  pp.query("node_balance", m_nodeBalance);
+  pp.query("incremental_lb", m_incrementalBalance);
 }
 
 void
@@ -2779,6 +3212,21 @@ AmrMesh::parseRedistributionRadius()
     MayDay::Error("AmrMesh::parseRedistributionRadius -- you have specified non-positive redistribution radius");
 }
 
+void
+AmrMesh::parseFirstTouch()
+{
+  CH_TIME("AmrMesh::parseFirstTouch()");
+  if (m_verbosity > 3) {
+    pout() << "AmrMesh::parseFirstTouch()" << endl;
+  }
+
+  ParmParse pp("AmrMesh");
+
+  m_firstTouch = false;
+
+  pp.query("first_touch", m_firstTouch);
+}
+
 void
 AmrMesh::parseCellCentroidInterpolation()
 {
@@ -3170,6 +3618,23 @@ AmrMesh::getVofIterator(const std::string a_realm, const phase::which_phase a_ph
   return m_realms[a_realm]->getVofIterator(a_phase);
 }
 
+const Vector<Vector<DataIndex>>&
+AmrMesh::getCutCellPatches(const std::string a_realm, const phase::which_phase a_phase) const
+{
+  CH_TIME("AmrMesh::getCutCellPatches(string, phase::which_phase)");
+  if (m_verbosity > 1) {
+    pout() << "AmrMesh::getCutCellPatches(string, phase::which_phase)" << endl;
+  }
+
+  if (!this->queryRealm(a_realm)) {
+    const std::string str = "AmrMesh::getCutCellPatches(string, phase::which_phase) - could not find realm '" +
+                            a_realm + "'";
+    MayDay::Abort(str.c_str());
+  }
+
+  return m_realms[a_realm]->getCutCellPatches(a_phase);
+}
+
 const AMRMask&
 AmrMesh::getMask(const std::string a_mask, const int a_buffer, const std::string a_realm) const
 {
@@ -3218,6 +3683,22 @@ AmrMesh::getLevelTiles(const std::string a_realm) const
   return m_realms[a_realm]->getLevelTiles();
 }
 
+const RefCountedPtr<MultigridLevelCache>&
+AmrMesh::getMultigridLevelCache(const std::string a_realm) const
+{
+  CH_TIME("AmrMesh::getMultigridLevelCache(string)");
+  if (m_verbosity > 1) {
+    pout() << "AmrMesh::getMultigridLevelCache(string)" << endl;
+  }
+
+  if (!this->queryRealm(a_realm)) {
+    const std::string str = "AmrMesh::getMultigridLevelCache(string) - could not find realm '" + a_realm + "'";
+    MayDay::Abort(str.c_str());
+  }
+
+  return m_realms[a_realm]->getMultigridLevelCache();
+}
+
 const Vector<RefCountedPtr<EBLevelGrid>>&
 AmrMesh::getEBLevelGrid(const std::string a_realm, const phase::which_phase a_phase) const
 {
@@ -3285,6 +3766,23 @@ AmrMesh::getLevelset(const std::string a_realm, const phase::which_phase a_phase
   return m_realms[a_realm]->getLevelset(a_phase);
 }
 
+const Vector<RefCountedPtr<LayoutData<CoveredMask>>>&
+AmrMesh::getCoveredMask(const std::string a_realm, const phase::which_phase a_phase) const
+{
+  CH_TIME("AmrMesh::getCoveredMask(string, phase::which_phase)");
+  if (m_verbosity > 1) {
+    pout() << "AmrMesh::getCoveredMask(string, phase::which_phase)" << endl;
+  }
+
+  if (!this->queryRealm(a_realm)) {
+    const std::string str = "AmrMesh::getCoveredMask(string, phase::which_phase) - could not find realm '" + a_realm +
+                            "'";
+    MayDay::Abort(str.c_str());
+  }
+
+  return m_realms[a_realm]->getCoveredMask(a_phase);
+}
+
 EBAMRParticleMesh&
 AmrMesh::getParticleMesh(const std::string a_realm, const phase::which_phase a_phase) const
 {
@@ -3443,6 +3941,81 @@ AmrMesh::nonConservativeDivergence(LevelData<BaseIVFAB<Real>>& a_nonConsDivF,
   nonConsDiv->nonConservativeDivergence(a_nonConsDivF, a_kappaDivF);
 }
 
+void
+AmrMesh::hybridDivergence(LevelData<EBCellFAB>&       a_divF,
+                          LevelData<BaseIVFAB<Real>>& a_massDifference,
+                          LevelData<BaseIVFAB<Real>>& a_nonConsDivF,
+                          const int&                  a_level,
+                          const std::string&          a_realm,
+                          const phase::which_phase&   a_phase) const noexcept
+{
+  CH_TIME("AmrMesh::hybridDivergence(level)");
+  if (m_verbosity > 1) {
+    pout() << "AmrMesh::hybridDivergence(level)" << endl;
+  }
+
+  const auto& nonConsDiv = m_realms[a_realm]->getNonConservativeDivergence(a_phase)[a_level];
+
+  nonConsDiv->hybridDivergence(a_divF, a_massDifference, a_nonConsDivF);
+}
+
+void
+AmrMesh::redistribute(EBAMRCellData&            a_phi,
+                      const EBAMRIVData&        a_deltaM,
+                      const std::string&        a_realm,
+                      const phase::which_phase& a_phase) const noexcept
+{
+  CH_TIME("AmrMesh::redistribute(EBAMRCellData, EBAMRIVData, string, phase)");
+  if (m_verbosity > 5) {
+    pout() << "AmrMesh::redistribute(EBAMRCellData, EBAMRIVData, string, phase)" << endl;
+  }
+
+  CH_assert(a_phi[0]->nComp() == a_deltaM[0]->nComp());
+
+  this->redistribute(a_phi, a_deltaM, a_realm, a_phase, a_phi[0]->interval());
+}
+
+void
+AmrMesh::redistribute(EBAMRCellData&            a_phi,
+                      const EBAMRIVData&        a_deltaM,
+                      const std::string&        a_realm,
+                      const phase::which_phase& a_phase,
+                      const Interval&           a_variables) const noexcept
+{
+  CH_TIME("AmrMesh::redistribute(EBAMRCellData, EBAMRIVData, string, phase, Interval)");
+  if (m_verbosity > 5) {
+    pout() << "AmrMesh::redistribute(EBAMRCellData, EBAMRIVData, string, phase, Interval)" << endl;
+  }
+
+  if (!(this->queryRealm(a_realm))) {
+    const std::string str = "AmrMesh::redistribute - could not find realm '" + a_realm + "'";
+
+    MayDay::Abort(str.c_str());
+  }
+
+  CH_assert(a_phi.getRealm() == a_realm);
+  CH_assert(a_deltaM.getRealm() == a_realm);
+
+  const Vector<RefCountedPtr<EBFluxRedistribution>>& redistOps = m_realms[a_realm]->getRedistributionOp(a_phase);
+
+  const Real scale = 1.0;
+
+  for (int lvl = 0; lvl <= m_finestLevel; lvl++) {
+    const bool hasCoar = lvl > 0;
+    const bool hasFine = lvl < m_finestLevel;
+
+    if (hasCoar) {
+      redistOps[lvl]->redistributeCoar(*a_phi[lvl - 1], *a_deltaM[lvl], scale, a_variables);
+    }
+
+    redistOps[lvl]->redistributeLevel(*a_phi[lvl], *a_deltaM[lvl], scale, a_variables);
+
+    if (hasFine) {
+      redistOps[lvl]->redistributeFine(*a_phi[lvl + 1], *a_deltaM[lvl], scale, a_variables);
+    }
+  }
+}
+
 bool
 AmrMesh::queryRealm(const std::string a_realm) const
 {
@@ -0,0 +1,152 @@
+/* chombo-discharge
+ * Copyright © 2026 SINTEF Energy Research.
+ * Please refer to Copyright.txt and LICENSE in the chombo-discharge root directory.
+ */
+
+/*!
+  @file   CD_BoxCosts.cpp
+  @brief  Implementation of CD_BoxCosts.H
+  @author Robert Marskar
+*/
+
+// Std includes
+#include <algorithm>
+#include <vector>
+
+// Chombo includes
+#include <CH_Timer.H>
+
+// Our includes
+#include <CD_BoxCosts.H>
+#include <CD_LoadBalancing.H>
+#include <CD_ParallelOps.H>
+#include <CD_NamespaceHeader.H>
+
+bool                                                       BoxCosts::s_enabled     = false;
+thread_local bool                                          BoxCosts::s_inScope     = false;
+thread_local Real                                          BoxCosts::s_scopeTime   = 0.0;
+thread_local bool                                          BoxCosts::s_inLoopTimer = false;
+std::map<std::string, std::map<int, std::map<Box, Real>>> BoxCosts::s_costs;
+
+BoxCosts::Scope::Scope(const std::string& a_realm, const int a_level, const Box& a_box) noexcept
+{
+  m_active = s_enabled;
+
+  if (m_active) {
+    m_realm      = &a_realm;
+    m_level      = a_level;
+    m_box        = a_box;
+    m_outerScope = s_inScope;
+    m_outerTime  = s_scopeTime;
+
+    s_inScope   = true;
+    s_scopeTime = 0.0;
+  }
+}
+
+BoxCosts::Scope::~Scope() noexcept
+{
+  if (m_active) {
+    const Real time = s_scopeTime;
+
+    s_inScope   = m_outerScope;
+    s_scopeTime = m_outerTime;
+
+#pragma omp critical(BoxCostsScope)
+    {
+      s_costs[*m_realm][m_level][m_box] += time;
+    }
+  }
+}
+
+void
+BoxCosts::setEnabled(const bool a_enable) noexcept
+{
+  s_enabled = a_enable;
+}
+
+bool
+BoxCosts::isEnabled() noexcept
+{
+  return s_enabled;
+}
+
+void
+BoxCosts::clear() noexcept
+{
+  CH_TIME("BoxCosts::clear");
+
+  s_costs.clear();
+}
+
+bool
+BoxCosts::hasCosts(const std::string& a_realm) noexcept
+{
+  CH_TIME("BoxCosts::hasCosts");
+
+  const int hasLocalCosts = (s_costs.find(a_realm) != s_costs.end()) ? 1 : 0;
+
+  return ParallelOps::max(hasLocalCosts) > 0;
+}
+
+Vector<Real>
+BoxCosts::getLoads(const std::string& a_realm, const int a_level, const Vector<Box>& a_boxes) noexcept
+{
+  CH_TIME("BoxCosts::getLoads");
+
+  // Linearize the costs on this rank and gather them on all ranks.
+  Vector<Box>  measuredBoxes;
+  Vector<Real> measuredCosts;
+
+  const auto realmIter = s_costs.find(a_realm);
+  if (realmIter != s_costs.end()) {
+    const auto levelIter = realmIter->second.find(a_level);
+
+    if (levelIter != realmIter->second.end()) {
+      for (const auto& boxCost : levelIter->second) {
+        measuredBoxes.push_back(boxCost.first);
+        measuredCosts.push_back(boxCost.second);
+      }
+    }
+  }
+
+  LoadBalancing::gatherBoxes(measuredBoxes);
+  LoadBalancing::gatherLoads(measuredCosts);
+
+  CH_assert(measuredBoxes.size() == measuredCosts.size());
+
+  // Average cost density on this level. This is used for regions that were not measured.
+  Real totalCost  = 0.0;
+  Real totalCells = 0.0;
+
+  for (int i = 0; i < measuredBoxes.size(); i++) {
+    totalCost += measuredCosts[i];
+    totalCells += measuredBoxes[i].numPts();
+  }
+
+  const Real averageDensity = (totalCost > 0.0) ? totalCost / totalCells : 1.0;
+
+  // Compute the load of each new box from the overlapping measured boxes.
+  const std::vector<std::vector<std::pair<int, long>>> overlaps = LoadBalancing::computeOverlaps(a_boxes, measuredBoxes);
+
+  Vector<Real> loads(a_boxes.size(), 0.0);
+
+  for (int ibox = 0; ibox < a_boxes.size(); ibox++) {
+    Real load         = 0.0;
+    Real coveredCells = 0.0;
+
+    for (const auto& overlap : overlaps[ibox]) {
+      load += measuredCosts[overlap.first] * overlap.second / measuredBoxes[overlap.first].numPts();
+      coveredCells += overlap.second;
+    }
+
+    // Measured patches on a level do not overlap, so the remaining cells are the unmeasured ones.
+    const Real uncoveredCells = std::max((Real)0.0, (Real)(a_boxes[ibox].numPts() - coveredCells));
+
+    loads[ibox] = load + averageDensity * uncoveredCells;
+  }
+
+  return loads;
+}
+
+#include <CD_NamespaceFooter.H>
@@ -0,0 +1,133 @@
+/* chombo-discharge
+ * Copyright © 2026 SINTEF Energy Research.
+ * Please refer to Copyright.txt and LICENSE in the chombo-discharge root directory.
+ */
+
+/*!
+  @file   CD_CoveredMask.cpp
+  @brief  Implementation of CD_CoveredMask.H
+  @author Robert Marskar
+*/
+
+// Std includes
+#include <cmath>
+
+// Chombo includes
+#include <BoxIterator.H>
+#include <CH_Timer.H>
+
+// Our includes
+#include <CD_CoveredMask.H>
+#include <CD_BatchIF.H>
+#include <CD_BoxLoops.H>
+#include <CD_NamespaceHeader.H>
+
+CoveredMask::CoveredMask() noexcept
+{
+  m_isDefined  = false;
+  m_dx         = 0.0;
+  m_refinement = 0;
+}
+
+CoveredMask::~CoveredMask() noexcept
+{}
+
+void
+CoveredMask::define(const BaseIF*        a_implicitFunction,
+                    const EBISBox&       a_ebisBox,
+                    const Box&           a_box,
+                    const ProblemDomain& a_domain,
+                    const RealVect&      a_probLo,
+                    const Real           a_dx,
+                    const int            a_refinement) noexcept
+{
+  CH_TIME("CoveredMask::define");
+
+  m_box        = a_box;
+  m_probLo     = a_probLo;
+  m_dx         = a_dx;
+  m_refinement = (a_implicitFunction != nullptr) ? a_refinement : 0;
+
+  m_cells.define(a_box, 1);
+  m_subValues.resize(0);
+
+  const Box& region      = a_ebisBox.getRegion();
+  const Box& domainBox   = a_domain.domainBox();
+  const bool allRegular  = a_ebisBox.isAllRegular();
+  const bool allCovered  = a_ebisBox.isAllCovered();
+  const int  numSubCells = (m_refinement > 0) ? int(std::pow(m_refinement, SpaceDim)) : 0;
+
+  // Cell type: 0 = regular, 1 = covered, 2 = cut-cell.
+  auto cellType = [&](const IntVect& iv) -> int {
+    if (allRegular || a_ebisBox.isRegular(iv)) {
+      return 0;
+    }
+    else if (allCovered || a_ebisBox.isCovered(iv)) {
+      return 1;
+    }
+
+    return 2;
+  };
+
+  std::vector<RealVect> subPositions;
+
+  auto kernel = [&](const IntVect& iv) -> void {
+    const int type = cellType(iv);
+
+    if (type == 2) {
+      if (numSubCells > 0) {
+        m_cells(iv, 0) = int(subPositions.size());
+
+        const Box subBox(IntVect::Zero, (m_refinement - 1) * IntVect::Unit);
+
+        // Sub-cells are ordered with the first direction running fastest, matching CoveredMask::classify.
+        auto subKernel = [&](const IntVect& subCell) -> void {
+          const RealVect pos = m_probLo + (RealVect(iv) + (0.5 * RealVect::Unit + RealVect(subCell)) / m_refinement) *
+                                            m_dx;
+
+          subPositions.emplace_back(pos);
+        };
+
+        BoxLoops::loop(subBox, subKernel);
+      }
+      else {
+        m_cells(iv, 0) = s_near;
+      }
+    }
+    else {
+      // Regular and covered cells are near the EB if any neighbor has a different type. Neighbors outside the
+      // EBISBox are unknown, but neighbors outside the domain are not EB cells.
+      bool isNear = false;
+
+      Box neighborhood(iv - IntVect::Unit, iv + IntVect::Unit);
+      neighborhood &= domainBox;
+
+      for (BoxIterator bit(neighborhood); bit.ok() && !isNear; ++bit) {
+        const IntVect& ivNeigh = bit();
+
+        if (!(region.contains(ivNeigh)) || cellType(ivNeigh) != type) {
+          isNear = true;
+        }
+      }
+
+      if (isNear) {
+        m_cells(iv, 0) = s_near;
+      }
+      else {
+        m_cells(iv, 0) = (type == 0) ? s_regular : s_covered;
+      }
+    }
+  };
+
+  BoxLoops::loop(a_box, kernel);
+
+  if (subPositions.size() > 0) {
+    m_subValues.resize(subPositions.size());
+
+    BatchIF::evaluate(*a_implicitFunction, subPositions.data(), m_subValues.data(), subPositions.size());
+  }
+
+  m_isDefined = true;
+}
+
+#include <CD_NamespaceFooter.H>
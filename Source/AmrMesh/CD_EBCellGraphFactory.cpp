@@ -0,0 +1,30 @@
+/* chombo-discharge
+ * Copyright © 2026 SINTEF Energy Research.
+ * Please refer to Copyright.txt and LICENSE in the chombo-discharge root directory.
+ */
+
+/*!
+  @file   CD_EBCellGraphFactory.cpp
+  @brief  Implementation of CD_EBCellGraphFactory.H
+  @author Robert Marskar
+*/
+
+// Our includes
+#include <CD_EBCellGraphFactory.H>
+#include <CD_NamespaceHeader.H>
+
+EBCellGraphFactory::EBCellGraphFactory(const LevelData<EBCellFAB>& a_data)
+{
+  m_data = &a_data;
+}
+
+EBCellGraphFactory::~EBCellGraphFactory()
+{}
+
+EBCellFAB*
+EBCellGraphFactory::create(const Box& a_box, int a_nComp, const DataIndex& a_dit) const
+{
+  return new EBCellFAB((*m_data)[a_dit].getEBISBox(), a_box, a_nComp);
+}
+
+#include <CD_NamespaceFooter.H>
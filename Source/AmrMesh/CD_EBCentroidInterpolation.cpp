@@ -9,6 +9,10 @@
   @author Robert Marskar
 */
 
+// Std includes
+#include <algorithm>
+#include <map>
+
 // Chombo includes
 #include <CH_Timer.H>
 #include <EBArith.H>
@@ -56,13 +60,60 @@ EBCentroidInterpolation::define(const EBLevelGrid& a_eblg, const Real& a_dx, con
   m_dx                = a_dx;
   m_interpolationType = a_interpolationType;
 
+  this->defineStencils(nullptr);
+
+  m_isDefined = true;
+}
+
+void
+EBCentroidInterpolation::define(const EBLevelGrid&             a_eblg,
+                                const Real&                    a_dx,
+                                const Type&                    a_interpolationType,
+                                const EBCentroidInterpolation& a_previous) noexcept
+{
+  CH_TIME("EBCentroidInterpolation::define(previous)");
+
+  CH_assert(a_eblg.isDefined());
+  CH_assert(a_dx >= 0.0);
+
+  m_eblg              = a_eblg;
+  m_dx                = a_dx;
+  m_interpolationType = a_interpolationType;
+
+  // TLDR: The stencils only depend on the grid patch and the (static) EB geometry, so they can be transplanted from the
+  //       previous object if it was defined with the same settings and EB ghost cells.
+  const bool reuseStencils = a_previous.m_isDefined && a_previous.m_interpolationType == m_interpolationType &&
+                             a_previous.m_dx == m_dx && a_previous.m_eblg.getDomain() == m_eblg.getDomain() &&
+                             a_previous.m_eblg.getGhost() == m_eblg.getGhost();
+
+  this->defineStencils(reuseStencils ? &a_previous : nullptr);
+
+  m_isDefined = true;
+}
+
+void
+EBCentroidInterpolation::defineStencils(const EBCentroidInterpolation* const a_previous) noexcept
+{
+  CH_TIME("EBCentroidInterpolation::defineStencils");
+
   const DisjointBoxLayout& dbl    = m_eblg.getDBL();
   const EBISLayout&        ebisl  = m_eblg.getEBISL();
   const ProblemDomain&     domain = m_eblg.getDomain();
   const DataIterator&      dit    = dbl.dataIterator();
 
+  // Grid patches in the previous grids that live on this rank.
+  std::map<Box, DataIndex> previousBoxes;
+  if (a_previous != nullptr) {
+    const DisjointBoxLayout& previousDBL = a_previous->m_eblg.getDBL();
+
+    for (DataIterator previousDit(previousDBL); previousDit.ok(); ++previousDit) {
+      previousBoxes.emplace(previousDBL[previousDit()], previousDit());
+    }
+  }
+
   m_vofIterator.define(dbl);
   m_interpStencils.define(dbl);
+  m_centroidStencils.define(dbl);
 
   const int nbox = dit.size();
 #pragma omp parallel for schedule(runtime)
@@ -81,82 +132,140 @@ EBCentroidInterpolation::define(const EBLevelGrid& a_eblg, const Real& a_dx, con
     vofit.define(irregIVS, ebGraph);
     stencils.define(irregIVS, ebGraph, 1);
 
-    for (vofit.reset(); vofit.ok(); ++vofit) {
-      const VolIndex& vof     = vofit();
-      VoFStencil&     stencil = stencils(vof, 0);
+    const auto previousBox = previousBoxes.find(cellBox);
 
-      auto defaultStencil = [&]() -> void {
-        stencil.clear();
-        stencil.add(vof, 1.0);
-      };
+    if (previousBox != previousBoxes.end()) {
+      const BaseIVFAB<VoFStencil>& previousStencils = a_previous->m_interpStencils[previousBox->second];
 
-      switch (m_interpolationType) {
-      case Type::Constant: {
-        stencil.add(vof, 1.0);
+      stencils.copy(cellBox, Interval(0, 0), cellBox, previousStencils, Interval(0, 0));
+    }
+    else {
+      for (vofit.reset(); vofit.ok(); ++vofit) {
+        const VolIndex& vof = vofit();
 
-        break;
+        this->computeStencil(stencils(vof, 0), vof, ebisBox, domain);
       }
-      case Type::Linear: {
-        const bool foundStencil = this->getLinearStencil(stencil, vof, ebisBox, domain);
+    }
 
-        if (!foundStencil) {
-          defaultStencil();
-        }
+    // Flatten the stencils, except those that involve multi-valued cells.
+    CentroidStencils& flatStencils = m_centroidStencils[din];
 
-        break;
-      }
-      case Type::Taylor: {
-        const bool foundStencil = this->getTaylorExtrapolationStencil(stencil, vof, ebisBox, domain);
+    flatStencils.m_offsets.emplace_back(0);
 
-        if (!foundStencil) {
-          defaultStencil();
-        }
+    for (vofit.reset(); vofit.ok(); ++vofit) {
+      const VolIndex&   vof     = vofit();
+      const VoFStencil& stencil = stencils(vof, 0);
 
-        break;
+      bool isMultiValued = ebisBox.isMultiValued(vof.gridIndex());
+      for (int i = 0; i < stencil.size(); i++) {
+        isMultiValued = isMultiValued || ebisBox.isMultiValued(stencil.vof(i).gridIndex());
       }
-      case Type::LeastSquares: {
-        const bool foundStencil = this->getLeastSquaresStencil(stencil, vof, ebisBox, domain);
 
-        if (!foundStencil) {
-          defaultStencil();
+      if (isMultiValued) {
+        flatStencils.m_multiValuedVofs.emplace_back(vof);
+      }
+      else {
+        for (int i = 0; i < stencil.size(); i++) {
+          flatStencils.m_cells.emplace_back(stencil.vof(i).gridIndex());
+          flatStencils.m_weights.emplace_back(stencil.weight(i));
         }
 
-        break;
+        flatStencils.m_vofs.emplace_back(vof);
+        flatStencils.m_offsets.emplace_back(flatStencils.m_weights.size());
       }
-      case Type::PiecewiseLinear: {
-        const bool foundStencil = this->getPiecewiseLinearStencil(stencil, vof, ebisBox, domain);
+    }
+  }
 
-        if (!foundStencil) {
-          defaultStencil();
-        }
+  if (MemoryTracker::isEnabled()) {
+    long long bytes = MemoryTracker::getBytes(m_interpStencils);
 
-        break;
-      }
-      case Type::MinMod: {
-        stencil.clear(); // No need for a stencil.
+    for (int mybox = 0; mybox < nbox; mybox++) {
+      const CentroidStencils& flatStencils = m_centroidStencils[dit[mybox]];
 
-        break;
-      }
-      case Type::MonotonizedCentral: {
-        stencil.clear(); // No need for a stencil.
+      bytes += (flatStencils.m_vofs.capacity() + flatStencils.m_multiValuedVofs.capacity()) * sizeof(VolIndex);
+      bytes += flatStencils.m_offsets.capacity() * sizeof(int);
+      bytes += flatStencils.m_cells.capacity() * sizeof(IntVect);
+      bytes += flatStencils.m_weights.capacity() * sizeof(Real);
+    }
 
-        break;
-      }
-      case Type::Superbee: {
-        stencil.clear(); // No need for a stencil.
+    m_stencilMemory = MemoryTracker::track("Stencils/EBCentroidInterpolation", bytes);
+  }
+}
 
-        break;
-      }
-      default: {
-        defaultStencil();
+void
+EBCentroidInterpolation::computeStencil(VoFStencil&          a_stencil,
+                                        const VolIndex&      a_vof,
+                                        const EBISBox&       a_ebisBox,
+                                        const ProblemDomain& a_domain) const noexcept
+{
+  auto defaultStencil = [&]() -> void {
+    a_stencil.clear();
+    a_stencil.add(a_vof, 1.0);
+  };
 
-        break;
-      }
-      }
+  switch (m_interpolationType) {
+  case Type::Constant: {
+    a_stencil.add(a_vof, 1.0);
+
+    break;
+  }
+  case Type::Linear: {
+    const bool foundStencil = this->getLinearStencil(a_stencil, a_vof, a_ebisBox, a_domain);
+
+    if (!foundStencil) {
+      defaultStencil();
     }
+
+    break;
   }
+  case Type::Taylor: {
+    const bool foundStencil = this->getTaylorExtrapolationStencil(a_stencil, a_vof, a_ebisBox, a_domain);
 
-  m_isDefined = true;
+    if (!foundStencil) {
+      defaultStencil();
+    }
+
+    break;
+  }
+  case Type::LeastSquares: {
+    const bool foundStencil = this->getLeastSquaresStencil(a_stencil, a_vof, a_ebisBox, a_domain);
+
+    if (!foundStencil) {
+      defaultStencil();
+    }
+
+    break;
+  }
+  case Type::PiecewiseLinear: {
+    const bool foundStencil = this->getPiecewiseLinearStencil(a_stencil, a_vof, a_ebisBox, a_domain);
+
+    if (!foundStencil) {
+      defaultStencil();
+    }
+
+    break;
+  }
+  case Type::MinMod: {
+    a_stencil.clear(); // No need for a stencil.
+
+    break;
+  }
+  case Type::MonotonizedCentral: {
+    a_stencil.clear(); // No need for a stencil.
+
+    break;
+  }
+  case Type::Superbee: {
+    a_stencil.clear(); // No need for a stencil.
+
+    break;
+  }
+  default: {
+    defaultStencil();
+
+    break;
+  }
+  }
 }
 
 bool
@@ -323,6 +432,45 @@ EBCentroidInterpolation::interpolate(BaseIVFAB<Real>& a_centroidData,
 
   const int nComp = a_cellData.nComp();
 
+  // TLDR: Cut-cells with flattened stencils are done for all components in one pass over the stencils, reading directly
+  //       from the single-valued data. The remaining cut-cells are done with the kernels below.
+  const bool isSlopeLimited = m_interpolationType == Type::MinMod || m_interpolationType == Type::MonotonizedCentral ||
+                              m_interpolationType == Type::Superbee;
+
+  if (!isSlopeLimited) {
+    const CentroidStencils& flatStencils = m_centroidStencils[a_din];
+    const BaseFab<Real>&    cellDataReg  = a_cellData.getSingleValuedFAB();
+    const Box&              dataBox      = cellDataReg.box();
+    const IntVect           dataLo       = dataBox.smallEnd();
+    const IntVect           stride(D_DECL(1, dataBox.size(0), dataBox.size(0) * dataBox.size(1)));
+
+    std::vector<const Real*> data(nComp);
+    std::vector<Real>        values(nComp);
+
+    for (int comp = 0; comp < nComp; comp++) {
+      data[comp] = cellDataReg.dataPtr(comp);
+    }
+
+    const int numVofs = flatStencils.m_vofs.size();
+    for (int ivof = 0; ivof < numVofs; ivof++) {
+      std::fill(values.begin(), values.end(), 0.0);
+
+      for (int i = flatStencils.m_offsets[ivof]; i < flatStencils.m_offsets[ivof + 1]; i++) {
+        const IntVect iv     = flatStencils.m_cells[i] - dataLo;
+        const int     idx    = D_TERM(iv[0], +iv[1] * stride[1], +iv[2] * stride[2]);
+        const Real    weight = flatStencils.m_weights[i];
+
+        for (int comp = 0; comp < nComp; comp++) {
+          values[comp] += weight * data[comp][idx];
+        }
+      }
+
+      for (int comp = 0; comp < nComp; comp++) {
+        a_centroidData(flatStencils.m_vofs[ivof], comp) = values[comp];
+      }
+    }
+  }
+
   for (int comp = 0; comp < nComp; comp++) {
 
     // This is the kernel that is used when the interpolation is expressable as a stencil.
@@ -428,7 +576,9 @@ EBCentroidInterpolation::interpolate(BaseIVFAB<Real>& a_centroidData,
       break;
     }
     default: {
-      BoxLoops::loop(m_vofIterator[a_din], stencilKernel);
+      for (const auto& vof : m_centroidStencils[a_din].m_multiValuedVofs) {
+        stencilKernel(vof);
+      }
 
       break;
     }
@@ -382,110 +382,123 @@ EBCoarAve::averageData(LevelData<EBCellFAB>&       a_coarData,
   const DataIterator& dit  = dblFine.dataIterator();
   const int           nbox = dit.size();
 
-  LevelData<EBCellFAB> coFiData(dblCoFi, 1, IntVect::Zero, EBCellFactory(m_eblgCoFi.getEBISL()));
+  // TLDR: All variables are coarsened into one buffer in a single pass over the patches, and the buffer is then copied
+  //       to the coarse grid with a single copyTo.
+  const Interval coarVars = Interval(0, a_variables.size() - 1);
 
-  for (int ivar = a_variables.begin(); ivar <= a_variables.end(); ivar++) {
+  LevelData<EBCellFAB> coFiData(dblCoFi, a_variables.size(), IntVect::Zero, EBCellFactory(m_eblgCoFi.getEBISL()));
 
-    CH_START(t1);
+  CH_START(t1);
 #pragma omp parallel for schedule(runtime)
-    for (int mybox = 0; mybox < nbox; mybox++) {
-      const DataIndex& din = dit[mybox];
-
-      EBCellFAB&       coarData = coFiData[din];
-      const EBCellFAB& fineData = a_fineData[din];
-
-      // Switch between methods.
-      switch (a_average) {
-      case Average::Arithmetic: {
-        this->arithmeticAverage(coarData, fineData, din, 0, ivar);
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex& din = dit[mybox];
 
-        break;
-      }
-      case Average::Harmonic: {
-        this->harmonicAverage(coarData, fineData, din, 0, ivar);
+    EBCellFAB&       coarData = coFiData[din];
+    const EBCellFAB& fineData = a_fineData[din];
 
-        break;
-      }
-      case Average::Conservative: {
-        this->conservativeAverage(coarData, fineData, din, 0, ivar);
+    // Switch between methods.
+    switch (a_average) {
+    case Average::Arithmetic: {
+      this->arithmeticAverage(coarData, fineData, din, coarVars, a_variables);
 
-        break;
-      }
-      default: {
-        MayDay::Error("EBCoarAve::averageData(LD<EBCellFAB>) - logic bust");
+      break;
+    }
+    case Average::Harmonic: {
+      this->harmonicAverage(coarData, fineData, din, coarVars, a_variables);
 
-        break;
-      }
-      }
+      break;
     }
-    CH_STOP(t1);
+    case Average::Conservative: {
+      this->conservativeAverage(coarData, fineData, din, coarVars, a_variables);
 
-    CH_START(t2);
-    const Interval srcInterv = Interval(0, 0);
-    const Interval dstInterv = Interval(ivar, ivar);
+      break;
+    }
+    default: {
+      MayDay::Error("EBCoarAve::averageData(LD<EBCellFAB>) - logic bust");
 
-    Copier& cellCopier = m_cellCopiers[a_coarData.ghostVect()];
-    if (!cellCopier.isDefined()) {
-      cellCopier.define(m_eblgCoFi.getDBL(), m_eblgCoar.getDBL(), a_coarData.ghostVect());
+      break;
     }
+    }
+  }
+  CH_STOP(t1);
 
-    coFiData.copyTo(srcInterv, a_coarData, dstInterv, cellCopier);
-    CH_STOP(t2);
+  CH_START(t2);
+  Copier& cellCopier = m_cellCopiers[a_coarData.ghostVect()];
+  if (!cellCopier.isDefined()) {
+    cellCopier.define(m_eblgCoFi.getDBL(), m_eblgCoar.getDBL(), a_coarData.ghostVect());
   }
+
+  coFiData.copyTo(coarVars, a_coarData, a_variables, cellCopier);
+  CH_STOP(t2);
 }
 
 void
 EBCoarAve::arithmeticAverage(EBCellFAB&       a_coarData,
                              const EBCellFAB& a_fineData,
                              const DataIndex& a_datInd,
-                             const int&       a_coarVar,
-                             const int&       a_fineVar) const noexcept
+                             const Interval&  a_coarVars,
+                             const Interval&  a_fineVars) const noexcept
 {
   CH_TIMERS("EBCoarAve::arithmeticAverage(EBCellFAB)");
   CH_TIMER("EBCoarAve::arithmeticAverage(EBCellFAB)::regular_cells", t1);
   CH_TIMER("EBCoarAve::arithmeticAverage(EBCellFAB)::irregular_cells", t2);
 
   CH_assert(m_isDefined);
-  CH_assert(a_coarData.nComp() > a_coarVar);
-  CH_assert(a_fineData.nComp() > a_fineVar);
+  CH_assert(a_coarVars.size() == a_fineVars.size());
+  CH_assert(a_coarData.nComp() > a_coarVars.end());
+  CH_assert(a_fineData.nComp() > a_fineVars.end());
 
   const Real dxCoar   = 1.0;
   const Real dxFine   = dxCoar / m_refRat;
   const Real dxFactor = std::pow(dxFine / dxCoar, SpaceDim);
   const Box  refiBox  = Box(IntVect::Zero, (m_refRat - 1) * IntVect::Unit);
+  const int  numVars  = a_coarVars.size();
 
   FArrayBox&       coarDataReg = a_coarData.getFArrayBox();
   const FArrayBox& fineDataReg = a_fineData.getFArrayBox();
 
   const BaseIVFAB<VoFStencil>& coarseningStencils = m_cellArithmeticStencils[a_datInd];
 
-  // Coarsening of regular cells.
-  auto regularKernel = [&](const IntVect& iv) -> void {
-    coarDataReg(iv, a_coarVar) = 0.0;
+  const Box& coarBox = m_eblgCoFi.getDBL()[a_datInd];
+
+  // Coarsening of regular cells. We accumulate one fine-grid offset at a time so the innermost loop runs over
+  // contiguous cells.
+  CH_START(t1);
+  for (int ivar = 0; ivar < numVars; ivar++) {
+    const int coarVar = a_coarVars.begin() + ivar;
+    const int fineVar = a_fineVars.begin() + ivar;
+
+    coarDataReg.setVal(0.0, coarBox, coarVar, 1);
 
     for (BoxIterator bit(refiBox); bit.ok(); ++bit) {
-      coarDataReg(iv, a_coarVar) += fineDataReg(m_refRat * iv + bit(), a_fineVar);
+      const IntVect offset = bit();
+
+      auto regularKernel = [&](const IntVect& iv) -> void {
+        coarDataReg(iv, coarVar) += fineDataReg(m_refRat * iv + offset, fineVar);
+      };
+
+      BoxLoops::loop(coarBox, regularKernel);
     }
 
-    coarDataReg(iv, a_coarVar) *= dxFactor;
-  };
+    coarDataReg.mult(dxFactor, coarBox, coarVar, 1);
+  }
+  CH_STOP(t1);
 
   // Coarsening of cut-cells.
   auto irregularKernel = [&](const VolIndex& vof) -> void {
-    a_coarData(vof, a_coarVar) = 0.0;
-
     const VoFStencil& stencil = coarseningStencils(vof, 0);
 
-    for (int i = 0; i < stencil.size(); i++) {
-      a_coarData(vof, a_coarVar) += stencil.weight(i) * a_fineData(stencil.vof(i), a_fineVar);
-    }
-  };
+    for (int ivar = 0; ivar < numVars; ivar++) {
+      const int coarVar = a_coarVars.begin() + ivar;
+      const int fineVar = a_fineVars.begin() + ivar;
 
-  CH_START(t1);
-  const Box& coarBox = m_eblgCoFi.getDBL()[a_datInd];
+      a_coarData(vof, coarVar) = 0.0;
 
-  BoxLoops::loop(coarBox, regularKernel);
-  CH_STOP(t1);
+      for (int i = 0; i < stencil.size(); i++) {
+        a_coarData(vof, coarVar) += stencil.weight(i) * a_fineData(stencil.vof(i), fineVar);
+      }
+    }
+  };
 
   CH_START(t2);
   VoFIterator& vofit = m_irregCellsCoFi[a_datInd];
@@ -498,8 +511,8 @@ void
 EBCoarAve::harmonicAverage(EBCellFAB&       a_coarData,
                            const EBCellFAB& a_fineData,
                            const DataIndex& a_datInd,
-                           const int&       a_coarVar,
-                           const int&       a_fineVar) const noexcept
+                           const Interval&  a_coarVars,
+                           const Interval&  a_fineVars) const noexcept
 
 {
   CH_TIMERS("EBCoarAve::harmonicAverage(EBCellFAB)");
@@ -507,47 +520,66 @@ EBCoarAve::harmonicAverage(EBCellFAB&       a_coarData,
   CH_TIMER("EBCoarAve::harmonicAverage(EBCellFAB)::irregular_cells", t2);
 
   CH_assert(m_isDefined);
-  CH_assert(a_coarData.nComp() > a_coarVar);
-  CH_assert(a_fineData.nComp() > a_fineVar);
+  CH_assert(a_coarVars.size() == a_fineVars.size());
+  CH_assert(a_coarData.nComp() > a_coarVars.end());
+  CH_assert(a_fineData.nComp() > a_fineVars.end());
 
   // Regular cells
   const Box  refiBox    = Box(IntVect::Zero, (m_refRat - 1) * IntVect::Unit);
   const Real numPerCoar = refiBox.numPts();
+  const int  numVars    = a_coarVars.size();
 
   FArrayBox&       coarDataReg = a_coarData.getFArrayBox();
   const FArrayBox& fineDataReg = a_fineData.getFArrayBox();
 
   const BaseIVFAB<VoFStencil>& coarseningStencils = m_cellHarmonicStencils[a_datInd];
 
-  // Harmonic coarsening of regular cells. Harmonic averaging is phiCoar = n/sum_{i<n}(1/x_i)
-  auto regularKernel = [&](const IntVect& iv) -> void {
-    Real coarVal = 0.0;
+  const Box& coarBox = m_eblgCoFi.getDBL()[a_datInd];
+
+  // Harmonic coarsening of regular cells. Harmonic averaging is phiCoar = n/sum_{i<n}(1/x_i). As for the arithmetic
+  // average we accumulate one fine-grid offset at a time.
+  CH_START(t1);
+  for (int ivar = 0; ivar < numVars; ivar++) {
+    const int coarVar = a_coarVars.begin() + ivar;
+    const int fineVar = a_fineVars.begin() + ivar;
+
+    coarDataReg.setVal(0.0, coarBox, coarVar, 1);
 
     for (BoxIterator bit(refiBox); bit.ok(); ++bit) {
-      coarVal += 1.0 / fineDataReg(m_refRat * iv + bit(), a_fineVar);
+      const IntVect offset = bit();
+
+      auto accumulateKernel = [&](const IntVect& iv) -> void {
+        coarDataReg(iv, coarVar) += 1.0 / fineDataReg(m_refRat * iv + offset, fineVar);
+      };
+
+      BoxLoops::loop(coarBox, accumulateKernel);
     }
 
-    coarDataReg(iv, a_coarVar) = numPerCoar / coarVal;
-  };
+    auto invertKernel = [&](const IntVect& iv) -> void {
+      coarDataReg(iv, coarVar) = numPerCoar / coarDataReg(iv, coarVar);
+    };
+
+    BoxLoops::loop(coarBox, invertKernel);
+  }
+  CH_STOP(t1);
 
   // Coarsening of cut-cells. We've put the stencil weights = 1/n so we only need to accumulate and invert.
   auto irregularKernel = [&](const VolIndex& vof) -> void {
-    a_coarData(vof, a_coarVar) = 0.0;
-
     const VoFStencil& stencil = coarseningStencils(vof, 0);
 
-    for (int i = 0; i < stencil.size(); i++) {
-      a_coarData(vof, a_coarVar) += stencil.weight(i) / a_fineData(stencil.vof(i), a_fineVar);
-    }
+    for (int ivar = 0; ivar < numVars; ivar++) {
+      const int coarVar = a_coarVars.begin() + ivar;
+      const int fineVar = a_fineVars.begin() + ivar;
 
-    a_coarData(vof, a_coarVar) = 1. / a_coarData(vof, a_coarVar);
-  };
+      a_coarData(vof, coarVar) = 0.0;
 
-  CH_START(t1);
-  const Box& coarBox = m_eblgCoFi.getDBL()[a_datInd];
+      for (int i = 0; i < stencil.size(); i++) {
+        a_coarData(vof, coarVar) += stencil.weight(i) / a_fineData(stencil.vof(i), fineVar);
+      }
 
-  BoxLoops::loop(coarBox, regularKernel);
-  CH_STOP(t1);
+      a_coarData(vof, coarVar) = 1. / a_coarData(vof, coarVar);
+    }
+  };
 
   // Irregular cells
   CH_START(t2);
@@ -561,54 +593,68 @@ void
 EBCoarAve::conservativeAverage(EBCellFAB&       a_coarData,
                                const EBCellFAB& a_fineData,
                                const DataIndex& a_datInd,
-                               const int&       a_coarVar,
-                               const int&       a_fineVar) const noexcept
+                               const Interval&  a_coarVars,
+                               const Interval&  a_fineVars) const noexcept
 {
   CH_TIMERS("EBCoarAve::conservativeAverage(EBCellFAB)");
   CH_TIMER("EBCoarAve::conservativeAverage(EBCellFAB)::regular_cells", t1);
   CH_TIMER("EBCoarAve::conservativeAverage(EBCellFAB)::irregular_cells", t2);
 
   CH_assert(m_isDefined);
-  CH_assert(a_coarData.nComp() > a_coarVar);
-  CH_assert(a_fineData.nComp() > a_fineVar);
+  CH_assert(a_coarVars.size() == a_fineVars.size());
+  CH_assert(a_coarData.nComp() > a_coarVars.end());
+  CH_assert(a_fineData.nComp() > a_fineVars.end());
 
   const Real dxCoar   = 1.0;
   const Real dxFine   = dxCoar / m_refRat;
   const Real dxFactor = std::pow(dxFine / dxCoar, SpaceDim);
   const Box  refiBox  = Box(IntVect::Zero, (m_refRat - 1) * IntVect::Unit);
+  const int  numVars  = a_coarVars.size();
 
   FArrayBox&       coarDataReg = a_coarData.getFArrayBox();
   const FArrayBox& fineDataReg = a_fineData.getFArrayBox();
 
   const BaseIVFAB<VoFStencil>& coarseningStencils = m_cellConservativeStencils[a_datInd];
 
-  // Coarsening of regular cells.
-  auto regularKernel = [&](const IntVect& iv) -> void {
-    coarDataReg(iv, a_coarVar) = 0.0;
+  const Box& coarBox = m_eblgCoFi.getDBL()[a_datInd];
+
+  // Coarsening of regular cells, one fine-grid offset at a time.
+  CH_START(t1);
+  for (int ivar = 0; ivar < numVars; ivar++) {
+    const int coarVar = a_coarVars.begin() + ivar;
+    const int fineVar = a_fineVars.begin() + ivar;
+
+    coarDataReg.setVal(0.0, coarBox, coarVar, 1);
 
     for (BoxIterator bit(refiBox); bit.ok(); ++bit) {
-      coarDataReg(iv, a_coarVar) += fineDataReg(m_refRat * iv + bit(), a_fineVar);
+      const IntVect offset = bit();
+
+      auto regularKernel = [&](const IntVect& iv) -> void {
+        coarDataReg(iv, coarVar) += fineDataReg(m_refRat * iv + offset, fineVar);
+      };
+
+      BoxLoops::loop(coarBox, regularKernel);
     }
 
-    coarDataReg(iv, a_coarVar) *= dxFactor;
-  };
+    coarDataReg.mult(dxFactor, coarBox, coarVar, 1);
+  }
+  CH_STOP(t1);
 
   // Coarsening of cut-cells.
   auto irregularKernel = [&](const VolIndex& vof) -> void {
-    a_coarData(vof, a_coarVar) = 0.0;
-
     const VoFStencil& stencil = coarseningStencils(vof, 0);
 
-    for (int i = 0; i < stencil.size(); i++) {
-      a_coarData(vof, a_coarVar) += stencil.weight(i) * a_fineData(stencil.vof(i), a_fineVar);
-    }
-  };
+    for (int ivar = 0; ivar < numVars; ivar++) {
+      const int coarVar = a_coarVars.begin() + ivar;
+      const int fineVar = a_fineVars.begin() + ivar;
 
-  CH_START(t1);
-  const Box& coarBox = m_eblgCoFi.getDBL()[a_datInd];
+      a_coarData(vof, coarVar) = 0.0;
 
-  BoxLoops::loop(coarBox, regularKernel);
-  CH_STOP(t1);
+      for (int i = 0; i < stencil.size(); i++) {
+        a_coarData(vof, coarVar) += stencil.weight(i) * a_fineData(stencil.vof(i), fineVar);
+      }
+    }
+  };
 
   CH_START(t2);
   VoFIterator& vofit = m_irregCellsCoFi[a_datInd];
@@ -636,36 +682,41 @@ EBCoarAve::averageData(LevelData<EBFluxFAB>&       a_coarData,
   const DataIterator& dit  = dblFine.dataIterator();
   const int           nbox = dit.size();
 
-  LevelData<EBFluxFAB> coFiData(dblCoFi, 1, IntVect::Zero, EBFluxFactory(m_eblgCoFi.getEBISL()));
+  // TLDR: All variables are coarsened into one buffer in a single pass over the patches, and the buffer is then copied
+  //       to the coarse grid with a single copyTo.
+  const int numVars = a_variables.size();
 
-  CH_START(t1);
-  for (int ivar = a_variables.begin(); ivar <= a_variables.end(); ivar++) {
+  LevelData<EBFluxFAB> coFiData(dblCoFi, numVars, IntVect::Zero, EBFluxFactory(m_eblgCoFi.getEBISL()));
 
+  CH_START(t1);
 #pragma omp parallel for schedule(runtime)
-    for (int mybox = 0; mybox < nbox; mybox++) {
-      const DataIndex& din = dit[mybox];
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex& din = dit[mybox];
+
+    EBFluxFAB&       coarData = coFiData[din];
+    const EBFluxFAB& fineData = a_fineData[din];
 
-      EBFluxFAB&       coarData = coFiData[din];
-      const EBFluxFAB& fineData = a_fineData[din];
+    for (int ivar = 0; ivar < numVars; ivar++) {
+      const int fineVar = a_variables.begin() + ivar;
 
       switch (a_average) {
       case Average::Arithmetic: {
         for (int dir = 0; dir < SpaceDim; dir++) {
-          this->arithmeticAverage(coarData[dir], fineData[dir], din, 0, ivar, dir);
+          this->arithmeticAverage(coarData[dir], fineData[dir], din, ivar, fineVar, dir);
         }
 
         break;
       }
       case Average::Harmonic: {
         for (int dir = 0; dir < SpaceDim; dir++) {
-          this->harmonicAverage(coarData[dir], fineData[dir], din, 0, ivar, dir);
+          this->harmonicAverage(coarData[dir], fineData[dir], din, ivar, fineVar, dir);
         }
 
         break;
       }
       case Average::Conservative: {
         for (int dir = 0; dir < SpaceDim; dir++) {
-          this->conservativeAverage(coarData[dir], fineData[dir], din, 0, ivar, dir);
+          this->conservativeAverage(coarData[dir], fineData[dir], din, ivar, fineVar, dir);
         }
 
         break;
@@ -677,18 +728,15 @@ EBCoarAve::averageData(LevelData<EBFluxFAB>&       a_coarData,
       }
       }
     }
-    CH_STOP(t1);
-
-    const Interval srcInterv = Interval(0, 0);
-    const Interval dstInterv = Interval(ivar, ivar);
-
-    Copier& faceCopier = m_faceCopiers[a_coarData.ghostVect()];
-    if (!faceCopier.isDefined()) {
-      faceCopier.define(m_eblgCoFi.getDBL(), m_eblgCoar.getDBL(), a_coarData.ghostVect());
-    }
+  }
+  CH_STOP(t1);
 
-    coFiData.copyTo(srcInterv, a_coarData, dstInterv, faceCopier);
+  Copier& faceCopier = m_faceCopiers[a_coarData.ghostVect()];
+  if (!faceCopier.isDefined()) {
+    faceCopier.define(m_eblgCoFi.getDBL(), m_eblgCoar.getDBL(), a_coarData.ghostVect());
   }
+
+  coFiData.copyTo(Interval(0, numVars - 1), a_coarData, a_variables, faceCopier);
 }
 
 void
@@ -941,29 +989,34 @@ EBCoarAve::averageData(LevelData<BaseIVFAB<Real>>&       a_coarData,
   BaseIVFactory<Real>        factCoFi(m_eblgCoFi.getEBISL(), m_irregSetsCoFi);
   coFiData.define(dblCoFi, a_variables.size(), IntVect::Zero, factCoFi);
 
-  for (int ivar = a_variables.begin(); ivar <= a_variables.end(); ivar++) {
-    CH_START(t1);
+  // All variables are coarsened in a single pass over the patches and copied to the coarse grid in one go.
+  const int numVars = a_variables.size();
+
+  CH_START(t1);
 #pragma omp parallel for schedule(runtime)
-    for (int mybox = 0; mybox < nbox; mybox++) {
-      const DataIndex& din = dit[mybox];
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex& din = dit[mybox];
+
+    BaseIVFAB<Real>&       coarData = coFiData[din];
+    const BaseIVFAB<Real>& fineData = a_fineData[din];
 
-      BaseIVFAB<Real>&       coarData = coFiData[din];
-      const BaseIVFAB<Real>& fineData = a_fineData[din];
+    for (int ivar = 0; ivar < numVars; ivar++) {
+      const int fineVar = a_variables.begin() + ivar;
 
       // Switch between averaging methods.
       switch (a_average) {
       case Average::Arithmetic: {
-        this->arithmeticAverage(coarData, fineData, din, 0, ivar);
+        this->arithmeticAverage(coarData, fineData, din, ivar, fineVar);
 
         break;
       }
       case Average::Harmonic: {
-        this->harmonicAverage(coarData, fineData, din, 0, ivar);
+        this->harmonicAverage(coarData, fineData, din, ivar, fineVar);
 
         break;
       }
       case Average::Conservative: {
-        this->conservativeAverage(coarData, fineData, din, 0, ivar);
+        this->conservativeAverage(coarData, fineData, din, ivar, fineVar);
 
         break;
       }
@@ -974,15 +1027,15 @@ EBCoarAve::averageData(LevelData<BaseIVFAB<Real>>&       a_coarData,
       }
       }
     }
-    CH_STOP(t1);
-
-    Copier& ebCopier = m_ebCopiers[a_coarData.ghostVect()];
-    if (!ebCopier.isDefined()) {
-      ebCopier.define(m_eblgCoFi.getDBL(), m_eblgCoar.getDBL(), a_coarData.ghostVect());
-    }
+  }
+  CH_STOP(t1);
 
-    coFiData.copyTo(Interval(0, 0), a_coarData, Interval(ivar, ivar), ebCopier);
+  Copier& ebCopier = m_ebCopiers[a_coarData.ghostVect()];
+  if (!ebCopier.isDefined()) {
+    ebCopier.define(m_eblgCoFi.getDBL(), m_eblgCoar.getDBL(), a_coarData.ghostVect());
   }
+
+  coFiData.copyTo(Interval(0, numVars - 1), a_coarData, a_variables, ebCopier);
 }
 
 void
@@ -162,6 +162,9 @@ EBFluxRedistribution::defineStencils() noexcept
   m_redistStencilsCoar.define(dbl);
   m_redistStencilsLevel.define(dbl);
   m_redistStencilsFine.define(dbl);
+  m_redistMapCoar.define(dbl);
+  m_redistMapLevel.define(dbl);
+  m_redistMapFine.define(dbl);
 
 #pragma omp parallel for schedule(runtime)
   for (int mybox = 0; mybox < nbox; mybox++) {
@@ -197,11 +200,19 @@ EBFluxRedistribution::defineStencils() noexcept
     BaseIVFAB<VoFStencil>& stencilsLevel = m_redistStencilsLevel[din];
     BaseIVFAB<VoFStencil>& stencilsFine  = m_redistStencilsFine[din];
 
+    RedistributionMap& mapCoar  = m_redistMapCoar[din];
+    RedistributionMap& mapLevel = m_redistMapLevel[din];
+    RedistributionMap& mapFine  = m_redistMapFine[din];
+
     vofit.define(redistCells, ebgraph);
     stencilsCoar.define(redistCells, ebgraph, 1);
     stencilsLevel.define(redistCells, ebgraph, 1);
     stencilsFine.define(redistCells, ebgraph, 1);
 
+    mapCoar.m_offsets.emplace_back(0);
+    mapLevel.m_offsets.emplace_back(0);
+    mapFine.m_offsets.emplace_back(0);
+
     for (vofit.reset(); vofit.ok(); ++vofit) {
       const VolIndex& vof = vofit();
 
@@ -291,10 +302,45 @@ EBFluxRedistribution::defineStencils() noexcept
           fineStencil.add(fineVoF, inverseVolume);
         }
       }
+
+      // Flatten the stencils, except those that involve multi-valued cells.
+      const bool isMultiValued = ebisBox.isMultiValued(vof.gridIndex());
+
+      this->flattenStencil(mapCoar, vof, coarStencil, ebisBoxCoar, isMultiValued);
+      this->flattenStencil(mapLevel, vof, levelStencil, ebisBox, isMultiValued);
+      this->flattenStencil(mapFine, vof, fineStencil, ebisBoxFine, isMultiValued);
     }
   }
 }
 
+void
+EBFluxRedistribution::flattenStencil(RedistributionMap& a_map,
+                                     const VolIndex&    a_vof,
+                                     const VoFStencil&  a_stencil,
+                                     const EBISBox&     a_ebisBox,
+                                     const bool         a_multiValued) const noexcept
+{
+  CH_assert(a_map.m_offsets.size() > 0);
+
+  bool isMultiValued = a_multiValued;
+  for (int i = 0; i < a_stencil.size(); i++) {
+    isMultiValued = isMultiValued || a_ebisBox.isMultiValued(a_stencil.vof(i).gridIndex());
+  }
+
+  if (isMultiValued) {
+    a_map.m_multiValuedVofs.emplace_back(a_vof);
+  }
+  else if (a_stencil.size() > 0) {
+    for (int i = 0; i < a_stencil.size(); i++) {
+      a_map.m_cells.emplace_back(a_stencil.vof(i).gridIndex());
+      a_map.m_weights.emplace_back(a_stencil.weight(i));
+    }
+
+    a_map.m_vofs.emplace_back(a_vof);
+    a_map.m_offsets.emplace_back(a_map.m_cells.size());
+  }
+}
+
 void
 EBFluxRedistribution::defineValidCells(LevelData<BaseFab<bool>>& a_validCells) const noexcept
 {
@@ -493,42 +539,31 @@ EBFluxRedistribution::redistributeCoar(LevelData<EBCellFAB>&             a_phiCo
   const EBISLayout&        ebislCoar  = m_eblgCoarsened.getEBISL();
   const ProblemDomain&     domainCoar = m_eblgCoarsened.getDomain();
   const int                nbox       = ditCoar.size();
+  const int                nComp      = a_variables.size();
 
-  LevelData<EBCellFAB> coarBuffer(dblCoar, 1, m_redistRadius * IntVect::Unit, EBCellFactory(ebislCoar));
-
-  for (int ivar = a_variables.begin(); ivar <= a_variables.end(); ivar++) {
+  LevelData<EBCellFAB> coarBuffer(dblCoar, nComp, m_redistRadius * IntVect::Unit, EBCellFactory(ebislCoar));
 
 #pragma omp parallel for schedule(runtime)
-    for (int mybox = 0; mybox < nbox; mybox++) {
-      const DataIndex& din = ditCoar[mybox];
-
-      const BaseIVFAB<Real>&       deltaM   = a_deltaM[din];
-      const BaseIVFAB<VoFStencil>& stencils = m_redistStencilsCoar[din];
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex& din = ditCoar[mybox];
 
-      EBCellFAB& buffer = coarBuffer[din];
-      buffer.setVal(0.0);
+    const RedistributionMap&     map      = m_redistMapCoar[din];
+    const BaseIVFAB<VoFStencil>& stencils = m_redistStencilsCoar[din];
 
-      // Apply stencil into buffer.
-      CH_START(t1);
-      VoFIterator& vofit = m_vofit[din];
-      for (vofit.reset(); vofit.ok(); ++vofit) {
-        const VolIndex&   vof      = vofit();
-        const VoFStencil& stencil  = stencils(vof, 0);
-        const Real&       massDiff = deltaM(vof, ivar);
+    EBCellFAB& buffer = coarBuffer[din];
+    buffer.setVal(0.0);
 
-        for (int i = 0; i < stencil.size(); i++) {
-          buffer(stencil.vof(i), 0) += a_scaleCoar * stencil.weight(i) * massDiff;
-        }
-      }
-      CH_STOP(t1);
-    }
+    // Apply stencils into buffer.
+    CH_START(t1);
+    this->redistributeBox(buffer, a_deltaM[din], map, stencils, a_scaleCoar, a_variables);
+    CH_STOP(t1);
+  }
 
-    // Increment a_phi by the result.
-    const Interval srcInterv = Interval(0, 0);
-    const Interval dstInterv = Interval(ivar, ivar);
+  // Increment a_phi by the result.
+  const Interval srcInterv = Interval(0, nComp - 1);
+  const Interval dstInterv = a_variables;
 
-    coarBuffer.copyTo(srcInterv, a_phiCoar, dstInterv, m_coarCopier, EBAddOp());
-  }
+  coarBuffer.copyTo(srcInterv, a_phiCoar, dstInterv, m_coarCopier, EBAddOp());
 }
 void
 EBFluxRedistribution::redistributeLevel(LevelData<EBCellFAB>&             a_phi,
@@ -552,42 +587,31 @@ EBFluxRedistribution::redistributeLevel(LevelData<EBCellFAB>&             a_phi,
   const EBISLayout&        ebisl  = m_eblg.getEBISL();
   const ProblemDomain&     domain = m_eblg.getDomain();
   const int                nbox   = dit.size();
+  const int                nComp  = a_variables.size();
 
-  LevelData<EBCellFAB> levelBuffer(dbl, 1, m_redistRadius * IntVect::Unit, EBCellFactory(ebisl));
-
-  for (int ivar = a_variables.begin(); ivar <= a_variables.end(); ivar++) {
+  LevelData<EBCellFAB> levelBuffer(dbl, nComp, m_redistRadius * IntVect::Unit, EBCellFactory(ebisl));
 
 #pragma omp parallel for schedule(runtime)
-    for (int mybox = 0; mybox < nbox; mybox++) {
-      const DataIndex& din = dit[mybox];
-
-      const BaseIVFAB<Real>&       deltaM   = a_deltaM[din];
-      const BaseIVFAB<VoFStencil>& stencils = m_redistStencilsLevel[din];
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex& din = dit[mybox];
 
-      EBCellFAB& buffer = levelBuffer[din];
-      buffer.setVal(0.0);
+    const RedistributionMap&     map      = m_redistMapLevel[din];
+    const BaseIVFAB<VoFStencil>& stencils = m_redistStencilsLevel[din];
 
-      // Apply stencil into buffer.
-      CH_START(t1);
-      VoFIterator& vofit = m_vofit[din];
-      for (vofit.reset(); vofit.ok(); ++vofit) {
-        const VolIndex&   vof      = vofit();
-        const VoFStencil& stencil  = stencils(vof, 0);
-        const Real&       massDiff = deltaM(vof, ivar);
+    EBCellFAB& buffer = levelBuffer[din];
+    buffer.setVal(0.0);
 
-        for (int i = 0; i < stencil.size(); i++) {
-          buffer(stencil.vof(i), 0) += a_scale * stencil.weight(i) * massDiff;
-        }
-      }
-      CH_STOP(t1);
-    }
+    // Apply stencils into buffer.
+    CH_START(t1);
+    this->redistributeBox(buffer, a_deltaM[din], map, stencils, a_scale, a_variables);
+    CH_STOP(t1);
+  }
 
-    // Increment a_phi by the result.
-    const Interval srcInterv = Interval(0, 0);
-    const Interval dstInterv = Interval(ivar, ivar);
+  // Increment a_phi by the result.
+  const Interval srcInterv = Interval(0, nComp - 1);
+  const Interval dstInterv = a_variables;
 
-    levelBuffer.copyTo(srcInterv, a_phi, dstInterv, m_levelCopier, EBAddOp());
-  }
+  levelBuffer.copyTo(srcInterv, a_phi, dstInterv, m_levelCopier, EBAddOp());
 }
 
 void
@@ -612,40 +636,93 @@ EBFluxRedistribution::redistributeFine(LevelData<EBCellFAB>&             a_phiFi
   const DataIterator&      ditFine   = dblFine.dataIterator();
   const EBISLayout&        ebislFine = m_eblgRefined.getEBISL();
   const int                nbox      = ditFine.size();
+  const int                nComp     = a_variables.size();
 
-  LevelData<EBCellFAB> fineBuffer(dblFine, 1, m_refToFine * m_redistRadius * IntVect::Unit, EBCellFactory(ebislFine));
+  LevelData<EBCellFAB> fineBuffer(dblFine,
+                                  nComp,
+                                  m_refToFine * m_redistRadius * IntVect::Unit,
+                                  EBCellFactory(ebislFine));
 
-  for (int ivar = a_variables.begin(); ivar <= a_variables.end(); ivar++) {
 #pragma omp parallel for schedule(runtime)
-    for (int mybox = 0; mybox < nbox; mybox++) {
-      const DataIndex& din = ditFine[mybox];
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex& din = ditFine[mybox];
 
-      const BaseIVFAB<Real>&       deltaM   = a_deltaM[din];
-      const BaseIVFAB<VoFStencil>& stencils = m_redistStencilsFine[din];
+    const RedistributionMap&     map      = m_redistMapFine[din];
+    const BaseIVFAB<VoFStencil>& stencils = m_redistStencilsFine[din];
 
-      EBCellFAB& buffer = fineBuffer[din];
-      buffer.setVal(0.0);
+    EBCellFAB& buffer = fineBuffer[din];
+    buffer.setVal(0.0);
 
-      // Apply stencil into buffer.
-      CH_START(t1);
-      VoFIterator& vofit = m_vofit[din];
-      for (vofit.reset(); vofit.ok(); ++vofit) {
-        const VolIndex&   vof      = vofit();
-        const VoFStencil& stencil  = stencils(vof, 0);
-        const Real&       massDiff = deltaM(vof, ivar);
+    // Apply stencils into buffer.
+    CH_START(t1);
+    this->redistributeBox(buffer, a_deltaM[din], map, stencils, a_scaleFine, a_variables);
+    CH_STOP(t1);
+  }
 
-        for (int i = 0; i < stencil.size(); i++) {
-          buffer(stencil.vof(i), 0) += a_scaleFine * stencil.weight(i) * massDiff;
-        }
+  // Increment a_phi by the result.
+  const Interval srcInterv = Interval(0, nComp - 1);
+  const Interval dstInterv = a_variables;
+
+  fineBuffer.copyTo(srcInterv, a_phiFine, dstInterv, m_fineCopier, EBAddOp());
+}
+
+void
+EBFluxRedistribution::redistributeBox(EBCellFAB&                   a_buffer,
+                                      const BaseIVFAB<Real>&       a_deltaM,
+                                      const RedistributionMap&     a_map,
+                                      const BaseIVFAB<VoFStencil>& a_stencils,
+                                      const Real                   a_scale,
+                                      const Interval&              a_variables) const noexcept
+{
+  CH_assert(a_buffer.nComp() == a_variables.size());
+  CH_assert(a_deltaM.nComp() > a_variables.end());
+
+  const int nComp    = a_variables.size();
+  const int firstVar = a_variables.begin();
+
+  // TLDR: Cut-cells with flattened stencils are done for all components in one pass over the stencils, writing directly
+  //       into the single-valued data. The remaining cut-cells use the VoFStencils.
+  BaseFab<Real>& bufferReg = a_buffer.getSingleValuedFAB();
+  const Box&     dataBox   = bufferReg.box();
+  const IntVect  dataLo    = dataBox.smallEnd();
+  const IntVect  stride(D_DECL(1, dataBox.size(0), dataBox.size(0) * dataBox.size(1)));
+
+  std::vector<Real*> data(nComp);
+  std::vector<Real>  mass(nComp);
+
+  for (int comp = 0; comp < nComp; comp++) {
+    data[comp] = bufferReg.dataPtr(comp);
+  }
+
+  const int numVofs = a_map.m_vofs.size();
+  for (int ivof = 0; ivof < numVofs; ivof++) {
+    const VolIndex& vof = a_map.m_vofs[ivof];
+
+    for (int comp = 0; comp < nComp; comp++) {
+      mass[comp] = a_scale * a_deltaM(vof, firstVar + comp);
+    }
+
+    for (int i = a_map.m_offsets[ivof]; i < a_map.m_offsets[ivof + 1]; i++) {
+      const IntVect iv     = a_map.m_cells[i] - dataLo;
+      const int     idx    = D_TERM(iv[0], +iv[1] * stride[1], +iv[2] * stride[2]);
+      const Real    weight = a_map.m_weights[i];
+
+      for (int comp = 0; comp < nComp; comp++) {
+        data[comp][idx] += weight * mass[comp];
       }
-      CH_STOP(t1);
     }
+  }
 
-    // Increment a_phi by the result.
-    const Interval srcInterv = Interval(0, 0);
-    const Interval dstInterv = Interval(ivar, ivar);
+  for (const VolIndex& vof : a_map.m_multiValuedVofs) {
+    const VoFStencil& stencil = a_stencils(vof, 0);
 
-    fineBuffer.copyTo(srcInterv, a_phiFine, dstInterv, m_fineCopier, EBAddOp());
+    for (int comp = 0; comp < nComp; comp++) {
+      const Real massDiff = a_deltaM(vof, firstVar + comp);
+
+      for (int i = 0; i < stencil.size(); i++) {
+        a_buffer(stencil.vof(i), comp) += a_scale * stencil.weight(i) * massDiff;
+      }
+    }
   }
 }
 
@@ -116,6 +116,16 @@ EBGradient::define(const EBLevelGrid& a_eblg,
   // Define optimized stencils.
   this->makeAggStencils();
 
+  if (MemoryTracker::isEnabled()) {
+    long long bytes = MemoryTracker::getBytes(m_levelStencils);
+
+    if (m_hasEBCF) {
+      bytes += MemoryTracker::getBytes(m_ebcfStencilsCoar) + MemoryTracker::getBytes(m_ebcfStencilsFine);
+    }
+
+    m_stencilMemory = MemoryTracker::track("Stencils/EBGradient", bytes);
+  }
+
   m_isDefined = true;
 }
 
@@ -133,16 +143,16 @@ EBGradient::computeLevelGradient(LevelData<EBCellFAB>& a_gradient, const LevelDa
   CH_TIMER("EBGradient::computeLevelGradient::set_covered_cells", t3);
 
   CH_assert(m_isDefined);
-  CH_assert(a_gradient.nComp() == SpaceDim);
-  CH_assert(a_phi.nComp() == 1);
+  CH_assert(a_gradient.nComp() == SpaceDim * a_phi.nComp());
   CH_assert(a_phi.ghostVect() == m_ghostVector);
   CH_assert(a_gradient.ghostVect() == m_ghostVector);
 
   // TLDR: This routine computes the level gradient, i.e. using finite difference stencils isolated to this level.
-  const DisjointBoxLayout& dbl   = m_eblg.getDBL();
-  const DataIterator&      dit   = dbl.dataIterator();
-  const EBISLayout&        ebisl = m_eblg.getEBISL();
-  const int                nbox  = dit.size();
+  const DisjointBoxLayout& dbl     = m_eblg.getDBL();
+  const DataIterator&      dit     = dbl.dataIterator();
+  const EBISLayout&        ebisl   = m_eblg.getEBISL();
+  const int                nbox    = dit.size();
+  const int                numComp = a_phi.nComp();
 
 #pragma omp parallel for schedule(runtime)
   for (int mybox = 0; mybox < nbox; mybox++) {
@@ -155,53 +165,29 @@ EBGradient::computeLevelGradient(LevelData<EBCellFAB>& a_gradient, const LevelDa
 
     if (!ebisBox.isAllCovered()) {
 
-      // Regular kernel -- this is the kernel used in regular cells. It just uses 2nd order centered differencing
-      // for the first derivative.
-      BaseFab<Real>&       gradFAB = grad.getSingleValuedFAB();
-      const BaseFab<Real>& phiFAB  = phi.getSingleValuedFAB();
-      const Real           idx     = 1. / (2.0 * m_dx);
-
-      auto regularKernel = [&](const IntVect& iv) -> void {
-        for (int dir = 0; dir < SpaceDim; dir++) {
-          gradFAB(iv, dir) = idx * (phiFAB(iv + BASISV(dir), m_comp) - phiFAB(iv - BASISV(dir), m_comp));
-        }
-      };
-
-      // Irregular kernel -- this is the kernel used in the cut-cells. It simply applies the finite difference based stencil.
-      auto irregularKernel = [&, this](const VolIndex& vof) -> void {
-        for (int dir = 0; dir < SpaceDim; dir++) {
-          grad(vof, dir) = 0.0;
-        }
-
-        // Apply stencil. Note that the stencil "variable" is the gradient component (i.e., direction)
-        auto& sten = m_levelStencils[din](vof, m_comp);
-        for (int i = 0; i < sten.size(); i++) {
-          const VolIndex& ivof    = sten.vof(i);
-          const Real&     iweight = sten.weight(i);
-          const Real&     ivar    = sten.variable(i);
-
-          grad(vof, ivar) += iweight * phi(ivof, m_comp);
-        }
-      };
-
-      // Now apply the kernels using our nifty BoxLoops.
+      // Regular cells use 2nd order centered differencing for the first derivative.
       CH_START(t1);
-      BoxLoops::loop(dbl[din], regularKernel);
+      for (int comp = 0; comp < numComp; comp++) {
+        this->computeRegularGradient(grad.getSingleValuedFAB(), phi.getSingleValuedFAB(), cellBox, comp, comp * SpaceDim);
+      }
       CH_STOP(t1);
 
-      // Irregular cells done using AggStencil. Which is faster.
+      // Irregular cells and domain boundary cells are done using AggStencil. Note that the stencil "variable" is the
+      // gradient component (i.e., direction), so there is one AggStencil per direction.
       CH_START(t2);
-      for (int dir = 0; dir < SpaceDim; dir++) {
-        EBCellFAB alias(Interval(dir, dir), grad);
-        m_aggLevelStencils[dir][din]->apply(alias, phi, 0, 0, 1, false);
+      for (int comp = 0; comp < numComp; comp++) {
+        for (int dir = 0; dir < SpaceDim; dir++) {
+          EBCellFAB alias(Interval(comp * SpaceDim + dir, comp * SpaceDim + dir), grad);
+          m_aggLevelStencils[dir][din]->apply(alias, phi, comp, 0, 1, false);
+        }
       }
       CH_STOP(t2);
     }
 
     // Covered data is always bogus.
     CH_START(t3);
-    for (int dir = 0; dir < SpaceDim; dir++) {
-      a_gradient[din].setCoveredCellVal(0.0, dir);
+    for (int comp = 0; comp < a_gradient.nComp(); comp++) {
+      grad.setCoveredCellVal(0.0, comp);
     }
     CH_STOP(t3);
   }
@@ -256,7 +242,7 @@ EBGradient::computeNormalDerivative(LevelData<EBFluxFAB>& a_gradient, const Leve
       // C++ kernel for regular grid faces. Note that we iterate over the IntVects in the face-centered boxes, so
       // the cell on the high side of the face has index iv and on the low side it has index iv - BASISV(dir);
       auto regularFaceDerivative = [&](const IntVect& iv) -> void {
-        regGradient(iv, dir) = idx * regPhi(iv, m_comp) - regPhi(iv - BASISV(dir), m_comp);
+        regGradient(iv, dir) = idx * (regPhi(iv, m_comp) - regPhi(iv - BASISV(dir), m_comp));
       };
 
       // Cut-cell version of the above.
@@ -287,9 +273,8 @@ EBGradient::computeAMRGradient(LevelData<EBCellFAB>&       a_gradient,
   CH_TIMER("EBGradient::computeAMRGradient::ebcf_calculate", t1);
 
   CH_assert(m_isDefined);
-  CH_assert(a_gradient.nComp() == SpaceDim);
-  CH_assert(a_phi.nComp() == 1);
-  CH_assert(a_phiFine.nComp() == 1);
+  CH_assert(a_gradient.nComp() == SpaceDim * a_phi.nComp());
+  CH_assert(a_phiFine.nComp() == a_phi.nComp());
 
   // TLDR: This routine computes the two-level gradient. It first computes the level gradient and then iterates through
   //       all cells that require a "two-level" view of the gradient.
@@ -300,12 +285,12 @@ EBGradient::computeAMRGradient(LevelData<EBCellFAB>&       a_gradient,
     const DisjointBoxLayout& dbl     = m_eblg.getDBL();
     const DisjointBoxLayout& dblFiCo = m_eblgFiCo.getDBL();
 
-    const EBISLayout& ebisl     = m_eblg.getEBISL();
     const EBISLayout& ebislFiCo = m_eblgFiCo.getEBISL();
 
-    const DataIterator dit = dbl.dataIterator();
+    const DataIterator dit     = dbl.dataIterator();
+    const int          numComp = a_phi.nComp();
 
-    LevelData<EBCellFAB> phiFiCo(dblFiCo, 1, m_ghostVector, EBCellFactory(ebislFiCo));
+    LevelData<EBCellFAB> phiFiCo(dblFiCo, numComp, m_ghostVector, EBCellFactory(ebislFiCo));
 
     a_phiFine.copyTo(phiFiCo, m_copier);
 
@@ -318,38 +303,76 @@ EBGradient::computeAMRGradient(LevelData<EBCellFAB>&       a_gradient,
       const EBCellFAB& phi      = a_phi[din];
       const EBCellFAB& phiFine  = phiFiCo[din];
 
-      const BaseIVFAB<VoFStencil>& stencilsCoar = m_ebcfStencilsCoar[din];
-      const BaseIVFAB<VoFStencil>& stencilsFine = m_ebcfStencilsFine[din];
-
-      auto kernel = [&](const VolIndex& vof) -> void {
-        const VoFStencil& stencilCoar = stencilsCoar(vof, m_comp);
-        const VoFStencil& stencilFine = stencilsFine(vof, m_comp);
-
+      // The coarse-level part of the stencil overwrites the level gradient and the fine-level part is added to it.
+      CH_START(t1);
+      for (int comp = 0; comp < numComp; comp++) {
         for (int dir = 0; dir < SpaceDim; dir++) {
-          gradient(vof, dir) = 0.0;
+          EBCellFAB alias(Interval(comp * SpaceDim + dir, comp * SpaceDim + dir), gradient);
+
+          m_aggEbcfStencilsCoar[dir][din]->apply(alias, phi, comp, 0, 1, false);
+          m_aggEbcfStencilsFine[dir][din]->apply(alias, phiFine, comp, 0, 1, true);
         }
+      }
+      CH_STOP(t1);
+    }
+  }
+}
 
-        for (int i = 0; i < stencilCoar.size(); i++) {
-          const VolIndex& coarVoF    = stencilCoar.vof(i);
-          const Real&     coarWeight = stencilCoar.weight(i);
-          const int&      coarVar    = stencilCoar.variable(i);
+void
+EBGradient::computeRegularGradient(BaseFab<Real>&       a_gradient,
+                                   const BaseFab<Real>& a_phi,
+                                   const Box&           a_cellBox,
+                                   const int            a_phiComp,
+                                   const int            a_gradComp) const noexcept
+{
+  CH_assert(a_phi.box().contains(grow(a_cellBox, 1)));
+  CH_assert(a_gradient.box().contains(a_cellBox));
+  CH_assert(a_gradient.nComp() >= a_gradComp + SpaceDim);
 
-          gradient(vof, coarVar) += coarWeight * phi(coarVoF, m_comp);
-        }
+  // Measured-cost accounting, see BoxCosts.
+  const BoxCosts::LoopTimer loopTimer;
 
-        for (int i = 0; i < stencilFine.size(); i++) {
-          const VolIndex& fineVoF    = stencilFine.vof(i);
-          const Real&     fineWeight = stencilFine.weight(i);
-          const int&      fineVar    = stencilFine.variable(i);
+  // TLDR: We index the data directly rather than through BaseFab::operator(), which lets the compiler vectorize the
+  //       innermost loop. The offset to the neighboring cells in direction dir is the stride of the input data in that
+  //       direction.
+  const Real factor = 1.0 / (2.0 * m_dx);
 
-          gradient(vof, fineVar) += fineWeight * phiFine(fineVoF, m_comp);
-        }
-      };
+  const Box&    phiBox  = a_phi.box();
+  const Box&    gradBox = a_gradient.box();
+  const IntVect lo      = a_cellBox.smallEnd();
+  const IntVect size    = a_cellBox.size();
 
-      CH_START(t1);
-      BoxLoops::loop(m_ebcfIterator[din], kernel);
-      CH_STOP(t1);
+  const IntVect phiStride(D_DECL(1, phiBox.size(0), phiBox.size(0) * phiBox.size(1)));
+  const IntVect gradStride(D_DECL(1, gradBox.size(0), gradBox.size(0) * gradBox.size(1)));
+
+  int phiOffset  = 0;
+  int gradOffset = 0;
+  for (int dir = 0; dir < SpaceDim; dir++) {
+    phiOffset += (lo[dir] - phiBox.smallEnd(dir)) * phiStride[dir];
+    gradOffset += (lo[dir] - gradBox.smallEnd(dir)) * gradStride[dir];
+  }
+
+  for (int dir = 0; dir < SpaceDim; dir++) {
+    const Real* phi  = a_phi.dataPtr(a_phiComp) + phiOffset;
+    Real*       grad = a_gradient.dataPtr(a_gradComp + dir) + gradOffset;
+
+    const int shift = phiStride[dir];
+
+#if CH_SPACEDIM == 3
+    for (int k = 0; k < size[2]; k++) {
+#endif
+      for (int j = 0; j < size[1]; j++) {
+        const Real* phiRow  = phi + D_TERM(0, +j * phiStride[1], +k * phiStride[2]);
+        Real*       gradRow = grad + D_TERM(0, +j * gradStride[1], +k * gradStride[2]);
+
+        CD_PRAGMA_SIMD
+        for (int i = 0; i < size[0]; i++) {
+          gradRow[i] = factor * (phiRow[i + shift] - phiRow[i - shift]);
+        }
+      }
+#if CH_SPACEDIM == 3
     }
+#endif
   }
 }
 
@@ -1079,39 +1102,58 @@ EBGradient::getLeastSquaresStencil(VoFStencil&            a_stencilCoar,
 void
 EBGradient::makeAggStencils() noexcept
 {
-  CH_TIMERS("EBGradient::makeAggStencils");
-  CH_TIMER("EBGradient::makeAggStencils::define_buffers", t1);
-  CH_TIMER("EBGradient::makeAggStencils::dbl_define", t2);
-  CH_TIMER("EBGradient::makeAggStencils::populate_stencil", t3);
-  CH_TIMER("EBGradient::makeAggStencils::define_aggstencil", t4);
+  CH_TIME("EBGradient::makeAggStencils");
 
-  CH_START(t1);
   // Make some proxies for the input/output data holders
   const DisjointBoxLayout& dbl   = m_eblg.getDBL();
   const EBISLayout&        ebisl = m_eblg.getEBISL();
 
   LevelData<EBCellFAB> proxy(dbl, 1, m_ghostVector, EBCellFactory(ebisl));
 
-  const DataIterator& dit  = dbl.dataIterator();
-  const int           nbox = dit.size();
-  CH_STOP(t1);
+  this->defineAggStencils(m_aggLevelStencils, m_levelStencils, m_levelIterator, proxy, proxy);
+
+  // The EBCF stencils are split into a part that reaches into the coarse-level data and a part that reaches into the
+  // fine-level data on the refined coarse grids.
+  if (m_hasEBCF) {
+    LevelData<EBCellFAB> proxyFiCo(m_eblgFiCo.getDBL(), 1, m_ghostVector, EBCellFactory(m_eblgFiCo.getEBISL()));
+
+    this->defineAggStencils(m_aggEbcfStencilsCoar, m_ebcfStencilsCoar, m_ebcfIterator, proxy, proxy);
+    this->defineAggStencils(m_aggEbcfStencilsFine, m_ebcfStencilsFine, m_ebcfIterator, proxyFiCo, proxy);
+  }
+}
+
+void
+EBGradient::defineAggStencils(LayoutData<RefCountedPtr<AggStencil<EBCellFAB, EBCellFAB>>> a_aggStencils[SpaceDim],
+                              const LayoutData<BaseIVFAB<VoFStencil>>&                    a_stencils,
+                              LayoutData<VoFIterator>&                                    a_iterator,
+                              const LevelData<EBCellFAB>&                                 a_srcProxy,
+                              const LevelData<EBCellFAB>&                                 a_dstProxy) noexcept
+{
+  CH_TIMERS("EBGradient::defineAggStencils");
+  CH_TIMER("EBGradient::defineAggStencils::dbl_define", t1);
+  CH_TIMER("EBGradient::defineAggStencils::populate_stencil", t2);
+  CH_TIMER("EBGradient::defineAggStencils::define_aggstencil", t3);
 
-  CH_START(t2);
+  const DisjointBoxLayout& dbl  = m_eblg.getDBL();
+  const DataIterator&      dit  = dbl.dataIterator();
+  const int                nbox = dit.size();
+
+  CH_START(t1);
   for (int dir = 0; dir < SpaceDim; dir++) {
-    m_aggLevelStencils[dir].define(dbl);
+    a_aggStencils[dir].define(dbl);
   }
-  CH_STOP(t2);
+  CH_STOP(t1);
 
 #pragma omp parallel for schedule(runtime)
   for (int mybox = 0; mybox < nbox; mybox++) {
     const DataIndex& din = dit[mybox];
 
-    const BaseIVFAB<VoFStencil>& rawStencils = m_levelStencils[din];
+    const BaseIVFAB<VoFStencil>& rawStencils = a_stencils[din];
 
     for (int dir = 0; dir < SpaceDim; dir++) {
 
       // Populate stencils
-      CH_START(t3);
+      CH_START(t2);
       Vector<RefCountedPtr<BaseIndex>>   dstBaseIndex;
       Vector<RefCountedPtr<BaseStencil>> dstBaseStencil;
 
@@ -1130,13 +1172,13 @@ EBGradient::makeAggStencils() noexcept
         dstBaseStencil.push_back(RefCountedPtr<BaseStencil>(new VoFStencil(derivDirStencil)));
       };
 
-      BoxLoops::loop(m_levelIterator[din], kernel);
-      CH_STOP(t3);
+      BoxLoops::loop(a_iterator[din], kernel);
+      CH_STOP(t2);
 
-      CH_START(t4);
-      m_aggLevelStencils[dir][din] = RefCountedPtr<AggStencil<EBCellFAB, EBCellFAB>>(
-        new AggStencil<EBCellFAB, EBCellFAB>(dstBaseIndex, dstBaseStencil, proxy[din], proxy[din]));
-      CH_STOP(t4);
+      CH_START(t3);
+      a_aggStencils[dir][din] = RefCountedPtr<AggStencil<EBCellFAB, EBCellFAB>>(
+        new AggStencil<EBCellFAB, EBCellFAB>(dstBaseIndex, dstBaseStencil, a_srcProxy[din], a_dstProxy[din]));
+      CH_STOP(t3);
     }
   }
 }
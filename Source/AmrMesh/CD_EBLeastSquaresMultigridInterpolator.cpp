@@ -114,19 +114,19 @@ EBLeastSquaresMultigridInterpolator::coarseFineInterp(LevelData<EBCellFAB>&
   const DataIterator dit  = a_phiFine.dataIterator();
   const int          nbox = dit.size();
 
-  LevelData<EBCellFAB> phiCoFi(m_eblgCoFi.getDBL(), 1, m_ghostVectorCoFi, EBCellFactory(m_eblgCoFi.getEBISL()));
+  // Copy all the variables to the buffer in one go, which holds the data on the coarse grid cells around each fine-grid
+  // patch. Note that the buffer provides a LOCAL view of the coarse grid around each fine-level patch, so we can apply
+  // the stencils directly.
+  LevelData<EBCellFAB>& phiCoFi = this->getCoarseBuffer(a_variables.size());
 
-  // Interpolate all variables near the EB. We will copy a_phiCoar to phiCoFi which holds the data on the coarse grid cells around each fine-grid
-  // patch. Note that phiCoFi provides a LOCAL view of the coarse grid around each fine-level patch, so we can apply the stencils directly.
-  for (int icomp = a_variables.begin(); icomp <= a_variables.end(); icomp++) {
-    const Interval srcInterv = Interval(icomp, icomp);
-    const Interval dstInterv = Interval(m_comp, m_comp);
+  a_phiCoar.copyTo(a_variables, phiCoFi, Interval(0, a_variables.size() - 1), m_copier);
 
-    // Copy to buffer
-    a_phiCoar.copyTo(srcInterv, phiCoFi, dstInterv, m_copier);
+  // Interpolate all variables near the EB.
+  for (int icomp = a_variables.begin(); icomp <= a_variables.end(); icomp++) {
+    const int coarComp = icomp - a_variables.begin();
 
     // Do regular interpolation as if the EB is not there.
-    this->regularCoarseFineInterp(a_phiFine, phiCoFi, icomp, 0);
+    this->regularCoarseFineInterp(a_phiFine, phiCoFi, icomp, coarComp);
 
     // Go through each grid patch and the to-be-interpolated ghost cells across the refinement boundary. We simply
     // apply the stencils here.
@@ -141,7 +141,7 @@ EBLeastSquaresMultigridInterpolator::coarseFineInterp(LevelData<EBCellFAB>&
       // Apply the coarse and fine stencils
       constexpr int numComp = 1;
       CH_START(t1);
-      m_aggCoarStencils[din]->apply(dstFine, srcCoar, m_comp, icomp, numComp, false);
+      m_aggCoarStencils[din]->apply(dstFine, srcCoar, coarComp, icomp, numComp, false);
       CH_STOP(t1);
 
       CH_START(t2);
@@ -197,28 +197,24 @@ EBLeastSquaresMultigridInterpolator::coarseFineInterpH(EBCellFAB&       a_phi,
 
   for (int ivar = a_variables.begin(); ivar <= a_variables.end(); ivar++) {
 
-    // Do the regular interp on all sides of the current patch.
+    // Do the regular interp on all sides of the current patch that have ghost cells on the refinement boundary.
     CH_START(t1);
-    for (int dir = 0; dir < SpaceDim; dir++) {
-      for (SideIterator sit; sit.ok(); ++sit) {
-        const IntVect shift = sign(sit()) * BASISV(dir);
-
-        // Regular homogeneous interpolation on side sit() in direction dir
-        const Box ghostBox = m_cfivs[a_dit].at(std::make_pair(dir, sit()));
-
-        if (!ghostBox.isEmpty()) {
-          BaseFab<Real>& phiReg = a_phi.getSingleValuedFAB();
-
-          // C++ kernel for homogeneous interpolation along a line, assumning that coarse-grid
-          // data is zero.
-          auto interpHomo = [&](const IntVect& iv) -> void {
-            phiReg(iv, ivar) = c1 * phiReg(iv - shift, ivar) + c2 * phiReg(iv - 2 * shift, ivar);
-          };
-
-          // Apply the kernel.
-          BoxLoops::loop(ghostBox, interpHomo);
-        }
-      }
+    BaseFab<Real>& phiReg = a_phi.getSingleValuedFAB();
+
+    for (const auto& ghostFace : m_cfGhostBoxes[a_dit]) {
+      const int            dir      = std::get<0>(ghostFace);
+      const Side::LoHiSide side     = std::get<1>(ghostFace);
+      const Box&           ghostBox = std::get<2>(ghostFace);
+      const IntVect        shift    = sign(side) * BASISV(dir);
+
+      // C++ kernel for homogeneous interpolation along a line, assumning that coarse-grid
+      // data is zero.
+      auto interpHomo = [&](const IntVect& iv) -> void {
+        phiReg(iv, ivar) = c1 * phiReg(iv - shift, ivar) + c2 * phiReg(iv - 2 * shift, ivar);
+      };
+
+      // Apply the kernel.
+      BoxLoops::loop(ghostBox, interpHomo);
     }
     CH_STOP(t1);
 
@@ -246,6 +242,7 @@ EBLeastSquaresMultigridInterpolator::defineGhostRegions() noexcept
   // Define the "regular" ghost interpolation regions. This is just one cell wide since the operator stencil
   // has a width of 1 in regular cells.
   m_cfivs.define(dbl);
+  m_cfGhostBoxes.define(dbl);
 
 #pragma omp parallel for schedule(runtime)
   for (int mybox = 0; mybox < nbox; mybox++) {
@@ -269,6 +266,10 @@ EBLeastSquaresMultigridInterpolator::defineGhostRegions() noexcept
         cfivs.recalcMinBox();
 
         cfivsBoxes.emplace(std::make_pair(dir, sit()), cfivs.minBox());
+
+        if (!(cfivs.minBox().isEmpty())) {
+          m_cfGhostBoxes[din].emplace_back(dir, sit(), cfivs.minBox());
+        }
       }
     }
   }
@@ -317,6 +318,18 @@ EBLeastSquaresMultigridInterpolator::defineBuffers() noexcept
   m_copier.define(m_eblgCoar.getDBL(), m_eblgCoFi.getDBL(), m_ghostVectorCoFi);
 }
 
+LevelData<EBCellFAB>&
+EBLeastSquaresMultigridInterpolator::getCoarseBuffer(const int a_numComp) const noexcept
+{
+  CH_TIME("EBLeastSquaresMultigridInterpolator::getCoarseBuffer");
+
+  if (!(m_phiCoFi.isDefined()) || m_phiCoFi.nComp() != a_numComp) {
+    m_phiCoFi.define(m_eblgCoFi.getDBL(), a_numComp, m_ghostVectorCoFi, EBCellFactory(m_eblgCoFi.getEBISL()));
+  }
+
+  return m_phiCoFi;
+}
+
 void
 EBLeastSquaresMultigridInterpolator::defineCoarseInterp() noexcept
 {
@@ -748,65 +761,65 @@ EBLeastSquaresMultigridInterpolator::regularCoarseFineInterp(LevelData<EBCellFAB
     FArrayBox&       finePhi = a_finePhi[din].getFArrayBox();
     const FArrayBox& coarPhi = a_coarPhi[din].getFArrayBox();
 
-    for (int dir = 0; dir < SpaceDim; dir++) {
-      for (SideIterator sit; sit.ok(); ++sit) {
-        const int iHiLo     = sign(sit());
-        const Box interpBox = m_cfivs[din].at(std::make_pair(dir, sit()));
+    for (const auto& ghostFace : m_cfGhostBoxes[din]) {
+      const int            dir       = std::get<0>(ghostFace);
+      const Side::LoHiSide side      = std::get<1>(ghostFace);
+      const Box&           interpBox = std::get<2>(ghostFace);
+      const int            iHiLo     = sign(side);
 
-        // Coarse-side interpolation stencil. This does interpolation orthogonal to direction 'dir'
-        const CoarseInterpQuadCF& coarseStencils = (sit() == Side::Lo) ? m_loCoarseInterpCF[dir][din]
-                                                                       : m_hiCoarseInterpCF[dir][din];
+      // Coarse-side interpolation stencil. This does interpolation orthogonal to direction 'dir'
+      const CoarseInterpQuadCF& coarseStencils = (side == Side::Lo) ? m_loCoarseInterpCF[dir][din]
+                                                                    : m_hiCoarseInterpCF[dir][din];
 
-        // Adds first derivative to the Taylor expansion.
-        auto applyDerivs = [&](const IntVect& fineIV) -> void {
-          const IntVect coarIV = coarsen(fineIV, m_refRat);
+      // Adds first derivative to the Taylor expansion.
+      auto applyDerivs = [&](const IntVect& fineIV) -> void {
+        const IntVect coarIV = coarsen(fineIV, m_refRat);
 
-          finePhi(fineIV, a_fineVar) = coarPhi(coarIV, a_coarVar);
+        finePhi(fineIV, a_fineVar) = coarPhi(coarIV, a_coarVar);
 
-          // Displacement vector from coarse-grid cell to fine-grid ghost cell. Note that this is normalized by
-          // the coarse grid cell size.
-          const RealVect delta = (RealVect(fineIV) - m_refRat * RealVect(coarIV) + 0.5 * (1.0 - m_refRat)) / m_refRat;
+        // Displacement vector from coarse-grid cell to fine-grid ghost cell. Note that this is normalized by
+        // the coarse grid cell size.
+        const RealVect delta = (RealVect(fineIV) - m_refRat * RealVect(coarIV) + 0.5 * (1.0 - m_refRat)) / m_refRat;
 
-          // Add contributions from first and second derivatives.
-          for (int d = 0; d < SpaceDim; d++) {
-            if (d != dir) {
-              const Real firstDeriv  = coarseStencils.computeFirstDeriv(coarPhi, coarIV, d, a_coarVar);
-              const Real secondDeriv = coarseStencils.computeSecondDeriv(coarPhi, coarIV, d, a_coarVar);
+        // Add contributions from first and second derivatives.
+        for (int d = 0; d < SpaceDim; d++) {
+          if (d != dir) {
+            const Real firstDeriv  = coarseStencils.computeFirstDeriv(coarPhi, coarIV, d, a_coarVar);
+            const Real secondDeriv = coarseStencils.computeSecondDeriv(coarPhi, coarIV, d, a_coarVar);
 
-              finePhi(fineIV, a_fineVar) += firstDeriv * delta[d] + 0.5 * secondDeriv * delta[d] * delta[d];
-            }
+            finePhi(fineIV, a_fineVar) += firstDeriv * delta[d] + 0.5 * secondDeriv * delta[d] * delta[d];
           }
+        }
 
 #if CH_SPACEDIM == 3
-          // Add contribution from mixed derivative. Only in 3D.
-          Real mixedDeriv = coarseStencils.computeMixedDeriv(coarPhi, coarIV, a_coarVar);
-          for (int d = 0; d < SpaceDim; d++) {
-            if (d != dir) {
-              mixedDeriv *= delta[d];
-            }
+        // Add contribution from mixed derivative. Only in 3D.
+        Real mixedDeriv = coarseStencils.computeMixedDeriv(coarPhi, coarIV, a_coarVar);
+        for (int d = 0; d < SpaceDim; d++) {
+          if (d != dir) {
+            mixedDeriv *= delta[d];
           }
-          finePhi(fineIV, a_fineVar) += mixedDeriv;
+        }
+        finePhi(fineIV, a_fineVar) += mixedDeriv;
 #endif
-        };
+      };
 
-        // We've put the coarse-grid interpolation into finePhi(fineIV, a_fineVar). Now use that value
-        // when doing quadratic interpolation with the additional fine-grid data.
-        auto interpOnFine = [&](const IntVect& fineIV) -> void {
-          const Real phi0 = finePhi(fineIV, a_fineVar);
-          const Real phi1 = finePhi(fineIV - iHiLo * BASISV(dir), a_fineVar);
-          const Real phi2 = finePhi(fineIV - 2 * iHiLo * BASISV(dir), a_fineVar);
+      // We've put the coarse-grid interpolation into finePhi(fineIV, a_fineVar). Now use that value
+      // when doing quadratic interpolation with the additional fine-grid data.
+      auto interpOnFine = [&](const IntVect& fineIV) -> void {
+        const Real phi0 = finePhi(fineIV, a_fineVar);
+        const Real phi1 = finePhi(fineIV - iHiLo * BASISV(dir), a_fineVar);
+        const Real phi2 = finePhi(fineIV - 2 * iHiLo * BASISV(dir), a_fineVar);
 
-          finePhi(fineIV, a_fineVar) = phi0 * L0 + phi1 * L1 + phi2 * L2;
-        };
+        finePhi(fineIV, a_fineVar) = phi0 * L0 + phi1 * L1 + phi2 * L2;
+      };
 
-        CH_START(t1);
-        BoxLoops::loop(interpBox, applyDerivs);
-        CH_STOP(t1);
+      CH_START(t1);
+      BoxLoops::loop(interpBox, applyDerivs);
+      CH_STOP(t1);
 
-        CH_START(t2);
-        BoxLoops::loop(interpBox, interpOnFine);
-        CH_STOP(t2);
-      }
+      CH_START(t2);
+      BoxLoops::loop(interpBox, interpOnFine);
+      CH_STOP(t2);
     }
   }
 }
@@ -118,76 +118,80 @@ EBMGProlong::prolongResidual(LevelData<EBCellFAB>&       a_fineData,
   CH_assert(a_fineData.nComp() > a_variables.end());
   CH_assert(a_coarData.nComp() > a_variables.end());
 
-  LevelData<EBCellFAB> coFiData(m_eblgCoFi.getDBL(), 1, IntVect::Zero, EBCellFactory(m_eblgCoFi.getEBISL()));
+  // TLDR: All variables are copied to the buffer in one go, after which each patch is prolonged for all variables in a
+  //       single pass.
+  const int numVars = a_variables.size();
 
-  const Box refineBox(IntVect::Zero, (m_refRat - 1) * IntVect::Unit);
+  LevelData<EBCellFAB> coFiData(m_eblgCoFi.getDBL(), numVars, IntVect::Zero, EBCellFactory(m_eblgCoFi.getEBISL()));
 
-  for (int ivar = a_variables.begin(); ivar <= a_variables.end(); ivar++) {
+  const Box refineBox(IntVect::Zero, (m_refRat - 1) * IntVect::Unit);
 
-    // Copy coarse data to buffer.
-    const Interval srcComps = Interval(ivar, ivar);
-    const Interval dstComps = Interval(0, 0);
+  // Copy coarse data to buffer.
+  const Interval dstComps = Interval(0, numVars - 1);
 
-    a_coarData.copyTo(srcComps, coFiData, dstComps, m_copier);
+  a_coarData.copyTo(a_variables, coFiData, dstComps, m_copier);
 
-    // Add coarse-grid residual to the fine grid. Recall that m_eblgCoFi is a coarsening of the fine grid
-    // so this runs over the part of the coarse level that is covered by the finer level.
-    const DisjointBoxLayout& dblCoFi   = m_eblgCoFi.getDBL();
-    const EBISLayout&        ebislFine = m_eblgFine.getEBISL();
+  // Add coarse-grid residual to the fine grid. Recall that m_eblgCoFi is a coarsening of the fine grid
+  // so this runs over the part of the coarse level that is covered by the finer level.
+  const DisjointBoxLayout& dblCoFi   = m_eblgCoFi.getDBL();
+  const EBISLayout&        ebislFine = m_eblgFine.getEBISL();
 
-    const DataIterator& dit  = dblCoFi.dataIterator();
-    const int           nbox = dit.size();
+  const DataIterator& dit  = dblCoFi.dataIterator();
+  const int           nbox = dit.size();
 
 #pragma omp parallel for schedule(runtime)
-    for (int mybox = 0; mybox < nbox; mybox++) {
-      const DataIndex& din = dit[mybox];
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex& din = dit[mybox];
 
-      EBCellFAB&       fineData = a_fineData[din];
-      const EBCellFAB& coarData = coFiData[din];
+    EBCellFAB&       fineData = a_fineData[din];
+    const EBCellFAB& coarData = coFiData[din];
 
-      FArrayBox&       fineDataReg = fineData.getFArrayBox();
-      const FArrayBox& coarDataReg = coarData.getFArrayBox();
+    FArrayBox&       fineDataReg = fineData.getFArrayBox();
+    const FArrayBox& coarDataReg = coarData.getFArrayBox();
 
-      const EBISBox& ebisBoxFine = ebislFine[din];
+    const EBISBox& ebisBoxFine = ebislFine[din];
 
-      const BaseIVFAB<VoFStencil>& prolongStencils = m_prolongStencils[din];
+    const BaseIVFAB<VoFStencil>& prolongStencils = m_prolongStencils[din];
 
-      // Regular kernel.
-      auto regularKernel = [&](const IntVect& ivCoar) -> void {
-        for (BoxIterator bit(refineBox); bit.ok(); ++bit) {
-          const IntVect ivFine = m_refRat * ivCoar + bit();
+    // Regular kernel.
+    auto regularKernel = [&](const IntVect& ivCoar) -> void {
+      for (BoxIterator bit(refineBox); bit.ok(); ++bit) {
+        const IntVect ivFine = m_refRat * ivCoar + bit();
 
-          // Put a guard for cut-cells on the fine grid because the irregular will do those.
-          if (!(ebisBoxFine.isIrregular(ivFine))) {
-            fineDataReg(ivFine, ivar) += coarDataReg(ivCoar, 0);
+        // Put a guard for cut-cells on the fine grid because the irregular will do those.
+        if (!(ebisBoxFine.isIrregular(ivFine))) {
+          for (int ivar = 0; ivar < numVars; ivar++) {
+            fineDataReg(ivFine, a_variables.begin() + ivar) += coarDataReg(ivCoar, ivar);
           }
         }
-      };
+      }
+    };
 
-      // Irregular kernel
-      auto irregularKernel = [&](const VolIndex& fineVoF) -> void {
-        const VoFStencil& prolongSten = prolongStencils(fineVoF, 0);
+    // Irregular kernel
+    auto irregularKernel = [&](const VolIndex& fineVoF) -> void {
+      const VoFStencil& prolongSten = prolongStencils(fineVoF, 0);
 
-        for (int i = 0; i < prolongSten.size(); i++) {
-          const VolIndex& coarVoF    = prolongSten.vof(i);
-          const Real&     coarWeight = prolongSten.weight(i);
+      for (int i = 0; i < prolongSten.size(); i++) {
+        const VolIndex& coarVoF    = prolongSten.vof(i);
+        const Real&     coarWeight = prolongSten.weight(i);
 
-          fineData(fineVoF, ivar) += coarWeight * coarData(coarVoF, 0);
+        for (int ivar = 0; ivar < numVars; ivar++) {
+          fineData(fineVoF, a_variables.begin() + ivar) += coarWeight * coarData(coarVoF, ivar);
         }
-      };
+      }
+    };
 
-      // Run kernels
-      const Box    coarBox  = dblCoFi[din];
-      VoFIterator& fineVoFs = m_vofitFine[din];
+    // Run kernels
+    const Box    coarBox  = dblCoFi[din];
+    VoFIterator& fineVoFs = m_vofitFine[din];
 
-      CH_START(t1);
-      BoxLoops::loop(coarBox, regularKernel);
-      CH_STOP(t1);
+    CH_START(t1);
+    BoxLoops::loop(coarBox, regularKernel);
+    CH_STOP(t1);
 
-      CH_START(t2);
-      BoxLoops::loop(fineVoFs, irregularKernel);
-      CH_STOP(t2);
-    }
+    CH_START(t2);
+    BoxLoops::loop(fineVoFs, irregularKernel);
+    CH_STOP(t2);
   }
 }
 
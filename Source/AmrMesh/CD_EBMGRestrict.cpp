@@ -129,66 +129,75 @@ EBMGRestrict::restrictResidual(LevelData<EBCellFAB>&       a_coarData,
   const DisjointBoxLayout& dblCoFi   = m_eblgCoFi.getDBL();
   const EBISLayout&        ebislCoFi = m_eblgCoFi.getEBISL();
 
-  LevelData<EBCellFAB> coFiData(dblCoFi, 1, IntVect::Zero, EBCellFactory(ebislCoFi));
+  // TLDR: All variables are restricted into one buffer in a single pass over the patches, after which we copy the
+  //       buffer to the coarse grid in one go. The regular kernel accumulates one of the fine-grid offsets at a time so
+  //       that the innermost loop runs over contiguous cells.
+  const int numVars = a_variables.size();
+
+  LevelData<EBCellFAB> coFiData(dblCoFi, numVars, IntVect::Zero, EBCellFactory(ebislCoFi));
 
   const DataIterator& dit  = dblCoFi.dataIterator();
   const int           nbox = dit.size();
 
-  for (int ivar = a_variables.begin(); ivar <= a_variables.end(); ivar++) {
-
 #pragma omp parallel for schedule(runtime)
-    for (int mybox = 0; mybox < nbox; mybox++) {
-      const DataIndex& din      = dit[mybox];
-      EBCellFAB&       coarData = coFiData[din];
-      const EBCellFAB& fineData = a_fineData[din];
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex& din      = dit[mybox];
+    EBCellFAB&       coarData = coFiData[din];
+    const EBCellFAB& fineData = a_fineData[din];
 
-      FArrayBox&       coarDataReg = coarData.getFArrayBox();
-      const FArrayBox& fineDataReg = fineData.getFArrayBox();
+    FArrayBox&       coarDataReg = coarData.getFArrayBox();
+    const FArrayBox& fineDataReg = fineData.getFArrayBox();
 
-      const BaseIVFAB<VoFStencil>& restrictStencils = m_restrictStencils[din];
+    const BaseIVFAB<VoFStencil>& restrictStencils = m_restrictStencils[din];
 
-      // Regular kernel.
-      auto regularKernel = [&](const IntVect& ivCoar) -> void {
-        for (BoxIterator bit(refineBox); bit.ok(); ++bit) {
-          const IntVect ivFine = m_refRat * ivCoar + bit();
+    const Box    coarBox  = dblCoFi[din];
+    VoFIterator& coarVoFs = m_vofitCoar[din];
 
-          coarDataReg(ivCoar, 0) += regFineWeight * fineDataReg(ivFine, ivar);
-        }
-      };
+    // Irregular kernel
+    auto irregularKernel = [&](const VolIndex& coarVoF) -> void {
+      const VoFStencil& restrictSten = restrictStencils(coarVoF, 0);
 
-      // Irregular kernel
-      auto irregularKernel = [&](const VolIndex& coarVoF) -> void {
-        const VoFStencil& restrictSten = restrictStencils(coarVoF, 0);
+      for (int ivar = 0; ivar < numVars; ivar++) {
+        const int fineVar = a_variables.begin() + ivar;
 
-        coarData(coarVoF, 0) = 0.0;
+        coarData(coarVoF, ivar) = 0.0;
         for (int i = 0; i < restrictSten.size(); i++) {
           const VolIndex& fineVoF    = restrictSten.vof(i);
           const Real&     fineWeight = restrictSten.weight(i);
 
-          coarData(coarVoF, 0) += fineWeight * fineData(fineVoF, ivar);
+          coarData(coarVoF, ivar) += fineWeight * fineData(fineVoF, fineVar);
         }
-      };
+      }
+    };
 
-      // Run kernels
-      coarData.setVal(0.0);
+    // Run kernels
+    coarData.setVal(0.0);
 
-      const Box    coarBox  = dblCoFi[din];
-      VoFIterator& coarVoFs = m_vofitCoar[din];
+    CH_START(t2);
+    for (int ivar = 0; ivar < numVars; ivar++) {
+      const int fineVar = a_variables.begin() + ivar;
 
-      CH_START(t2);
-      BoxLoops::loop(coarBox, regularKernel);
-      CH_STOP(t2);
+      for (BoxIterator bit(refineBox); bit.ok(); ++bit) {
+        const IntVect offset = bit();
 
-      CH_START(t3);
-      BoxLoops::loop(coarVoFs, irregularKernel);
-      CH_STOP(t3);
-    }
+        // Regular kernel.
+        auto regularKernel = [&](const IntVect& ivCoar) -> void {
+          coarDataReg(ivCoar, ivar) += regFineWeight * fineDataReg(m_refRat * ivCoar + offset, fineVar);
+        };
 
-    const Interval srcComps = Interval(0, 0);
-    const Interval dstComps = Interval(ivar, ivar);
+        BoxLoops::loop(coarBox, regularKernel);
+      }
+    }
+    CH_STOP(t2);
 
-    coFiData.copyTo(srcComps, a_coarData, dstComps, m_copier);
+    CH_START(t3);
+    BoxLoops::loop(coarVoFs, irregularKernel);
+    CH_STOP(t3);
   }
+
+  const Interval srcComps = Interval(0, numVars - 1);
+
+  coFiData.copyTo(srcComps, a_coarData, a_variables, m_copier);
 }
 
 #include <CD_NamespaceFooter.H>
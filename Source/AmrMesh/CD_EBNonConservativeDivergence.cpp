@@ -151,4 +151,61 @@ EBNonConservativeDivergence::nonConservativeDivergence(LevelData<BaseIVFAB<Real>
   }
 }
 
+void
+EBNonConservativeDivergence::hybridDivergence(LevelData<EBCellFAB>&       a_divF,
+                                              LevelData<BaseIVFAB<Real>>& a_massDifference,
+                                              LevelData<BaseIVFAB<Real>>& a_nonConsDivF) const noexcept
+{
+  CH_TIME("EBNonConservativeDivergence::hybridDivergence");
+
+  CH_assert(m_isDefined);
+  CH_assert(a_divF.nComp() == a_massDifference.nComp());
+  CH_assert(a_divF.nComp() == a_nonConsDivF.nComp());
+  CH_assert(a_divF.disjointBoxLayout() == m_eblg.getDBL());
+
+  const DisjointBoxLayout& dbl   = m_eblg.getDBL();
+  const EBISLayout&        ebisl = m_eblg.getEBISL();
+  const DataIterator&      dit   = dbl.dataIterator();
+
+  const int nComp = a_divF.nComp();
+  const int nbox  = dit.size();
+
+#pragma omp parallel for schedule(runtime)
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex&             din      = dit[mybox];
+    const BaseIVFAB<VoFStencil>& stencils = m_stencils[din];
+    const EBISBox&               ebisbox  = ebisl[din];
+
+    EBCellFAB&       divF        = a_divF[din];
+    BaseIVFAB<Real>& deltaM      = a_massDifference[din];
+    BaseIVFAB<Real>& nonConsDivF = a_nonConsDivF[din];
+
+    for (int comp = 0; comp < nComp; comp++) {
+
+      // The stencils read kappa*div(F) in neighboring cut-cells, so the non-conservative divergence must be computed
+      // for all cut-cells in the patch before we overwrite divF.
+      auto nonConsKernel = [&](const VolIndex& vof) -> void {
+        nonConsDivF(vof, comp) = 0.0;
+
+        const VoFStencil& stencil = stencils(vof, 0);
+        for (int i = 0; i < stencil.size(); i++) {
+          nonConsDivF(vof, comp) += stencil.weight(i) * divF(stencil.vof(i), comp);
+        }
+      };
+
+      auto hybridKernel = [&](const VolIndex& vof) -> void {
+        const Real kappa = ebisbox.volFrac(vof);
+        const Real dc    = divF(vof, comp);
+        const Real dnc   = nonConsDivF(vof, comp);
+
+        divF(vof, comp)   = dc + (1 - kappa) * dnc;
+        deltaM(vof, comp) = (1 - kappa) * (dc - kappa * dnc);
+      };
+
+      BoxLoops::loop(m_vofIterator[din], nonConsKernel);
+      BoxLoops::loop(m_vofIterator[din], hybridKernel);
+    }
+  }
+}
+
 #include <CD_NamespaceFooter.H>
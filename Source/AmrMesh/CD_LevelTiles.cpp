@@ -9,6 +9,9 @@
   @author Robert Marskar
 */
 
+// Std includes
+#include <algorithm>
+
 // Chombo includes
 #include <CH_Timer.H>
 #include <BoxLayout.H>
@@ -22,7 +25,9 @@ LevelTiles::LevelTiles() noexcept
 {
   CH_TIME("LevelTiles::LevelTiles(weak)");
 
-  m_isDefined = false;
+  m_isDefined     = false;
+  m_useDenseTiles = false;
+  m_mortonBits    = 0;
 }
 
 LevelTiles::LevelTiles(const DisjointBoxLayout& a_dbl, const int a_blockingFactor) noexcept
@@ -69,13 +74,94 @@ LevelTiles::define(const DisjointBoxLayout& a_dbl, const int a_blockingFactor) n
   }
 
   // Figure out which global indices correspond to which local indices.
+  m_dataIndices.resize(a_dbl.size());
+
   for (DataIterator dit(a_dbl); dit.ok(); ++dit) {
     m_myGrids[a_dbl.index(dit())] = dit();
+
+    m_dataIndices[a_dbl.index(dit())] = dit();
   }
 
+  this->defineTileIndex(a_dbl, a_blockingFactor);
+
   m_isDefined = true;
 }
 
+void
+LevelTiles::defineTileIndex(const DisjointBoxLayout& a_dbl, const int a_blockingFactor) noexcept
+{
+  CH_TIME("LevelTiles::defineTileIndex");
+
+  const unsigned int numTiles = a_dbl.size();
+
+  std::vector<IntVect> tiles(numTiles);
+
+  IntVect lo = IntVect::Zero;
+  IntVect hi = IntVect::Zero;
+
+  m_tileBox = Box();
+  m_gridRanks.resize(numTiles);
+  m_denseTiles.clear();
+  m_sortedTiles.clear();
+
+  for (LayoutIterator lit = a_dbl.layoutIterator(); lit.ok(); ++lit) {
+    const LayoutIndex  lidx   = lit();
+    const IntVect      tile   = coarsen(a_dbl[lidx], a_blockingFactor).smallEnd();
+    const unsigned int tileID = a_dbl.index(lidx);
+
+    tiles[tileID]       = tile;
+    m_gridRanks[tileID] = a_dbl.procID(lidx);
+  }
+
+  // Bounding box of the tiles.
+  for (unsigned int tileID = 0; tileID < numTiles; tileID++) {
+    if (tileID == 0) {
+      lo = tiles[tileID];
+      hi = tiles[tileID];
+    }
+    else {
+      lo.min(tiles[tileID]);
+      hi.max(tiles[tileID]);
+    }
+  }
+
+  if (numTiles > 0) {
+    m_tileBox = Box(lo, hi);
+  }
+
+  // Number of bits required for the Morton index.
+  m_mortonBits = 0;
+  for (int dir = 0; dir < SpaceDim; dir++) {
+    while ((1 << m_mortonBits) < (hi[dir] - lo[dir] + 1)) {
+      m_mortonBits++;
+    }
+  }
+
+  // Use the dense index if the bounding box is not too sparsely populated. The Morton index is used as a fallback and
+  // must fit in 64 bits.
+  m_useDenseTiles = m_tileBox.isEmpty() || m_tileBox.numPts() <= s_maxDenseRatio * numTiles ||
+                    m_mortonBits * SpaceDim > 64;
+
+  if (m_useDenseTiles) {
+    if (!(m_tileBox.isEmpty())) {
+      m_denseTiles.resize(m_tileBox.numPts(), -1);
+    }
+
+    for (unsigned int tileID = 0; tileID < numTiles; tileID++) {
+      m_denseTiles[m_tileBox.index(tiles[tileID])] = tileID;
+    }
+  }
+  else {
+    m_sortedTiles.reserve(numTiles);
+
+    for (unsigned int tileID = 0; tileID < numTiles; tileID++) {
+      m_sortedTiles.emplace_back(this->computeMortonIndex(tiles[tileID]), tileID);
+    }
+
+    std::sort(m_sortedTiles.begin(), m_sortedTiles.end());
+  }
+}
+
 const std::map<IntVect, unsigned int, LevelTiles::TileComparator>&
 LevelTiles::getMyTiles() const noexcept
 {
@@ -9,6 +9,11 @@
   @author  Robert Marskar
 */
 
+// Std includes
+#include <map>
+#include <limits>
+#include <functional>
+
 // Chombo includes
 #include <ParmParse.H>
 
@@ -16,6 +21,503 @@
 #include <CD_LoadBalancing.H>
 #include <CD_NamespaceHeader.H>
 
+std::vector<std::vector<int>> LoadBalancing::s_nodeRanks;
+
+std::vector<std::vector<std::pair<int, long>>>
+LoadBalancing::computeOverlaps(const Vector<Box>& a_boxes, const Vector<Box>& a_otherBoxes)
+{
+  CH_TIME("LoadBalancing::computeOverlaps");
+
+  std::vector<std::vector<std::pair<int, long>>> overlaps(a_boxes.size());
+
+  int binSize = 1;
+  for (int i = 0; i < a_otherBoxes.size(); i++) {
+    for (int dir = 0; dir < SpaceDim; dir++) {
+      binSize = std::max(binSize, a_otherBoxes[i].size(dir));
+    }
+  }
+
+  // TLDR: Sort the other boxes into bins no smaller than the largest box. Each box then lives in at most 2^SpaceDim bins
+  //       and we only need to check the bins that a box touches.
+  auto getBin = [binSize](const int a_index) -> int {
+    return (a_index >= 0) ? a_index / binSize : -((-a_index - 1) / binSize) - 1;
+  };
+
+  auto forEachBin = [&getBin](const Box& a_box, const std::function<void(const std::vector<int>&)>& a_func) -> void {
+    std::vector<int> lobin(SpaceDim);
+    std::vector<int> hibin(SpaceDim);
+    std::vector<int> bin(SpaceDim);
+
+    for (int dir = 0; dir < SpaceDim; dir++) {
+      lobin[dir] = getBin(a_box.smallEnd(dir));
+      hibin[dir] = getBin(a_box.bigEnd(dir));
+      bin[dir]   = lobin[dir];
+    }
+
+    while (true) {
+      a_func(bin);
+
+      int dir = 0;
+      while (dir < SpaceDim && bin[dir] == hibin[dir]) {
+        bin[dir] = lobin[dir];
+        dir++;
+      }
+
+      if (dir == SpaceDim) {
+        break;
+      }
+
+      bin[dir]++;
+    }
+  };
+
+  std::map<std::vector<int>, std::vector<int>> bins;
+  for (int i = 0; i < a_otherBoxes.size(); i++) {
+    if (!a_otherBoxes[i].isEmpty()) {
+      forEachBin(a_otherBoxes[i], [&bins, i](const std::vector<int>& a_bin) -> void {
+        bins[a_bin].emplace_back(i);
+      });
+    }
+  }
+
+  // The lastVisited array makes sure that a box which lives in several bins is only counted once.
+  std::vector<int> lastVisited(a_otherBoxes.size(), -1);
+
+  for (int ibox = 0; ibox < a_boxes.size(); ibox++) {
+    const Box& box = a_boxes[ibox];
+
+    if (box.isEmpty()) {
+      continue;
+    }
+
+    forEachBin(box, [&](const std::vector<int>& a_bin) -> void {
+      const auto binIter = bins.find(a_bin);
+
+      if (binIter != bins.end()) {
+        for (const int& i : binIter->second) {
+          if (lastVisited[i] != ibox) {
+            lastVisited[i] = ibox;
+
+            const Box overlap = box & a_otherBoxes[i];
+
+            if (!overlap.isEmpty()) {
+              overlaps[ibox].emplace_back(i, overlap.numPts());
+            }
+          }
+        }
+      }
+    });
+  }
+
+  return overlaps;
+}
+
+long long
+LoadBalancing::migratedCells(const Vector<Box>& a_boxes,
+                             const Vector<int>& a_ranks,
+                             const Vector<Box>& a_oldBoxes,
+                             const Vector<int>& a_oldRanks)
+{
+  CH_TIME("LoadBalancing::migratedCells");
+
+  CH_assert(a_boxes.size() == a_ranks.size());
+  CH_assert(a_oldBoxes.size() == a_oldRanks.size());
+
+  const std::vector<std::vector<std::pair<int, long>>> overlaps = LoadBalancing::computeOverlaps(a_boxes, a_oldBoxes);
+
+  long long numCells = 0LL;
+
+  for (int ibox = 0; ibox < a_boxes.size(); ibox++) {
+    for (const auto& overlap : overlaps[ibox]) {
+      if (a_oldRanks[overlap.first] != a_ranks[ibox]) {
+        numCells += overlap.second;
+      }
+    }
+  }
+
+  return numCells;
+}
+
+const std::vector<std::vector<int>>&
+LoadBalancing::getNodeRanks()
+{
+  CH_TIME("LoadBalancing::getNodeRanks");
+
+  if (s_nodeRanks.size() == 0) {
+#ifdef CH_MPI
+    // Identify each node by the global rank of its first rank.
+    MPI_Comm nodeComm;
+    MPI_Comm_split_type(Chombo_MPI::comm, MPI_COMM_TYPE_SHARED, procID(), MPI_INFO_NULL, &nodeComm);
+
+    int leader = procID();
+    MPI_Bcast(&leader, 1, MPI_INT, 0, nodeComm);
+    MPI_Comm_free(&nodeComm);
+
+    std::vector<int> leaders(numProc());
+    MPI_Allgather(&leader, 1, MPI_INT, &leaders[0], 1, MPI_INT, Chombo_MPI::comm);
+
+    std::map<int, int> nodeIndex;
+    for (int rank = 0; rank < numProc(); rank++) {
+      if (nodeIndex.find(leaders[rank]) == nodeIndex.end()) {
+        const int inode = nodeIndex.size();
+
+        nodeIndex.emplace(leaders[rank], inode);
+        s_nodeRanks.emplace_back();
+      }
+
+      s_nodeRanks[nodeIndex.at(leaders[rank])].emplace_back(rank);
+    }
+#else
+    s_nodeRanks.emplace_back(1, 0);
+#endif
+  }
+
+  return s_nodeRanks;
+}
+
+std::vector<LoadBalancing::Subset>
+LoadBalancing::makeSubsets(const Vector<Real>&      a_boxLoads,
+                           const int                a_firstBox,
+                           const int                a_lastBox,
+                           const std::vector<Real>& a_weights)
+{
+  CH_TIME("LoadBalancing::makeSubsets");
+
+  const int numBoxes   = a_lastBox + 1;
+  const int numSubsets = a_weights.size();
+
+  CH_assert(numSubsets <= a_lastBox - a_firstBox + 1);
+
+  std::vector<Subset> subsets(numSubsets);
+
+  if (numSubsets == 0) {
+    return subsets;
+  }
+
+  // Figure out the total and target load for the first subset.
+  Real totalLoad   = 0.0;
+  Real totalWeight = 0.0;
+  for (int ibox = a_firstBox; ibox <= a_lastBox; ibox++) {
+    totalLoad += a_boxLoads[ibox];
+  }
+  for (const auto& w : a_weights) {
+    totalWeight += w;
+  }
+
+  Real staticTargetLoad = totalLoad * a_weights[0] / totalWeight;
+
+  // Build the grid subsets. When we do this we iterate through the boxes and try to ensure that we partition
+  // the subsets such that the subsetLoad is as close to the dynamic targetLoad as possible.
+  int firstSubsetBox = a_firstBox;
+
+  Real remainingLoad   = totalLoad;
+  Real remainingWeight = totalWeight;
+
+  for (int curSubset = 0; curSubset < numSubsets; curSubset++) {
+
+    // The firstSubsetBox is the index for the first box in this subset (always assigned).
+    Real subsetLoad = a_boxLoads[firstSubsetBox];
+
+    int lastSubsetBox = firstSubsetBox;
+
+    const int subsetsLeft = numSubsets - (curSubset + 1);
+    const int boxesLeft   = numBoxes - (firstSubsetBox + 1);
+
+    if (boxesLeft > subsetsLeft) {
+      for (int ibox = firstSubsetBox + 1; ibox < numBoxes; ibox++) {
+
+        // Hook for catching case when we add too many boxes to this subset. Each remaining subset must have at least one box.
+        if (numBoxes - lastSubsetBox - 1 <= subsetsLeft) {
+          break;
+        }
+
+        // Check if we should add this box - we do this by making sure that the dynamically moving target load stays as close
+        // to the static load as possible.
+        //
+        // In the below, '1' is the load without ibox, and '2' is the load with ibox
+        const Real load1 = subsetLoad;
+        const Real load2 = subsetLoad + a_boxLoads[ibox];
+
+        // Check if we should add this box.
+        bool addBoxToSubset = false;
+
+        if (a_boxLoads[ibox] <= std::numeric_limits<Real>::epsilon()) {
+          addBoxToSubset = true;
+        }
+        else if (load1 > staticTargetLoad) {
+          addBoxToSubset = false;
+        }
+        else if (load2 <= staticTargetLoad) {
+          addBoxToSubset = true;
+        }
+        else if (load1 <= staticTargetLoad && load2 > staticTargetLoad) {
+          // Compute the new average load if we add or don't add this box to the current subset. Accept the answer
+          // that leads to a smallest deviation from the static target load.
+          const Real loadErrWithoutBox = std::abs(load1 - staticTargetLoad);
+          const Real loadErrWithBox    = std::abs(load2 - staticTargetLoad);
+
+          if (loadErrWithBox <= loadErrWithoutBox) {
+            addBoxToSubset = true;
+          }
+        }
+
+        // Add box or break out of box iteration.
+        if (addBoxToSubset) {
+          subsetLoad    = subsetLoad + a_boxLoads[ibox];
+          lastSubsetBox = ibox;
+
+          continue;
+        }
+        else {
+          lastSubsetBox = ibox - 1;
+
+          break;
+        }
+      }
+    }
+
+    // Create the subset
+    subsets[curSubset] = std::make_pair(std::make_pair(firstSubsetBox, lastSubsetBox), subsetLoad);
+
+    // Update the remaining load and the target load for the next subset.
+    remainingLoad   = remainingLoad - subsetLoad;
+    remainingWeight = remainingWeight - a_weights[curSubset];
+
+    if (subsetsLeft > 0) {
+      staticTargetLoad = remainingLoad * a_weights[curSubset + 1] / remainingWeight;
+    }
+
+    // Update start box for next iteration.
+    firstSubsetBox = lastSubsetBox + 1;
+  }
+
+  return subsets;
+}
+
+std::vector<LoadBalancing::Subset>
+LoadBalancing::makeMultiSubsets(const std::vector<Vector<Real>>& a_boxWeights,
+                                const std::vector<Real>&         a_coefficients,
+                                const int                        a_numSubsets)
+{
+  CH_TIME("LoadBalancing::makeMultiSubsets");
+
+  const int numConstraints = a_boxWeights.size();
+  const int numBoxes       = (numConstraints > 0) ? a_boxWeights[0].size() : 0;
+
+  CH_assert(a_numSubsets <= numBoxes);
+
+  std::vector<Subset> subsets(a_numSubsets);
+
+  // Remaining weight for each constraint
+  std::vector<Real> remaining(numConstraints, 0.0);
+  for (int c = 0; c < numConstraints; c++) {
+    for (int ibox = 0; ibox < numBoxes; ibox++) {
+      remaining[c] += a_boxWeights[c][ibox];
+    }
+  }
+
+  std::vector<Real> target(numConstraints);
+  std::vector<Real> load(numConstraints);
+  std::vector<Real> loadWithBox(numConstraints);
+
+  // Fill fraction of the most loaded constraint.
+  auto fillFraction = [&](const std::vector<Real>& a_load) -> Real {
+    Real f = 0.0;
+
+    for (int c = 0; c < numConstraints; c++) {
+      if (target[c] > 0.0) {
+        f = std::max(f, a_load[c] / target[c]);
+      }
+    }
+
+    return f;
+  };
+
+  int firstSubsetBox = 0;
+
+  for (int curSubset = 0; curSubset < a_numSubsets; curSubset++) {
+    const int subsetsLeft = a_numSubsets - (curSubset + 1);
+
+    for (int c = 0; c < numConstraints; c++) {
+      target[c] = remaining[c] / (subsetsLeft + 1);
+      load[c]   = a_boxWeights[c][firstSubsetBox];
+    }
+
+    int lastSubsetBox = firstSubsetBox;
+
+    for (int ibox = firstSubsetBox + 1; ibox < numBoxes; ibox++) {
+
+      // Each remaining subset must have at least one box.
+      if (numBoxes - lastSubsetBox - 1 <= subsetsLeft) {
+        break;
+      }
+
+      bool addBoxToSubset = (subsetsLeft == 0);
+
+      if (!addBoxToSubset) {
+        for (int c = 0; c < numConstraints; c++) {
+          loadWithBox[c] = load[c] + a_boxWeights[c][ibox];
+        }
+
+        const Real f1 = fillFraction(load);
+        const Real f2 = fillFraction(loadWithBox);
+
+        if (f2 <= 1.0 || f2 <= f1) {
+          addBoxToSubset = true;
+        }
+        else if (f1 < 1.0 && (f2 - 1.0) <= (1.0 - f1)) {
+          addBoxToSubset = true;
+        }
+      }
+
+      if (addBoxToSubset) {
+        for (int c = 0; c < numConstraints; c++) {
+          load[c] += a_boxWeights[c][ibox];
+        }
+
+        lastSubsetBox = ibox;
+      }
+      else {
+        break;
+      }
+    }
+
+    Real cost = 0.0;
+    for (int c = 0; c < numConstraints; c++) {
+      cost += a_coefficients[c] * load[c];
+
+      remaining[c] -= load[c];
+    }
+
+    subsets[curSubset] = std::make_pair(std::make_pair(firstSubsetBox, lastSubsetBox), cost);
+
+    firstSubsetBox = lastSubsetBox + 1;
+  }
+
+  return subsets;
+}
+
+std::vector<Real>
+LoadBalancing::fitCoefficients(const std::vector<std::vector<Real>>& a_weights, const std::vector<Real>& a_times)
+{
+  CH_TIME("LoadBalancing::fitCoefficients");
+
+  CH_assert(a_weights.size() == a_times.size());
+
+  const int numSamples = a_weights.size();
+
+  if (numSamples == 0) {
+    return std::vector<Real>();
+  }
+
+  const int numConstraints = a_weights[0].size();
+
+  // Scale each constraint by its root-mean-square so that the normal equations are well conditioned.
+  std::vector<Real> scale(numConstraints, 0.0);
+  for (int i = 0; i < numSamples; i++) {
+    for (int c = 0; c < numConstraints; c++) {
+      scale[c] += a_weights[i][c] * a_weights[i][c];
+    }
+  }
+
+  std::vector<bool> active(numConstraints);
+  for (int c = 0; c < numConstraints; c++) {
+    scale[c]  = sqrt(scale[c] / numSamples);
+    active[c] = scale[c] > 0.0;
+  }
+
+  std::vector<Real> coeffs(numConstraints, 0.0);
+
+  // Solve the normal equations for the active constraints. If a coefficient comes out negative we remove the most
+  // negative one and solve again.
+  for (int iter = 0; iter < numConstraints; iter++) {
+    std::vector<int> idx;
+    for (int c = 0; c < numConstraints; c++) {
+      if (active[c]) {
+        idx.emplace_back(c);
+      }
+    }
+
+    const int N = idx.size();
+
+    if (N == 0) {
+      break;
+    }
+
+    // Augmented system [A | b] with A = W^T W and b = W^T t.
+    std::vector<std::vector<Real>> A(N, std::vector<Real>(N + 1, 0.0));
+    for (int i = 0; i < numSamples; i++) {
+      for (int r = 0; r < N; r++) {
+        const Real wr = a_weights[i][idx[r]] / scale[idx[r]];
+
+        for (int s = 0; s < N; s++) {
+          A[r][s] += wr * a_weights[i][idx[s]] / scale[idx[s]];
+        }
+
+        A[r][N] += wr * a_times[i];
+      }
+    }
+
+    // Small regularization in case the constraints are linearly dependent.
+    for (int r = 0; r < N; r++) {
+      A[r][r] += 1.E-10 * numSamples;
+    }
+
+    // Gaussian elimination with partial pivoting.
+    for (int k = 0; k < N; k++) {
+      int pivot = k;
+      for (int r = k + 1; r < N; r++) {
+        if (std::abs(A[r][k]) > std::abs(A[pivot][k])) {
+          pivot = r;
+        }
+      }
+
+      std::swap(A[k], A[pivot]);
+
+      for (int r = k + 1; r < N; r++) {
+        const Real factor = A[r][k] / A[k][k];
+
+        for (int s = k; s <= N; s++) {
+          A[r][s] -= factor * A[k][s];
+        }
+      }
+    }
+
+    std::vector<Real> x(N, 0.0);
+    for (int r = N - 1; r >= 0; r--) {
+      Real sum = A[r][N];
+      for (int s = r + 1; s < N; s++) {
+        sum -= A[r][s] * x[s];
+      }
+
+      x[r] = sum / A[r][r];
+    }
+
+    // Check for negative coefficients.
+    int  mostNegative = -1;
+    Real minCoeff     = 0.0;
+    for (int r = 0; r < N; r++) {
+      if (x[r] < minCoeff) {
+        minCoeff     = x[r];
+        mostNegative = idx[r];
+      }
+    }
+
+    if (mostNegative < 0) {
+      for (int r = 0; r < N; r++) {
+        coeffs[idx[r]] = x[r] / scale[idx[r]];
+      }
+
+      break;
+    }
+    else {
+      active[mostNegative] = false;
+    }
+  }
+
+  return coeffs;
+}
+
 void
 LoadBalancing::sort(Vector<Box>& a_boxes, const BoxSorting a_which)
 {
@@ -275,6 +777,116 @@ LoadBalancing::gatherBoxesAndLoads(Vector<Box>& a_boxes, Vector<int>& a_loads)
 #endif
 }
 
+std::vector<Real>
+LoadBalancing::surfaceToVolume(const Vector<Box>& a_boxes, const Vector<int>& a_ranks)
+{
+  CH_TIME("LoadBalancing::surfaceToVolume");
+
+  CH_assert(a_boxes.size() == a_ranks.size());
+
+  const int numBoxes = a_boxes.size();
+
+  std::vector<long long> surface(numProc(), 0LL);
+  std::vector<long long> volume(numProc(), 0LL);
+
+  // Boxes owned by each rank.
+  std::vector<std::vector<int>> rankBoxes(numProc());
+  for (int ibox = 0; ibox < numBoxes; ibox++) {
+    rankBoxes[a_ranks[ibox]].emplace_back(ibox);
+  }
+
+  // Count all box faces and subtract the ones that are shared with other boxes on the same rank. Since the boxes are
+  // disjoint, a face that is shared is found once from each side.
+  for (int rank = 0; rank < numProc(); rank++) {
+    for (const auto& ibox : rankBoxes[rank]) {
+      const Box& box = a_boxes[ibox];
+
+      volume[rank] += box.numPts();
+
+      for (int dir = 0; dir < SpaceDim; dir++) {
+        for (SideIterator sit; sit.ok(); ++sit) {
+          const Box adjBox = adjCellBox(box, dir, sit(), 1);
+
+          surface[rank] += adjBox.numPts();
+
+          for (const auto& jbox : rankBoxes[rank]) {
+            if (jbox != ibox && adjBox.intersectsNotEmpty(a_boxes[jbox])) {
+              surface[rank] -= (adjBox & a_boxes[jbox]).numPts();
+            }
+          }
+        }
+      }
+    }
+  }
+
+  std::vector<Real> ret(numProc(), 0.0);
+  for (int rank = 0; rank < numProc(); rank++) {
+    if (volume[rank] > 0LL) {
+      ret[rank] = (1.0 * surface[rank]) / volume[rank];
+    }
+  }
+
+  return ret;
+}
+
+uint64_t
+LoadBalancing::hilbertIndex(const IntVect& a_iv, const int a_bits)
+{
+  CH_assert(a_bits > 0);
+
+  uint64_t X[SpaceDim];
+  for (int dir = 0; dir < SpaceDim; dir++) {
+    CH_assert(a_iv[dir] >= 0);
+
+    X[dir] = (uint64_t)a_iv[dir];
+  }
+
+  const uint64_t M = uint64_t(1) << (a_bits - 1);
+
+  // Inverse undo excess work. This transforms the coordinates to the "transposed" Hilbert index.
+  for (uint64_t Q = M; Q > 1; Q >>= 1) {
+    const uint64_t P = Q - 1;
+
+    for (int dir = 0; dir < SpaceDim; dir++) {
+      if (X[dir] & Q) {
+        X[0] ^= P;
+      }
+      else {
+        const uint64_t t = (X[0] ^ X[dir]) & P;
+
+        X[0] ^= t;
+        X[dir] ^= t;
+      }
+    }
+  }
+
+  // Gray encode.
+  for (int dir = 1; dir < SpaceDim; dir++) {
+    X[dir] ^= X[dir - 1];
+  }
+
+  uint64_t t = 0;
+  for (uint64_t Q = M; Q > 1; Q >>= 1) {
+    if (X[SpaceDim - 1] & Q) {
+      t ^= Q - 1;
+    }
+  }
+
+  for (int dir = 0; dir < SpaceDim; dir++) {
+    X[dir] ^= t;
+  }
+
+  // Interleave the bits of the transposed index, most significant bit first.
+  uint64_t index = 0;
+  for (int b = a_bits - 1; b >= 0; b--) {
+    for (int dir = 0; dir < SpaceDim; dir++) {
+      index = (index << 1) | ((X[dir] >> b) & 1);
+    }
+  }
+
+  return index;
+}
+
 int
 LoadBalancing::maxBits(std::vector<Box>::iterator a_first, std::vector<Box>::iterator a_last)
 {
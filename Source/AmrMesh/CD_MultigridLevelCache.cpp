@@ -0,0 +1,143 @@
+/* chombo-discharge
+ * Copyright © 2026 SINTEF Energy Research.
+ * Please refer to Copyright.txt and LICENSE in the chombo-discharge root directory.
+ */
+
+/*!
+  @file   CD_MultigridLevelCache.cpp
+  @brief  Implementation of CD_MultigridLevelCache.H
+  @author Robert Marskar
+*/
+
+// Chombo includes
+#include <CH_Timer.H>
+
+// Our includes
+#include <CD_MultigridLevelCache.H>
+#include <CD_NamespaceHeader.H>
+
+bool
+MultigridLevelCache::Key::operator==(const Key& a_other) const noexcept
+{
+  return m_fineGrids == a_other.m_fineGrids && m_fineDomain == a_other.m_fineDomain &&
+         m_indexSpace == a_other.m_indexSpace && m_refRat == a_other.m_refRat &&
+         m_blockingFactor == a_other.m_blockingFactor && m_numGhost == a_other.m_numGhost &&
+         m_agglomerationCells == a_other.m_agglomerationCells;
+}
+
+MultigridLevelCache::MultigridLevelCache() noexcept
+{
+  CH_TIME("MultigridLevelCache::MultigridLevelCache");
+
+  m_numBuilt  = 0;
+  m_numReused = 0;
+}
+
+MultigridLevelCache::~MultigridLevelCache() noexcept
+{}
+
+void
+MultigridLevelCache::clear() noexcept
+{
+  CH_TIME("MultigridLevelCache::clear");
+
+  m_ebEntries.clear();
+  m_mfEntries.clear();
+
+  m_numBuilt  = 0;
+  m_numReused = 0;
+}
+
+template <typename T>
+bool
+MultigridLevelCache::findOrBuild(std::vector<Entry<T>>&         a_entries,
+                                 T&                             a_coarGrid,
+                                 const Key&                     a_key,
+                                 const std::function<bool(T&)>& a_builder)
+{
+  // The number of entries is small (a few per AMR level), so a linear search is fine.
+  for (const auto& entry : a_entries) {
+    if (entry.m_key == a_key) {
+      m_numReused++;
+
+      if (entry.m_hasCoarser) {
+        a_coarGrid = entry.m_coarGrid;
+      }
+
+      return entry.m_hasCoarser;
+    }
+  }
+
+  Entry<T> entry;
+
+  entry.m_key        = a_key;
+  entry.m_hasCoarser = a_builder(entry.m_coarGrid);
+
+  if (entry.m_hasCoarser) {
+    a_coarGrid = entry.m_coarGrid;
+  }
+
+  a_entries.emplace_back(entry);
+
+  m_numBuilt++;
+
+  return entry.m_hasCoarser;
+}
+
+bool
+MultigridLevelCache::getCoarsening(EBLevelGrid&       a_coarGrid,
+                                   const EBLevelGrid& a_fineGrid,
+                                   const int          a_refRat,
+                                   const int          a_blockingFactor,
+                                   const int          a_numGhost,
+                                   const int          a_agglomerationCells,
+                                   const EBBuilder&   a_builder)
+{
+  CH_TIME("MultigridLevelCache::getCoarsening(EBLevelGrid)");
+
+  const Key key{a_fineGrid.getDBL(),
+                a_fineGrid.getDomain(),
+                (const void*)a_fineGrid.getEBIS(),
+                a_refRat,
+                a_blockingFactor,
+                a_numGhost,
+                a_agglomerationCells};
+
+  return this->findOrBuild(m_ebEntries, a_coarGrid, key, a_builder);
+}
+
+bool
+MultigridLevelCache::getCoarsening(MFLevelGrid&       a_coarGrid,
+                                   const MFLevelGrid& a_fineGrid,
+                                   const int          a_refRat,
+                                   const int          a_blockingFactor,
+                                   const int          a_numGhost,
+                                   const int          a_agglomerationCells,
+                                   const MFBuilder&   a_builder)
+{
+  CH_TIME("MultigridLevelCache::getCoarsening(MFLevelGrid)");
+
+  const Key key{a_fineGrid.getGrids(),
+                a_fineGrid.getDomain(),
+                a_fineGrid.getMfIndexSpace().isNull() ? nullptr : (const void*)(&(*a_fineGrid.getMfIndexSpace())),
+                a_refRat,
+                a_blockingFactor,
+                a_numGhost,
+                a_agglomerationCells};
+
+  return this->findOrBuild(m_mfEntries, a_coarGrid, key, a_builder);
+}
+
+size_t
+MultigridLevelCache::getNumBuilt() const noexcept
+{
+  return m_numBuilt;
+}
+
+size_t
+MultigridLevelCache::getNumReused() const noexcept
+{
+  return m_numReused;
+}
+
+#include <CD_NamespaceFooter.H>
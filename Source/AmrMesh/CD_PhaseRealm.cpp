@@ -9,6 +9,10 @@
   @author Robert Marskar
 */
 
+// Std includes
+#include <algorithm>
+#include <vector>
+
 // Chombo includes
 #include <EBArith.H>
 #include <ParmParse.H>
@@ -23,16 +27,34 @@
 #include <CD_EBLeastSquaresMultigridInterpolator.H>
 #include <CD_MemoryReport.H>
 #include <CD_BoxLoops.H>
+#include <CD_BatchIF.H>
 #include <CD_NamespaceHeader.H>
 
+// Order in which regridOperators builds the operators.
+static const std::vector<std::string> s_operatorBuildOrder = {s_eb_coar_ave,
+                                                              s_eb_multigrid,
+                                                              s_eb_fill_patch,
+                                                              s_eb_fine_interp,
+                                                              s_eb_flux_reg,
+                                                              s_eb_redist,
+                                                              s_eb_gradient,
+                                                              s_eb_irreg_interp,
+                                                              s_noncons_div,
+                                                              s_particle_mesh,
+                                                              s_levelset,
+                                                              s_covered_mask};
+
 PhaseRealm::PhaseRealm()
 {
   CH_TIME("PhaseRealm::PhaseRealm");
 
   // Default settings
-  m_isDefined = false;
-  m_profile   = false;
-  m_verbose   = false;
+  m_isDefined     = false;
+  m_profile       = false;
+  m_verbose       = false;
+  m_lazyOperators = false;
+
+  m_coveredMaskRefinement = 4;
 
   this->registerOperator(s_eb_gradient);
   this->registerOperator(s_eb_irreg_interp);
@@ -41,11 +63,42 @@ PhaseRealm::PhaseRealm()
   ParmParse pp("PhaseRealm");
   pp.query("profile", m_profile);
   pp.query("verbosity", m_verbose);
+  pp.query("covered_mask_refinement", m_coveredMaskRefinement);
+
+  this->parseLazyOperators();
 }
 
 PhaseRealm::~PhaseRealm()
 {}
 
+void
+PhaseRealm::parseLazyOperators()
+{
+  CH_TIME("PhaseRealm::parseLazyOperators");
+
+  ParmParse pp("PhaseRealm");
+
+  m_lazyOperators = false;
+  pp.query("lazy_operators", m_lazyOperators);
+
+  m_eagerOperators.clear();
+
+  const int numEager = pp.countval("eager_operators");
+  if (numEager > 0) {
+    std::vector<std::string> eagerOperators(numEager);
+    pp.getarr("eager_operators", eagerOperators, 0, numEager);
+
+    for (const auto& op : eagerOperators) {
+      if (std::find(s_operatorBuildOrder.begin(), s_operatorBuildOrder.end(), op) == s_operatorBuildOrder.end()) {
+        const std::string str = "PhaseRealm::parseLazyOperators - unknown operator '" + op + "' in eager_operators";
+        MayDay::Error(str.c_str());
+      }
+
+      m_eagerOperators.insert(op);
+    }
+  }
+}
+
 void
 PhaseRealm::define(const Vector<DisjointBoxLayout>&      a_grids,
                    const Vector<ProblemDomain>&          a_domains,
@@ -95,6 +148,9 @@ PhaseRealm::define(const Vector<DisjointBoxLayout>&      a_grids,
   ParmParse pp("PhaseRealm");
   pp.query("profile", m_profile);
   pp.query("verbosity", m_verbose);
+  pp.query("covered_mask_refinement", m_coveredMaskRefinement);
+
+  this->parseLazyOperators();
 }
 
 void
@@ -119,12 +175,20 @@ PhaseRealm::preRegrid()
     pout() << "PhaseRealm::preRegrid" << endl;
   }
 
+  // Keep the centroid interpolation objects so their stencils can be reused on patches that do not change. If the
+  // operator is still pending from an earlier regrid, we keep the objects from before that regrid.
+  if (m_cellCentroidInterpolation.size() > 0) {
+    m_previousCellCentroidInterpolation = m_cellCentroidInterpolation;
+    m_previousEBCentroidInterpolation   = m_ebCentroidInterpolation;
+  }
+
   m_grids.resize(0);
   m_ebisl.resize(0);
   m_eblg.resize(0);
   m_eblgCoFi.resize(0);
   m_eblgFiCo.resize(0);
   m_vofIter.resize(0);
+  m_cutCellPatches.resize(0);
   m_coarAve.resize(0);
   m_multigridInterpolator.resize(0);
   m_ebFineInterp.resize(0);
@@ -132,6 +196,7 @@ PhaseRealm::preRegrid()
   m_redistributionOp.resize(0);
   m_gradientOp.resize(0);
   m_levelset.resize(0);
+  m_coveredMask.resize(0);
   m_cellCentroidInterpolation.resize(0);
   m_ebCentroidInterpolation.resize(0);
   m_nonConservativeDivergence.resize(0);
@@ -189,146 +254,125 @@ PhaseRealm::regridOperators(const int a_lmin)
 
   if (m_isDefined) {
 
-    Timer timer("PhaseRealm::regridOperators(int)");
+    // TLDR: Lazy operators are only marked for construction here, and the get-functions build them on first access. If
+    //       an operator is still pending from a previous regrid it must be rebuilt from the coarser of the two levels.
+    for (const auto& op : s_operatorBuildOrder) {
+      const bool isLazy = m_lazyOperators && this->queryOperator(op) && m_eagerOperators.count(op) == 0;
 
-    if (m_profile) {
-      pout() << "before/after coarave define" << endl;
-      MemoryReport::getMaxMinMemoryUsage();
-    }
-    timer.startEvent("EBCoarAve");
-    this->defineEBCoarAve(a_lmin);
-    timer.stopEvent("EBCoarAve");
-    if (m_profile) {
-      MemoryReport::getMaxMinMemoryUsage();
-      pout() << endl;
-    }
+      if (isLazy) {
+        const auto it = m_pendingOperators.find(op);
 
-    if (m_profile) {
-      pout() << "before/after mg define" << endl;
-      MemoryReport::getMaxMinMemoryUsage();
-    }
-    timer.startEvent("Multigrid interpolator");
-    this->defineEBMultigrid(a_lmin);
-    timer.stopEvent("Multigrid interpolator");
-    if (m_profile) {
-      MemoryReport::getMaxMinMemoryUsage();
-      pout() << endl;
-    }
+        m_pendingOperators[op] = (it != m_pendingOperators.end()) ? std::min(it->second, a_lmin) : a_lmin;
+      }
+      else {
+        m_pendingOperators.erase(op);
 
-    if (m_profile) {
-      pout() << "before/after fillpatch define" << endl;
-      MemoryReport::getMaxMinMemoryUsage();
-    }
-    timer.startEvent("Ghost interp");
-    this->defineFillPatch(a_lmin);
-    timer.stopEvent("Ghost interp");
-    if (m_profile) {
-      MemoryReport::getMaxMinMemoryUsage();
-      pout() << endl;
+        this->buildOperator(op, a_lmin);
+      }
     }
 
     if (m_profile) {
-      pout() << "before/after pwlinterp define" << endl;
-      MemoryReport::getMaxMinMemoryUsage();
-    }
-    timer.startEvent("PWL interp");
-    this->defineEBCoarseToFineInterp(a_lmin);
-    timer.stopEvent("PWL interp");
-    if (m_profile) {
-      MemoryReport::getMaxMinMemoryUsage();
+      pout() << "PhaseRealm::regridOperators - accumulated operator construction times:" << endl;
+      for (const auto& t : m_operatorTimes) {
+        pout() << "\t" << t.first << " = " << t.second << " s" << endl;
+      }
       pout() << endl;
     }
+  }
+}
 
-    if (m_profile) {
-      pout() << "before/after fluxreg define" << endl;
-      MemoryReport::getMaxMinMemoryUsage();
-    }
-    timer.startEvent("Flux register");
-    this->defineFluxReg(a_lmin, 1);
-    timer.stopEvent("Flux register");
-    if (m_profile) {
-      MemoryReport::getMaxMinMemoryUsage();
-      pout() << endl;
-    }
+void
+PhaseRealm::buildOperator(const std::string a_operator, const int a_lmin)
+{
+  CH_TIME("PhaseRealm::buildOperator");
+  if (m_verbose) {
+    pout() << "PhaseRealm::buildOperator" << endl;
+  }
 
-    if (m_profile) {
-      pout() << "before/after redist define" << endl;
-      MemoryReport::getMaxMinMemoryUsage();
-    }
-    timer.startEvent("EB redist");
-    this->defineRedistOper(a_lmin, 1);
-    timer.stopEvent("EB redist");
-    if (m_profile) {
-      MemoryReport::getMaxMinMemoryUsage();
-      pout() << endl;
-    }
+  if (m_profile) {
+    pout() << "before/after " << a_operator << " define" << endl;
+    MemoryReport::getMaxMinMemoryUsage();
+  }
 
-    if (m_profile) {
-      pout() << "before/after gradsten define" << endl;
-      MemoryReport::getMaxMinMemoryUsage();
-    }
-    timer.startEvent("Gradient stencil");
-    this->defineGradSten(a_lmin);
-    timer.stopEvent("Gradient stencil");
-    if (m_profile) {
-      MemoryReport::getMaxMinMemoryUsage();
-      pout() << endl;
-    }
+  const Real startTime = Timer::wallClock();
 
-    if (m_profile) {
-      pout() << "before/after irregsten define" << endl;
-      MemoryReport::getMaxMinMemoryUsage();
-    }
-    timer.startEvent("Irreg stencil");
+  if (a_operator == s_eb_coar_ave) {
+    this->defineEBCoarAve(a_lmin);
+  }
+  else if (a_operator == s_eb_multigrid) {
+    this->defineEBMultigrid(a_lmin);
+  }
+  else if (a_operator == s_eb_fill_patch) {
+    this->defineFillPatch(a_lmin);
+  }
+  else if (a_operator == s_eb_fine_interp) {
+    this->defineEBCoarseToFineInterp(a_lmin);
+  }
+  else if (a_operator == s_eb_flux_reg) {
+    this->defineFluxReg(a_lmin, 1);
+  }
+  else if (a_operator == s_eb_redist) {
+    this->defineRedistOper(a_lmin, 1);
+  }
+  else if (a_operator == s_eb_gradient) {
+    this->defineGradSten(a_lmin);
+  }
+  else if (a_operator == s_eb_irreg_interp) {
     this->defineIrregSten();
-    timer.stopEvent("Irreg stencil");
-    if (m_profile) {
-      MemoryReport::getMaxMinMemoryUsage();
-      pout() << endl;
-    }
-
-    if (m_profile) {
-      pout() << "before/after nonconsdivsten define" << endl;
-      MemoryReport::getMaxMinMemoryUsage();
-    }
-    timer.startEvent("Non-conservative stencil");
+  }
+  else if (a_operator == s_noncons_div) {
     this->defineNonConservativeDivergence(a_lmin);
-    timer.stopEvent("Non-conservative stencil");
-    if (m_profile) {
-      MemoryReport::getMaxMinMemoryUsage();
-      pout() << endl;
-    }
-
-    if (m_profile) {
-      pout() << "before/after particlemesh define" << endl;
-      MemoryReport::getMaxMinMemoryUsage();
-    }
-    timer.startEvent("Particle-mesh");
+  }
+  else if (a_operator == s_particle_mesh) {
     this->defineParticleMesh();
-    timer.stopEvent("Particle-mesh");
-    if (m_profile) {
-      MemoryReport::getMaxMinMemoryUsage();
-      pout() << endl;
-    }
-
-    if (m_profile) {
-      pout() << "before/after levelset define" << endl;
-      MemoryReport::getMaxMinMemoryUsage();
-    }
-    timer.startEvent("Levelset");
+  }
+  else if (a_operator == s_levelset) {
     this->defineLevelSet(a_lmin, m_numLsfGhostCells);
-    timer.stopEvent("Levelset");
-    if (m_profile) {
-      MemoryReport::getMaxMinMemoryUsage();
-      pout() << endl;
-    }
+  }
+  else if (a_operator == s_covered_mask) {
+    this->defineCoveredMask(a_lmin);
+  }
+  else {
+    const std::string str = "PhaseRealm::buildOperator - unknown operator '" + a_operator + "'";
+    MayDay::Error(str.c_str());
+  }
 
-    if (m_profile) {
-      timer.eventReport(pout());
-    }
+  const Real buildTime = Timer::wallClock() - startTime;
+
+  if (this->queryOperator(a_operator)) {
+    m_operatorTimes[a_operator] += buildTime;
+  }
+
+  if (m_profile) {
+    MemoryReport::getMaxMinMemoryUsage();
+    pout() << "PhaseRealm::buildOperator - built '" << a_operator << "' in " << buildTime << " s" << endl;
+    pout() << endl;
+  }
+}
+
+void
+PhaseRealm::buildPendingOperator(const std::string a_operator) const
+{
+  CH_TIME("PhaseRealm::buildPendingOperator");
+
+  const auto it = m_pendingOperators.find(a_operator);
+
+  if (it != m_pendingOperators.end()) {
+    const int lmin = it->second;
+
+    m_pendingOperators.erase(it);
+
+    // The operator containers are mutable caches, but defining the level-set also writes to m_levelset.
+    const_cast<PhaseRealm*>(this)->buildOperator(a_operator, lmin);
   }
 }
 
+const std::map<std::string, Real>&
+PhaseRealm::getOperatorTimes() const
+{
+  return m_operatorTimes;
+}
+
 void
 PhaseRealm::registerOperator(const std::string a_operator)
 {
@@ -343,7 +387,7 @@ PhaseRealm::registerOperator(const std::string a_operator)
         a_operator.compare(s_eb_redist) == 0 || a_operator.compare(s_noncons_div) == 0 ||
         a_operator.compare(s_eb_gradient) == 0 || a_operator.compare(s_particle_mesh) == 0 ||
         a_operator.compare(s_eb_irreg_interp) == 0 || a_operator.compare(s_eb_multigrid) == 0 ||
-        a_operator.compare(s_levelset) == 0)) {
+        a_operator.compare(s_levelset) == 0 || a_operator.compare(s_covered_mask) == 0)) {
 
     const std::string str = "PhaseRealm::registerOperator - unknown operator '" + a_operator + "' requested";
     MayDay::Error(str.c_str());
@@ -387,8 +431,15 @@ PhaseRealm::defineEBLevelGrid(const int a_lmin)
   m_eblgCoFi.resize(1 + m_finestLevel);
   m_eblgFiCo.resize(1 + m_finestLevel);
   m_ebisl.resize(1 + m_finestLevel);
+  m_ebislMemory.resize(1 + m_finestLevel);
 
   for (int lvl = a_lmin; lvl <= m_finestLevel; lvl++) {
+#ifdef CH_USE_MEMORY_TRACKING
+    // The EBIS layouts are not simple to size, so we use the difference in unfreed memory instead. This only works with
+    // Chombo's memory tracking.
+    const long long unfreedBefore = MemoryReport::getUnfreedMemory();
+#endif
+
     m_eblg[lvl] = RefCountedPtr<EBLevelGrid>(
       new EBLevelGrid(m_grids[lvl], m_domains[lvl], m_numEbGhostsCells, &(*m_ebis)));
 
@@ -405,6 +456,11 @@ PhaseRealm::defineEBLevelGrid(const int a_lmin)
 
     m_ebisl[lvl] = m_eblg[lvl]->getEBISL();
 
+#ifdef CH_USE_MEMORY_TRACKING
+    m_ebislMemory[lvl] = MemoryTracker::track("EBISLayout/level " + std::to_string(lvl),
+                                              std::max(0LL, MemoryReport::getUnfreedMemory() - unfreedBefore));
+#endif
+
     // Define the coarsened grids.
     if (lvl > 0) {
       m_eblgCoFi[lvl - 1] = RefCountedPtr<EBLevelGrid>(new EBLevelGrid());
@@ -432,6 +488,7 @@ PhaseRealm::defineVofIterator(const int a_lmin)
   }
 
   m_vofIter.resize(1 + m_finestLevel);
+  m_cutCellPatches.resize(1 + m_finestLevel);
 
   for (int lvl = a_lmin; lvl <= m_finestLevel; lvl++) {
 
@@ -441,6 +498,9 @@ PhaseRealm::defineVofIterator(const int a_lmin)
     const DataIterator&      dit = dbl.dataIterator();
 
     const int nbox = dit.size();
+
+    std::vector<char> hasCutCells(nbox, 0);
+
 #pragma omp parallel for schedule(runtime)
     for (int mybox = 0; mybox < nbox; mybox++) {
       const DataIndex& din = dit[mybox];
@@ -453,6 +513,17 @@ PhaseRealm::defineVofIterator(const int a_lmin)
       const IntVectSet& irreg   = ebisbox.getIrregIVS(cellBox);
 
       vofit.define(irreg, ebgraph);
+
+      hasCutCells[mybox] = irreg.isEmpty() ? 0 : 1;
+    }
+
+    // Collect the patches that have cut-cells.
+    m_cutCellPatches[lvl].resize(0);
+
+    for (int mybox = 0; mybox < nbox; mybox++) {
+      if (hasCutCells[mybox] != 0) {
+        m_cutCellPatches[lvl].push_back(dit[mybox]);
+      }
     }
   }
 }
@@ -494,13 +565,30 @@ PhaseRealm::defineLevelSet(const int a_lmin, const int a_numGhost)
         const Box  bx  = fab.box();
 
         if (!m_baseif.isNull()) {
-          auto kernel = [&](const IntVect& iv) -> void {
-            const RealVect pos = m_probLo + (0.5 * RealVect::Unit + RealVect(iv)) * dx;
 
-            fab(iv, comp) = m_baseif->value(pos);
+          // Evaluate the implicit function on all points in the box in one batch.
+          std::vector<RealVect> positions;
+          std::vector<Real>     values(bx.numPts());
+
+          positions.reserve(bx.numPts());
+
+          auto positionKernel = [&](const IntVect& iv) -> void {
+            positions.emplace_back(m_probLo + (0.5 * RealVect::Unit + RealVect(iv)) * dx);
           };
 
-          BoxLoops::loop(bx, kernel);
+          BoxLoops::loop(bx, positionKernel);
+
+          BatchIF::evaluate(*m_baseif, positions.data(), values.data(), positions.size());
+
+          size_t i = 0;
+
+          auto valueKernel = [&](const IntVect& iv) -> void {
+            fab(iv, comp) = values[i];
+
+            i++;
+          };
+
+          BoxLoops::loop(bx, valueKernel);
         }
         else {
           fab.setVal(minVal, comp);
@@ -510,6 +598,42 @@ PhaseRealm::defineLevelSet(const int a_lmin, const int a_numGhost)
   }
 }
 
+void
+PhaseRealm::defineCoveredMask(const int a_lmin)
+{
+  CH_TIME("PhaseRealm::defineCoveredMask");
+  if (m_verbose) {
+    pout() << "PhaseRealm::defineCoveredMask" << endl;
+  }
+
+  const bool doThisOperator = this->queryOperator(s_covered_mask);
+
+  m_coveredMask.resize(1 + m_finestLevel);
+
+  if (doThisOperator) {
+    for (int lvl = a_lmin; lvl <= m_finestLevel; lvl++) {
+      const DisjointBoxLayout& dbl = m_grids[lvl];
+      const DataIterator&      dit = dbl.dataIterator();
+
+      m_coveredMask[lvl] = RefCountedPtr<LayoutData<CoveredMask>>(new LayoutData<CoveredMask>(dbl));
+
+      const int nbox = dit.size();
+#pragma omp parallel for schedule(runtime)
+      for (int mybox = 0; mybox < nbox; mybox++) {
+        const DataIndex& din = dit[mybox];
+
+        (*m_coveredMask[lvl])[din].define(m_baseif.isNull() ? nullptr : &(*m_baseif),
+                                          m_ebisl[lvl][din],
+                                          dbl[din],
+                                          m_domains[lvl],
+                                          m_probLo,
+                                          m_dx[lvl],
+                                          m_coveredMaskRefinement);
+      }
+    }
+  }
+}
+
 void
 PhaseRealm::defineEBCoarAve(const int a_lmin)
 {
@@ -807,13 +931,34 @@ PhaseRealm::defineIrregSten()
 
   if (doThisOperator) {
     for (int lvl = 0; lvl <= m_finestLevel; lvl++) {
-      m_cellCentroidInterpolation[lvl] = RefCountedPtr<CellCentroidInterpolation>(
-        new CellCentroidInterpolation(*m_eblg[lvl], m_dx[lvl], m_cellCentroidInterpolationType));
-
-      m_ebCentroidInterpolation[lvl] = RefCountedPtr<EBCentroidInterpolation>(
-        new EBCentroidInterpolation(*m_eblg[lvl], m_dx[lvl], m_ebCentroidInterpolationType));
+      m_cellCentroidInterpolation[lvl] = RefCountedPtr<CellCentroidInterpolation>(new CellCentroidInterpolation());
+      m_ebCentroidInterpolation[lvl]   = RefCountedPtr<EBCentroidInterpolation>(new EBCentroidInterpolation());
+
+      // Transplant stencils from the old objects on patches that did not change.
+      const bool hasPrevious = lvl < m_previousCellCentroidInterpolation.size() &&
+                               !(m_previousCellCentroidInterpolation[lvl].isNull()) &&
+                               !(m_previousEBCentroidInterpolation[lvl].isNull());
+
+      if (hasPrevious) {
+        m_cellCentroidInterpolation[lvl]->define(*m_eblg[lvl],
+                                                 m_dx[lvl],
+                                                 m_cellCentroidInterpolationType,
+                                                 *m_previousCellCentroidInterpolation[lvl]);
+        m_ebCentroidInterpolation[lvl]->define(*m_eblg[lvl],
+                                               m_dx[lvl],
+                                               m_ebCentroidInterpolationType,
+                                               *m_previousEBCentroidInterpolation[lvl]);
+      }
+      else {
+        m_cellCentroidInterpolation[lvl]->define(*m_eblg[lvl], m_dx[lvl], m_cellCentroidInterpolationType);
+        m_ebCentroidInterpolation[lvl]->define(*m_eblg[lvl], m_dx[lvl], m_ebCentroidInterpolationType);
+      }
     }
   }
+
+  // Release the old stencils.
+  m_previousCellCentroidInterpolation.resize(0);
+  m_previousEBCentroidInterpolation.resize(0);
 }
 
 void
@@ -890,6 +1035,12 @@ PhaseRealm::getVofIterator() const
   return m_vofIter;
 }
 
+const Vector<Vector<DataIndex>>&
+PhaseRealm::getCutCellPatches() const
+{
+  return m_cutCellPatches;
+}
+
 const Vector<RefCountedPtr<EBGradient>>&
 PhaseRealm::getGradientOp() const
 {
@@ -897,6 +1048,8 @@ PhaseRealm::getGradientOp() const
     MayDay::Error("PhaseRealm::getGradientOp - operator not registered!");
   }
 
+  this->buildPendingOperator(s_eb_gradient);
+
   return m_gradientOp;
 }
 
@@ -907,6 +1060,8 @@ PhaseRealm::getCellCentroidInterpolation() const
     MayDay::Error("PhaseRealm::getCellCentroidInterpolation - operator not registered!");
   }
 
+  this->buildPendingOperator(s_eb_irreg_interp);
+
   return m_cellCentroidInterpolation;
 }
 
@@ -917,6 +1072,8 @@ PhaseRealm::getEBCentroidInterpolation() const
     MayDay::Error("PhaseRealm::getEBCentroidInterpolation - operator not registered!");
   }
 
+  this->buildPendingOperator(s_eb_irreg_interp);
+
   return m_ebCentroidInterpolation;
 }
 
@@ -927,6 +1084,8 @@ PhaseRealm::getNonConservativeDivergence() const
     MayDay::Error("PhaseRealm::getNonConservativeDivergence - operator not registered!");
   }
 
+  this->buildPendingOperator(s_noncons_div);
+
   return m_nonConservativeDivergence;
 }
 
@@ -937,6 +1096,8 @@ PhaseRealm::getCoarseAverage() const
     MayDay::Error("PhaseRealm::getCoarseAverage - operator not registered!");
   }
 
+  this->buildPendingOperator(s_eb_coar_ave);
+
   return m_coarAve;
 }
 
@@ -947,6 +1108,8 @@ PhaseRealm::getMultigridInterpolator() const
     MayDay::Error("PhaseRealm::getEBMultigridInterpolator - operator not registered!");
   }
 
+  this->buildPendingOperator(s_eb_multigrid);
+
   return m_multigridInterpolator;
 }
 
@@ -957,6 +1120,8 @@ PhaseRealm::getGhostCellInterpolator() const
     MayDay::Error("PhaseRealm::getFillPatch - operator not registered!");
   }
 
+  this->buildPendingOperator(s_eb_fill_patch);
+
   return m_ghostCellInterpolator;
 }
 
@@ -967,6 +1132,8 @@ PhaseRealm::getFineInterp() const
     MayDay::Error("PhaseRealm::getFineInterp - operator not registered!");
   }
 
+  this->buildPendingOperator(s_eb_fine_interp);
+
   return m_ebFineInterp;
 }
 
@@ -977,6 +1144,8 @@ PhaseRealm::getFluxRegister() const
     MayDay::Error("PhaseRealm::getFluxRegister - operator not registered!");
   }
 
+  this->buildPendingOperator(s_eb_flux_reg);
+
   return m_ebReflux;
 }
 
@@ -987,6 +1156,8 @@ PhaseRealm::getRedistributionOp() const
     MayDay::Error("PhaseRealm::getRedistributionOp - operator not registered!");
   }
 
+  this->buildPendingOperator(s_eb_redist);
+
   return m_redistributionOp;
 }
 
@@ -997,6 +1168,8 @@ PhaseRealm::getParticleMesh() const
     MayDay::Error("PhaseRealm::getParticleMesh - operator not registered!");
   }
 
+  this->buildPendingOperator(s_particle_mesh);
+
   return m_particleMesh;
 }
 
@@ -1007,6 +1180,8 @@ PhaseRealm::getSurfaceDeposition() const
     MayDay::Error("PhaseRealm::getSurfaceDepostion - operator not registered!");
   }
 
+  this->buildPendingOperator(s_particle_mesh);
+
   return m_surfaceDeposition;
 }
 
@@ -1017,7 +1192,21 @@ PhaseRealm::getLevelset() const
     MayDay::Error("PhaseRealm::getLevelset - operator not registered!");
   }
 
+  this->buildPendingOperator(s_levelset);
+
   return m_levelset;
 }
 
+const Vector<RefCountedPtr<LayoutData<CoveredMask>>>&
+PhaseRealm::getCoveredMask() const
+{
+  if (!this->queryOperator(s_covered_mask)) {
+    MayDay::Error("PhaseRealm::getCoveredMask - operator not registered!");
+  }
+
+  this->buildPendingOperator(s_covered_mask);
+
+  return m_coveredMask;
+}
+
 #include <CD_NamespaceFooter.H>
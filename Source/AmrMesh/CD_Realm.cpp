@@ -32,6 +32,8 @@ Realm::Realm()
 
   pp.query("verbosity", m_verbosity);
 
+  m_multigridLevelCache = RefCountedPtr<MultigridLevelCache>(new MultigridLevelCache());
+
   // Just empty points until define() is called
   m_realms.emplace(phase::gas, RefCountedPtr<PhaseRealm>(new PhaseRealm()));
   m_realms.emplace(phase::solid, RefCountedPtr<PhaseRealm>(new PhaseRealm()));
@@ -65,6 +67,9 @@ Realm::define(const Vector<DisjointBoxLayout>&                          a_grids,
     pout() << "Realm::define" << endl;
   }
 
+  m_exchangeCopiers.clear();
+  m_multigridLevelCache->clear();
+
   m_grids                = a_grids;
   m_domains              = a_domains;
   m_refinementRatios     = a_refRat;
@@ -141,6 +146,8 @@ Realm::preRegrid()
   m_grids.resize(0);
   m_mflg.resize(0);
   m_validCells.resize(0);
+  m_exchangeCopiers.clear();
+  m_multigridLevelCache->clear();
 
   for (auto& mask : m_masks) {
     mask.second.resize(0);
@@ -627,6 +634,12 @@ Realm::getVofIterator(const phase::which_phase a_phase) const
   return m_realms[a_phase]->getVofIterator();
 }
 
+const Vector<Vector<DataIndex>>&
+Realm::getCutCellPatches(const phase::which_phase a_phase) const
+{
+  return m_realms[a_phase]->getCutCellPatches();
+}
+
 const Vector<RefCountedPtr<EBNonConservativeDivergence>>&
 Realm::getNonConservativeDivergence(const phase::which_phase a_phase) const
 {
@@ -705,6 +718,12 @@ Realm::getLevelset(const phase::which_phase a_phase) const
   return m_realms[a_phase]->getLevelset();
 }
 
+const Vector<RefCountedPtr<LayoutData<CoveredMask>>>&
+Realm::getCoveredMask(const phase::which_phase a_phase) const
+{
+  return m_realms[a_phase]->getCoveredMask();
+}
+
 const AMRMask&
 Realm::getMask(const std::string a_mask, const int a_buffer) const
 {
@@ -728,4 +747,35 @@ Realm::getLevelTiles() const noexcept
   return m_levelTiles;
 }
 
+const RefCountedPtr<MultigridLevelCache>&
+Realm::getMultigridLevelCache() const noexcept
+{
+  return m_multigridLevelCache;
+}
+
+const Vector<Copier>&
+Realm::getExchangeCopiers(const int a_numGhost) const
+{
+  CH_TIME("Realm::getExchangeCopiers");
+  if (m_verbosity > 5) {
+    pout() << "Realm::getExchangeCopiers" << endl;
+  }
+
+  CH_assert(a_numGhost > 0);
+
+  auto it = m_exchangeCopiers.find(a_numGhost);
+
+  if (it == m_exchangeCopiers.end()) {
+    it = m_exchangeCopiers.emplace(a_numGhost, Vector<Copier>(1 + m_finestLevel)).first;
+
+    Vector<Copier>& copiers = it->second;
+
+    for (int lvl = 0; lvl <= m_finestLevel; lvl++) {
+      copiers[lvl].exchangeDefine(m_grids[lvl], a_numGhost * IntVect::Unit);
+    }
+  }
+
+  return it->second;
+}
+
 #include <CD_NamespaceFooter.H>
@@ -10,6 +10,9 @@
 */
 
 // Std includes
+#include <algorithm>
+#include <iterator>
+#include <limits>
 #include <set>
 
 // Chombo includes
@@ -135,49 +138,10 @@ TiledMeshRefine::makeLevelTiles(TileSet&             a_tiles,
   }
   CH_STOP(t1);
 
-  // Gather tiles globally
-#ifdef CH_MPI
+  // Combine tiles globally
   CH_START(t2);
-  const int mySendCount  = a_tiles.size() * SpaceDim;
-  int*      mySendBuffer = new int[mySendCount];
-
-  // Get the number of elements sent by each MPI rank and compute the offset array which is required by Allgatherv
-  int  recvCount  = mySendCount;
-  int* sendCounts = new int[numProc()];
-  int* offsets    = new int[numProc()];
-
-  MPI_Allreduce(MPI_IN_PLACE, &recvCount, 1, MPI_INT, MPI_SUM, Chombo_MPI::comm);
-  MPI_Allgather(&mySendCount, 1, MPI_INT, sendCounts, 1, MPI_INT, Chombo_MPI::comm);
-  offsets[0] = 0;
-  for (int i = 0; i < numProc() - 1; i++) {
-    offsets[i + 1] = offsets[i] + sendCounts[i];
-  }
-
-  // Linearize the tiles as integers onto the send buffer
-  int idx = 0;
-  for (const auto& t : a_tiles) {
-    for (int dir = 0; dir < SpaceDim; dir++, idx++) {
-      mySendBuffer[idx] = t[dir];
-    }
-  }
-  a_tiles.clear();
-
-  // Allocate storage and gather tiles
-  int* recvBuffer = new int[recvCount];
-  MPI_Allgatherv(mySendBuffer, mySendCount, MPI_INT, recvBuffer, sendCounts, offsets, MPI_INT, Chombo_MPI::comm);
-
-  // de-linearize the received data back into tiles
-  for (int i = 0; i < recvCount; i += SpaceDim) {
-    a_tiles.emplace(Tile(D_DECL(recvBuffer[i], recvBuffer[i + 1], recvBuffer[i + 2])));
-  }
-
-  delete[] recvBuffer;
-  delete[] offsets;
-  delete[] sendCounts;
-  delete[] mySendBuffer;
-
+  this->combineTiles(a_tiles, tileBox);
   CH_STOP(t2);
-#endif
 
   // Ensure proper nesting by adding coarsened tiles from the fine level. We grow by one tile (one the fine level) in order
   // to ensure that we're nesting correctly.
@@ -203,6 +167,187 @@ TiledMeshRefine::makeLevelTiles(TileSet&             a_tiles,
   CH_STOP(t3);
 }
 
+void
+TiledMeshRefine::combineTiles(TileSet& a_tiles, const Box& a_tileBox) const noexcept
+{
+  CH_TIME("TiledMeshRefine::combineTiles");
+
+#ifdef CH_MPI
+  CH_assert(a_tileBox.smallEnd() == IntVect::Zero);
+
+  const IntVect numTiles = a_tileBox.size();
+
+  // Linearize the tiles. The first direction is the most significant one so the keys sort like the tiles.
+  std::vector<uint64_t> keys;
+  keys.reserve(a_tiles.size());
+
+  for (const auto& t : a_tiles) {
+    uint64_t key = 0;
+    for (int dir = 0; dir < SpaceDim; dir++) {
+      key = key * numTiles[dir] + t[dir];
+    }
+
+    keys.emplace_back(key);
+  }
+
+  std::sort(keys.begin(), keys.end());
+
+  // Use a bitmap if it is smaller than what the sparse reduction would move.
+  const long long totalKeys   = ParallelOps::sum((long long)keys.size());
+  const long long bitmapWords = (a_tileBox.numPts() + 63) / 64;
+
+  if (bitmapWords <= totalKeys && bitmapWords < std::numeric_limits<int>::max()) {
+    std::vector<uint64_t> bitmap(bitmapWords, 0);
+
+    for (const auto& key : keys) {
+      bitmap[key / 64] |= (uint64_t)1 << (key % 64);
+    }
+
+    MPI_Allreduce(MPI_IN_PLACE, bitmap.data(), (int)bitmapWords, MPI_UINT64_T, MPI_BOR, Chombo_MPI::comm);
+
+    keys.clear();
+    for (long long word = 0; word < bitmapWords; word++) {
+      for (int bit = 0; bit < 64; bit++) {
+        if ((bitmap[word] >> bit) & 1) {
+          keys.emplace_back(64 * word + bit);
+        }
+      }
+    }
+  }
+  else {
+    this->unionKeys(keys);
+  }
+
+  // De-linearize back into tiles. Since the keys are sorted we can insert at the end of the set.
+  a_tiles.clear();
+  for (const auto& key : keys) {
+    uint64_t k = key;
+    IntVect  iv;
+
+    for (int dir = SpaceDim - 1; dir >= 0; dir--) {
+      iv[dir] = k % numTiles[dir];
+      k /= numTiles[dir];
+    }
+
+    a_tiles.emplace_hint(a_tiles.end(), Tile(D_DECL(iv[0], iv[1], iv[2])));
+  }
+#endif
+}
+
+void
+TiledMeshRefine::unionKeys(std::vector<uint64_t>& a_keys) const noexcept
+{
+  CH_TIME("TiledMeshRefine::unionKeys");
+
+#ifdef CH_MPI
+  const int rank     = procID();
+  const int numRanks = numProc();
+
+  int powerOfTwo = 1;
+  while (2 * powerOfTwo <= numRanks) {
+    powerOfTwo *= 2;
+  }
+
+  const int remainder = numRanks - powerOfTwo;
+
+  auto sendKeys = [](const std::vector<uint64_t>& a_sendKeys, const int a_toRank) -> void {
+    int count = a_sendKeys.size();
+
+    MPI_Send(&count, 1, MPI_INT, a_toRank, 0, Chombo_MPI::comm);
+    MPI_Send(a_sendKeys.data(), count, MPI_UINT64_T, a_toRank, 1, Chombo_MPI::comm);
+  };
+
+  auto recvKeys = [](const int a_fromRank) -> std::vector<uint64_t> {
+    int count = 0;
+
+    MPI_Recv(&count, 1, MPI_INT, a_fromRank, 0, Chombo_MPI::comm, MPI_STATUS_IGNORE);
+
+    std::vector<uint64_t> recv(count);
+    MPI_Recv(recv.data(), count, MPI_UINT64_T, a_fromRank, 1, Chombo_MPI::comm, MPI_STATUS_IGNORE);
+
+    return recv;
+  };
+
+  auto mergeKeys = [&a_keys](const std::vector<uint64_t>& a_otherKeys) -> void {
+    std::vector<uint64_t> merged;
+    merged.reserve(a_keys.size() + a_otherKeys.size());
+
+    std::set_union(a_keys.begin(), a_keys.end(), a_otherKeys.begin(), a_otherKeys.end(), std::back_inserter(merged));
+
+    a_keys.swap(merged);
+  };
+
+  // TLDR: Fold the first 2*remainder ranks pairwise so that powerOfTwo ranks take part in the recursive doubling. The
+  //       even ranks in this range sit out and get the result back at the end.
+  int newRank = -1;
+
+  if (rank < 2 * remainder) {
+    if (rank % 2 == 0) {
+      sendKeys(a_keys, rank + 1);
+    }
+    else {
+      mergeKeys(recvKeys(rank - 1));
+
+      newRank = rank / 2;
+    }
+  }
+  else {
+    newRank = rank - remainder;
+  }
+
+  if (newRank >= 0) {
+    for (int mask = 1; mask < powerOfTwo; mask <<= 1) {
+      const int newPartner = newRank ^ mask;
+      const int partner    = (newPartner < remainder) ? 2 * newPartner + 1 : newPartner + remainder;
+
+      // Exchange sizes, then keys.
+      int sendCount = a_keys.size();
+      int recvCount = 0;
+
+      MPI_Sendrecv(&sendCount,
+                   1,
+                   MPI_INT,
+                   partner,
+                   2,
+                   &recvCount,
+                   1,
+                   MPI_INT,
+                   partner,
+                   2,
+                   Chombo_MPI::comm,
+                   MPI_STATUS_IGNORE);
+
+      std::vector<uint64_t> otherKeys(recvCount);
+
+      MPI_Sendrecv(a_keys.data(),
+                   sendCount,
+                   MPI_UINT64_T,
+                   partner,
+                   3,
+                   otherKeys.data(),
+                   recvCount,
+                   MPI_UINT64_T,
+                   partner,
+                   3,
+                   Chombo_MPI::comm,
+                   MPI_STATUS_IGNORE);
+
+      mergeKeys(otherKeys);
+    }
+  }
+
+  // Send the result back to the ranks that sat out.
+  if (rank < 2 * remainder) {
+    if (rank % 2 == 0) {
+      a_keys = recvKeys(rank + 1);
+    }
+    else {
+      sendKeys(a_keys, rank - 1);
+    }
+  }
+#endif
+}
+
 void
 TiledMeshRefine::makeBoxesFromTiles(Vector<Box>&         a_boxes,
                                     const TileSet&       a_tileSet,
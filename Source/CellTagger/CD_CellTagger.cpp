@@ -271,6 +271,28 @@ CellTagger::insideTagBox(const RealVect a_pos) const
   return doThisRefine;
 }
 
+bool
+CellTagger::intersectsTagBox(const RealVect a_lo, const RealVect a_hi) const
+{
+  CH_TIME("CellTagger::intersectsTagBox(RealVect, RealVect)");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::intersectsTagBox(RealVect, RealVect)" << endl;
+  }
+
+  bool intersects = (m_tagBoxes.size() > 0) ? false : true; // If we don't have any boxes, everything goes.
+
+  for (int ibox = 0; ibox < m_tagBoxes.size(); ibox++) {
+    const RealVect lo = m_tagBoxes[ibox].getLo();
+    const RealVect hi = m_tagBoxes[ibox].getHi();
+
+    if (a_hi >= lo && a_lo <= hi) {
+      intersects = true;
+    }
+  }
+
+  return intersects;
+}
+
 int
 CellTagger::getManualRefinementLevel(const RealVect a_pos) const
 {
@@ -15,6 +15,7 @@
 // Our includes
 #include <CD_CdrCTU.H>
 #include <CD_BoxLoops.H>
+#include <CD_BoxCosts.H>
 #include <CD_DataOps.H>
 #include <CD_ParallelOps.H>
 #include <CD_NamespaceHeader.H>
@@ -50,6 +51,7 @@ CdrCTU::parseOptions()
   this->parseMultigridSettings();     // Parses multigrid settings.
   this->parseDivergenceComputation(); // Non-conservative divergence blending
   this->parseRegridSlopes();          // Parses regrid slopes
+  this->parseActivityThreshold();     // Parses threshold for dormant patches
 }
 
 void
@@ -67,20 +69,21 @@ CdrCTU::parseRuntimeOptions()
   this->parseMultigridSettings();     // Parses multigrid settings.
   this->parseDivergenceComputation(); // Non-conservative divergence blending.
   this->parseRegridSlopes();          // Parses regrid slopes
+  this->parseActivityThreshold();     // Parses threshold for dormant patches
 }
 
 Real
-CdrCTU::computeAdvectionDt()
+CdrCTU::computeLevelAdvectionDt(const int a_level, const bool a_localOnly)
 {
-  CH_TIME("CdrCTU::computeAdvectionDt()");
+  CH_TIME("CdrCTU::computeLevelAdvectionDt(int, bool)");
   if (m_verbosity > 5) {
-    pout() << m_name + "::computeAdvectionDt()" << endl;
+    pout() << m_name + "::computeLevelAdvectionDt(int, bool)" << endl;
   }
 
   Real minDt = std::numeric_limits<Real>::max();
 
   if (!m_useCTU) {
-    minDt = CdrMultigrid::computeAdvectionDt();
+    minDt = CdrMultigrid::computeLevelAdvectionDt(a_level, true);
   }
   else {
 
@@ -90,62 +93,60 @@ CdrCTU::computeAdvectionDt()
     //       Bell, Colella, Glaz, J. Comp. Phys 85 (257), 1989
     //       Minion, J. Comp. Phys 123 (435), 1996
     if (m_isMobile) {
-      for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
-        const DisjointBoxLayout& dbl   = m_amr->getGrids(m_realm)[lvl];
-        const EBISLayout&        ebisl = m_amr->getEBISLayout(m_realm, m_phase)[lvl];
-        const Real               dx    = m_amr->getDx()[lvl];
-        const DataIterator&      dit   = dbl.dataIterator();
+      const DisjointBoxLayout& dbl   = m_amr->getGrids(m_realm)[a_level];
+      const EBISLayout&        ebisl = m_amr->getEBISLayout(m_realm, m_phase)[a_level];
+      const Real               dx    = m_amr->getDx()[a_level];
+      const DataIterator&      dit   = dbl.dataIterator();
 
-        const int nbox = dit.size();
+      const int nbox = dit.size();
 
 #pragma omp parallel for schedule(runtime) reduction(min : minDt)
-        for (int mybox = 0; mybox < nbox; mybox++) {
-          const DataIndex& din = dit[mybox];
+      for (int mybox = 0; mybox < nbox; mybox++) {
+        const DataIndex& din = dit[mybox];
 
-          const Box        cellBox = dbl[din];
-          const EBCellFAB& velo    = (*m_cellVelocity[lvl])[din];
-          const EBISBox&   ebisBox = ebisl[din];
+        const Box        cellBox = dbl[din];
+        const EBCellFAB& velo    = (*m_cellVelocity[a_level])[din];
+        const EBISBox&   ebisBox = ebisl[din];
 
-          VoFIterator& vofit = (*m_amr->getVofIterator(m_realm, m_phase)[lvl])[din];
+        VoFIterator& vofit = (*m_amr->getVofIterator(m_realm, m_phase)[a_level])[din];
 
-          // Regular grid data.
-          const BaseFab<Real>& veloReg = velo.getSingleValuedFAB();
+        // Regular grid data.
+        const BaseFab<Real>& veloReg = velo.getSingleValuedFAB();
 
-          // Compute dt = dx/(|vx|+|vy|+|vz|) and check if it's smaller than the smallest so far.
-          auto regularKernel = [&](const IntVect& iv) -> void {
-            Real velMax = 0.0;
-            if (ebisBox.isRegular(iv)) {
-              for (int dir = 0; dir < SpaceDim; dir++) {
-                velMax = std::max(velMax, std::abs(veloReg(iv, dir)));
-              }
+        // Compute dt = dx/(|vx|+|vy|+|vz|) and check if it's smaller than the smallest so far.
+        auto regularKernel = [&](const IntVect& iv) -> void {
+          Real velMax = 0.0;
+          if (ebisBox.isRegular(iv)) {
+            for (int dir = 0; dir < SpaceDim; dir++) {
+              velMax = std::max(velMax, std::abs(veloReg(iv, dir)));
             }
+          }
 
-            if (velMax > 0.0) {
-              minDt = std::min(dx / velMax, minDt);
-            }
-          };
+          if (velMax > 0.0) {
+            minDt = std::min(dx / velMax, minDt);
+          }
+        };
 
-          // Same kernel, but for cut-cells.
-          auto irregularKernel = [&](const VolIndex& vof) -> void {
-            Real velMax = 0.0;
-            for (int dir = 0; dir < SpaceDim; dir++) {
-              velMax = std::max(velMax, std::abs(velo(vof, dir)));
-            }
+        // Same kernel, but for cut-cells.
+        auto irregularKernel = [&](const VolIndex& vof) -> void {
+          Real velMax = 0.0;
+          for (int dir = 0; dir < SpaceDim; dir++) {
+            velMax = std::max(velMax, std::abs(velo(vof, dir)));
+          }
 
-            if (velMax > 0.0) {
-              minDt = std::min(dx / velMax, minDt);
-            }
-          };
+          if (velMax > 0.0) {
+            minDt = std::min(dx / velMax, minDt);
+          }
+        };
 
-          // Execute the kernels.
-          BoxLoops::loop(cellBox, regularKernel);
-          BoxLoops::loop(vofit, irregularKernel);
-        }
+        // Execute the kernels.
+        BoxLoops::loop(cellBox, regularKernel);
+        BoxLoops::loop(vofit, irregularKernel);
       }
     }
   }
 
-  return ParallelOps::min(minDt);
+  return a_localOnly ? minDt : ParallelOps::min(minDt);
 }
 
 void
@@ -195,13 +196,24 @@ CdrCTU::advectToFaces(EBAMRFluxData& a_facePhi, const EBAMRCellData& a_cellPhi,
 
   DataOps::setValue(a_facePhi, 0.0);
 
-  // Ghost cells need to be interpolated. We make a copy of a_cellPhi which we use for that. This requires
-  EBAMRCellData phi;
-  m_amr->allocate(phi, m_realm, m_phase, m_nComp);
-  DataOps::copy(phi, a_cellPhi);
+  // Ghost cells need to be interpolated. We make a copy of a_cellPhi which we use for that, unless the ghost cells have
+  // already been filled (in which case a_cellPhi has also been coarsened).
+  EBAMRCellData        scratch;
+  const EBAMRCellData* phiPtr = &a_cellPhi;
+
+  if (!m_ghostCellsFilled) {
+    m_amr->allocate(scratch, m_realm, m_phase, m_nComp);
+    DataOps::copy(scratch, a_cellPhi);
+
+    m_amr->conservativeAverage(scratch, m_realm, m_phase);
+    m_amr->interpGhostPwl(scratch, m_realm, m_phase);
+
+    phiPtr = &scratch;
+  }
 
-  m_amr->conservativeAverage(phi, m_realm, m_phase);
-  m_amr->interpGhostPwl(phi, m_realm, m_phase);
+  const EBAMRCellData& phi = *phiPtr;
+
+  this->computeActiveBoxes(phi);
 
   for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
     const DisjointBoxLayout& dbl    = m_amr->getGrids(m_realm)[lvl];
@@ -211,10 +223,18 @@ CdrCTU::advectToFaces(EBAMRFluxData& a_facePhi, const EBAMRCellData& a_cellPhi,
 
     const int nbox = dit.size();
 
-#pragma omp parallel for schedule(runtime)
+    // With fewer patches than threads the regular-cell kernels are threaded over tiles instead.
+#pragma omp parallel for schedule(runtime) if (BoxLoops::threadOverBoxes(nbox))
     for (int mybox = 0; mybox < nbox; mybox++) {
       const DataIndex& din = dit[mybox];
 
+      const BoxCosts::Scope costScope(m_realm, lvl, dbl[din]);
+
+      // Dormant patches have zero face states.
+      if (!this->isActiveBox(lvl, din)) {
+        continue;
+      }
+
       EBFluxFAB&       facePhi = (*a_facePhi[lvl])[din];
       const EBCellFAB& cellPhi = (*phi[lvl])[din];
       const EBCellFAB& cellVel = (*m_cellVelocity[lvl])[din];
@@ -449,7 +469,7 @@ CdrCTU::computeNormalSlopes(EBCellFAB&           a_normalSlopes,
     };
 
     // Apply the kernels. Beware of corrected slopes near the boundaries.
-    BoxLoops::loop(interiorCells, regularKernel);
+    BoxLoops::loopTiled(interiorCells, regularKernel);
     BoxLoops::loop(bndryLo, boundaryKernelLo);
     BoxLoops::loop(bndryHi, boundaryKernelHi);
     BoxLoops::loop(vofit, irregularKernel);
@@ -751,7 +771,7 @@ CdrCTU::upwind(EBFluxFAB&           a_facePhi,
     };
 
     // Launch the kernels.
-    BoxLoops::loop(interiorFaces, regularKernel);
+    BoxLoops::loopTiled(interiorFaces, regularKernel);
     BoxLoops::loop(bndryFacesLo, boundaryKernelLo);
     BoxLoops::loop(bndryFacesHi, boundaryKernelHi);
     BoxLoops::loop(irregFaces, irregularKernel);
@@ -50,6 +50,7 @@ CdrGodunov::parseOptions()
   this->parseExtrapolateSourceTerm(); // Parses source term extrapolation for Godunov time extrapolation.
   this->parseDivergenceComputation(); // Parses non-conservative divergence blending
   this->parseRegridSlopes();          // Parses regrid slopes
+  this->parseActivityThreshold();     // Parses threshold for dormant patches
 }
 
 void
@@ -68,14 +69,15 @@ CdrGodunov::parseRuntimeOptions()
   this->parseExtrapolateSourceTerm(); // Parses source term extrapolation
   this->parseDivergenceComputation(); // Parses non-conservative divergence blending.
   this->parseRegridSlopes();          // Parses regrid slopes
+  this->parseActivityThreshold();     // Parses threshold for dormant patches
 }
 
 Real
-CdrGodunov::computeAdvectionDt()
+CdrGodunov::computeLevelAdvectionDt(const int a_level, const bool a_localOnly)
 {
-  CH_TIME("CdrGodunov::computeAdvectionDt()");
+  CH_TIME("CdrGodunov::computeLevelAdvectionDt(int, bool)");
   if (m_verbosity > 5) {
-    pout() << m_name + "::computeAdvectionDt()" << endl;
+    pout() << m_name + "::computeLevelAdvectionDt(int, bool)" << endl;
   }
 
   // TLDR: For advection, Bell, Collela, and Glaz says we must have dt <= dx/max(|vx|, |vy|, |vz|). See these two papers for details:
@@ -86,60 +88,58 @@ CdrGodunov::computeAdvectionDt()
   Real minDt = std::numeric_limits<Real>::max();
 
   if (m_isMobile) {
-    for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
-      const DisjointBoxLayout& dbl   = m_amr->getGrids(m_realm)[lvl];
-      const EBISLayout&        ebisl = m_amr->getEBISLayout(m_realm, m_phase)[lvl];
-      const Real               dx    = m_amr->getDx()[lvl];
-      const DataIterator&      dit   = dbl.dataIterator();
+    const DisjointBoxLayout& dbl   = m_amr->getGrids(m_realm)[a_level];
+    const EBISLayout&        ebisl = m_amr->getEBISLayout(m_realm, m_phase)[a_level];
+    const Real               dx    = m_amr->getDx()[a_level];
+    const DataIterator&      dit   = dbl.dataIterator();
 
-      const int nbox = dit.size();
+    const int nbox = dit.size();
 
 #pragma omp parallel for schedule(runtime) reduction(min : minDt)
-      for (int mybox = 0; mybox < nbox; mybox++) {
-        const DataIndex& din     = dit[mybox];
-        const Box        cellBox = dbl[din];
-        const EBCellFAB& velo    = (*m_cellVelocity[lvl])[din];
-        const EBISBox&   ebisBox = ebisl[din];
-
-        VoFIterator& vofit = (*m_amr->getVofIterator(m_realm, m_phase)[lvl])[din];
-
-        // Regular grid data.
-        const BaseFab<Real>& veloReg = velo.getSingleValuedFAB();
-
-        // Compute dt = dx/(|vx|+|vy|+|vz|) and check if it's smaller than the smallest so far.
-        auto regularKernel = [&](const IntVect& iv) -> void {
-          Real velMax = 0.0;
-          if (ebisBox.isRegular(iv)) {
-            for (int dir = 0; dir < SpaceDim; dir++) {
-              velMax = std::max(velMax, std::abs(veloReg(iv, dir)));
-            }
-          }
+    for (int mybox = 0; mybox < nbox; mybox++) {
+      const DataIndex& din     = dit[mybox];
+      const Box        cellBox = dbl[din];
+      const EBCellFAB& velo    = (*m_cellVelocity[a_level])[din];
+      const EBISBox&   ebisBox = ebisl[din];
 
-          if (velMax > 0.0) {
-            minDt = std::min(dx / velMax, minDt);
-          }
-        };
+      VoFIterator& vofit = (*m_amr->getVofIterator(m_realm, m_phase)[a_level])[din];
 
-        // Same kernel, but for cut-cells.
-        auto irregularKernel = [&](const VolIndex& vof) -> void {
-          Real velMax = 0.0;
-          for (int dir = 0; dir < SpaceDim; dir++) {
-            velMax = std::max(velMax, std::abs(velo(vof, dir)));
-          }
+      // Regular grid data.
+      const BaseFab<Real>& veloReg = velo.getSingleValuedFAB();
 
-          if (velMax > 0.0) {
-            minDt = std::min(dx / velMax, minDt);
+      // Compute dt = dx/(|vx|+|vy|+|vz|) and check if it's smaller than the smallest so far.
+      auto regularKernel = [&](const IntVect& iv) -> void {
+        Real velMax = 0.0;
+        if (ebisBox.isRegular(iv)) {
+          for (int dir = 0; dir < SpaceDim; dir++) {
+            velMax = std::max(velMax, std::abs(veloReg(iv, dir)));
           }
-        };
-
-        // Execute the kernels.
-        BoxLoops::loop(cellBox, regularKernel);
-        BoxLoops::loop(vofit, irregularKernel);
-      }
+        }
+
+        if (velMax > 0.0) {
+          minDt = std::min(dx / velMax, minDt);
+        }
+      };
+
+      // Same kernel, but for cut-cells.
+      auto irregularKernel = [&](const VolIndex& vof) -> void {
+        Real velMax = 0.0;
+        for (int dir = 0; dir < SpaceDim; dir++) {
+          velMax = std::max(velMax, std::abs(velo(vof, dir)));
+        }
+
+        if (velMax > 0.0) {
+          minDt = std::min(dx / velMax, minDt);
+        }
+      };
+
+      // Execute the kernels.
+      BoxLoops::loop(cellBox, regularKernel);
+      BoxLoops::loop(vofit, irregularKernel);
     }
   }
 
-  return ParallelOps::min(minDt);
+  return a_localOnly ? minDt : ParallelOps::min(minDt);
 }
 
 void
@@ -251,6 +251,8 @@ CdrGodunov::advectToFaces(EBAMRFluxData& a_facePhi, const EBAMRCellData& a_cellP
   m_amr->conservativeAverage(scratch, m_realm, m_phase);
   m_amr->interpGhost(scratch, m_realm, m_phase);
 
+  this->computeActiveBoxes(a_cellPhi);
+
   // This code extrapolates the cell-centered state to face centers on every grid level, in both space and time.
   for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
     const DisjointBoxLayout& dbl = m_amr->getGrids(m_realm)[lvl];
@@ -267,6 +269,13 @@ CdrGodunov::advectToFaces(EBAMRFluxData& a_facePhi, const EBAMRCellData& a_cellP
       const EBCellFAB& cellVel = (*m_cellVelocity[lvl])[din];
       const EBFluxFAB& faceVel = (*m_faceVelocity[lvl])[din];
       const EBCellFAB& source  = (*scratch[lvl])[din];
+
+      // Dormant patches have zero face states.
+      if (!this->isActiveBox(lvl, din)) {
+        facePhi.setVal(0.0);
+
+        continue;
+      }
       const Real       time    = 0.0;
 
       EBAdvectPatchIntegrator& ebAdvectPatch = m_levelAdvect[lvl]->getPatchAdvect(din);
@@ -29,6 +29,9 @@ CdrMultigrid::CdrMultigrid() : CdrSolver()
   m_name               = "CdrMultigrid";
   m_className          = "CdrMultigrid";
   m_hasMultigridSolver = false;
+
+  m_multigridTelemetry     = false;
+  m_multigridTelemetryFile = "none";
 }
 
 CdrMultigrid::~CdrMultigrid()
@@ -104,6 +107,13 @@ CdrMultigrid::setMultigridSolverCoefficients()
     MayDay::Error("CdrMultigrid::setMultigridSolverCoefficients -- must set up solver first!");
   }
 
+  // Updating the coefficients rebuilds all the operator stencils, so don't do it if the coefficients did not change.
+  if (!this->hasNewDiffusionCoefficients()) {
+    return;
+  }
+
+  this->storeMultigridCoefficients();
+
   // Get the AMR operators and update the coefficients.
   Vector<AMRLevelOp<LevelData<EBCellFAB>>*>& operatorsAMR = m_multigridSolver->getAMROperators();
 
@@ -137,6 +147,56 @@ CdrMultigrid::setMultigridSolverCoefficients()
   }
 }
 
+bool
+CdrMultigrid::hasNewDiffusionCoefficients()
+{
+  CH_TIME("CdrMultigrid::hasNewDiffusionCoefficients()");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::hasNewDiffusionCoefficients()" << endl;
+  }
+
+  EBAMRFluxData deltaFace;
+  EBAMRIVData   deltaEB;
+
+  m_amr->allocate(deltaFace, m_realm, m_phase, m_nComp);
+  m_amr->allocate(deltaEB, m_realm, m_phase, m_nComp);
+
+  DataOps::copy(deltaFace, m_faceCenteredDiffusionCoefficient, Interval(m_comp, m_comp), Interval(m_comp, m_comp));
+  DataOps::copy(deltaEB, m_ebCenteredDiffusionCoefficient);
+
+  DataOps::incr(deltaFace, m_multigridFaceDco, -1.0);
+  DataOps::incr(deltaEB, m_multigridEbDco, -1.0);
+
+  Real maxFace = 0.0;
+  Real minFace = 0.0;
+  Real maxEB   = 0.0;
+  Real minEB   = 0.0;
+
+  DataOps::getMaxMin(maxFace, minFace, deltaFace, m_comp);
+  DataOps::getMaxMinNorm(maxEB, minEB, deltaEB);
+
+  // Note that the EB norm is -max(Real) if there are no cut-cells.
+  return (maxFace > 0.0 || minFace < 0.0 || maxEB > 0.0);
+}
+
+void
+CdrMultigrid::storeMultigridCoefficients()
+{
+  CH_TIME("CdrMultigrid::storeMultigridCoefficients()");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::storeMultigridCoefficients()" << endl;
+  }
+
+  m_amr->allocate(m_multigridFaceDco, m_realm, m_phase, m_nComp);
+  m_amr->allocate(m_multigridEbDco, m_realm, m_phase, m_nComp);
+
+  DataOps::copy(m_multigridFaceDco,
+                m_faceCenteredDiffusionCoefficient,
+                Interval(m_comp, m_comp),
+                Interval(m_comp, m_comp));
+  DataOps::copy(m_multigridEbDco, m_ebCenteredDiffusionCoefficient);
+}
+
 void
 CdrMultigrid::computeKappaLphi(EBAMRCellData& a_kappaLphi, const EBAMRCellData& a_phi)
 {
@@ -223,6 +283,10 @@ CdrMultigrid::advanceEuler(EBAMRCellData&       a_newPhi,
     const int coarsestLevel = 0;
     const int finestLevel   = m_amr->getFinestLevel();
 
+    if (m_multigridTelemetry) {
+      m_telemetry.startSolve(m_name, m_time);
+    }
+
     // Figure out how far away we are form a "converged" solution.
     const Real zeroResid = m_multigridSolver->computeAMRResidual(zer, eulerRHS, finestLevel, coarsestLevel);
 
@@ -232,8 +296,16 @@ CdrMultigrid::advanceEuler(EBAMRCellData&       a_newPhi,
     // Always from previous solution.
     DataOps::copy(a_newPhi, a_oldPhi);
 
+    if (m_multigridTelemetry) {
+      m_telemetry.addResidual(m_multigridSolver->computeAMRResidual(newPhi, eulerRHS, finestLevel, coarsestLevel));
+    }
+
     // Do the multigrid solve.
     m_multigridSolver->solveNoInitResid(newPhi, resid, eulerRHS, finestLevel, coarsestLevel, false);
+
+    if (m_multigridTelemetry) {
+      this->stopTelemetry(newPhi, eulerRHS);
+    }
   }
   else {
     DataOps::copy(a_newPhi, a_oldPhi);
@@ -322,6 +394,10 @@ CdrMultigrid::advanceCrankNicholson(EBAMRCellData&       a_newPhi,
     m_amr->alias(resid, m_residual);
     m_amr->alias(zer, zero);
 
+    if (m_multigridTelemetry) {
+      m_telemetry.startSolve(m_name, m_time);
+    }
+
     // Figure out how far away we are form a "converged" solution.
     const Real zeroResid = m_multigridSolver->computeAMRResidual(zer, eulerRHS, finestLevel, coarsestLevel);
 
@@ -331,14 +407,49 @@ CdrMultigrid::advanceCrankNicholson(EBAMRCellData&       a_newPhi,
     // Always from previous solution.
     DataOps::copy(a_newPhi, a_oldPhi);
 
+    if (m_multigridTelemetry) {
+      m_telemetry.addResidual(m_multigridSolver->computeAMRResidual(newPhi, eulerRHS, finestLevel, coarsestLevel));
+    }
+
     // Do the multigrid solve.
     m_multigridSolver->solveNoInitResid(newPhi, resid, eulerRHS, finestLevel, coarsestLevel, false);
+
+    if (m_multigridTelemetry) {
+      this->stopTelemetry(newPhi, eulerRHS);
+    }
   }
   else {
     DataOps::copy(a_newPhi, a_oldPhi);
   }
 }
 
+const MultigridTelemetry&
+CdrMultigrid::getMultigridTelemetry() const noexcept
+{
+  return m_telemetry;
+}
+
+void
+CdrMultigrid::stopTelemetry(Vector<LevelData<EBCellFAB>*>& a_phi, const Vector<LevelData<EBCellFAB>*>& a_rhs) noexcept
+{
+  CH_TIME("CdrMultigrid::stopTelemetry");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::stopTelemetry" << endl;
+  }
+
+  const int finestLevel = m_amr->getFinestLevel();
+
+  m_telemetry.addResidual(m_multigridSolver->computeAMRResidual(a_phi, a_rhs, finestLevel, 0));
+
+  const int status = m_multigridSolver->m_exitStatus; // 1 => Initial norm sufficiently reduced, 8 => Norm sufficiently small
+
+  m_telemetry.stopSolve(status == 1 || status == 8);
+
+  if (m_multigridTelemetryFile != "none") {
+    m_telemetry.writeCSV(m_multigridTelemetryFile);
+  }
+}
+
 void
 CdrMultigrid::setupDiffusionSolver()
 {
@@ -359,6 +470,7 @@ CdrMultigrid::setupDiffusionSolver()
     // This sets up the multigrid Helmholtz solver.
     this->setupHelmholtzFactory();
     this->setupMultigrid();
+    this->storeMultigridCoefficients();
 
     m_hasMultigridSolver = true;
   }
@@ -426,7 +538,11 @@ CdrMultigrid::setupHelmholtzFactory()
                              ghostRhs,
                              m_smoother,
                              bottomDomain,
-                             m_amr->getMaxBoxSize()));
+                             m_amr->getMaxBoxSize(),
+                             EBHelmholtzOpFactory::AmrLevelGrids(),
+                             m_amr->getMultigridLevelCache(m_realm)));
+
+  m_helmholtzOpFactory->setTelemetry(m_multigridTelemetry ? m_telemetry.getTimer() : RefCountedPtr<Timer>());
 }
 
 void
@@ -539,13 +655,17 @@ CdrMultigrid::computeDivJ(EBAMRCellData& a_divJ,
     m_amr->allocate(scratchFlux, m_realm, m_phase, m_nComp);
 
     // Fill ghost cells
-    m_amr->interpGhostPwl(a_phi, m_realm, m_phase);
+    if (!m_ghostCellsFilled) {
+      m_amr->interpGhostPwl(a_phi, m_realm, m_phase);
+    }
 
     // We will let scratchFlux hold the total flux = advection + diffusion fluxes
     DataOps::setValue(scratchFlux, 0.0);
 
     if (m_isMobile && !m_isDiffusive) {
-      m_amr->interpGhostPwl(m_cellVelocity, m_realm, m_phase);
+      if (!m_ghostCellsFilled) {
+        m_amr->interpGhostPwl(m_cellVelocity, m_realm, m_phase);
+      }
 
       // Update face velocity and advect to faces.
       this->averageVelocityToFaces();
@@ -557,7 +677,9 @@ CdrMultigrid::computeDivJ(EBAMRCellData& a_divJ,
       DataOps::scale(scratchFlux, -1.0);
     }
     else if (m_isMobile && m_isDiffusive) { //
-      m_amr->interpGhostPwl(m_cellVelocity, m_realm, m_phase);
+      if (!m_ghostCellsFilled) {
+        m_amr->interpGhostPwl(m_cellVelocity, m_realm, m_phase);
+      }
       this->averageVelocityToFaces();
       this->advectToFaces(m_faceStates, a_phi, a_extrapDt);
 
@@ -604,8 +726,10 @@ CdrMultigrid::computeDivF(EBAMRCellData& a_divF,
     m_amr->allocate(scratchFlux, m_realm, m_phase, m_nComp);
 
     // Fill ghost cells
-    m_amr->interpGhostPwl(a_phi, m_realm, m_phase);
-    m_amr->interpGhostPwl(m_cellVelocity, m_realm, m_phase);
+    if (!m_ghostCellsFilled) {
+      m_amr->interpGhostPwl(a_phi, m_realm, m_phase);
+      m_amr->interpGhostPwl(m_cellVelocity, m_realm, m_phase);
+    }
 
     // Cell-centered velocities become face-centered velocities.
     this->averageVelocityToFaces();
@@ -695,6 +819,11 @@ CdrMultigrid::parseMultigridSettings()
   pp.get("gmg_exit_hang", m_multigridExitHang);
   pp.get("gmg_min_cells", m_minCellsBottom);
 
+  m_multigridTelemetry     = false;
+  m_multigridTelemetryFile = "none";
+  pp.query("gmg_telemetry", m_multigridTelemetry);
+  pp.query("gmg_telem_file", m_multigridTelemetryFile);
+
   // Fetch the desired bottom solver from the input script. We look for things like CdrMultigrid.gmg_bottom_solver = bicgstab or '= simple <number>'
   // where <number> is the number of relaxation for the smoothing solver.
   const int num = pp.countval("gmg_bottom_solver");
@@ -19,6 +19,7 @@
 #include <CD_CdrSolver.H>
 #include <CD_DataOps.H>
 #include <CD_BoxLoops.H>
+#include <CD_BoxCosts.H>
 #include <CD_ParallelOps.H>
 #include <CD_DischargeIO.H>
 #include <CD_Random.H>
@@ -31,10 +32,12 @@ CdrSolver::CdrSolver()
 {
 
   // Default options.
-  m_verbosity    = -1;
-  m_name         = "CdrSolver";
-  m_className    = "CdrSolver";
-  m_regridSlopes = true;
+  m_verbosity        = -1;
+  m_name             = "CdrSolver";
+  m_className        = "CdrSolver";
+  m_regridSlopes      = true;
+  m_ghostCellsFilled  = false;
+  m_activityThreshold = -1.0;
 
   this->setRealm(Realm::Primal);
   this->setDefaultDomainBC(); // Set default domain BCs (wall)
@@ -85,7 +88,7 @@ CdrSolver::setDefaultDomainBC()
       const CdrDomainBC::DomainSide domainSide = std::make_pair(dir, sit());
 
       this->setDomainBcType(domainSide, CdrDomainBC::BcType::Wall);
-      this->setDomainBcFunction(domainSide, zero);
+      this->setDomainBcFunction(domainSide, zero, false);
     }
   }
 }
@@ -99,18 +102,23 @@ CdrSolver::setDomainBcType(const CdrDomainBC::DomainSide a_domainSide, const Cdr
   }
 
   m_domainBC.setBcType(a_domainSide, a_bcType);
+
+  m_domainFluxCached[a_domainSide] = false;
 }
 
 void
 CdrSolver::setDomainBcFunction(const CdrDomainBC::DomainSide   a_domainSide,
-                               const CdrDomainBC::FluxFunction a_fluxFunction)
+                               const CdrDomainBC::FluxFunction a_fluxFunction,
+                               const bool                      a_timeDependent)
 {
   CH_TIME("CdrSolver::setDomainBcFunction(CdrDomainBC::DomainSide, CdrDomainBC::FluxFunction)");
   if (m_verbosity > 5) {
     pout() << m_name + "::setDomainBcFunction(CdrDomainBC::DomainSide, CdrDomainBC::FluxFunction)" << endl;
   }
 
-  m_domainBC.setBcFunction(a_domainSide, a_fluxFunction);
+  m_domainBC.setBcFunction(a_domainSide, a_fluxFunction, a_timeDependent);
+
+  m_domainFluxCached[a_domainSide] = false;
 }
 
 std::string
@@ -339,6 +347,9 @@ CdrSolver::allocate()
 
   // Define interpolation stencils
   this->defineInterpolationStencils();
+
+  // Define the domain faces and invalidate the cached BC values.
+  this->defineDomainFaces();
 }
 
 void
@@ -443,7 +454,10 @@ CdrSolver::computeDivG(EBAMRCellData&     a_divG,
   this->conservativeDivergenceNoKappaDivision(a_divG, a_G, a_ebFlux);
 
   // Compute hybrid divergence.
-  if (!a_conservativeOnly) {
+  if (!a_conservativeOnly && m_blendConservation) {
+    this->hybridDivergenceAndRedistribution(a_divG);
+  }
+  else if (!a_conservativeOnly) {
     // Compute the non-conservative divergence
     this->nonConservativeDivergence(m_nonConservativeDivG, a_divG);
 
@@ -451,24 +465,44 @@ CdrSolver::computeDivG(EBAMRCellData&     a_divG,
     this->hybridDivergence(a_divG, m_massDifference, m_nonConservativeDivG);
 
     if (m_whichRedistribution != Redistribution::None) {
+      m_amr->redistribute(a_divG, m_massDifference, m_realm, m_phase);
+    }
+  }
+}
 
-      Vector<RefCountedPtr<EBFluxRedistribution>>& redistOps = m_amr->getRedistributionOp(m_realm, m_phase);
+void
+CdrSolver::hybridDivergenceAndRedistribution(EBAMRCellData& a_divG)
+{
+  CH_TIME("CdrSolver::hybridDivergenceAndRedistribution(EBAMRCellData)");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::hybridDivergenceAndRedistribution(EBAMRCellData)" << endl;
+  }
 
-      for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
-        const Real     scale     = 1.0;
-        const Interval variables = Interval(0, 0);
-        const bool     hasCoar   = lvl > 0;
-        const bool     hasFine   = lvl < m_amr->getFinestLevel();
+  CH_assert(a_divG[0]->nComp() == 1);
 
-        if (hasCoar) {
-          redistOps[lvl]->redistributeCoar(*a_divG[lvl - 1], *m_massDifference[lvl], scale, variables);
-        }
+  // TLDR: This does the same as nonConservativeDivergence, hybridDivergence, and the redistribution in computeDivG, but
+  //       level by level. The redistribution from level l-1 into level l must wait until the hybrid divergence on level
+  //       l has been computed since it changes kappa*div(G) in the cut-cells that it reads.
+  Vector<RefCountedPtr<EBFluxRedistribution>>& redistOps = m_amr->getRedistributionOp(m_realm, m_phase);
 
-        redistOps[lvl]->redistributeLevel(*a_divG[lvl], *m_massDifference[lvl], scale, variables);
+  const bool     doRedist  = m_whichRedistribution != Redistribution::None;
+  const Real     scale     = 1.0;
+  const Interval variables = Interval(0, 0);
 
-        if (hasFine) {
-          redistOps[lvl]->redistributeFine(*a_divG[lvl + 1], *m_massDifference[lvl], scale, variables);
-        }
+  for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
+    m_amr->hybridDivergence(*a_divG[lvl], *m_massDifference[lvl], *m_nonConservativeDivG[lvl], lvl, m_realm, m_phase);
+
+    if (doRedist) {
+      const bool hasCoar = lvl > 0;
+
+      if (hasCoar) {
+        redistOps[lvl]->redistributeCoar(*a_divG[lvl - 1], *m_massDifference[lvl], scale, variables);
+      }
+
+      redistOps[lvl]->redistributeLevel(*a_divG[lvl], *m_massDifference[lvl], scale, variables);
+
+      if (hasCoar) {
+        redistOps[lvl - 1]->redistributeFine(*a_divG[lvl], *m_massDifference[lvl - 1], scale, variables);
       }
     }
   }
@@ -484,28 +518,10 @@ CdrSolver::redistribute(EBAMRCellData& a_phi, const EBAMRIVData& a_delta) const
 
   CH_assert(a_phi.getRealm() == m_realm);
   CH_assert(a_delta.getRealm() == m_realm);
+  CH_assert(a_phi[0]->nComp() == 1);
+  CH_assert(a_delta[0]->nComp() == 1);
 
-  Vector<RefCountedPtr<EBFluxRedistribution>>& redistOps = m_amr->getRedistributionOp(m_realm, m_phase);
-
-  for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
-    const Real     scale     = 1.0;
-    const Interval variables = Interval(0, 0);
-    const bool     hasCoar   = lvl > 0;
-    const bool     hasFine   = lvl < m_amr->getFinestLevel();
-
-    CH_assert(a_phi[lvl]->nComp() == 1);
-    CH_assert(a_delta[lvl]->nComp() == 1);
-
-    if (hasCoar) {
-      redistOps[lvl]->redistributeCoar(*a_phi[lvl - 1], *a_delta[lvl], scale, variables);
-    }
-
-    redistOps[lvl]->redistributeLevel(*a_phi[lvl], *a_delta[lvl], scale, variables);
-
-    if (hasFine) {
-      redistOps[lvl]->redistributeFine(*a_phi[lvl + 1], *a_delta[lvl], scale, variables);
-    }
-  }
+  m_amr->redistribute(a_phi, a_delta, m_realm, m_phase);
 }
 
 void
@@ -628,6 +644,8 @@ CdrSolver::computeDiffusionFlux(LevelData<EBFluxFAB>& a_flux, const LevelData<EB
   for (int mybox = 0; mybox < nbox; mybox++) {
     const DataIndex& din = dit[mybox];
 
+    const BoxCosts::Scope costScope(m_realm, a_lvl, dbl[din]);
+
     const EBCellFAB& phi     = a_phi[din];
     const Box&       cellBox = dbl[din];
     const EBISBox&   ebisbox = ebisl[din];
@@ -710,6 +728,8 @@ CdrSolver::computeAdvectionDiffusionFlux(EBAMRFluxData&       a_flux,
     for (int mybox = 0; mybox < nbox; mybox++) {
       const DataIndex& din = dit[mybox];
 
+      const BoxCosts::Scope costScope(m_realm, lvl, dbl[din]);
+
       const Box&     cellBox = dbl[din];
       const EBISBox& ebisbox = ebisl[din];
       const EBGraph& ebgraph = ebisbox.getEBGraph();
@@ -870,13 +890,26 @@ CdrSolver::fillDomainFlux(LevelData<EBFluxFAB>& a_flux, const int a_level)
 
   CH_assert(a_flux.nComp() == 1);
 
-  // TLDR: This iterates through all domain faces and sets the BC flux to either data-based, function-based, wall bc, or extrapolated outflow. This
-  //       routine uses a face-iterator (because of BaseIFFAB<T>), but performance should be acceptable since we go through a very small number of faces.
+  // TLDR: This iterates through all domain faces and sets the BC flux to either data-based, function-based, wall bc, or
+  //       extrapolated outflow. The domain faces and their positions are cached in defineDomainFaces, and for
+  //       time-independent function BCs the fluxes are cached as well.
 
-  const DisjointBoxLayout& dbl    = m_amr->getGrids(m_realm)[a_level];
-  const ProblemDomain&     domain = m_amr->getDomains()[a_level];
-  const EBISLayout&        ebisl  = m_amr->getEBISLayout(m_realm, m_phase)[a_level];
-  const DataIterator&      dit    = dbl.dataIterator();
+  // Cache the function values on sides with time-independent function BCs. Done here since the box loop is threaded.
+  for (int dir = 0; dir < SpaceDim; dir++) {
+    for (SideIterator sit; sit.ok(); ++sit) {
+      const CdrDomainBC::DomainSide domainSide = std::make_pair(dir, sit());
+
+      const bool isFunction = m_domainBC.getBcType(domainSide) == CdrDomainBC::BcType::Function;
+
+      if (isFunction && !(m_domainBC.isTimeDependent(domainSide)) && !(m_domainFluxCached[domainSide])) {
+        this->cacheDomainFlux(domainSide);
+      }
+    }
+  }
+
+  const DisjointBoxLayout& dbl   = m_amr->getGrids(m_realm)[a_level];
+  const EBISLayout&        ebisl = m_amr->getEBISLayout(m_realm, m_phase)[a_level];
+  const DataIterator&      dit   = dbl.dataIterator();
 
   const int nbox = dit.size();
 
@@ -885,13 +918,10 @@ CdrSolver::fillDomainFlux(LevelData<EBFluxFAB>& a_flux, const int a_level)
     const DataIndex& din = dit[mybox];
 
     const EBISBox& ebisbox = ebisl[din];
-    const EBGraph& ebgraph = ebisbox.getEBGraph();
-    const Box      cellBox = dbl[din];
 
     for (int dir = 0; dir < SpaceDim; dir++) {
       EBFaceFAB& flux = a_flux[din][dir];
 
-      // Iterate over domain cells. I'm REALLY not sure about if this is performant...
       for (SideIterator sit; sit.ok(); ++sit) {
         const Side::LoHiSide side = sit();
 
@@ -899,48 +929,58 @@ CdrSolver::fillDomainFlux(LevelData<EBFluxFAB>& a_flux, const int a_level)
         const CdrDomainBC::BcType&       bcType     = m_domainBC.getBcType(domainSide);
         const CdrDomainBC::FluxFunction& bcFunction = m_domainBC.getBcFunction(domainSide);
 
+        // Domain faces on this side of the patch.
+        const DomainFaces&            domainFaces = (*m_domainFaces[a_level])[din].at(domainSide);
+        const std::vector<FaceIndex>& faces       = domainFaces.faces;
+        const int                     numFaces    = faces.size();
+
         // Data-based BC holders -- needed if bcType is CdrDomainBC::BcType::DataBased.
         const BaseIFFAB<Real>& dataBasedFlux = (*m_domainFlux[a_level])[din](dir, side);
 
-        // Create a box which abuts the current domain side
-        Box boundaryCellBox;
-        boundaryCellBox = adjCellBox(domain.domainBox(), dir, side, -1);
-        boundaryCellBox &= cellBox;
+        // Set the flux on the BC. This can be data-based, wall, function-based, outflow (extrapolated).
+        switch (bcType) {
+        case CdrDomainBC::BcType::DataBased: {
+          for (int i = 0; i < numFaces; i++) {
+            flux(faces[i], m_comp) = sign(side) * dataBasedFlux(faces[i], m_comp);
+          }
 
-        // Use a face-iterator here to go through domain faces -- sort of have to do this because of (the odd) design decision to use a BaseIFFAB for holding
-        // the domain fluxes.
-        //
-        // A FaceIterator may be inefficient, but we are REALLY going through a very small number of faces so there shouldn't be a performance hit here.
-        const IntVectSet ivs(boundaryCellBox);
-        FaceIterator     faceit(ivs, ebgraph, dir, FaceStop::AllBoundaryOnly);
+          break;
+        }
+        case CdrDomainBC::BcType::Wall: {
+          for (int i = 0; i < numFaces; i++) {
+            flux(faces[i], m_comp) = 0.0;
+          }
 
-        auto kernel = [&](const FaceIndex& face) -> void {
-          // Set the flux on the BC. This can be data-based, wall, function-based, outflow (extrapolated).
-          switch (bcType) {
-          case CdrDomainBC::BcType::DataBased: {
-            flux(face, m_comp) = sign(sit()) * dataBasedFlux(face, m_comp);
+          break;
+        }
+        case CdrDomainBC::BcType::Function: {
+          if (m_domainBC.isTimeDependent(domainSide)) {
+            const std::vector<RealVect>& positions = domainFaces.positions;
 
-            break;
+            for (int i = 0; i < numFaces; i++) {
+              flux(faces[i], m_comp) = -sign(side) * bcFunction(positions[i], m_time);
+            }
           }
-          case CdrDomainBC::BcType::Wall: {
-            flux(face, m_comp) = 0.0;
+          else {
+            const std::vector<Real>& values = domainFaces.values;
 
-            break;
+            for (int i = 0; i < numFaces; i++) {
+              flux(faces[i], m_comp) = values[i];
+            }
           }
-          case CdrDomainBC::BcType::Function: {
-            const RealVect pos = EBArith::getFaceLocation(face, m_amr->getDx()[a_level], m_amr->getProbLo());
 
-            flux(face, m_comp) = -sign(sit()) * bcFunction(pos, m_time);
+          break;
+        }
+        case CdrDomainBC::BcType::Outflow: {
+          for (int i = 0; i < numFaces; i++) {
+            const FaceIndex& face = faces[i];
 
-            break;
-          }
-          case CdrDomainBC::BcType::Outflow: {
             flux(face, m_comp) = 0.0;
 
             // Get the next interior face(s) and extrapolate from these.
-            const VolIndex interiorVof = face.getVoF(flip(sit()));
+            const VolIndex interiorVof = face.getVoF(flip(side));
 
-            const std::vector<FaceIndex> neighborFaces = ebisbox.getFaces(interiorVof, dir, flip(sit())).stdVector();
+            const std::vector<FaceIndex> neighborFaces = ebisbox.getFaces(interiorVof, dir, flip(side)).stdVector();
 
             if (neighborFaces.size() > 0) {
               Real sumArea = 0.0;
@@ -952,29 +992,127 @@ CdrSolver::fillDomainFlux(LevelData<EBFluxFAB>& a_flux, const int a_level)
                 flux(face, m_comp) += areaFrac * flux(f, m_comp);
               }
 
-              flux(face, m_comp) = sign(sit()) * std::max((Real)0.0, sign(sit()) * flux(face, m_comp)) / sumArea;
+              flux(face, m_comp) = sign(side) * std::max((Real)0.0, sign(side) * flux(face, m_comp)) / sumArea;
             }
-
-            break;
           }
-          case CdrDomainBC::BcType::Solver: {
-            // Don't do anything beacuse the solver will have filled the flux already.
 
-            break;
-          }
-          default: {
-            MayDay::Error(
-              "CdrSolver::fillDomainFlux(LD<EBFluxFAB>, int) - trying to fill unsupported domain bc flux type");
+          break;
+        }
+        case CdrDomainBC::BcType::Solver: {
+          // Don't do anything beacuse the solver will have filled the flux already.
 
-            break;
-          }
+          break;
+        }
+        default: {
+          MayDay::Error(
+            "CdrSolver::fillDomainFlux(LD<EBFluxFAB>, int) - trying to fill unsupported domain bc flux type");
+
+          break;
+        }
+        }
+      }
+    }
+  }
+}
+
+void
+CdrSolver::defineDomainFaces()
+{
+  CH_TIME("CdrSolver::defineDomainFaces()");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::defineDomainFaces()" << endl;
+  }
+
+  const int finestLevel = m_amr->getFinestLevel();
+
+  m_domainFaces.resize(1 + finestLevel);
+
+  for (int lvl = 0; lvl <= finestLevel; lvl++) {
+    const DisjointBoxLayout& dbl    = m_amr->getGrids(m_realm)[lvl];
+    const ProblemDomain&     domain = m_amr->getDomains()[lvl];
+    const EBISLayout&        ebisl  = m_amr->getEBISLayout(m_realm, m_phase)[lvl];
+    const DataIterator&      dit    = dbl.dataIterator();
+
+    m_domainFaces[lvl] = RefCountedPtr<LayoutData<std::map<CdrDomainBC::DomainSide, DomainFaces>>>(
+      new LayoutData<std::map<CdrDomainBC::DomainSide, DomainFaces>>(dbl));
+
+    const int nbox = dit.size();
+
+#pragma omp parallel for schedule(runtime)
+    for (int mybox = 0; mybox < nbox; mybox++) {
+      const DataIndex& din = dit[mybox];
+
+      const EBGraph& ebgraph = ebisl[din].getEBGraph();
+      const Box      cellBox = dbl[din];
+
+      std::map<CdrDomainBC::DomainSide, DomainFaces>& patchFaces = (*m_domainFaces[lvl])[din];
+
+      for (int dir = 0; dir < SpaceDim; dir++) {
+        for (SideIterator sit; sit.ok(); ++sit) {
+          DomainFaces& domainFaces = patchFaces[std::make_pair(dir, sit())];
+
+          // Create a box which abuts the current domain side
+          Box boundaryCellBox = adjCellBox(domain.domainBox(), dir, sit(), -1);
+          boundaryCellBox &= cellBox;
+
+          if (!(boundaryCellBox.isEmpty())) {
+            const IntVectSet ivs(boundaryCellBox);
+            FaceIterator     faceit(ivs, ebgraph, dir, FaceStop::AllBoundaryOnly);
+
+            auto kernel = [&](const FaceIndex& face) -> void {
+              domainFaces.faces.emplace_back(face);
+              domainFaces.positions.emplace_back(
+                EBArith::getFaceLocation(face, m_amr->getDx()[lvl], m_amr->getProbLo()));
+            };
+
+            BoxLoops::loop(faceit, kernel);
           }
-        };
-        // Run the kernel
-        BoxLoops::loop(faceit, kernel);
+        }
+      }
+    }
+  }
+
+  // Invalidate cached BC values.
+  for (auto& cached : m_domainFluxCached) {
+    cached.second = false;
+  }
+}
+
+void
+CdrSolver::cacheDomainFlux(const CdrDomainBC::DomainSide a_domainSide)
+{
+  CH_TIME("CdrSolver::cacheDomainFlux(CdrDomainBC::DomainSide)");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::cacheDomainFlux(CdrDomainBC::DomainSide)" << endl;
+  }
+
+  const CdrDomainBC::FluxFunction& bcFunction = m_domainBC.getBcFunction(a_domainSide);
+
+  const Real s = -sign(a_domainSide.second);
+
+  for (int lvl = 0; lvl < m_domainFaces.size(); lvl++) {
+    const DisjointBoxLayout& dbl = m_amr->getGrids(m_realm)[lvl];
+    const DataIterator&      dit = dbl.dataIterator();
+
+    const int nbox = dit.size();
+
+#pragma omp parallel for schedule(runtime)
+    for (int mybox = 0; mybox < nbox; mybox++) {
+      const DataIndex& din = dit[mybox];
+
+      DomainFaces& domainFaces = (*m_domainFaces[lvl])[din].at(a_domainSide);
+
+      const int numFaces = domainFaces.faces.size();
+
+      domainFaces.values.resize(numFaces);
+
+      for (int i = 0; i < numFaces; i++) {
+        domainFaces.values[i] = s * bcFunction(domainFaces.positions[i], m_time);
       }
     }
   }
+
+  m_domainFluxCached[a_domainSide] = true;
 }
 
 void
@@ -997,8 +1135,14 @@ CdrSolver::conservativeDivergenceNoKappaDivision(EBAMRCellData&     a_conservati
   //
   // This routine computes just that: a_conservativeDivergence = kappa*div(F) = Sum(fluxes).
   //
+  // The face centroid interpolation only reaches one cell into the ghost region, and the divergence is only needed out
+  // to the redistribution radius (for the non-conservative divergence and the redistribution). So we only exchange
+  // those ghost layers.
+  const Interval interv(m_comp, m_comp);
+  const int      redistRadius = m_amr->getRedistributionRadius();
+
   for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
-    a_flux[lvl]->exchange();
+    m_amr->exchange(*a_flux[lvl], m_realm, lvl, 1, interv);
 
     // Compute kappa*div(F) in regular cells
     this->conservativeDivergenceRegular(*a_conservativeDivergence[lvl], *a_flux[lvl], lvl);
@@ -1006,7 +1150,7 @@ CdrSolver::conservativeDivergenceNoKappaDivision(EBAMRCellData&     a_conservati
     // Recompute divergence on irregular cells
     this->computeDivergenceIrregular(*a_conservativeDivergence[lvl], *a_flux[lvl], *a_ebFlux[lvl], lvl);
 
-    a_conservativeDivergence[lvl]->exchange();
+    m_amr->exchange(*a_conservativeDivergence[lvl], m_realm, lvl, redistRadius, interv);
   }
 
   m_amr->conservativeAverage(a_conservativeDivergence, m_realm, m_phase);
@@ -1042,6 +1186,8 @@ CdrSolver::computeDivergenceIrregular(LevelData<EBCellFAB>&             a_divG,
   for (int mybox = 0; mybox < nbox; mybox++) {
     const DataIndex& din = dit[mybox];
 
+    const BoxCosts::Scope costScope(m_realm, a_lvl, dbl[din]);
+
     EBCellFAB&             divG    = a_divG[din];
     const BaseIVFAB<Real>& ebflux  = a_ebFlux[din];
     const EBISBox&         ebisbox = ebisl[din];
@@ -1107,6 +1253,8 @@ CdrSolver::conservativeDivergenceRegular(LevelData<EBCellFAB>&       a_divJ,
   for (int mybox = 0; mybox < nbox; mybox++) {
     const DataIndex& din = dit[mybox];
 
+    const BoxCosts::Scope costScope(m_realm, a_lvl, dbl[din]);
+
     const Box      cellBox = dbl[din];
     EBCellFAB&     divJ    = a_divJ[din];
     BaseFab<Real>& divJReg = divJ.getSingleValuedFAB();
@@ -1136,8 +1284,6 @@ CdrSolver::conservativeDivergenceRegular(LevelData<EBCellFAB>&       a_divJ,
 
     BoxLoops::loop(vofit, irregularKernel);
   }
-
-  a_divJ.exchange();
 }
 
 void
@@ -1154,6 +1300,7 @@ CdrSolver::defineInterpolationStencils()
 
   for (int dir = 0; dir < SpaceDim; dir++) {
     (m_interpStencils[dir]).resize(1 + finestLevel);
+    (m_faceCentroidStencils[dir]).resize(1 + finestLevel);
 
     for (int lvl = 0; lvl <= finestLevel; lvl++) {
       const DisjointBoxLayout& dbl    = m_amr->getGrids(m_realm)[lvl];
@@ -1164,6 +1311,9 @@ CdrSolver::defineInterpolationStencils()
       m_interpStencils[dir][lvl] = RefCountedPtr<LayoutData<BaseIFFAB<FaceStencil>>>(
         new LayoutData<BaseIFFAB<FaceStencil>>(dbl));
 
+      m_faceCentroidStencils[dir][lvl] = RefCountedPtr<LayoutData<FaceCentroidStencils>>(
+        new LayoutData<FaceCentroidStencils>(dbl));
+
       const int nbox = dit.size();
 
 #pragma omp parallel for schedule(runtime)
@@ -1171,6 +1321,7 @@ CdrSolver::defineInterpolationStencils()
         const DataIndex& din = dit[mybox];
 
         BaseIFFAB<FaceStencil>& sten     = (*m_interpStencils[dir][lvl])[din];
+        FaceCentroidStencils&   flatSten = (*m_faceCentroidStencils[dir][lvl])[din];
         const Box               cellBox  = dbl[din];
         const EBISBox&          ebisbox  = ebisl[din];
         const EBGraph&          ebgraph  = ebisbox.getEBGraph();
@@ -1178,10 +1329,22 @@ CdrSolver::defineInterpolationStencils()
 
         sten.define(irregIVS, ebisbox.getEBGraph(), dir, m_nComp);
 
+        flatSten.m_offsets.emplace_back(0);
+
         FaceIterator faceIt(irregIVS, ebgraph, dir, FaceStop::SurroundingWithBoundary);
 
         auto kernel = [&](const FaceIndex& face) -> void {
           sten(face, m_comp) = EBArith::getInterpStencil(face, IntVectSet(), ebisbox, domain.domainBox());
+
+          const FaceStencil& faceSten = sten(face, m_comp);
+
+          for (int i = 0; i < faceSten.size(); i++) {
+            flatSten.m_stencilFaces.emplace_back(faceSten.face(i));
+            flatSten.m_weights.emplace_back(faceSten.weight(i));
+          }
+
+          flatSten.m_faces.emplace_back(face);
+          flatSten.m_offsets.emplace_back(flatSten.m_weights.size());
         };
 
         BoxLoops::loop(faceIt, kernel);
@@ -1351,6 +1514,8 @@ CdrSolver::hybridDivergence(LevelData<EBCellFAB>&             a_hybridDivergence
   for (int mybox = 0; mybox < nbox; mybox++) {
     const DataIndex& din = dit[mybox];
 
+    const BoxCosts::Scope costScope(m_realm, a_lvl, dbl[din]);
+
     // On input, divH contains kappa*div(F) and divNC contains the non-conservative divergence
     EBCellFAB&             divH   = a_hybridDivergence[din];
     BaseIVFAB<Real>&       deltaM = a_massDifference[din];
@@ -1382,11 +1547,13 @@ CdrSolver::interpolateFluxToFaceCentroids(EBAMRFluxData& a_flux)
     pout() << m_name + "::interpolateFluxToFaceCentroids(EBAMRFluxData)" << endl;
   }
 
+  // The face centroid stencils only reach one cell into the ghost region.
   for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
-    a_flux[lvl]->exchange();
+    const Interval interv(0, a_flux[lvl]->nComp() - 1);
+
+    m_amr->exchange(*a_flux[lvl], m_realm, lvl, 1, interv);
 
     this->interpolateFluxToFaceCentroids(*a_flux[lvl], lvl);
-    ;
   }
 }
 
@@ -1400,8 +1567,9 @@ CdrSolver::interpolateFluxToFaceCentroids(LevelData<EBFluxFAB>& a_flux, const in
 
   CH_assert(a_flux.nComp() == 1);
 
-  // TLDR: We are given face-centered fluxes which we want to put on face centroids. To do this we store face-centered
-  //       fluxes on temporary storage and just interpolate them to face centroids.
+  // TLDR: We are given face-centered fluxes which we want to put on face centroids. The stencils read from faces that
+  //       we overwrite, so we first gather the face centroid fluxes for all cut-cell faces in the patch and then write
+  //       them into a_flux. The flattened stencils are computed in defineInterpolationStencils.
 
   const DisjointBoxLayout& dbl   = m_amr->getGrids(m_realm)[a_lvl];
   const EBISLayout&        ebisl = m_amr->getEBISLayout(m_realm, m_phase)[a_lvl];
@@ -1413,43 +1581,37 @@ CdrSolver::interpolateFluxToFaceCentroids(LevelData<EBFluxFAB>& a_flux, const in
   for (int mybox = 0; mybox < nbox; mybox++) {
     const DataIndex& din = dit[mybox];
 
-    const Box        cellBox  = dbl.get(din);
-    const EBISBox&   ebisbox  = ebisl[din];
-    const EBGraph&   ebgraph  = ebisbox.getEBGraph();
-    const IntVectSet irregIVS = ebisbox.getIrregIVS(cellBox);
+    const BoxCosts::Scope costScope(m_realm, a_lvl, dbl[din]);
+
+    const Box      cellBox = dbl.get(din);
+    const EBISBox& ebisbox = ebisl[din];
 
     const bool isRegular   = ebisbox.isRegular(cellBox);
     const bool isCovered   = ebisbox.isCovered(cellBox);
     const bool isIrregular = !isRegular && !isCovered;
 
     if (isIrregular) {
+      std::vector<Real> centroidFlux;
+
       for (int dir = 0; dir < SpaceDim; dir++) {
         EBFaceFAB& faceFlux = a_flux[din][dir];
 
-        // Make a copy of faceFlux which we use as interpolant. EBFaceFAB
-        // needs a cell box, so here you go.
-        EBFaceFAB clone(ebisbox, faceFlux.getCellRegion(), dir, m_nComp);
-        clone.setVal(0.0);
-        clone += faceFlux;
-
-        // Compute face centroid flux on cut-cell face centroids. Since a_flux enforces boundary conditions
-        // we include domain boundary cut-cell faces in the interpolation.
-        FaceIterator faceit(irregIVS, ebgraph, dir, FaceStop::SurroundingWithBoundary);
-
-        auto kernel = [&](const FaceIndex& face) -> void {
-          const FaceStencil& sten = (*m_interpStencils[dir][a_lvl])[din](face, m_comp);
+        // Since a_flux enforces boundary conditions the stencils include domain boundary cut-cell faces.
+        const FaceCentroidStencils& sten = (*m_faceCentroidStencils[dir][a_lvl])[din];
 
-          faceFlux(face, m_comp) = 0.;
+        const int numFaces = sten.m_faces.size();
 
-          for (int i = 0; i < sten.size(); i++) {
-            const FaceIndex& iface   = sten.face(i);
-            const Real       iweight = sten.weight(i);
+        centroidFlux.assign(numFaces, 0.0);
 
-            faceFlux(face, m_comp) += iweight * clone(iface, m_comp);
+        for (int iface = 0; iface < numFaces; iface++) {
+          for (int i = sten.m_offsets[iface]; i < sten.m_offsets[iface + 1]; i++) {
+            centroidFlux[iface] += sten.m_weights[i] * faceFlux(sten.m_stencilFaces[i], m_comp);
           }
-        };
+        }
 
-        BoxLoops::loop(faceit, kernel);
+        for (int iface = 0; iface < numFaces; iface++) {
+          faceFlux(sten.m_faces[iface], m_comp) = centroidFlux[iface];
+        }
       }
     }
   }
@@ -1492,9 +1654,17 @@ CdrSolver::regrid(const int a_lmin, const int a_oldFinestLevel, const int a_newF
   const EBCoarseToFineInterp::Type interpType = m_regridSlopes ? EBCoarseToFineInterp::Type::ConservativeMinMod
                                                                : EBCoarseToFineInterp::Type::ConservativePWC;
 
-  // Interpolate to the new grids.
-  m_amr->interpToNewGrids(m_phi, m_cachePhi, m_phase, a_lmin, a_oldFinestLevel, a_newFinestLevel, interpType);
-  m_amr->interpToNewGrids(m_source, m_cacheSource, m_phase, a_lmin, a_oldFinestLevel, a_newFinestLevel, interpType);
+  // Interpolate to the new grids with a single aggregated copy per level.
+  Vector<EBAMRCellData*> newData;
+  Vector<EBAMRCellData*> oldData;
+
+  newData.push_back(&m_phi);
+  newData.push_back(&m_source);
+
+  oldData.push_back(&m_cachePhi);
+  oldData.push_back(&m_cacheSource);
+
+  m_amr->interpToNewGrids(newData, oldData, m_phase, a_lmin, a_oldFinestLevel, a_newFinestLevel, interpType);
 
   // Coarsen data and update ghost cells.
   m_amr->conservativeAverage(m_phi, m_realm, m_phase);
@@ -1768,6 +1938,17 @@ CdrSolver::setVerbosity(const int a_verbosity)
   }
 }
 
+void
+CdrSolver::setGhostCellsFilled(const bool a_ghostCellsFilled) noexcept
+{
+  CH_TIME("CdrSolver::setGhostCellsFilled(bool)");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::setGhostCellsFilled(bool)" << endl;
+  }
+
+  m_ghostCellsFilled = a_ghostCellsFilled;
+}
+
 void
 CdrSolver::writePlotFile()
 {
@@ -1984,11 +2165,29 @@ CdrSolver::readCheckpointLevel(HDF5Handle& a_handle, const int a_level)
 #endif
 
 Real
-CdrSolver::computeAdvectionDt()
+CdrSolver::computeAdvectionDt(const bool a_localOnly)
+{
+  CH_TIME("CdrSolver::computeAdvectionDt(bool)");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::computeAdvectionDt(bool)" << endl;
+  }
+
+  Real minDt = std::numeric_limits<Real>::max();
+
+  // Reduce once over the MPI ranks rather than once per level.
+  for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
+    minDt = std::min(minDt, this->computeLevelAdvectionDt(lvl, true));
+  }
+
+  return a_localOnly ? minDt : ParallelOps::min(minDt);
+}
+
+Real
+CdrSolver::computeLevelAdvectionDt(const int a_level, const bool a_localOnly)
 {
-  CH_TIME("CdrSolver::computeAdvectionDt()");
+  CH_TIME("CdrSolver::computeLevelAdvectionDt(int, bool)");
   if (m_verbosity > 5) {
-    pout() << m_name + "::computeAdvectionDt()" << endl;
+    pout() << m_name + "::computeLevelAdvectionDt(int, bool)" << endl;
   }
 
   // TLDR: For advection we must have dt <= dx/(|vx|+|vy|+|vz|). E.g., with first order upwind phi^(k+1)_i = phi^k_i - (v*dt) * (phi^k_i - phi^k_(i-1))/dx so
@@ -1997,65 +2196,63 @@ CdrSolver::computeAdvectionDt()
   Real minDt = std::numeric_limits<Real>::max();
 
   if (m_isMobile) {
-    for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
-      const DisjointBoxLayout& dbl   = m_amr->getGrids(m_realm)[lvl];
-      const EBISLayout&        ebisl = m_amr->getEBISLayout(m_realm, m_phase)[lvl];
-      const Real               dx    = m_amr->getDx()[lvl];
-      const DataIterator&      dit   = dbl.dataIterator();
+    const DisjointBoxLayout& dbl   = m_amr->getGrids(m_realm)[a_level];
+    const EBISLayout&        ebisl = m_amr->getEBISLayout(m_realm, m_phase)[a_level];
+    const Real               dx    = m_amr->getDx()[a_level];
+    const DataIterator&      dit   = dbl.dataIterator();
 
-      const int nbox = dit.size();
+    const int nbox = dit.size();
 
 #pragma omp parallel for schedule(runtime) reduction(min : minDt)
-      for (int mybox = 0; mybox < nbox; mybox++) {
-        const DataIndex& din = dit[mybox];
-
-        const Box        cellBox = dbl[din];
-        const EBCellFAB& velo    = (*m_cellVelocity[lvl])[din];
-        const EBISBox&   ebisBox = ebisl[din];
-
-        VoFIterator& vofit = (*m_amr->getVofIterator(m_realm, m_phase)[lvl])[din];
+    for (int mybox = 0; mybox < nbox; mybox++) {
+      const DataIndex& din = dit[mybox];
 
-        // Regular grid data.
-        const BaseFab<Real>& veloReg = velo.getSingleValuedFAB();
+      const Box        cellBox = dbl[din];
+      const EBCellFAB& velo    = (*m_cellVelocity[a_level])[din];
+      const EBISBox&   ebisBox = ebisl[din];
 
-        // Compute dt = dx/(|vx|+|vy|+|vz|) and check if it's smaller than the smallest so far.
-        auto regularKernel = [&](const IntVect& iv) -> void {
-          if (!ebisBox.isCovered(iv)) {
-            Real vel = 0.0;
-            for (int dir = 0; dir < SpaceDim; dir++) {
-              vel += std::abs(veloReg(iv, dir));
-            }
+      VoFIterator& vofit = (*m_amr->getVofIterator(m_realm, m_phase)[a_level])[din];
 
-            minDt = std::min(dx / vel, minDt);
-          }
-        };
+      // Regular grid data.
+      const BaseFab<Real>& veloReg = velo.getSingleValuedFAB();
 
-        // Same kernel, but for cut-cells.
-        auto irregularKernel = [&](const VolIndex& vof) -> void {
+      // Compute dt = dx/(|vx|+|vy|+|vz|) and check if it's smaller than the smallest so far.
+      auto regularKernel = [&](const IntVect& iv) -> void {
+        if (!ebisBox.isCovered(iv)) {
           Real vel = 0.0;
           for (int dir = 0; dir < SpaceDim; dir++) {
-            vel += std::abs(velo(vof, dir));
+            vel += std::abs(veloReg(iv, dir));
           }
 
           minDt = std::min(dx / vel, minDt);
-        };
+        }
+      };
 
-        // Execute the kernels.
-        BoxLoops::loop(cellBox, regularKernel);
-        BoxLoops::loop(vofit, irregularKernel);
-      }
+      // Same kernel, but for cut-cells.
+      auto irregularKernel = [&](const VolIndex& vof) -> void {
+        Real vel = 0.0;
+        for (int dir = 0; dir < SpaceDim; dir++) {
+          vel += std::abs(velo(vof, dir));
+        }
+
+        minDt = std::min(dx / vel, minDt);
+      };
+
+      // Execute the kernels.
+      BoxLoops::loop(cellBox, regularKernel);
+      BoxLoops::loop(vofit, irregularKernel);
     }
   }
 
-  return ParallelOps::min(minDt);
+  return a_localOnly ? minDt : ParallelOps::min(minDt);
 }
 
 Real
-CdrSolver::computeDiffusionDt()
+CdrSolver::computeDiffusionDt(const bool a_localOnly)
 {
-  CH_TIME("CdrSolver::computeDiffusionDt()");
+  CH_TIME("CdrSolver::computeDiffusionDt(bool)");
   if (m_verbosity > 5) {
-    pout() << m_name + "::computeDiffusionDt()" << endl;
+    pout() << m_name + "::computeDiffusionDt(bool)" << endl;
   }
 
   // TLDR: For advection we must have dt <= (dx*dx)/(2*d*D) where D is diffusion coefficient and d is spatial dimensions.
@@ -2133,15 +2330,15 @@ CdrSolver::computeDiffusionDt()
     }
   }
 
-  return ParallelOps::min(minDt);
+  return a_localOnly ? minDt : ParallelOps::min(minDt);
 }
 
 Real
-CdrSolver::computeAdvectionDiffusionDt()
+CdrSolver::computeAdvectionDiffusionDt(const bool a_localOnly)
 {
-  CH_TIME("CdrSolver::computeAdvectionDiffusionDt()");
+  CH_TIME("CdrSolver::computeAdvectionDiffusionDt(bool)");
   if (m_verbosity > 5) {
-    pout() << m_name + "::computeAdvectionDiffusionDt()" << endl;
+    pout() << m_name + "::computeAdvectionDiffusionDt(bool)" << endl;
   }
 
   // In 1D we have, e.g. d(phi)/dt = -d/dx(v*phi) + D*d^2(phi)/dx^2. Discretizing it with e.g. first order upwind and centered differencing yields
@@ -2251,7 +2448,7 @@ CdrSolver::computeAdvectionDiffusionDt()
     }
   }
 
-  return ParallelOps::min(minDt);
+  return a_localOnly ? minDt : ParallelOps::min(minDt);
 }
 
 Real
@@ -2498,7 +2695,7 @@ CdrSolver::computeMass()
 }
 
 Real
-CdrSolver::computeMass(const EBAMRCellData& a_phi, const bool a_kappaScale)
+CdrSolver::computeMass(const EBAMRCellData& a_phi, const bool a_kappaScale, const bool a_localOnly)
 {
   CH_TIME("CdrSolver::computeMass(EBAMRCellData)");
   if (m_verbosity > 5) {
@@ -2554,7 +2751,7 @@ CdrSolver::computeMass(const EBAMRCellData& a_phi, const bool a_kappaScale)
     }
   }
 
-  return ParallelOps::sum(mass);
+  return a_localOnly ? mass : ParallelOps::sum(mass);
 }
 
 Real
@@ -3219,4 +3416,93 @@ CdrSolver::parseRegridSlopes()
   pp.get("use_regrid_slopes", m_regridSlopes);
 }
 
+void
+CdrSolver::parseActivityThreshold()
+{
+  CH_TIME("CdrSolver::parseActivityThreshold()");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::parseActivityThreshold()" << endl;
+  }
+
+  ParmParse pp(m_className.c_str());
+
+  m_activityThreshold = -1.0;
+  pp.query("activity_threshold", m_activityThreshold);
+}
+
+void
+CdrSolver::computeActiveBoxes(const EBAMRCellData& a_phi) noexcept
+{
+  CH_TIME("CdrSolver::computeActiveBoxes(EBAMRCellData)");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::computeActiveBoxes(EBAMRCellData)" << endl;
+  }
+
+  CH_assert(a_phi[0]->nComp() == 1);
+
+  if (m_activityThreshold <= 0.0) {
+    m_activeBoxes.resize(0);
+
+    return;
+  }
+
+  m_activeBoxes.resize(1 + m_amr->getFinestLevel());
+
+  for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
+    const DisjointBoxLayout& dbl    = m_amr->getGrids(m_realm)[lvl];
+    const ProblemDomain&     domain = m_amr->getDomains()[lvl];
+    const EBISLayout&        ebisl  = m_amr->getEBISLayout(m_realm, m_phase)[lvl];
+    const DataIterator&      dit    = dbl.dataIterator();
+
+    m_activeBoxes[lvl] = RefCountedPtr<LayoutData<bool>>(new LayoutData<bool>(dbl));
+
+    LayoutData<bool>& activeBoxes = *m_activeBoxes[lvl];
+
+    const int nbox = dit.size();
+
+#pragma omp parallel for schedule(runtime)
+    for (int mybox = 0; mybox < nbox; mybox++) {
+      const DataIndex& din = dit[mybox];
+
+      const Box            grownBox = grow(dbl[din], 1) & domain;
+      const EBISBox&       ebisBox  = ebisl[din];
+      const EBCellFAB&     phi      = (*a_phi[lvl])[din];
+      const BaseFab<Real>& phiReg   = phi.getSingleValuedFAB();
+
+      bool isActive = false;
+
+      auto regularKernel = [&](const IntVect& iv) -> void {
+        if (std::abs(phiReg(iv, m_comp)) >= m_activityThreshold) {
+          isActive = true;
+        }
+      };
+
+      auto irregularKernel = [&](const VolIndex& vof) -> void {
+        if (std::abs(phi(vof, m_comp)) >= m_activityThreshold) {
+          isActive = true;
+        }
+      };
+
+      VoFIterator vofit(ebisBox.getMultiCells(grownBox), ebisBox.getEBGraph());
+
+      BoxLoops::loop(grownBox, regularKernel);
+      BoxLoops::loop(vofit, irregularKernel);
+
+      activeBoxes[din] = isActive;
+    }
+  }
+}
+
+bool
+CdrSolver::isActiveBox(const int a_level, const DataIndex& a_din) const noexcept
+{
+  CH_assert(a_level >= 0);
+
+  if (m_activityThreshold <= 0.0 || a_level >= m_activeBoxes.size()) {
+    return true;
+  }
+
+  return (*m_activeBoxes[a_level])[a_din];
+}
+
 #include <CD_NamespaceFooter.H>
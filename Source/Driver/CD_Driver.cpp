@@ -10,9 +10,15 @@
 */
 
 // Std includes
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <sstream>
+#include <vector>
+#include <sys/stat.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 // Chombo includes
 #include <EBArith.H>
@@ -26,14 +32,18 @@
 
 // Our includes
 #include <CD_Driver.H>
+#include <CD_Ensemble.H>
 #include <CD_Random.H>
 #include <CD_VofUtils.H>
 #include <CD_DataOps.H>
 #include <CD_BoxLoops.H>
+#include <CD_BoxCosts.H>
 #include <CD_MultifluidAlias.H>
 #include <CD_Units.H>
 #include <CD_MemoryReport.H>
 #include <CD_Timer.H>
+#include <CD_Profiler.H>
+#include <CD_MemoryTracker.H>
 #include <CD_ParallelOps.H>
 #include <CD_DischargeIO.H>
 #include <CD_OpenMP.H>
@@ -50,6 +60,9 @@ Driver::Driver(const RefCountedPtr<ComputationalGeometry>& a_computationalGeomet
 
   m_verbosity = -1;
 
+  // Split the MPI ranks into ensemble members if the user asked for it. This must happen before any MPI communication.
+  Ensemble::initialize();
+
   this->setComputationalGeometry(a_computationalGeometry); // Set computational geometry
   this->setTimeStepper(a_timeStepper);                     // Set time stepper
   this->setAmr(a_amr);                                     // Set amr
@@ -67,8 +80,15 @@ Driver::Driver(const RefCountedPtr<ComputationalGeometry>& a_computationalGeomet
   m_outputDt = -1.0;
 
   m_profile      = false;
+  m_plotStaging  = false;
   m_doCoarsening = true;
 
+  m_checkpointsSinceFull = 0;
+  m_fullCheckpointStep   = -1;
+
+  m_tagCentroidLevel = -1;
+  m_tagCentroid      = RealVect::Zero;
+
   // Parse some class options and create the output directories for the simulation.
   this->parseOptions();
 
@@ -428,9 +448,16 @@ Driver::getCellsAndBoxes(long long&                       a_numLocalCells,
       numBoxes += 1;
     }
 
-    const long long cellsThisLevel       = ParallelOps::sum(numCellsNoGhosts);
-    const long long cellsThisLevelGhosts = ParallelOps::sum(numCellsWithGhosts);
-    const long long boxesThisLevel       = ParallelOps::sum(numBoxes);
+    long long cellsThisLevel       = numCellsNoGhosts;
+    long long cellsThisLevelGhosts = numCellsWithGhosts;
+    long long boxesThisLevel       = numBoxes;
+
+    ParallelOps::Reduction reduction;
+
+    reduction.sum(cellsThisLevel);
+    reduction.sum(cellsThisLevelGhosts);
+    reduction.sum(boxesThisLevel);
+    reduction.reduce();
 
     // Total for this level
     a_numLocalCells += numCellsNoGhosts;
@@ -591,10 +618,18 @@ Driver::gridReport()
 
   // If this is an MPI run we want to include the maximum consum memory in the report as well. We compute the
   // smallest/largest memory consumptions.
-  const long long minUnfreedMemory = ParallelOps::min(localUnfreedMemory);
-  const long long minPeakMemory    = ParallelOps::min(localPeakMemory);
-  const long long maxUnfreedMemory = ParallelOps::max(localUnfreedMemory);
-  const long long maxPeakMemory    = ParallelOps::max(localPeakMemory);
+  long long minUnfreedMemory = localUnfreedMemory;
+  long long minPeakMemory    = localPeakMemory;
+  long long maxUnfreedMemory = localUnfreedMemory;
+  long long maxPeakMemory    = localPeakMemory;
+
+  ParallelOps::Reduction reduction;
+
+  reduction.min(minUnfreedMemory);
+  reduction.min(minPeakMemory);
+  reduction.max(maxUnfreedMemory);
+  reduction.max(maxPeakMemory);
+  reduction.reduce();
 
   pout() << "\tMin unfreed memory    = " << std::ceil(minUnfreedMemory / BytesPerMB) << " (MB)" << endl
          << "\tMin peak memory       = " << std::ceil(minPeakMemory / BytesPerMB) << " (MB)" << endl
@@ -611,6 +646,7 @@ void
 Driver::regrid(const int a_lmin, const int a_lmax, const bool a_useInitialData)
 {
   CH_TIMERS("Driver::regrid");
+  CD_PROFILE("Driver::regrid");
   CH_TIMER("Driver::regrid::compact_tags", t1);
   if (m_verbosity > 2) {
     pout() << "Driver::regrid" << endl;
@@ -651,6 +687,32 @@ Driver::regrid(const int a_lmin, const int a_lmax, const bool a_useInitialData)
     CH_STOP(t1);
   }
 
+  // Generate the new grid boxes. If the grids do not change on any level we skip the regrid. Note that the realms clear
+  // all their levels in preRegrid, so a regrid that does happen must still start from a_lmin.
+  timer.startEvent("Generate boxes");
+  Vector<Vector<Box>> newBoxes;
+
+  const int generatedFinestLevel = m_amr->makeGridBoxes(newBoxes, tags, a_lmin, a_lmax);
+
+  bool gridsChanged = true;
+  if (m_skipIdenticalRegrids) {
+    gridsChanged = m_amr->getCoarsestChangedLevel(newBoxes, generatedFinestLevel, a_lmin) >= 0;
+  }
+  timer.stopEvent("Generate boxes");
+
+  if (!gridsChanged) {
+    if (a_useInitialData) {
+      m_timeStepper->initialData();
+    }
+
+    m_needsNewGeometricTags = false;
+
+    if (m_verbosity > 1) {
+      pout() << "\nDriver::regrid - Grids did not change. Skipping the regrid step\n" << endl;
+    }
+    return;
+  }
+
   // Store things that need to be regridded
   timer.startEvent("Pre-regrid");
   this->cacheTags(m_tags); // Cache m_tags because after regrid, ownership will change
@@ -664,7 +726,7 @@ Driver::regrid(const int a_lmin, const int a_lmax, const bool a_useInitialData)
   // Regrid AMR. Only levels [lmin, lmax] are allowed to change.
   timer.startEvent("Regrid AmrMesh");
   const int oldFinestLevel = m_amr->getFinestLevel();
-  m_amr->regridAmr(tags, a_lmin, a_lmax);
+  m_amr->regridAmr(newBoxes, generatedFinestLevel, a_lmin);
   const int newFinestLevel = m_amr->getFinestLevel();
   timer.stopEvent("Regrid AmrMesh");
 
@@ -682,6 +744,9 @@ Driver::regrid(const int a_lmin, const int a_lmax, const bool a_useInitialData)
       m_amr->regridRealm(str, procs, boxes, a_lmin);
     }
   }
+
+  // Measured costs refer to the old grids and must be discarded.
+  BoxCosts::clear();
   timer.stopEvent("Load balancing");
 
   // Regrid the operators
@@ -804,6 +869,7 @@ Driver::run(const Real a_startTime, const Real a_endTime, const int a_maxSteps)
 
     bool isLastStep  = false;
     bool isFirstStep = true;
+    bool pendingDt   = false;
 
     // Store the initial dt in case we have to abort (in case the time step became too small for some reason).
     const Real initDt = m_dt;
@@ -824,6 +890,8 @@ Driver::run(const Real a_startTime, const Real a_endTime, const int a_maxSteps)
       const bool canRegrid         = maxSimDepth > 0 && maxAmrDepth > 0 && m_regridInterval > 0;
       const bool regridStep        = m_timeStep % m_regridInterval == 0;
       const bool regridTimeStepper = m_timeStepper->needToRegrid();
+
+      bool regridded = false;
       if (canRegrid && (regridStep || regridTimeStepper)) {
         if (!isFirstStep) {
 
@@ -837,8 +905,13 @@ Driver::run(const Real a_startTime, const Real a_endTime, const int a_maxSteps)
             this->writePreRegridFile();
           }
 
+          // Let the autotuner (if it is active) set the box size and blocking factor for the new grids.
+          this->autotuneGrids();
+
           this->regrid(lmin, lmax, false);
 
+          regridded = true;
+
           // Write a grid report, displaying information about the new grids. Can also write
           // a regrid file if necessary.
           if (m_verbosity > 0) {
@@ -850,9 +923,19 @@ Driver::run(const Real a_startTime, const Real a_endTime, const int a_maxSteps)
         }
       }
 
-      // Compute a time step for the TimeStepper::advance(...) method.
+      // Compute a time step for the TimeStepper::advance(...) method. If the computation was started at the end of the
+      // previous step we complete it, but the result is discarded if the grids changed in between.
       if (!isFirstStep) {
-        m_dt = m_timeStepper->computeDt();
+        if (pendingDt) {
+          const Real overlappedDt = m_timeStepper->computeDtEnd();
+
+          pendingDt = false;
+
+          m_dt = regridded ? m_timeStepper->computeDt() : overlappedDt;
+        }
+        else {
+          m_dt = m_timeStepper->computeDt();
+        }
       }
       else { // In this case we already had one.
         isFirstStep = false;
@@ -911,9 +994,19 @@ Driver::run(const Real a_startTime, const Real a_endTime, const int a_maxSteps)
 
       // Time stepper advances solutions. Note that the time stepper can choose to use a time step different
       // from the one we computed (because some time-steppers use adaptive time-stepping).
-      m_wallClockOne      = Timer::wallClock();
-      const Real actualDt = m_timeStepper->advance(m_dt);
-      m_wallClockTwo      = Timer::wallClock();
+      m_wallClockOne = Timer::wallClock();
+      Real actualDt;
+      {
+        CD_PROFILE("TimeStepper::advance");
+
+        actualDt = m_timeStepper->advance(m_dt);
+      }
+      m_wallClockTwo = Timer::wallClock();
+
+      if (m_autotuneGrids) {
+        m_autotuneSteps++;
+        m_autotuneTime += m_wallClockTwo - m_wallClockOne;
+      }
 
       // Synchronize times
       m_dt = actualDt;
@@ -934,6 +1027,30 @@ Driver::run(const Real a_startTime, const Real a_endTime, const int a_maxSteps)
         this->stepReport(a_startTime, a_endTime, a_maxSteps);
       }
 
+      // Print the tracked memory and its high-water marks during this step, and start a new measurement period.
+      if (MemoryTracker::isEnabled()) {
+        MemoryTracker::sample();
+        MemoryTracker::report(pout());
+        MemoryTracker::resetHighWater();
+      }
+
+      // Start computing the time step for the next step so that the reduction over the MPI ranks overlaps with the
+      // output below. We skip this if the next step regrids at the regular interval since the time step is then computed
+      // on the new grids.
+      const bool regridNextStep = canRegrid && (m_timeStep % m_regridInterval == 0);
+      if (m_overlapDt && !isLastStep && !regridNextStep) {
+        m_timeStepper->computeDtBegin();
+
+        pendingDt = true;
+      }
+
+      // In-situ diagnostics
+      if (m_diagnosticsInterval > 0 && m_diagnostics.isEnabled()) {
+        if (m_timeStep % m_diagnosticsInterval == 0 || isLastStep) {
+          this->writeDiagnostics();
+        }
+      }
+
 #ifdef CH_USE_HDF5
       // Write plot files, memory files, loads, checkpoint etc.
       if (m_plotInterval > 0) {
@@ -961,6 +1078,13 @@ Driver::run(const Real a_startTime, const Real a_endTime, const int a_maxSteps)
         }
       }
 
+      // Write plot files restricted to the plot region.
+      if (m_regionPlotInterval > 0) {
+        if (m_timeStep % m_regionPlotInterval == 0 || isLastStep == true) {
+          this->writeRegionPlotFile();
+        }
+      }
+
       // Write checkpoint file
       if (m_checkpointInterval > 0) {
         if (m_timeStep % m_checkpointInterval == 0 || isLastStep == true) {
@@ -972,16 +1096,30 @@ Driver::run(const Real a_startTime, const Real a_endTime, const int a_maxSteps)
       }
 #endif
 
-      // Rebuild the ParmParse table and read input parameters again. Some parameters are allowed to change during runtime.
-      this->rebuildParmParse();
+      // Rebuild the ParmParse table and read input parameters again if the input file changed. Some parameters are
+      // allowed to change during runtime.
+      if (m_runtimeOptionsInterval > 0 && m_timeStep % m_runtimeOptionsInterval == 0) {
+        if (this->inputFileChanged()) {
+          if (m_verbosity > 2) {
+            pout() << "Driver::run -- Input file changed, parsing runtime options" << endl;
+          }
+
+          this->rebuildParmParse();
 
-      this->parseRuntimeOptions();
-      m_amr->parseRuntimeOptions();
-      m_timeStepper->parseRuntimeOptions();
-      if (!m_cellTagger.isNull()) {
-        m_cellTagger->parseRuntimeOptions();
+          this->parseRuntimeOptions();
+          m_amr->parseRuntimeOptions();
+          m_timeStepper->parseRuntimeOptions();
+          if (!m_cellTagger.isNull()) {
+            m_cellTagger->parseRuntimeOptions();
+          }
+        }
       }
     }
+
+    // Complete the time step computation if the loop ended for other reasons than the last step.
+    if (pendingDt) {
+      m_timeStepper->computeDtEnd();
+    }
   }
 
   if (m_verbosity > 0) {
@@ -991,6 +1129,15 @@ Driver::run(const Real a_startTime, const Real a_endTime, const int a_maxSteps)
 
     MemoryReport::getMaxMinMemoryUsage();
   }
+
+  if (Profiler::isEnabled()) {
+    Profiler::eventReport(pout());
+  }
+
+  // Every rank must take part in writing the trace, also those that did not record anything.
+  if (ParallelOps::max(Profiler::isTracing() ? 1 : 0) > 0) {
+    Profiler::writeTrace(m_outputDirectory + "/mpi/" + m_outputFileNames + ".trace.json");
+  }
 }
 
 void
@@ -1003,9 +1150,7 @@ Driver::setupAndRun(const std::string a_inputFile)
 
   // TLDR: Call setup(...), which will select among the various setup functions.
 
-  char iter_str[100];
-  sprintf(iter_str, ".check%07d.%dd.hdf5", m_restartStep, SpaceDim);
-  const std::string restartFile = m_outputDirectory + "/chk/" + m_outputFileNames + std::string(iter_str);
+  const std::string restartFile = this->getCheckpointFileName(m_restartStep);
 
   this->setup(a_inputFile, m_initialRegrids, m_restart, restartFile);
 
@@ -1028,6 +1173,34 @@ Driver::rebuildParmParse() const
   pp.redefine(m_inputFile.c_str());
 }
 
+bool
+Driver::inputFileChanged()
+{
+  CH_TIME("Driver::inputFileChanged()");
+  if (m_verbosity > 5) {
+    pout() << "Driver::inputFileChanged()" << endl;
+  }
+
+  // Master rank checks the file and tells everyone else.
+  int changed = 0;
+
+  if (procID() == 0) {
+    struct stat buffer;
+
+    if (stat(m_inputFile.c_str(), &buffer) == 0) {
+      const long long fileTime = static_cast<long long>(buffer.st_mtime);
+      const long long fileSize = static_cast<long long>(buffer.st_size);
+
+      changed = (fileTime != m_inputFileTime || fileSize != m_inputFileSize) ? 1 : 0;
+
+      m_inputFileTime = fileTime;
+      m_inputFileSize = fileSize;
+    }
+  }
+
+  return ParallelOps::max(changed) > 0;
+}
+
 void
 Driver::setComputationalGeometry(const RefCountedPtr<ComputationalGeometry>& a_computationalGeometry)
 {
@@ -1090,19 +1263,109 @@ Driver::parseOptions()
 
   pp.get("verbosity", m_verbosity);
   pp.query("profile", m_profile);
+
+  m_profileSetup = false;
+  pp.query("profile_setup", m_profileSetup);
+
+  m_profiler = false;
+  pp.query("profiler", m_profiler);
+  Profiler::setEnabled(m_profiler);
+
+  bool trace           = false;
+  int  traceRankStride = 1;
+  int  traceMaxEvents  = 1000000;
+
+  pp.query("trace", trace);
+  pp.query("trace_rank_stride", traceRankStride);
+  pp.query("trace_max_events", traceMaxEvents);
+  Profiler::setTracing(trace, traceRankStride, std::max(0, traceMaxEvents));
+
+  bool memoryTracker = false;
+  pp.query("memory_tracker", memoryTracker);
+  MemoryTracker::setEnabled(memoryTracker);
+
+  m_overlapDt = true;
+  pp.query("overlap_dt", m_overlapDt);
+
+  if (pp.contains("tile_size")) {
+    Vector<int> v(SpaceDim);
+
+    pp.getarr("tile_size", v, 0, SpaceDim);
+
+    const IntVect tileSize(D_DECL(v[0], v[1], v[2]));
+    if (!(tileSize > IntVect::Zero)) {
+      MayDay::Error("Driver::parseOptions -- 'Driver.tile_size' must be positive");
+    }
+
+    BoxLoops::setTileSize(tileSize);
+  }
+
+  // The OpenMP loops over the patches use schedule(runtime). A static schedule gives a fixed patch-to-thread mapping,
+  // which is needed for NUMA first-touch (AmrMesh.first_touch) to put the data next to the thread that uses it.
+  std::string ompSchedule = "runtime";
+  pp.query("omp_schedule", ompSchedule);
+
+  if (ompSchedule != "runtime" && ompSchedule != "static" && ompSchedule != "dynamic" && ompSchedule != "guided") {
+    MayDay::Error("Driver::parseOptions -- 'Driver.omp_schedule' must be 'runtime', 'static', 'dynamic', or 'guided'");
+  }
+
+#ifdef _OPENMP
+  if (ompSchedule == "static") {
+    omp_set_schedule(omp_sched_static, 0);
+  }
+  else if (ompSchedule == "dynamic") {
+    omp_set_schedule(omp_sched_dynamic, 1);
+  }
+  else if (ompSchedule == "guided") {
+    omp_set_schedule(omp_sched_guided, 0);
+  }
+#endif
+
   if (m_verbosity > 5) {
     pout() << "Driver::parseOptions()" << endl;
   }
 
   pp.get("regrid_interval", m_regridInterval);
   pp.get("initial_regrids", m_initialRegrids);
+
+  m_restartRegrids = -1;
+  m_restartRanks   = true;
+
+  pp.query("restart_regrids", m_restartRegrids);
+  pp.query("restart_reuse_ranks", m_restartRanks);
   pp.get("restart", m_restartStep);
   pp.get("write_memory", m_writeMemory);
   pp.get("write_loads", m_writeLoads);
+
+  m_runtimeOptionsInterval = 1;
+  pp.query("runtime_options_interval", m_runtimeOptionsInterval);
+
+  m_skipIdenticalRegrids = false;
+  pp.query("skip_identical_regrids", m_skipIdenticalRegrids);
+
+  m_tagLookAhead    = 0.0;
+  m_tagLookAheadMax = 8;
+  pp.query("tag_look_ahead", m_tagLookAhead);
+  pp.query("tag_look_ahead_max", m_tagLookAheadMax);
+
+  m_measuredLoads = false;
+  pp.query("measured_loads", m_measuredLoads);
+  BoxCosts::setEnabled(m_measuredLoads);
+
   pp.get("output_directory", m_outputDirectory);
   pp.get("output_names", m_outputFileNames);
+
+  // Each ensemble member writes to its own subdirectory.
+  if (Ensemble::isEnsemble()) {
+    m_outputDirectory += "/" + Ensemble::getMemberName();
+  }
+
   pp.get("plot_interval", m_plotInterval);
   pp.get("checkpoint_interval", m_checkpointInterval);
+
+  m_checkpointFullInterval = 1;
+  pp.query("checkpoint_full_interval", m_checkpointFullInterval);
+
   pp.get("write_regrid_files", m_writeRegridFiles);
   pp.get("write_restart_files", m_writeRestartFiles);
   pp.get("num_plot_ghost", m_numPlotGhost);
@@ -1113,6 +1376,10 @@ Driver::parseOptions()
   pp.get("start_time", m_startTime);
   pp.get("stop_time", m_stopTime);
   pp.get("max_plot_depth", m_maxPlotLevel);
+  pp.query("plot_staging", m_plotStaging);
+  this->parsePlotPrecision();
+  this->parseDiagnostics();
+  this->parseRegionPlot();
   pp.get("max_chk_depth", m_maxCheckpointDepth);
   pp.get("do_init_load_balance", m_doInitLoadBalancing);
   pp.get("output_dt", m_outputDt);
@@ -1124,11 +1391,97 @@ Driver::parseOptions()
   this->parseGeometryGeneration();
   this->parseGeometryRefinement();
   this->parseIrregTagGrowth();
+  this->parseGridAutotuning();
 
   // Not a required thing.
   pp.query("coarsening", m_doCoarsening);
 }
 
+void
+Driver::parsePlotPrecision()
+{
+  CH_TIME("Driver::parsePlotPrecision()");
+  if (m_verbosity > 5) {
+    pout() << "Driver::parsePlotPrecision()" << endl;
+  }
+
+  ParmParse pp("Driver");
+
+  std::string str = "double";
+
+  m_plotSinglePrecision = false;
+  m_plotMantissaBits    = -1;
+  m_plotCompression     = 0;
+
+  pp.query("plot_precision", str);
+  pp.query("plot_mantissa_bits", m_plotMantissaBits);
+  pp.query("plot_compression", m_plotCompression);
+
+  if (str == "float") {
+    m_plotSinglePrecision = true;
+  }
+  else if (str != "double") {
+    MayDay::Error("Driver::parsePlotPrecision -- expected 'float' or 'double' for Driver.plot_precision");
+  }
+
+  if (m_plotCompression < 0 || m_plotCompression > 9) {
+    MayDay::Error("Driver::parsePlotPrecision -- Driver.plot_compression must be between 0 and 9");
+  }
+}
+
+void
+Driver::parseDiagnostics()
+{
+  CH_TIME("Driver::parseDiagnostics()");
+  if (m_verbosity > 5) {
+    pout() << "Driver::parseDiagnostics()" << endl;
+  }
+
+  ParmParse pp("Driver");
+
+  m_diagnosticsInterval = -1;
+
+  pp.query("diagnostics_interval", m_diagnosticsInterval);
+
+  m_diagnostics.parseOptions();
+}
+
+void
+Driver::parseRegionPlot()
+{
+  CH_TIME("Driver::parseRegionPlot()");
+  if (m_verbosity > 5) {
+    pout() << "Driver::parseRegionPlot()" << endl;
+  }
+
+  ParmParse pp("Driver");
+
+  m_regionPlotInterval = -1;
+  m_regionPlotLo       = m_amr->getProbLo();
+  m_regionPlotHi       = m_amr->getProbHi();
+
+  pp.query("region_plot_interval", m_regionPlotInterval);
+
+  if (m_regionPlotInterval > 0) {
+    Vector<Real> v(SpaceDim);
+
+    pp.getarr("region_plot_lo", v, 0, SpaceDim);
+    m_regionPlotLo = RealVect(D_DECL(v[0], v[1], v[2]));
+
+    pp.getarr("region_plot_hi", v, 0, SpaceDim);
+    m_regionPlotHi = RealVect(D_DECL(v[0], v[1], v[2]));
+
+    for (int dir = 0; dir < SpaceDim; dir++) {
+      if (m_regionPlotHi[dir] < m_regionPlotLo[dir]) {
+        MayDay::Error("Driver::parseRegionPlot -- Driver.region_plot_hi must not be smaller than Driver.region_plot_lo");
+      }
+      if (m_regionPlotLo[dir] > m_amr->getProbHi()[dir] || m_regionPlotHi[dir] < m_amr->getProbLo()[dir]) {
+        MayDay::Error("Driver::parseRegionPlot -- plot region does not overlap the domain");
+      }
+    }
+  }
+}
+
 void
 Driver::parseRuntimeOptions()
 {
@@ -1142,14 +1495,35 @@ Driver::parseRuntimeOptions()
   }
   pp.get("write_memory", m_writeMemory);
   pp.get("write_loads", m_writeLoads);
+  pp.query("runtime_options_interval", m_runtimeOptionsInterval);
+
+  m_skipIdenticalRegrids = false;
+  pp.query("skip_identical_regrids", m_skipIdenticalRegrids);
+
+  m_tagLookAhead    = 0.0;
+  m_tagLookAheadMax = 8;
+  pp.query("tag_look_ahead", m_tagLookAhead);
+  pp.query("tag_look_ahead_max", m_tagLookAheadMax);
+
+  m_measuredLoads = false;
+  pp.query("measured_loads", m_measuredLoads);
+  BoxCosts::setEnabled(m_measuredLoads);
+
+  pp.query("overlap_dt", m_overlapDt);
+
   pp.get("plot_interval", m_plotInterval);
   pp.get("regrid_interval", m_regridInterval);
   pp.get("checkpoint_interval", m_checkpointInterval);
+  pp.query("checkpoint_full_interval", m_checkpointFullInterval);
   pp.get("write_regrid_files", m_writeRegridFiles);
   pp.get("write_restart_files", m_writeRestartFiles);
   pp.get("num_plot_ghost", m_numPlotGhost);
   pp.get("allow_coarsening", m_allowCoarsening);
   pp.get("max_plot_depth", m_maxPlotLevel);
+  pp.query("plot_staging", m_plotStaging);
+  this->parsePlotPrecision();
+  this->parseDiagnostics();
+  this->parseRegionPlot();
   pp.get("max_steps", m_maxSteps);
   pp.get("stop_time", m_stopTime);
   pp.get("output_dt", m_outputDt);
@@ -1211,6 +1585,134 @@ Driver::parseIrregTagGrowth()
   m_irregTagGrowth = std::max(0, m_irregTagGrowth);
 }
 
+void
+Driver::parseGridAutotuning()
+{
+  CH_TIME("Driver::parseGridAutotuning()");
+  if (m_verbosity > 5) {
+    pout() << "Driver::parseGridAutotuning()" << endl;
+  }
+
+  ParmParse pp("Driver");
+
+  m_autotuneGrids = false;
+  pp.query("autotune_grids", m_autotuneGrids);
+
+  m_autotuneCandidates.clear();
+  m_autotuneCosts.clear();
+
+  m_autotuneCandidate = 0;
+  m_autotuneSteps     = 0;
+  m_autotuneTime      = 0.0;
+
+  if (!m_autotuneGrids) {
+    return;
+  }
+
+  // The first candidate is the input configuration, which is what the first regrid interval runs with.
+  const int inputBoxSize  = m_amr->getMaxBoxSize();
+  const int inputBlocking = m_amr->getBlockingFactor();
+
+  std::vector<int> boxSizes(1, inputBoxSize);
+  std::vector<int> blockingFactors(1, inputBlocking);
+
+  if (pp.contains("autotune_box_sizes")) {
+    pp.getarr("autotune_box_sizes", boxSizes, 0, pp.countval("autotune_box_sizes"));
+  }
+  if (pp.contains("autotune_blocking_factors")) {
+    pp.getarr("autotune_blocking_factors", blockingFactors, 0, pp.countval("autotune_blocking_factors"));
+  }
+
+  // Skip configurations that AmrMesh would not accept.
+  const Vector<int>& refRat = m_amr->getRefinementRatios();
+
+  auto isValid = [&](const int a_boxSize, const int a_blocking) -> bool {
+    bool valid = a_blocking >= 4 && a_blocking % 2 == 0 && a_boxSize >= 8 && a_boxSize % a_blocking == 0;
+
+    for (int lvl = 0; lvl < std::min(m_amr->getMaxAmrDepth(), (int)refRat.size()); lvl++) {
+      valid = valid && (a_blocking % refRat[lvl] == 0) && (refRat[lvl] <= 2 || a_blocking >= 8);
+    }
+
+    return valid;
+  };
+
+  m_autotuneCandidates.emplace_back(inputBoxSize, inputBlocking);
+
+  for (const auto& boxSize : boxSizes) {
+    for (const auto& blocking : blockingFactors) {
+      const std::pair<int, int> candidate(boxSize, blocking);
+
+      const bool isNew = std::find(m_autotuneCandidates.begin(), m_autotuneCandidates.end(), candidate) ==
+                         m_autotuneCandidates.end();
+
+      if (isNew && isValid(boxSize, blocking)) {
+        m_autotuneCandidates.emplace_back(candidate);
+      }
+    }
+  }
+
+  m_autotuneCosts.resize(m_autotuneCandidates.size(), -1.0);
+
+  // Nothing to choose between.
+  if (m_autotuneCandidates.size() < 2) {
+    m_autotuneGrids = false;
+  }
+}
+
+void
+Driver::autotuneGrids()
+{
+  CH_TIME("Driver::autotuneGrids()");
+  if (m_verbosity > 5) {
+    pout() << "Driver::autotuneGrids()" << endl;
+  }
+
+  if (!m_autotuneGrids) {
+    return;
+  }
+
+  // Measure the cost of the current configuration as the mean wall time per step. We use the maximum over the ranks
+  // since the slowest rank sets the pace. If there were no steps since the last regrid we keep the same candidate.
+  if (m_autotuneSteps > 0) {
+    m_autotuneCosts[m_autotuneCandidate] = ParallelOps::max(m_autotuneTime / m_autotuneSteps);
+
+    if (m_verbosity > 0) {
+      pout() << "Driver::autotuneGrids -- max_box_size = " << m_autotuneCandidates[m_autotuneCandidate].first
+             << ", blocking_factor = " << m_autotuneCandidates[m_autotuneCandidate].second << ": "
+             << m_autotuneCosts[m_autotuneCandidate] << " s/step over " << m_autotuneSteps << " steps" << endl;
+    }
+
+    m_autotuneCandidate++;
+  }
+
+  m_autotuneSteps = 0;
+  m_autotuneTime  = 0.0;
+
+  // Try the next candidate, or keep the cheapest one if all have been measured.
+  if (m_autotuneCandidate >= m_autotuneCandidates.size()) {
+    int best = 0;
+    for (int i = 1; i < m_autotuneCandidates.size(); i++) {
+      if (m_autotuneCosts[i] < m_autotuneCosts[best]) {
+        best = i;
+      }
+    }
+
+    m_autotuneCandidate = best;
+    m_autotuneGrids     = false;
+
+    pout() << "Driver::autotuneGrids -- keeping max_box_size = " << m_autotuneCandidates[best].first
+           << ", blocking_factor = " << m_autotuneCandidates[best].second << " (" << m_autotuneCosts[best]
+           << " s/step) for the rest of the simulation" << endl;
+  }
+  else if (m_verbosity > 0) {
+    pout() << "Driver::autotuneGrids -- trying max_box_size = " << m_autotuneCandidates[m_autotuneCandidate].first
+           << ", blocking_factor = " << m_autotuneCandidates[m_autotuneCandidate].second << endl;
+  }
+
+  m_amr->setGridParameters(m_autotuneCandidates[m_autotuneCandidate].first,
+                           m_autotuneCandidates[m_autotuneCandidate].second);
+}
+
 void
 Driver::parseGeometryGeneration()
 {
@@ -1224,6 +1726,24 @@ Driver::parseGeometryGeneration()
   pp.get("geometry_generation", m_geometryGeneration);
   pp.get("geometry_scan_level", m_geoScanLevel);
 
+  m_geometryCache = "none";
+  pp.query("geometry_cache", m_geometryCache);
+
+  if (m_geometryCache == "none") {
+    m_geometryCache = "";
+  }
+
+  if (Ensemble::isEnsemble() && m_geometryCache.empty()) {
+    pout() << "Driver::parseGeometryGeneration - ensemble members generate the geometry independently. "
+           << "Use Driver.geometry_cache to share it." << endl;
+  }
+
+  m_geometryBenchmark      = false;
+  m_geometryBenchmarkLevel = -1;
+
+  pp.query("geometry_benchmark", m_geometryBenchmark);
+  pp.query("geometry_benchmark_level", m_geometryBenchmarkLevel);
+
   if (!(m_geometryGeneration == "chombo-discharge" || m_geometryGeneration == "chombo")) {
     MayDay::Abort("Driver:parseGeometryGeneration - unsupported argument requested");
   }
@@ -1374,11 +1894,17 @@ Driver::setup(const std::string a_inputFile,
   }
 
   // We store the input file because we want ParmParse to read parameters
-  // at every time step (for run-time configuration purposes).
-  m_inputFile = a_inputFile;
+  // again if the file changes (for run-time configuration purposes).
+  m_inputFile     = a_inputFile;
+  m_inputFileTime = -1;
+  m_inputFileSize = -1;
+
+  this->inputFileChanged();
 
   this->createOutputDirectories();
 
+  m_setupTimer = Timer("Driver::setup");
+
   if (m_geometryOnly) {
     this->setupGeometryOnly();
   }
@@ -1394,7 +1920,9 @@ Driver::setup(const std::string a_inputFile,
           this->writeComputationalLoads();
         }
 
+        m_setupTimer.startEvent("Initial plot file");
         this->writePlotFile();
+        m_setupTimer.stopEvent("Initial plot file");
       }
 #endif
     }
@@ -1406,6 +1934,13 @@ Driver::setup(const std::string a_inputFile,
 #endif
     }
   }
+
+  // Report the time spent in each of the setup stages. The file has one row per rank so that load imbalance in the
+  // setup can be identified.
+  if (m_profileSetup) {
+    m_setupTimer.eventReport(pout(), false);
+    m_setupTimer.writeReportToFile(m_outputDirectory + "/mpi/" + m_outputFileNames + ".setup.dat");
+  }
 }
 
 void
@@ -1420,6 +1955,12 @@ Driver::setupGeometryOnly()
 
   const Real t0 = Timer::wallClock();
 
+  // In benchmark mode we can stop at a coarser level than the finest AMR level.
+  int finestLevel = m_amr->getMaxAmrDepth();
+  if (m_geometryBenchmark && m_geometryBenchmarkLevel >= 0) {
+    finestLevel = std::min(m_geometryBenchmarkLevel, finestLevel);
+  }
+
   // Need to activate some flags that trigger Chombo or chombo-discharge geo-generation method.
   if (m_geometryGeneration == "chombo-discharge") {
 
@@ -1437,7 +1978,7 @@ Driver::setupGeometryOnly()
       }
     }
     else {
-      const int amrLevel = std::min(m_geoScanLevel, m_amr->getMaxAmrDepth());
+      const int amrLevel = std::min(m_geoScanLevel, finestLevel);
       scanDomain         = m_amr->getDomains()[amrLevel];
     }
 
@@ -1456,18 +1997,38 @@ Driver::setupGeometryOnly()
     }
   }
 
-  const int numCoarsenings = m_doCoarsening ? -1 : m_amr->getMaxAmrDepth();
+  const int numCoarsenings = m_doCoarsening ? -1 : finestLevel;
 
-  m_computationalGeometry->buildGeometries(m_amr->getFinestDomain(),
+  m_computationalGeometry->setProfile(m_geometryBenchmark);
+  m_computationalGeometry->useGeometryCache(m_geometryCache);
+
+  // Ensemble members share the EBIS through the geometry cache. The first member generates and writes it, and the other
+  // members wait and then read it.
+  if (!(m_geometryCache.empty())) {
+    Ensemble::beginFirstMemberSection();
+  }
+
+  m_computationalGeometry->buildGeometries(m_amr->getDomains()[finestLevel],
                                            m_amr->getProbLo(),
-                                           m_amr->getFinestDx(),
+                                           m_amr->getDx()[finestLevel],
                                            m_amr->getMaxEbisBoxSize(),
                                            m_amr->getNumberOfEbGhostCells(),
                                            numCoarsenings);
+
+  if (!(m_geometryCache.empty())) {
+    Ensemble::endFirstMemberSection();
+  }
+
   const Real t1 = Timer::wallClock();
   if (procID() == 0)
     std::cout << "geotime = " << t1 - t0 << std::endl;
 
+  // The benchmark mode only reports on the geometry generation. The EBIS might not cover the finest AMR levels so we
+  // can't make grids from it.
+  if (m_geometryBenchmark) {
+    return;
+  }
+
   // Set implicit functions now.
   m_amr->setBaseImplicitFunction(phase::gas, m_computationalGeometry->getGasImplicitFunction());
   m_amr->setBaseImplicitFunction(phase::solid, m_computationalGeometry->getSolidImplicitFunction());
@@ -1539,7 +2100,16 @@ Driver::setupFresh(const int a_initialRegrids)
     m_computationalGeometry->useChomboShop();
   }
 
+  m_setupTimer.startEvent("Geometry generation");
   const int numCoarsenings = m_doCoarsening ? -1 : m_amr->getMaxAmrDepth();
+  m_computationalGeometry->useGeometryCache(m_geometryCache);
+
+  // Ensemble members share the EBIS through the geometry cache. The first member generates and writes it, and the other
+  // members wait and then read it.
+  if (!(m_geometryCache.empty())) {
+    Ensemble::beginFirstMemberSection();
+  }
+
   m_computationalGeometry->buildGeometries(m_amr->getFinestDomain(),
                                            m_amr->getProbLo(),
                                            m_amr->getFinestDx(),
@@ -1547,6 +2117,12 @@ Driver::setupFresh(const int a_initialRegrids)
                                            m_amr->getNumberOfEbGhostCells(),
                                            numCoarsenings);
 
+  if (!(m_geometryCache.empty())) {
+    Ensemble::endFirstMemberSection();
+  }
+
+  m_setupTimer.stopEvent("Geometry generation");
+
   // Register Realms
   m_timeStepper->setAmr(m_amr);
   m_timeStepper->registerRealms();
@@ -1556,7 +2132,9 @@ Driver::setupFresh(const int a_initialRegrids)
   m_amr->setBaseImplicitFunction(phase::solid, m_computationalGeometry->getSolidImplicitFunction());
 
   // Get geometry tags
+  m_setupTimer.startEvent("Geometry tags");
   this->getGeometryTags();
+  m_setupTimer.stopEvent("Geometry tags");
 
   // TLDR:
   // -----
@@ -1567,6 +2145,7 @@ Driver::setupFresh(const int a_initialRegrids)
 
   // When we're setting up fresh, we need to regrid everything from the
   // base level and upwards, so no hardcap on the permitted grids.
+  m_setupTimer.startEvent("Grid generation");
   const int lmin    = 0;
   const int hardcap = -1;
   m_amr->regridAmr(m_geomTags, lmin, hardcap);
@@ -1574,24 +2153,36 @@ Driver::setupFresh(const int a_initialRegrids)
 
   // Allocate internal storage
   this->allocateInternals();
+  m_setupTimer.stopEvent("Grid generation");
 
   // Provide TimeStepper with geometry in case it needs it.
   m_timeStepper->setComputationalGeometry(m_computationalGeometry);
 
   // TimeStepper setup. This instantiatse solvers (but does not necessarily fill them with data).
+  m_setupTimer.startEvent("Solver setup");
   m_timeStepper->setupSolvers();
   m_timeStepper->synchronizeSolverTimes(m_timeStep, m_time, m_dt);
+  m_setupTimer.stopEvent("Solver setup");
 
   // Set up the AMR operators
+  m_setupTimer.startEvent("Operator setup");
   m_timeStepper->registerOperators();
   m_amr->regridOperators(lmin);
+  m_setupTimer.stopEvent("Operator setup");
 
   // Fill solves with initial data
+  m_setupTimer.startEvent("Solver allocation");
   m_timeStepper->allocate();
+  m_setupTimer.stopEvent("Solver allocation");
+
+  m_setupTimer.startEvent("Initial data");
   m_timeStepper->initialData();
+  m_setupTimer.stopEvent("Initial data");
 
   // If called for -- we can perform a
   if (m_doInitLoadBalancing) {
+    m_setupTimer.startEvent("Initial load balance");
+
     this->cacheTags(m_tags);
     m_timeStepper->preRegrid(lmin, lmax);
     if (!(m_cellTagger.isNull())) {
@@ -1615,6 +2206,7 @@ Driver::setupFresh(const int a_initialRegrids)
     this->regridInternals(lmax, lmax);       // Regrid internals for Driver.
     m_timeStepper->regrid(lmin, lmax, lmax); // Regrid solvers.
     m_timeStepper->initialData();            // Need to fill with initial data again.
+    m_setupTimer.stopEvent("Initial load balance");
   }
 
   // CellTagger
@@ -1628,6 +2220,7 @@ Driver::setupFresh(const int a_initialRegrids)
   }
 
   // Initial regrids
+  m_setupTimer.startEvent("Initial regrids");
   for (int i = 0; i < a_initialRegrids; i++) {
     if (m_verbosity > 5) {
       pout() << "Driver -- initial regrid # " << i + 1 << endl;
@@ -1641,9 +2234,12 @@ Driver::setupFresh(const int a_initialRegrids)
       this->gridReport();
     }
   }
+  m_setupTimer.stopEvent("Initial regrids");
 
   // Do post initialize stuff
+  m_setupTimer.startEvent("Post initialize");
   m_timeStepper->postInitialize();
+  m_setupTimer.stopEvent("Post initialize");
 }
 
 #ifdef CH_USE_HDF5
@@ -1677,6 +2273,15 @@ Driver::setupForRestart(const int a_initialRegrids, const std::string a_restartF
 
   const int numCoarsenings = m_doCoarsening ? -1 : m_amr->getMaxAmrDepth();
 
+  m_setupTimer.startEvent("Geometry generation");
+  m_computationalGeometry->useGeometryCache(m_geometryCache);
+
+  // Ensemble members share the EBIS through the geometry cache. The first member generates and writes it, and the other
+  // members wait and then read it.
+  if (!(m_geometryCache.empty())) {
+    Ensemble::beginFirstMemberSection();
+  }
+
   m_computationalGeometry->buildGeometries(m_amr->getFinestDomain(),
                                            m_amr->getProbLo(),
                                            m_amr->getFinestDx(),
@@ -1684,7 +2289,15 @@ Driver::setupForRestart(const int a_initialRegrids, const std::string a_restartF
                                            m_amr->getNumberOfEbGhostCells(),
                                            numCoarsenings);
 
-  this->getGeometryTags(); // Get geometric tags.
+  if (!(m_geometryCache.empty())) {
+    Ensemble::endFirstMemberSection();
+  }
+
+  m_setupTimer.stopEvent("Geometry generation");
+
+  // The grids are read from the checkpoint file so we do not need the geometric tags until the next regrid. Defer them
+  // to the first regrid.
+  m_needsNewGeometricTags = true;
 
   m_timeStepper->setAmr(m_amr);                                     // Set amr
   m_timeStepper->registerRealms();                                  // Register Realms
@@ -1695,10 +2308,14 @@ Driver::setupForRestart(const int a_initialRegrids, const std::string a_restartF
   m_amr->setBaseImplicitFunction(phase::solid, m_computationalGeometry->getSolidImplicitFunction());
 
   // Read checkpoint file
+  m_setupTimer.startEvent("Read checkpoint");
   this->readCheckpointFile(a_restartFile);
+  m_setupTimer.stopEvent("Read checkpoint");
 
   // Time stepper does post checkpoint setup
+  m_setupTimer.startEvent("Post checkpoint setup");
   m_timeStepper->postCheckpointSetup();
+  m_setupTimer.stopEvent("Post checkpoint setup");
 
   // Prepare storage for CellTagger
   if (!m_cellTagger.isNull()) {
@@ -1709,8 +2326,12 @@ Driver::setupForRestart(const int a_initialRegrids, const std::string a_restartF
     this->writeRestartFile();
   }
 
-  // Initial regrids
-  for (int i = 0; i < a_initialRegrids; i++) {
+  // Initial regrids. Users can restart without them, using the checkpointed grids as they are.
+  const int numRegrids = (m_restartRegrids >= 0) ? m_restartRegrids : a_initialRegrids;
+
+  m_setupTimer.startEvent("Initial regrids");
+
+  for (int i = 0; i < numRegrids; i++) {
     if (m_verbosity > 0) {
       pout() << "Driver -- initial regrid # " << i + 1 << endl;
     }
@@ -1732,6 +2353,7 @@ Driver::setupForRestart(const int a_initialRegrids, const std::string a_restartF
       this->gridReport();
     }
   }
+  m_setupTimer.stopEvent("Initial regrids");
 }
 #endif
 
@@ -1860,8 +2482,14 @@ Driver::stepReport(const Real a_startTime, const Real a_endTime, const int a_max
          << endl;
 
 #ifdef CH_MPI
-  const long long maxUnfreedMem = ParallelOps::max(unfreedMem);
-  const long long maxPeakMem    = ParallelOps::max(peakMem);
+  long long maxUnfreedMem = unfreedMem;
+  long long maxPeakMem    = peakMem;
+
+  ParallelOps::Reduction reduction;
+
+  reduction.max(maxUnfreedMem);
+  reduction.max(maxPeakMem);
+  reduction.reduce();
 
   pout() << "                                -- Max unfreed memory    : " << std::ceil(maxUnfreedMem / bytesPerMB)
          << "(MB)" << endl;
@@ -1922,19 +2550,56 @@ Driver::tagCells(Vector<IntVectSet>& a_allTags, EBAMRTags& a_cellTags)
     gotNewTags = m_cellTagger->tagCells(a_cellTags);
   }
 
-  // Gather tags from the cell tagger.
+  // Gather tags from the cell tagger. Converting each patch to an IntVectSet and taking the union inserts the tagged cells
+  // one at a time into a tree, which is slow for large tag sets. Instead, each patch compresses its tags into boxes that
+  // span contiguous runs of tagged cells along the first coordinate direction. This is done independently for each patch
+  // and the boxes are then added to the IntVectSet.
   for (int lvl = 0; lvl <= finestLevel; lvl++) {
     const DataIterator& dit  = a_cellTags[lvl]->dataIterator();
     const int           nbox = dit.size();
 
-    IntVectSet& tags = a_allTags[lvl];
+    std::vector<std::vector<Box>> tagBoxes(nbox);
 
-#pragma omp parallel for schedule(runtime) reduction(+ : tags)
+#pragma omp parallel for schedule(runtime)
     for (int mybox = 0; mybox < nbox; mybox++) {
       const DataIndex& din = dit[mybox];
 
-      // Implicity converts to TreeIntVecSet
-      tags |= IntVectSet((*a_cellTags[lvl])[din]);
+      const DenseIntVectSet& cellTags = (*a_cellTags[lvl])[din];
+      std::vector<Box>&      boxes    = tagBoxes[mybox];
+
+      IntVect runLo;
+      IntVect runHi;
+      bool    hasRun = false;
+
+      // The iterator runs through the tagged cells with the first coordinate running fastest.
+      for (DenseIntVectSetIterator it(cellTags); it.ok(); ++it) {
+        const IntVect iv = it();
+
+        if (hasRun && iv == runHi + BASISV(0)) {
+          runHi = iv;
+        }
+        else {
+          if (hasRun) {
+            boxes.emplace_back(runLo, runHi);
+          }
+
+          runLo  = iv;
+          runHi  = iv;
+          hasRun = true;
+        }
+      }
+
+      if (hasRun) {
+        boxes.emplace_back(runLo, runHi);
+      }
+    }
+
+    IntVectSet& tags = a_allTags[lvl];
+
+    for (const auto& boxes : tagBoxes) {
+      for (const auto& box : boxes) {
+        tags |= box;
+      }
     }
 
     // Grow tags with cell taggers buffer
@@ -1945,6 +2610,11 @@ Driver::tagCells(Vector<IntVectSet>& a_allTags, EBAMRTags& a_cellTags)
     }
   }
 
+  // Extrapolate the cell tags along the direction in which they moved since the last regrid.
+  if (!m_cellTagger.isNull()) {
+    this->extrapolateTags(a_allTags);
+  }
+
   // Add geometric tags.
   if (m_allowCoarsening) {
     const int finestTagLevel = this->getFinestTagLevel(a_cellTags);
@@ -1967,6 +2637,105 @@ Driver::tagCells(Vector<IntVectSet>& a_allTags, EBAMRTags& a_cellTags)
   return gotNewTags;
 }
 
+void
+Driver::extrapolateTags(Vector<IntVectSet>& a_allTags)
+{
+  CH_TIME("Driver::extrapolateTags");
+  if (m_verbosity > 5) {
+    pout() << "Driver::extrapolateTags" << endl;
+  }
+
+  // TLDR: We compute the centroid of the cell tags on the finest level that has tags, and compare it with the centroid
+  //       from the previous call. The displacement between the two is taken as the propagation of the tagged region
+  //       over one regrid interval. The tags on each level are then swept along this displacement (scaled by
+  //       m_tagLookAhead) so that the grids are built ahead of e.g. a streamer front. The centroid is only compared
+  //       between calls that use the same level, since adding or removing a level moves the centroid.
+
+  const int           finestLevel = m_amr->getFinestLevel();
+  const Vector<Real>& dx          = m_amr->getDx();
+  const RealVect&     probLo      = m_amr->getProbLo();
+
+  int centroidLevel = -1;
+  for (int lvl = 0; lvl <= finestLevel; lvl++) {
+    if (!(a_allTags[lvl].isEmpty())) {
+      centroidLevel = lvl;
+    }
+  }
+  centroidLevel = ParallelOps::max(centroidLevel);
+
+  if (centroidLevel < 0) {
+    m_tagCentroidLevel = -1;
+
+    return;
+  }
+
+  // Compute the tag centroid on the finest tagged level.
+  Real     numTags  = 0.0;
+  RealVect centroid = RealVect::Zero;
+
+  for (IVSIterator it(a_allTags[centroidLevel]); it.ok(); ++it) {
+    centroid += probLo + (RealVect(it()) + 0.5 * RealVect::Unit) * dx[centroidLevel];
+    numTags  += 1.0;
+  }
+
+  ParallelOps::Reduction reduction;
+
+  reduction.sum(numTags);
+  for (int dir = 0; dir < SpaceDim; dir++) {
+    reduction.sum(centroid[dir]);
+  }
+  reduction.reduce();
+
+  centroid /= numTags;
+
+  const bool     hasPrevious  = (centroidLevel == m_tagCentroidLevel);
+  const RealVect displacement = centroid - m_tagCentroid;
+
+  m_tagCentroidLevel = centroidLevel;
+  m_tagCentroid      = centroid;
+
+  if (m_tagLookAhead <= 0.0 || !hasPrevious) {
+    return;
+  }
+
+  // Sweep the tags along the displacement. We shift by at most one cell in each direction per step so that the swept
+  // region remains contiguous.
+  for (int lvl = 0; lvl <= finestLevel; lvl++) {
+    RealVect shift = m_tagLookAhead * displacement / dx[lvl];
+
+    const Real maxShift = shift.vectorLength();
+    if (maxShift > m_tagLookAheadMax) {
+      shift *= m_tagLookAheadMax / maxShift;
+    }
+
+    int numSteps = 0;
+    for (int dir = 0; dir < SpaceDim; dir++) {
+      numSteps = std::max(numSteps, int(std::lround(std::abs(shift[dir]))));
+    }
+
+    if (numSteps > 0 && !(a_allTags[lvl].isEmpty())) {
+      IntVectSet sweptTags = a_allTags[lvl];
+
+      for (int step = 1; step <= numSteps; step++) {
+        const RealVect s = shift * Real(step) / Real(numSteps);
+
+        IntVectSet shiftedTags = a_allTags[lvl];
+        shiftedTags.shift(IntVect(D_DECL(std::lround(s[0]), std::lround(s[1]), std::lround(s[2]))));
+
+        sweptTags |= shiftedTags;
+      }
+
+      sweptTags &= m_amr->getDomains()[lvl].domainBox();
+
+      a_allTags[lvl] = sweptTags;
+    }
+  }
+
+  if (m_verbosity > 2) {
+    pout() << "Driver::extrapolateTags - tag centroid moved by " << displacement << endl;
+  }
+}
+
 void
 Driver::writeMemoryUsage()
 {
@@ -2152,6 +2921,7 @@ void
 Driver::writePlotFile()
 {
   CH_TIME("Driver::writePlotFile()");
+  CD_PROFILE("Driver::writePlotFile");
   if (m_verbosity > 3) {
     pout() << "Driver::writePlotFile()" << endl;
   }
@@ -2237,9 +3007,28 @@ Driver::writeCrashFile()
 }
 
 void
-Driver::writePlotFile(const std::string a_filename)
+Driver::writeRegionPlotFile()
+{
+  CH_TIME("Driver::writeRegionPlotFile()");
+  CD_PROFILE("Driver::writeRegionPlotFile");
+  if (m_verbosity > 3) {
+    pout() << "Driver::writeRegionPlotFile()" << endl;
+  }
+
+  // Filename
+  char              file_char[1000];
+  const std::string prefix = m_outputDirectory + "/plt/" + m_outputFileNames;
+  sprintf(file_char, "%s.region.step%07d.%dd.hdf5", prefix.c_str(), m_timeStep, SpaceDim);
+  string fname(file_char);
+
+  // Write.
+  this->writePlotFile(fname, true);
+}
+
+void
+Driver::writePlotFile(const std::string a_filename, const bool a_region)
 {
-  CH_TIMERS("Driver::writePlotFile(string)");
+  CH_TIMERS("Driver::writePlotFile(string, bool)");
   CH_TIMER("Driver::writePlotFile::allocate", t1);
   CH_TIMER("Driver::writePlotFile::assemble", t2);
   CH_TIMER("Driver::writePlotFile::interp_exchange", t3);
@@ -2247,7 +3036,7 @@ Driver::writePlotFile(const std::string a_filename)
   CH_TIMER("Driver::writePlotFile::hdf5_write", t5);
 
   if (m_verbosity >= 1) {
-    pout() << "Driver::writePlotFile(string)" << endl;
+    pout() << "Driver::writePlotFile(string, bool)" << endl;
   }
 
   // Time stepper does pre-plot operations
@@ -2284,10 +3073,62 @@ Driver::writePlotFile(const std::string a_filename)
     handle.close();
 #endif
 
+#ifdef CH_USE_HDF5
+    // Output precision. The mantissa rounding applies to all plot variables.
+    DischargeIO::PlotPrecision plotPrecision;
+
+    plotPrecision.singlePrecision = m_plotSinglePrecision;
+    plotPrecision.compression     = m_plotCompression;
+    plotPrecision.mantissaBits    = Vector<int>(numOutputComp, m_plotMantissaBits);
+
+    // HDF5 write of a single level. The output data is released while it is converted to the HDF5 layout.
+    auto writeLevel = [&](HDF5Handle& a_handle, LevelData<EBCellFAB>& a_outputData, const int a_level) -> void {
+      const int refRat = (a_level < m_amr->getFinestLevel()) ? m_amr->getRefinementRatios()[a_level] : 1;
+
+      // Cells that overlap the plot region. Regions with zero extent in a direction (planes) are one cell thick. The region
+      // is known to overlap the domain so we can clamp the indices to the domain.
+      Box region;
+      if (a_region) {
+        const RealVect probLo    = m_amr->getProbLo();
+        const Real     dx        = m_amr->getDx()[a_level];
+        const Box      domainBox = m_amr->getDomains()[a_level].domainBox();
+
+        IntVect lo;
+        IntVect hi;
+        for (int dir = 0; dir < SpaceDim; dir++) {
+          lo[dir] = std::floor((m_regionPlotLo[dir] - probLo[dir]) / dx);
+          hi[dir] = std::floor((m_regionPlotHi[dir] - probLo[dir]) / dx);
+
+          lo[dir] = std::min(std::max(lo[dir], domainBox.smallEnd(dir)), domainBox.bigEnd(dir));
+          hi[dir] = std::min(std::max(hi[dir], domainBox.smallEnd(dir)), domainBox.bigEnd(dir));
+        }
+
+        region = Box(lo, hi);
+      }
+
+      DischargeIO::writeEBHDF5Level(a_handle,
+                                    a_outputData,
+                                    m_amr->getDomains()[a_level],
+                                    m_amr->getDx()[a_level],
+                                    m_dt,
+                                    m_time,
+                                    a_level,
+                                    refRat,
+                                    m_numPlotGhost,
+                                    true,
+                                    plotPrecision,
+                                    region);
+    };
+#endif
+
+    // When staging the output we assemble the data on all levels first and then write them through one file handle.
+    Vector<RefCountedPtr<LevelData<EBCellFAB>>> stagedData;
+
     Timer timer("Driver::writePlotFile");
     for (int lvl = 0; lvl <= maxPlotLevel; lvl++) {
       timer.startEvent("Allocate");
-      LevelData<EBCellFAB> outputData;
+      RefCountedPtr<LevelData<EBCellFAB>> outputDataPtr(new LevelData<EBCellFAB>());
+      LevelData<EBCellFAB>&               outputData = *outputDataPtr;
       m_amr->allocate(outputData, m_realm, phase::gas, lvl, numOutputComp);
       DataOps::setValue(outputData, 0.0);
       timer.stopEvent("Allocate");
@@ -2305,6 +3146,12 @@ Driver::writePlotFile(const std::string a_filename)
       this->writePlotData(outputData, comp, lvl);
       timer.stopEvent("Assemble data");
 
+      if (m_plotStaging) {
+        stagedData.push_back(outputDataPtr);
+
+        continue;
+      }
+
       // Do the HDF5 write.
 #ifdef CH_USE_HDF5
       if (m_verbosity > 2) {
@@ -2314,16 +3161,7 @@ Driver::writePlotFile(const std::string a_filename)
 
       timer.startEvent("HDF5 write");
       HDF5Handle handle(a_filename.c_str(), HDF5Handle::OPEN_RDWR);
-      const int  refRat = (lvl < m_amr->getFinestLevel()) ? m_amr->getRefinementRatios()[lvl] : 1;
-      DischargeIO::writeEBHDF5Level(handle,
-                                    outputData,
-                                    m_amr->getDomains()[lvl],
-                                    m_amr->getDx()[lvl],
-                                    m_dt,
-                                    m_time,
-                                    lvl,
-                                    refRat,
-                                    m_numPlotGhost);
+      writeLevel(handle, outputData, lvl);
       handle.close();
       timer.stopEvent("HDF5 write");
 
@@ -2333,6 +3171,23 @@ Driver::writePlotFile(const std::string a_filename)
 #endif
     }
 
+#ifdef CH_USE_HDF5
+    if (m_plotStaging) {
+      if (m_verbosity > 2) {
+        pout() << "Driver::writePlotFile -- HDF5 write of staged data" << endl;
+        MemoryReport::getMaxMinMemoryUsage();
+      }
+
+      timer.startEvent("HDF5 write");
+      HDF5Handle handle(a_filename.c_str(), HDF5Handle::OPEN_RDWR);
+      for (int lvl = 0; lvl < stagedData.size(); lvl++) {
+        writeLevel(handle, *stagedData[lvl], lvl);
+      }
+      handle.close();
+      timer.stopEvent("HDF5 write");
+    }
+#endif
+
     if (m_profile) {
       timer.eventReport(pout(), true);
     }
@@ -2536,10 +3391,65 @@ Driver::writeLoads(LevelData<EBCellFAB>& a_output, int& a_comp, const int a_leve
   }
 }
 
+void
+Driver::writeDiagnostics()
+{
+  CH_TIME("Driver::writeDiagnostics()");
+  if (m_verbosity > 3) {
+    pout() << "Driver::writeDiagnostics()" << endl;
+  }
+
+  const std::string fileName = m_outputDirectory + "/" + m_outputFileNames + ".diagnostics.csv";
+
+  // Time stepper does pre-plot operations
+  m_timeStepper->prePlot();
+  if (!(m_cellTagger.isNull())) {
+    m_cellTagger->prePlot();
+  }
+
+  int numOutputComp = m_timeStepper->getNumberOfPlotVariables();
+  if (!m_cellTagger.isNull()) {
+    numOutputComp += m_cellTagger->getNumberOfPlotVariables();
+  }
+  numOutputComp += this->getNumberOfPlotVariables();
+
+  Vector<std::string> plotVariableNames;
+  plotVariableNames.append(m_timeStepper->getPlotVariableNames());
+  if (!(m_cellTagger.isNull())) {
+    plotVariableNames.append(m_cellTagger->getPlotVariableNames());
+  }
+  plotVariableNames.append(this->getPlotVariableNames());
+
+  // Assemble the plot data on all levels. Unlike writePlotFile we always use all levels since the reductions are done across
+  // the AMR hierarchy.
+  Vector<RefCountedPtr<LevelData<EBCellFAB>>> outputData;
+
+  for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
+    outputData.push_back(RefCountedPtr<LevelData<EBCellFAB>>(new LevelData<EBCellFAB>()));
+
+    m_amr->allocate(*outputData[lvl], m_realm, phase::gas, lvl, std::max(1, numOutputComp));
+    DataOps::setValue(*outputData[lvl], 0.0);
+
+    int comp = 0;
+
+    m_timeStepper->writePlotData(*outputData[lvl], comp, m_realm, lvl);
+    if (!(m_cellTagger.isNull())) {
+      m_cellTagger->writePlotData(*outputData[lvl], comp, m_realm, lvl);
+    }
+    this->writePlotData(*outputData[lvl], comp, lvl);
+  }
+
+  m_diagnostics.evaluate(fileName, plotVariableNames, outputData, m_amr, m_realm, m_timeStep, m_time);
+
+  // TimeStepper does post-plot operations.
+  m_timeStepper->postPlot();
+}
+
 void
 Driver::writeCheckpointFile()
 {
   CH_TIME("Driver::writeCheckpointFile()");
+  CD_PROFILE("Driver::writeCheckpointFile");
   if (m_verbosity >= 1) {
     pout() << "Driver::writeCheckpointFile()" << endl;
   }
@@ -2559,6 +3469,7 @@ Driver::writeCheckpointFile()
   header.m_real["dt"]           = m_dt;
   header.m_int["step"]          = m_timeStep;
   header.m_int["finestLevel"]   = finestLevel;
+  header.m_int["num_ranks"]     = numProc();
 
   // Write realm names -- these are needed because we also write computational loads to checkpoint files
   // so we can load balance on immediately restart, using the checkpointed loads.
@@ -2566,16 +3477,24 @@ Driver::writeCheckpointFile()
     header.m_string[r] = r;
   }
 
+  // Incremental checkpoints refer to the last full checkpoint for the data that only changes when we regrid.
+  const bool incremental = this->canWriteIncrementalCheckpoint();
+  if (incremental) {
+    header.m_int["base_checkpoint"] = m_fullCheckpointStep;
+  }
+
   // Time stepper writes necessary meta-data to header.
   m_timeStepper->writeCheckpointHeader(header);
 
-  // Create the output file name.
-  char              str[100];
-  const std::string prefix = m_outputDirectory + "/chk/" + m_outputFileNames;
-  sprintf(str, "%s.check%07d.%dd.hdf5", prefix.c_str(), m_timeStep, SpaceDim);
+  if (m_verbosity >= 2) {
+    if (incremental) {
+      pout() << "Driver::writeCheckpointFile - writing incremental checkpoint (base step = " << m_fullCheckpointStep << ")"
+             << endl;
+    }
+  }
 
   // Output file
-  HDF5Handle handleOut(str, HDF5Handle::CREATE);
+  HDF5Handle handleOut(this->getCheckpointFileName(m_timeStep), HDF5Handle::CREATE);
   header.writeToFile(handleOut);
 
   Timer timer("Driver::writeCheckpointFile");
@@ -2599,8 +3518,11 @@ Driver::writeCheckpointFile()
     // Time stepper checkpoints solver data.
     m_timeStepper->writeCheckpointData(handleOut, lvl);
 
-    // Driver checkpoints internal data. This involves the cell tags and the computational loads on the various realms.
-    this->writeCheckpointLevel(handleOut, lvl);
+    // Driver checkpoints internal data. This involves the cell tags and the computational loads on the various realms. These
+    // are only changed by regrids so incremental checkpoints take them from the full checkpoint.
+    if (!incremental) {
+      this->writeCheckpointLevel(handleOut, lvl);
+    }
   }
 
   if (m_profile) {
@@ -2609,9 +3531,81 @@ Driver::writeCheckpointFile()
   }
 
   handleOut.close();
+
+  if (incremental) {
+    m_checkpointsSinceFull++;
+  }
+  else {
+    m_checkpointsSinceFull = 0;
+    m_fullCheckpointStep   = m_timeStep;
+
+    m_fullCheckpointGrids.clear();
+    for (const auto& r : m_amr->getRealms()) {
+      const Vector<DisjointBoxLayout>& grids = m_amr->getGrids(r);
+
+      for (int lvl = 0; lvl <= finestCheckLevel; lvl++) {
+        m_fullCheckpointGrids[r].push_back(grids[lvl]);
+      }
+    }
+  }
 #endif
 }
 
+std::string
+Driver::getCheckpointFileName(const int a_step) const
+{
+  CH_TIME("Driver::getCheckpointFileName(int)");
+  if (m_verbosity > 5) {
+    pout() << "Driver::getCheckpointFileName(int)" << endl;
+  }
+
+  char              str[100];
+  const std::string prefix = m_outputDirectory + "/chk/" + m_outputFileNames;
+  sprintf(str, "%s.check%07d.%dd.hdf5", prefix.c_str(), a_step, SpaceDim);
+
+  return std::string(str);
+}
+
+bool
+Driver::canWriteIncrementalCheckpoint() const
+{
+  CH_TIME("Driver::canWriteIncrementalCheckpoint()");
+  if (m_verbosity > 5) {
+    pout() << "Driver::canWriteIncrementalCheckpoint()" << endl;
+  }
+
+  if (m_checkpointFullInterval <= 1 || m_fullCheckpointStep < 0 || m_fullCheckpointStep == m_timeStep) {
+    return false;
+  }
+  if (m_checkpointsSinceFull + 1 >= m_checkpointFullInterval) {
+    return false;
+  }
+
+  // The grids are compared by identity. Regrids always create new grids, unless they are skipped.
+  const int finestLevel      = m_amr->getFinestLevel();
+  int       finestCheckLevel = Min(m_maxCheckpointDepth, finestLevel);
+  if (m_maxCheckpointDepth < 0) {
+    finestCheckLevel = finestLevel;
+  }
+
+  for (const auto& r : m_amr->getRealms()) {
+    const auto it = m_fullCheckpointGrids.find(r);
+
+    if (it == m_fullCheckpointGrids.end() || it->second.size() != finestCheckLevel + 1) {
+      return false;
+    }
+
+    const Vector<DisjointBoxLayout>& grids = m_amr->getGrids(r);
+    for (int lvl = 0; lvl <= finestCheckLevel; lvl++) {
+      if (!(grids[lvl] == it->second[lvl])) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
 #ifdef CH_USE_HDF5
 void
 Driver::writeCheckpointLevel(HDF5Handle& a_handle, const int a_level)
@@ -2623,6 +3617,7 @@ Driver::writeCheckpointLevel(HDF5Handle& a_handle, const int a_level)
 
   this->writeCheckpointTags(a_handle, a_level);
   this->writeCheckpointRealmLoads(a_handle, a_level);
+  this->writeCheckpointRealmRanks(a_handle, a_level);
 }
 #endif
 
@@ -2684,26 +3679,32 @@ Driver::writeCheckpointRealmLoads(HDF5Handle& a_handle, const int a_level)
 
   const int nbox = dit.size();
 
-  // Make some storage and set the computational load to be the same in every patch. Later when
-  // we read the file we can just fetch the computational load from one of the cells.
-  LevelData<FArrayBox> scratch(dbl, 1, IntVect::Zero);
+  // The loads are written as a flat array with one entry per box, where each rank writes the loads of its own boxes. This
+  // can be read back in a single collective read, regardless of the number of ranks used when restarting.
+  std::vector<std::pair<unsigned long long, unsigned long long>> ranges;
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    ranges.emplace_back(dit[mybox].intCode(), 1ULL);
+  }
 
-  // Get loads.
   for (auto r : m_amr->getRealms()) {
     const Vector<long int> loads = m_timeStepper->getCheckpointLoads(r, a_level);
 
-#pragma omp parallel for schedule(runtime)
+    std::vector<long long> localLoads;
     for (int mybox = 0; mybox < nbox; mybox++) {
-      const DataIndex& din = dit[mybox];
-
-      scratch[din].setVal(loads[din.intCode()]);
+      localLoads.emplace_back(loads[dit[mybox].intCode()]);
     }
 
     // String identifier in HDF file.
-    const std::string str = r + "_loads";
+    const std::string str = r + "_box_loads";
 
-    // Write
-    write(a_handle, scratch, str);
+    DischargeIO::writeDataset(a_handle,
+                              str,
+                              H5T_NATIVE_LLONG,
+                              H5T_NATIVE_LLONG,
+                              dbl.size(),
+                              ranges,
+                              localLoads.data(),
+                              0);
   }
 }
 #endif
@@ -2733,6 +3734,7 @@ Driver::readCheckpointFile(const std::string& a_restartFile)
   const int  baseLevel   = 0;
   const int  finestLevel = header.m_int["finestLevel"];
   const int  prevMaxEB   = header.m_int["finest_eb_lvl"];
+  const bool sameRanks   = header.m_int.find("num_ranks") != header.m_int.end() && header.m_int["num_ranks"] == numProc();
 
   if (prevMaxEB != m_amr->getMaxAmrDepth()) {
     const std::string err = "Driver::readCheckpointFile -- max EB level changed. Proceed at your own peril";
@@ -2740,6 +3742,31 @@ Driver::readCheckpointFile(const std::string& a_restartFile)
     MayDay::Warning(err.c_str());
   }
 
+  // Incremental checkpoints do not contain the tags, loads, and box-to-rank mappings. These are read from the full checkpoint
+  // that the incremental checkpoint was written against.
+  HDF5Handle baseHandle;
+
+  const bool incremental = header.m_int.find("base_checkpoint") != header.m_int.end();
+  if (incremental) {
+    const std::string baseFile = this->getCheckpointFileName(header.m_int["base_checkpoint"]);
+
+    if (m_verbosity > 0) {
+      pout() << "Driver::readCheckpointFile(string) -- reading grid data from full checkpoint " << baseFile << endl;
+    }
+
+    std::ifstream f(baseFile);
+    if (!f.good()) {
+      const std::string err = "Driver::readCheckpointFile - could not find full checkpoint '" + baseFile + "'";
+
+      MayDay::Error(err.c_str());
+    }
+    f.close();
+
+    baseHandle.open(baseFile, HDF5Handle::OPEN_RDONLY);
+  }
+
+  HDF5Handle& gridDataHandle = incremental ? baseHandle : handle_in;
+
   // Get the names of the realms that were checkpointed. This is a part of the HDF header.
   std::map<std::string, Vector<Vector<long int>>> checkpointedLoads;
   for (auto s : header.m_string) {
@@ -2781,6 +3808,22 @@ Driver::readCheckpointFile(const std::string& a_restartFile)
     if (status != 0) {
       MayDay::Error("Driver::readCheckpointFile - file has no grids");
     }
+
+    if (incremental) {
+      Vector<Box> baseBoxes;
+
+      baseHandle.setGroupToLevel(lvl);
+      read(baseHandle, baseBoxes);
+
+      bool sameBoxes = baseBoxes.size() == boxes[lvl].size();
+      for (int ibox = 0; ibox < baseBoxes.size() && sameBoxes; ibox++) {
+        sameBoxes = baseBoxes[ibox] == boxes[lvl][ibox];
+      }
+
+      if (!sameBoxes) {
+        MayDay::Error("Driver::readCheckpointFile - grids differ from the full checkpoint");
+      }
+    }
   }
 
   // Read in the computational loads from the HDF5 file.
@@ -2792,7 +3835,8 @@ Driver::readCheckpointFile(const std::string& a_restartFile)
     for (int lvl = 0; lvl <= finestLevel; lvl++) {
       realmLoads[lvl].resize(boxes[lvl].size(), 0L);
 
-      this->readCheckpointRealmLoads(realmLoads[lvl], handle_in, realmName, lvl);
+      gridDataHandle.setGroupToLevel(lvl);
+      this->readCheckpointRealmLoads(realmLoads[lvl], gridDataHandle, realmName, lvl);
     }
   }
 
@@ -2815,9 +3859,39 @@ Driver::readCheckpointFile(const std::string& a_restartFile)
     curLoads = (foundCheckedLoads) ? checkpointedLoads.at(curRealm) : checkpointedLoads.at(Realm::Primal);
   }
 
+  // If the checkpoint was written with the same number of ranks we can reuse the box-to-rank mapping of the checkpointed
+  // realms rather than load balancing them again. Realms that were not checkpointed are load balanced.
+  std::map<std::string, Vector<Vector<int>>> simulationRanks;
+  if (m_restartRanks && sameRanks) {
+    for (auto it = simulationLoads.begin(); it != simulationLoads.end();) {
+      if (checkpointedLoads.find(it->first) != checkpointedLoads.end()) {
+        Vector<Vector<int>>& ranks = simulationRanks[it->first];
+
+        ranks.resize(1 + finestLevel);
+        for (int lvl = 0; lvl <= finestLevel; lvl++) {
+          ranks[lvl].resize(boxes[lvl].size(), 0);
+
+          gridDataHandle.setGroupToLevel(lvl);
+
+          this->readCheckpointRealmRanks(ranks[lvl], gridDataHandle, it->first, lvl);
+        }
+
+        it = simulationLoads.erase(it);
+      }
+      else {
+        ++it;
+      }
+    }
+  }
+
   // Define AmrMesh and Realms.
   m_amr->setFinestLevel(finestLevel);
-  m_amr->setGrids(boxes, simulationLoads);
+  if (simulationLoads.size() > 0) {
+    m_amr->setGrids(boxes, simulationLoads);
+  }
+  if (simulationRanks.size() > 0) {
+    m_amr->setGrids(boxes, simulationRanks);
+  }
 
   // Instantiate solvers and register operators
   m_timeStepper->setupSolvers();
@@ -2837,11 +3911,15 @@ Driver::readCheckpointFile(const std::string& a_restartFile)
     m_timeStepper->readCheckpointData(handle_in, lvl);
 
     // Read in internal data
-    readCheckpointLevel(handle_in, lvl);
+    gridDataHandle.setGroupToLevel(lvl);
+    readCheckpointLevel(gridDataHandle, lvl);
   }
 
   // Close input file
   handle_in.close();
+  if (incremental) {
+    baseHandle.close();
+  }
 
   if (m_verbosity > 0) {
     pout() << "Driver::readCheckpointFile(string) -- DONE!" << endl;
@@ -2849,6 +3927,41 @@ Driver::readCheckpointFile(const std::string& a_restartFile)
 }
 #endif
 
+#ifdef CH_USE_HDF5
+void
+Driver::writeCheckpointRealmRanks(HDF5Handle& a_handle, const int a_level)
+{
+  CH_TIME("Driver::writeCheckpointRealmRanks(HDF5Handle, int)");
+  if (m_verbosity > 5) {
+    pout() << "Driver::writeCheckpointRealmRanks(HDF5Handle, int)" << endl;
+  }
+
+  // The master rank writes the box-to-rank mapping for each realm.
+  for (auto r : m_amr->getRealms()) {
+    const DisjointBoxLayout& dbl = m_amr->getGrids(r)[a_level];
+
+    std::vector<int> ranks;
+    for (LayoutIterator lit = dbl.layoutIterator(); lit.ok(); ++lit) {
+      ranks.emplace_back(dbl.procID(lit()));
+    }
+
+    std::vector<std::pair<unsigned long long, unsigned long long>> ranges;
+    if (procID() == 0) {
+      ranges.emplace_back(0ULL, ranks.size());
+    }
+
+    DischargeIO::writeDataset(a_handle,
+                              r + "_ranks",
+                              H5T_NATIVE_INT,
+                              H5T_NATIVE_INT,
+                              ranks.size(),
+                              ranges,
+                              ranks.data(),
+                              0);
+  }
+}
+#endif
+
 #ifdef CH_USE_HDF5
 void
 Driver::readCheckpointLevel(HDF5Handle& a_handle, const int a_level)
@@ -2890,6 +4003,25 @@ Driver::readCheckpointLevel(HDF5Handle& a_handle, const int a_level)
 }
 #endif
 
+#ifdef CH_USE_HDF5
+void
+Driver::readCheckpointRealmRanks(Vector<int>&      a_ranks,
+                                 HDF5Handle&       a_handle,
+                                 const std::string a_realm,
+                                 const int         a_level)
+{
+  CH_TIME("Driver::readCheckpointRealmRanks(Vector<int>, HDF5Handle, string, int)");
+  if (m_verbosity > 5) {
+    pout() << "Driver::readCheckpointRealmRanks(Vector<int>, HDF5Handle, string, int)" << endl;
+  }
+
+  std::vector<std::pair<unsigned long long, unsigned long long>> ranges;
+  ranges.emplace_back(0ULL, a_ranks.size());
+
+  DischargeIO::readDataset(a_handle, a_realm + "_ranks", H5T_NATIVE_INT, ranges, &a_ranks[0]);
+}
+#endif
+
 #ifdef CH_USE_HDF5
 void
 Driver::readCheckpointRealmLoads(Vector<long int>& a_loads,
@@ -2902,8 +4034,26 @@ Driver::readCheckpointRealmLoads(Vector<long int>& a_loads,
     pout() << "Driver::readCheckpointRealmLoads((Vector<long int>, HDF5Handle, string, int))" << endl;
   }
 
-  // This reads computational loads from a file. When we wrote them we set the load in each grid patch, so we can just fetch using
-  // FArrayBox::max() function for getting it.
+  // Newer checkpoint files store the loads as a flat array which every rank reads in full.
+  const std::string flatStr = a_realm + "_box_loads";
+
+  if (H5Lexists(a_handle.groupID(), flatStr.c_str(), H5P_DEFAULT) > 0) {
+    std::vector<long long> loads(a_loads.size(), 0LL);
+
+    std::vector<std::pair<unsigned long long, unsigned long long>> ranges;
+    ranges.emplace_back(0ULL, a_loads.size());
+
+    DischargeIO::readDataset(a_handle, flatStr, H5T_NATIVE_LLONG, ranges, loads.data());
+
+    for (int ibox = 0; ibox < a_loads.size(); ibox++) {
+      a_loads[ibox] = loads[ibox];
+    }
+
+    return;
+  }
+
+  // Older checkpoint files store the load as a constant in each grid patch, so we can just fetch using the FArrayBox::max()
+  // function for getting it.
 
   // Identifier in HDF5 file.
   const std::string str = a_realm + "_loads";
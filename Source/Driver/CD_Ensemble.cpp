@@ -0,0 +1,195 @@
+/* chombo-discharge
+ * Copyright © 2026 SINTEF Energy Research.
+ * Please refer to Copyright.txt and LICENSE in the chombo-discharge root directory.
+ */
+
+/*!
+  @file   CD_Ensemble.cpp
+  @brief  Implementation of CD_Ensemble.H
+  @author Robert Marskar
+*/
+
+// Std includes
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Chombo includes
+#include <CH_Timer.H>
+#include <MayDay.H>
+#include <ParmParse.H>
+#include <SPMD.H>
+
+// Our includes
+#include <CD_Ensemble.H>
+#include <CD_Random.H>
+#include <CD_NamespaceHeader.H>
+
+bool Ensemble::s_isInitialized = false;
+int  Ensemble::s_numMembers    = 1;
+int  Ensemble::s_memberIndex   = 0;
+
+void
+Ensemble::initialize()
+{
+  CH_TIME("Ensemble::initialize()");
+
+  if (s_isInitialized) {
+    return;
+  }
+
+  s_isInitialized = true;
+
+  int ensembleSize = 1;
+
+  ParmParse pp("Driver");
+  pp.query("ensemble_size", ensembleSize);
+
+  if (ensembleSize <= 1) {
+    return;
+  }
+
+#ifdef CH_MPI
+  int worldRank;
+  int worldSize;
+
+  MPI_Comm_rank(MPI_COMM_WORLD, &worldRank);
+  MPI_Comm_size(MPI_COMM_WORLD, &worldSize);
+
+  if (worldSize % ensembleSize != 0) {
+    MayDay::Error("Ensemble::initialize - the number of MPI ranks must be divisible by Driver.ensemble_size");
+  }
+
+  s_numMembers  = ensembleSize;
+  s_memberIndex = worldRank / (worldSize / ensembleSize);
+
+  const int seed = Ensemble::computeMemberSeed();
+
+  // Open the pout files before the split so they are named by the rank in MPI_COMM_WORLD. Otherwise the members would
+  // all write to the same files.
+  pout() << "Ensemble::initialize - splitting " << worldSize << " ranks into " << s_numMembers << " ensemble members"
+         << endl;
+
+  MPI_Comm memberComm;
+  MPI_Comm_split(MPI_COMM_WORLD, s_memberIndex, worldRank, &memberComm);
+
+  Chombo_MPI::comm = memberComm;
+
+  // Seed the RNG with the member seed. This overrides previous calls to Random::seed().
+  Random::setSeed(seed);
+
+  pout() << "Ensemble::initialize - this rank is rank " << procID() << " in ensemble member " << s_memberIndex
+         << " (seed = " << seed << ")" << endl;
+#else
+  MayDay::Warning("Ensemble::initialize - ensemble runs require MPI, running one member only");
+#endif
+}
+
+bool
+Ensemble::isEnsemble() noexcept
+{
+  return s_numMembers > 1;
+}
+
+int
+Ensemble::getNumberOfMembers() noexcept
+{
+  return s_numMembers;
+}
+
+int
+Ensemble::getMemberIndex() noexcept
+{
+  return s_memberIndex;
+}
+
+std::string
+Ensemble::getMemberName()
+{
+  if (!(Ensemble::isEnsemble())) {
+    return std::string();
+  }
+
+  std::stringstream ss;
+
+  ss << "ensemble" << std::setfill('0') << std::setw(4) << s_memberIndex;
+
+  return ss.str();
+}
+
+void
+Ensemble::worldBarrier() noexcept
+{
+  CH_TIME("Ensemble::worldBarrier()");
+
+#ifdef CH_MPI
+  MPI_Barrier(MPI_COMM_WORLD);
+#endif
+}
+
+void
+Ensemble::beginFirstMemberSection() noexcept
+{
+  CH_TIME("Ensemble::beginFirstMemberSection()");
+
+  if (Ensemble::isEnsemble() && s_memberIndex > 0) {
+    Ensemble::worldBarrier();
+  }
+}
+
+void
+Ensemble::endFirstMemberSection() noexcept
+{
+  CH_TIME("Ensemble::endFirstMemberSection()");
+
+  if (Ensemble::isEnsemble() && s_memberIndex == 0) {
+    Ensemble::worldBarrier();
+  }
+}
+
+int
+Ensemble::computeMemberSeed()
+{
+  CH_TIME("Ensemble::computeMemberSeed()");
+
+  // Same rules as Random::seed(), but a random seed is drawn once and shared by all members.
+  int baseSeed = 0;
+
+  ParmParse pp("Random");
+  pp.query("seed", baseSeed);
+
+  if (baseSeed < 0) {
+    baseSeed = (int)std::chrono::system_clock::now().time_since_epoch().count();
+
+    if (baseSeed < 0) {
+      baseSeed = -baseSeed;
+    }
+
+#ifdef CH_MPI
+    MPI_Bcast(&baseSeed, 1, MPI_INT, 0, MPI_COMM_WORLD);
+#endif
+  }
+
+  // Offset by the number of seeds that Random::setSeed uses per member, i.e. one per rank and thread.
+  int seedsPerMember = 1;
+
+#ifdef CH_MPI
+  int worldSize;
+
+  MPI_Comm_size(MPI_COMM_WORLD, &worldSize);
+
+  seedsPerMember = worldSize / s_numMembers;
+#endif
+
+#ifdef _OPENMP
+  seedsPerMember *= omp_get_max_threads();
+#endif
+
+  return baseSeed + s_memberIndex * seedsPerMember;
+}
+
+#include <CD_NamespaceFooter.H>
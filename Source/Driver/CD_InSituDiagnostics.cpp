@@ -0,0 +1,455 @@
+/* chombo-discharge
+ * Copyright © 2026 SINTEF Energy Research.
+ * Please refer to Copyright.txt and LICENSE in the chombo-discharge root directory.
+ */
+
+/*!
+  @file   CD_InSituDiagnostics.cpp
+  @brief  Implementation of CD_InSituDiagnostics.H
+  @author Robert Marskar
+*/
+
+// Std includes
+#include <cmath>
+#include <fstream>
+#include <limits>
+
+// Chombo includes
+#include <CH_Timer.H>
+#include <ParmParse.H>
+#include <SPMD.H>
+
+// Our includes
+#include <CD_InSituDiagnostics.H>
+#include <CD_ParallelOps.H>
+#include <CD_NamespaceHeader.H>
+
+InSituDiagnostics::InSituDiagnostics() noexcept
+{
+  m_diagnostics.resize(0);
+}
+
+InSituDiagnostics::~InSituDiagnostics() noexcept
+{}
+
+void
+InSituDiagnostics::parseOptions() noexcept
+{
+  CH_TIME("InSituDiagnostics::parseOptions");
+
+  ParmParse pp("Driver");
+
+  m_diagnostics.resize(0);
+
+  const int num = pp.countval("diagnostics");
+  if (num <= 0) {
+    return;
+  }
+
+  Vector<std::string> names(num);
+  pp.getarr("diagnostics", names, 0, num);
+
+  for (int i = 0; i < names.size(); i++) {
+    const std::string name = names[i];
+
+    if (name == "none") {
+      continue;
+    }
+
+    const std::string prefix = "Driver.diagnostics." + name;
+
+    ParmParse ppDiag(prefix.c_str());
+
+    Diagnostic diagnostic;
+
+    std::string type;
+    ppDiag.get("type", type);
+
+    diagnostic.name = name;
+
+    if (type == "max") {
+      diagnostic.type = Reduction::Max;
+    }
+    else if (type == "min") {
+      diagnostic.type = Reduction::Min;
+    }
+    else if (type == "integral") {
+      diagnostic.type = Reduction::Integral;
+    }
+    else if (type == "average") {
+      diagnostic.type = Reduction::Average;
+    }
+    else if (type == "probe") {
+      diagnostic.type = Reduction::Probe;
+    }
+    else if (type == "line") {
+      diagnostic.type = Reduction::Line;
+    }
+    else {
+      const std::string err = "InSituDiagnostics::parseOptions -- unknown type '" + type + "' for " + prefix;
+
+      MayDay::Error(err.c_str());
+    }
+
+    const int numVars = ppDiag.countval("variables");
+    if (numVars <= 0) {
+      const std::string err = "InSituDiagnostics::parseOptions -- no variables given for " + prefix;
+
+      MayDay::Error(err.c_str());
+    }
+
+    Vector<std::string> variables(numVars);
+    ppDiag.getarr("variables", variables, 0, numVars);
+
+    diagnostic.variables = variables.stdVector();
+
+    Vector<Real> v(SpaceDim);
+
+    if (diagnostic.type == Reduction::Probe) {
+      ppDiag.getarr("position", v, 0, SpaceDim);
+
+      diagnostic.points.emplace_back(RealVect(D_DECL(v[0], v[1], v[2])));
+    }
+    else if (diagnostic.type == Reduction::Line) {
+      int numPoints;
+
+      ppDiag.getarr("start", v, 0, SpaceDim);
+      const RealVect start = RealVect(D_DECL(v[0], v[1], v[2]));
+
+      ppDiag.getarr("end", v, 0, SpaceDim);
+      const RealVect end = RealVect(D_DECL(v[0], v[1], v[2]));
+
+      ppDiag.get("num_points", numPoints);
+
+      if (numPoints < 2) {
+        const std::string err = "InSituDiagnostics::parseOptions -- need at least two points for " + prefix;
+
+        MayDay::Error(err.c_str());
+      }
+
+      for (int i = 0; i < numPoints; i++) {
+        diagnostic.points.emplace_back(start + (end - start) * Real(i) / Real(numPoints - 1));
+      }
+    }
+
+    m_diagnostics.emplace_back(diagnostic);
+  }
+}
+
+bool
+InSituDiagnostics::isEnabled() const noexcept
+{
+  return m_diagnostics.size() > 0;
+}
+
+void
+InSituDiagnostics::evaluate(const std::string                                  a_fileName,
+                            const Vector<std::string>&                         a_variableNames,
+                            const Vector<RefCountedPtr<LevelData<EBCellFAB>>>& a_data,
+                            const RefCountedPtr<AmrMesh>&                      a_amr,
+                            const std::string                                  a_realm,
+                            const int                                          a_step,
+                            const Real                                         a_time) const noexcept
+{
+  CH_TIME("InSituDiagnostics::evaluate");
+
+  std::vector<std::string> columns;
+  std::vector<Real>        values;
+
+  for (const auto& diagnostic : m_diagnostics) {
+
+    // Look up the plot variables. Variables that are not plotted are an error since the column layout would change.
+    std::vector<int> comps;
+
+    for (const auto& var : diagnostic.variables) {
+      int comp = -1;
+
+      for (int i = 0; i < a_variableNames.size(); i++) {
+        if (a_variableNames[i] == var) {
+          comp = i;
+
+          break;
+        }
+      }
+
+      if (comp < 0) {
+        const std::string err = "InSituDiagnostics::evaluate -- could not find plot variable '" + var + "' for diagnostic '" +
+                                diagnostic.name + "'";
+
+        MayDay::Error(err.c_str());
+      }
+
+      comps.emplace_back(comp);
+    }
+
+    const std::vector<std::string> diagColumns = this->getColumnNames(diagnostic);
+    const std::vector<Real>        diagValues  = this->evaluateDiagnostic(diagnostic, comps, a_data, a_amr, a_realm);
+
+    CH_assert(diagColumns.size() == diagValues.size());
+
+    columns.insert(columns.end(), diagColumns.begin(), diagColumns.end());
+    values.insert(values.end(), diagValues.begin(), diagValues.end());
+  }
+
+  if (procID() == 0) {
+    std::ofstream f;
+    f.open(a_fileName, std::ios_base::app);
+
+    if (f.tellp() == 0) {
+      f << "# step,time";
+      for (const auto& c : columns) {
+        f << "," << c;
+      }
+      f << "\n";
+    }
+
+    f.precision(std::numeric_limits<Real>::max_digits10);
+
+    f << a_step << "," << a_time;
+    for (const auto& v : values) {
+      f << "," << v;
+    }
+    f << "\n";
+
+    f.close();
+  }
+}
+
+std::vector<std::string>
+InSituDiagnostics::getColumnNames(const Diagnostic& a_diagnostic) const noexcept
+{
+  std::vector<std::string> columns;
+
+  switch (a_diagnostic.type) {
+  case Reduction::Max:
+  case Reduction::Min: {
+    columns.emplace_back(a_diagnostic.name);
+    columns.emplace_back(a_diagnostic.name + "_x");
+    columns.emplace_back(a_diagnostic.name + "_y");
+#if CH_SPACEDIM == 3
+    columns.emplace_back(a_diagnostic.name + "_z");
+#endif
+
+    break;
+  }
+  case Reduction::Integral:
+  case Reduction::Average:
+  case Reduction::Probe: {
+    columns.emplace_back(a_diagnostic.name);
+
+    break;
+  }
+  case Reduction::Line: {
+    for (int i = 0; i < a_diagnostic.points.size(); i++) {
+      columns.emplace_back(a_diagnostic.name + "_" + std::to_string(i));
+    }
+
+    break;
+  }
+  default: {
+    MayDay::Error("InSituDiagnostics::getColumnNames -- logic bust");
+
+    break;
+  }
+  }
+
+  return columns;
+}
+
+std::vector<Real>
+InSituDiagnostics::evaluateDiagnostic(const Diagnostic&                                  a_diagnostic,
+                                      const std::vector<int>&                            a_comps,
+                                      const Vector<RefCountedPtr<LevelData<EBCellFAB>>>& a_data,
+                                      const RefCountedPtr<AmrMesh>&                      a_amr,
+                                      const std::string                                  a_realm) const noexcept
+{
+  CH_TIME("InSituDiagnostics::evaluateDiagnostic");
+
+  std::vector<Real> ret;
+
+  switch (a_diagnostic.type) {
+  case Reduction::Max:
+  case Reduction::Min:
+  case Reduction::Integral:
+  case Reduction::Average: {
+    ret = this->evaluateReduction(a_diagnostic, a_comps, a_data, a_amr, a_realm);
+
+    break;
+  }
+  case Reduction::Probe:
+  case Reduction::Line: {
+    ret = this->evaluateProbes(a_diagnostic, a_comps, a_data, a_amr, a_realm);
+
+    break;
+  }
+  default: {
+    MayDay::Error("InSituDiagnostics::evaluateDiagnostic -- logic bust");
+
+    break;
+  }
+  }
+
+  return ret;
+}
+
+std::vector<Real>
+InSituDiagnostics::evaluateReduction(const Diagnostic&                                  a_diagnostic,
+                                     const std::vector<int>&                            a_comps,
+                                     const Vector<RefCountedPtr<LevelData<EBCellFAB>>>& a_data,
+                                     const RefCountedPtr<AmrMesh>&                      a_amr,
+                                     const std::string                                  a_realm) const noexcept
+{
+  CH_TIME("InSituDiagnostics::evaluateReduction");
+
+  const bool isMax = a_diagnostic.type == Reduction::Max;
+  const bool isMin = a_diagnostic.type == Reduction::Min;
+
+  const RealVect probLo = a_amr->getProbLo();
+
+  Real     extremum    = isMax ? -std::numeric_limits<Real>::max() : std::numeric_limits<Real>::max();
+  RealVect extremumPos = RealVect::Zero;
+  Real     integral    = 0.0;
+  Real     volume      = 0.0;
+
+  for (int lvl = 0; lvl < a_data.size(); lvl++) {
+    const DisjointBoxLayout& dbl  = a_data[lvl]->disjointBoxLayout();
+    const DataIterator&      dit  = dbl.dataIterator();
+    const Real               dx   = a_amr->getDx()[lvl];
+    const Real               dV   = std::pow(dx, SpaceDim);
+    const int                nbox = dit.size();
+
+    const LevelData<BaseFab<bool>>& validCells = *a_amr->getValidCells(a_realm)[lvl];
+
+    for (int mybox = 0; mybox < nbox; mybox++) {
+      const DataIndex& din = dit[mybox];
+
+      const EBCellFAB&     data    = (*a_data[lvl])[din];
+      const FArrayBox&     dataReg = data.getFArrayBox();
+      const EBISBox&       ebisbox = data.getEBISBox();
+      const BaseFab<bool>& valid   = validCells[din];
+
+      for (BoxIterator bit(dbl[din]); bit.ok(); ++bit) {
+        const IntVect iv = bit();
+
+        if (!valid(iv, 0) || ebisbox.isCovered(iv)) {
+          continue;
+        }
+
+        const Real value = cellValue(dataReg, iv, a_comps);
+
+        if ((isMax && value > extremum) || (isMin && value < extremum)) {
+          extremum    = value;
+          extremumPos = probLo + (RealVect(iv) + 0.5 * RealVect::Unit) * dx;
+        }
+
+        const Real kappa = ebisbox.isIrregular(iv) ? ebisbox.volFrac(VolIndex(iv, 0)) : 1.0;
+
+        integral += kappa * value * dV;
+        volume += kappa * dV;
+      }
+    }
+  }
+
+  std::vector<Real> ret;
+
+  switch (a_diagnostic.type) {
+  case Reduction::Max:
+  case Reduction::Min: {
+    const std::pair<Real, RealVect> reduced = isMax ? ParallelOps::max(extremum, extremumPos)
+                                                    : ParallelOps::min(extremum, extremumPos);
+
+    ret.emplace_back(reduced.first);
+    for (int dir = 0; dir < SpaceDim; dir++) {
+      ret.emplace_back(reduced.second[dir]);
+    }
+
+    break;
+  }
+  case Reduction::Integral: {
+    ret.emplace_back(ParallelOps::sum(integral));
+
+    break;
+  }
+  case Reduction::Average: {
+    const Real globalIntegral = ParallelOps::sum(integral);
+    const Real globalVolume   = ParallelOps::sum(volume);
+
+    ret.emplace_back((globalVolume > 0.0) ? globalIntegral / globalVolume : 0.0);
+
+    break;
+  }
+  default: {
+    MayDay::Error("InSituDiagnostics::evaluateReduction -- logic bust");
+
+    break;
+  }
+  }
+
+  return ret;
+}
+
+std::vector<Real>
+InSituDiagnostics::evaluateProbes(const Diagnostic&                                  a_diagnostic,
+                                  const std::vector<int>&                            a_comps,
+                                  const Vector<RefCountedPtr<LevelData<EBCellFAB>>>& a_data,
+                                  const RefCountedPtr<AmrMesh>&                      a_amr,
+                                  const std::string                                  a_realm) const noexcept
+{
+  CH_TIME("InSituDiagnostics::evaluateProbes");
+
+  const RealVect probLo    = a_amr->getProbLo();
+  const int      numPoints = a_diagnostic.points.size();
+
+  // Valid cells do not overlap, so at most one rank finds each probe and we can sum the values.
+  Vector<Real> values(numPoints, 0.0);
+
+  for (int lvl = 0; lvl < a_data.size(); lvl++) {
+    const DisjointBoxLayout& dbl = a_data[lvl]->disjointBoxLayout();
+    const Real               dx  = a_amr->getDx()[lvl];
+
+    DataIterator dit = dbl.dataIterator();
+
+    const LevelData<BaseFab<bool>>& validCells = *a_amr->getValidCells(a_realm)[lvl];
+
+    for (int ipoint = 0; ipoint < numPoints; ipoint++) {
+      const RealVect pos = (a_diagnostic.points[ipoint] - probLo) / dx;
+      const IntVect  iv  = IntVect(D_DECL(std::floor(pos[0]), std::floor(pos[1]), std::floor(pos[2])));
+
+      for (dit.reset(); dit.ok(); ++dit) {
+        const Box box = dbl[dit()];
+
+        if (!box.contains(iv)) {
+          continue;
+        }
+
+        const EBCellFAB& data    = (*a_data[lvl])[dit()];
+        const EBISBox&   ebisbox = data.getEBISBox();
+
+        if (validCells[dit()](iv, 0) && !ebisbox.isCovered(iv)) {
+          values[ipoint] = cellValue(data.getFArrayBox(), iv, a_comps);
+        }
+      }
+    }
+  }
+
+  ParallelOps::vectorSum(values);
+
+  return values.stdVector();
+}
+
+Real
+InSituDiagnostics::cellValue(const FArrayBox& a_data, const IntVect& a_iv, const std::vector<int>& a_comps) noexcept
+{
+  if (a_comps.size() == 1) {
+    return a_data(a_iv, a_comps[0]);
+  }
+
+  Real sum = 0.0;
+  for (const auto& comp : a_comps) {
+    sum += a_data(a_iv, comp) * a_data(a_iv, comp);
+  }
+
+  return std::sqrt(sum);
+}
+
+#include <CD_NamespaceFooter.H>
@@ -9,9 +9,14 @@
   @author Robert Marskar
 */
 
+// Std includes
+#include <algorithm>
+#include <cmath>
+
 // Our includes
 #include <CD_TimeStepper.H>
 #include <CD_LoadBalancing.H>
+#include <CD_BoxCosts.H>
 #include <CD_NamespaceHeader.H>
 
 TimeStepper::TimeStepper()
@@ -46,6 +51,26 @@ TimeStepper::setComputationalGeometry(const RefCountedPtr<ComputationalGeometry>
   m_computationalGeometry = a_computationalGeometry;
 }
 
+void
+TimeStepper::computeDtBegin()
+{
+  CH_TIME("TimeStepper::computeDtBegin()");
+  if (m_verbosity > 5) {
+    pout() << "TimeStepper::computeDtBegin()" << endl;
+  }
+}
+
+Real
+TimeStepper::computeDtEnd()
+{
+  CH_TIME("TimeStepper::computeDtEnd()");
+  if (m_verbosity > 5) {
+    pout() << "TimeStepper::computeDtEnd()" << endl;
+  }
+
+  return this->computeDt();
+}
+
 bool
 TimeStepper::needToRegrid()
 {
@@ -78,8 +103,20 @@ TimeStepper::getCheckpointLoads(const std::string a_realm, const int a_level) co
   const Vector<Box>&       boxArray = dbl.boxArray();
 
   Vector<long int> loads(boxArray.size(), 0L);
-  for (int i = 0; i < boxArray.size(); i++) {
-    loads[i] = boxArray[i].numPts();
+
+  // Use measured costs if we have them so that a restart is load balanced the same way as a regrid. The costs are in seconds,
+  // and we store them in nanoseconds.
+  if (BoxCosts::hasCosts(a_realm)) {
+    const Vector<Real> measuredLoads = BoxCosts::getLoads(a_realm, a_level, boxArray);
+
+    for (int i = 0; i < boxArray.size(); i++) {
+      loads[i] = std::max(1L, lround(1.E9 * measuredLoads[i]));
+    }
+  }
+  else {
+    for (int i = 0; i < boxArray.size(); i++) {
+      loads[i] = boxArray[i].numPts();
+    }
   }
 
   return loads;
@@ -93,7 +130,7 @@ TimeStepper::loadBalanceThisRealm(const std::string a_realm) const
     pout() << "TimeStepper::loadBalanceThisRealm(string)" << endl;
   }
 
-  return false;
+  return BoxCosts::isEnabled();
 }
 
 void
@@ -115,16 +152,26 @@ TimeStepper::loadBalanceBoxes(Vector<Vector<int>>&             a_procs,
   Loads rankLoads;
   rankLoads.resetLoads();
 
+  // Use measured costs if we have them, otherwise the box volume.
+  const bool measuredLoads = BoxCosts::hasCosts(a_realm);
+
   for (int lvl = 0; lvl <= a_finestLevel; lvl++) {
     a_boxes[lvl] = a_grids[lvl].boxArray();
 
-    Vector<long int> boxLoads(a_boxes[lvl].size());
+    if (measuredLoads) {
+      const Vector<Real> boxLoads = BoxCosts::getLoads(a_realm, lvl, a_boxes[lvl]);
 
-    for (int ibox = 0; ibox < a_boxes[lvl].size(); ibox++) {
-      boxLoads[ibox] = a_boxes[lvl][ibox].numPts();
+      LoadBalancing::makeBalance(a_procs[lvl], rankLoads, boxLoads, a_boxes[lvl]);
     }
+    else {
+      Vector<long int> boxLoads(a_boxes[lvl].size());
 
-    LoadBalancing::makeBalance(a_procs[lvl], rankLoads, boxLoads, a_boxes[lvl]);
+      for (int ibox = 0; ibox < a_boxes[lvl].size(); ibox++) {
+        boxLoads[ibox] = a_boxes[lvl][ibox].numPts();
+      }
+
+      LoadBalancing::makeBalance(a_procs[lvl], rankLoads, boxLoads, a_boxes[lvl]);
+    }
   }
 }
 
@@ -35,11 +35,12 @@ FieldSolver::FieldSolver()
   CH_TIME("FieldSolver::FieldSolver()");
 
   // Default settings.
-  m_className    = "FieldSolver";
-  m_realm        = Realm::Primal;
-  m_isVoltageSet = false;
-  m_regridSlopes = true;
-  m_verbosity    = -1;
+  m_className       = "FieldSolver";
+  m_realm           = Realm::Primal;
+  m_isVoltageSet    = false;
+  m_regridSlopes    = true;
+  m_cullDielectrics = false;
+  m_verbosity       = -1;
 
   this->setDataLocation(Location::Cell::Center);
   this->setDefaultDomainBcFunctions();
@@ -203,25 +204,6 @@ FieldSolver::computeDisplacementField(MFAMRCellData& a_displacementField, const
 
   if (m_multifluidIndexSpace->numPhases() > 1 && dielectrics.size() > 0) {
 
-    // Lambda which returns the relative permittivity at some position
-    auto permittivity = [&dielectrics](const RealVect& pos) -> Real {
-      Real minDist = std::numeric_limits<Real>::infinity();
-      int  closest = 0;
-
-      for (int i = 0; i < dielectrics.size(); i++) {
-        const RefCountedPtr<BaseIF> func = dielectrics[i].getImplicitFunction();
-
-        const Real curDist = func->value(pos);
-
-        if (std::abs(curDist) <= std::abs(minDist)) {
-          minDist = curDist;
-          closest = i;
-        }
-      }
-
-      return dielectrics[closest].getPermittivity(pos);
-    };
-
     // Iterate through data
     for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
       const Real               dx     = m_amr->getDx()[lvl];
@@ -240,6 +222,9 @@ FieldSolver::computeDisplacementField(MFAMRCellData& a_displacementField, const
         const EBGraph&   ebgraph = ebisbox.getEBGraph();
         const IntVectSet ivs     = ebisbox.getIrregIVS(cellBox);
 
+        // Dielectrics that can be closest to a point in this patch.
+        const std::vector<int> candidates = this->getDielectricCandidates(cellBox, probLo, dx);
+
         // Get handle to data on the solid phase
         MFCellFAB& D    = (*a_displacementField[lvl])[din];
         EBCellFAB& Dsol = D.getPhase(phase::solid);
@@ -252,7 +237,7 @@ FieldSolver::computeDisplacementField(MFAMRCellData& a_displacementField, const
         auto regularKernel = [&](const IntVect& iv) -> void {
           if (ebisbox.isRegular(iv)) {
             const RealVect pos    = probLo + (0.5 * RealVect::Unit + RealVect(iv)) * dx;
-            const Real     epsRel = permittivity(pos);
+            const Real     epsRel = this->getDielectricPermittivity(pos, candidates);
 
             for (int comp = 0; comp < SpaceDim; comp++) {
               Dreg(iv, comp) *= epsRel;
@@ -263,7 +248,7 @@ FieldSolver::computeDisplacementField(MFAMRCellData& a_displacementField, const
         // Irregular kernel
         auto irregularKernel = [&](const VolIndex& vof) -> void {
           const RealVect pos    = probLo + Location::position(m_dataLocation, vof, ebisbox, dx);
-          const Real     epsRel = permittivity(pos);
+          const Real     epsRel = this->getDielectricPermittivity(pos, candidates);
 
           for (int comp = 0; comp < SpaceDim; comp++) {
             Dsol(vof, comp) *= epsRel;
@@ -642,6 +627,21 @@ FieldSolver::parseRegridSlopes()
   pp.get("use_regrid_slopes", m_regridSlopes);
 }
 
+void
+FieldSolver::parseDielectricCulling()
+{
+  CH_TIME("FieldSolver::parseDielectricCulling()");
+  if (m_verbosity > 5) {
+    pout() << "FieldSolver::parseDielectricCulling()" << endl;
+  }
+
+  ParmParse pp(m_className.c_str());
+
+  m_cullDielectrics = false;
+
+  pp.query("cull_dielectrics", m_cullDielectrics);
+}
+
 std::string
 FieldSolver::makeBcString(const int a_dir, const Side::LoHiSide a_side) const
 {
@@ -923,18 +923,20 @@ FieldSolver::setCellPermittivities(EBCellFAB&      a_relPerm,
 
   BaseFab<Real>& relPermFAB = a_relPerm.getSingleValuedFAB();
 
+  const std::vector<int> candidates = this->getDielectricCandidates(a_cellBox, a_probLo, a_dx);
+
   // Regular kernel
   auto regularKernel = [&](const IntVect& iv) -> void {
     if (a_ebisbox.isRegular(iv)) {
       const RealVect pos     = a_probLo + (0.5 * RealVect::Unit + RealVect(iv)) * a_dx;
-      relPermFAB(iv, m_comp) = this->getDielectricPermittivity(pos);
+      relPermFAB(iv, m_comp) = this->getDielectricPermittivity(pos, candidates);
     }
   };
 
   // Irregular kernel
   auto irregularKernel = [&](const VolIndex& vof) -> void {
     const RealVect pos     = a_probLo + Location::position(m_dataLocation, vof, a_ebisbox, a_dx);
-    a_relPerm(vof, m_comp) = this->getDielectricPermittivity(pos);
+    a_relPerm(vof, m_comp) = this->getDielectricPermittivity(pos, candidates);
   };
 
   // Kernel regions.
@@ -965,6 +967,8 @@ FieldSolver::setFacePermittivities(EBFluxFAB&      a_relPerm,
   const EBGraph&   ebgraph = a_ebisbox.getEBGraph();
   const IntVectSet irreg   = a_ebisbox.getIrregIVS(a_cellBox);
 
+  const std::vector<int> candidates = this->getDielectricCandidates(a_cellBox, a_probLo, a_dx);
+
   for (int dir = 0; dir < SpaceDim; dir++) {
 
     // Kernel regions.
@@ -977,13 +981,13 @@ FieldSolver::setFacePermittivities(EBFluxFAB&      a_relPerm,
     // Regular kernel
     auto regularKernel = [&](const IntVect& iv) -> void {
       const RealVect pos     = a_probLo + a_dx * (RealVect(iv) + 0.5 * RealVect::Unit) - 0.5 * a_dx * BASISREALV(dir);
-      relPermFAB(iv, m_comp) = this->getDielectricPermittivity(pos);
+      relPermFAB(iv, m_comp) = this->getDielectricPermittivity(pos, candidates);
     };
 
     // Irregular kernel.
     auto irregularKernel = [&](const FaceIndex& face) -> void {
       const RealVect pos           = a_probLo + Location::position(m_faceLocation, face, a_ebisbox, a_dx);
-      a_relPerm[dir](face, m_comp) = this->getDielectricPermittivity(pos);
+      a_relPerm[dir](face, m_comp) = this->getDielectricPermittivity(pos, candidates);
     };
 
     // Launch kernels.
@@ -1011,15 +1015,79 @@ FieldSolver::setEbPermittivities(BaseIVFAB<Real>& a_relPerm,
 
   VoFIterator vofit(ivs, ebgraph);
 
+  const std::vector<int> candidates = this->getDielectricCandidates(a_cellBox, a_probLo, a_dx);
+
   auto kernel = [&](const VolIndex& vof) -> void {
     const RealVect pos = Location::position(Location::Cell::Boundary, vof, a_ebisbox, a_dx);
 
-    a_relPerm(vof, m_comp) = this->getDielectricPermittivity(pos);
+    a_relPerm(vof, m_comp) = this->getDielectricPermittivity(pos, candidates);
   };
 
   BoxLoops::loop(vofit, kernel);
 }
 
+std::vector<int>
+FieldSolver::getDielectricCandidates(const Box& a_cellBox, const RealVect& a_probLo, const Real a_dx) const
+{
+  CH_TIME("FieldSolver::getDielectricCandidates(Box, RealVect, Real)");
+
+  const Vector<Dielectric>& dielectrics = m_computationalGeometry->getDielectrics();
+
+  const int numDielectrics = dielectrics.size();
+
+  CH_assert(numDielectrics > 0);
+
+  std::vector<int> candidates;
+
+  // If all dielectrics have the same constant permittivity we don't need to know which one is closest.
+  bool samePermittivity = true;
+  for (int i = 0; i < numDielectrics; i++) {
+    samePermittivity = samePermittivity && dielectrics[i].isConstantPermittivity();
+  }
+  if (samePermittivity) {
+    const Real eps = dielectrics[0].getPermittivity(RealVect::Zero);
+
+    for (int i = 1; i < numDielectrics; i++) {
+      samePermittivity = samePermittivity && (dielectrics[i].getPermittivity(RealVect::Zero) == eps);
+    }
+  }
+
+  if (samePermittivity) {
+    candidates.emplace_back(0);
+  }
+  else if (m_cullDielectrics && numDielectrics > 1) {
+
+    // TLDR: Every point in the patch (including faces and ghost cells) is within a distance r of the patch center. With
+    //       Lipschitz constant one, the distance to dielectric i is everywhere in [d_i - r, d_i + r] where d_i is the
+    //       distance at the center, so dielectric i can be discarded if d_i - r is larger than the smallest d_j + r.
+    const Box      grownBox = grow(a_cellBox, 1);
+    const RealVect center   = a_probLo + 0.5 * a_dx * RealVect(grownBox.smallEnd() + grownBox.bigEnd() + IntVect::Unit);
+    const Real     radius   = 0.5 * a_dx * RealVect(grownBox.size()).vectorLength();
+
+    std::vector<Real> distances(numDielectrics);
+
+    Real minUpper = std::numeric_limits<Real>::infinity();
+    for (int i = 0; i < numDielectrics; i++) {
+      distances[i] = std::abs(dielectrics[i].getImplicitFunction()->value(center));
+
+      minUpper = std::min(minUpper, distances[i] + radius);
+    }
+
+    for (int i = 0; i < numDielectrics; i++) {
+      if (distances[i] - radius <= minUpper) {
+        candidates.emplace_back(i);
+      }
+    }
+  }
+  else {
+    for (int i = 0; i < numDielectrics; i++) {
+      candidates.emplace_back(i);
+    }
+  }
+
+  return candidates;
+}
+
 void
 FieldSolver::writePlotFile()
 {
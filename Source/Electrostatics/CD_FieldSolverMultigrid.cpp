@@ -23,6 +23,8 @@
 #include <CD_MFHelmholtzJumpBCFactory.H>
 #include <CD_MFHelmholtzSaturationChargeJumpBCFactory.H>
 #include <CD_Units.H>
+#include <CD_Timer.H>
+#include <CD_ParallelOps.H>
 #include <CD_NamespaceHeader.H>
 
 constexpr Real FieldSolverMultigrid::m_alpha;
@@ -33,8 +35,13 @@ FieldSolverMultigrid::FieldSolverMultigrid() : FieldSolver()
   CH_TIME("FieldSolverMultigrid::FieldSolverMultigrid()");
 
   // Default settings
-  m_isSolverSetup = false;
-  m_className     = "FieldSolverMultigrid";
+  m_isSolverSetup          = false;
+  m_reuseOperators         = false;
+  m_superposition          = false;
+  m_hasLaplacePotential    = false;
+  m_multigridTelemetry     = false;
+  m_multigridTelemetryFile = "none";
+  m_className              = "FieldSolverMultigrid";
 }
 
 FieldSolverMultigrid::~FieldSolverMultigrid()
@@ -56,7 +63,9 @@ FieldSolverMultigrid::parseOptions()
   this->parseMultigridSettings();
   this->parseKappaSource();
   this->parseJumpBC();
+  this->parseSuperposition();
   this->parseRegridSlopes();
+  this->parseDielectricCulling();
 }
 
 void
@@ -72,6 +81,7 @@ FieldSolverMultigrid::parseRuntimeOptions()
   this->parseKappaSource();
   this->parsePlotVariables();
   this->parseRegridSlopes();
+  this->parseDielectricCulling();
 }
 
 void
@@ -102,10 +112,32 @@ FieldSolverMultigrid::parseMultigridSettings()
   pp.get("gmg_pre_smooth", m_multigridPreSmooth);
   pp.get("gmg_post_smooth", m_multigridPostSmooth);
   pp.get("gmg_bott_smooth", m_multigridBottomSmooth);
+
+  m_multigridSmoothGrowth = 1.0;
+  pp.query("gmg_smooth_growth", m_multigridSmoothGrowth);
   pp.get("gmg_max_iter", m_multigridMaxIterations);
   pp.get("gmg_min_iter", m_multigridMinIterations);
   pp.get("gmg_exit_tol", m_multigridExitTolerance);
   pp.get("gmg_exit_hang", m_multigridExitHang);
+
+  m_multigridWarmStartTolerance = -1.0;
+  m_multigridMaxExitTolerance   = 1.E-4;
+  m_multigridInnerTolerance     = -1.0;
+  m_multigridOuterIterations    = 10;
+
+  pp.query("gmg_warm_tol", m_multigridWarmStartTolerance);
+  pp.query("gmg_warm_max_tol", m_multigridMaxExitTolerance);
+  pp.query("gmg_inner_tol", m_multigridInnerTolerance);
+  pp.query("gmg_outer_iter", m_multigridOuterIterations);
+
+  m_reuseOperators = false;
+  pp.query("gmg_reuse_ops", m_reuseOperators);
+
+  m_multigridTelemetry     = false;
+  m_multigridTelemetryFile = "none";
+  pp.query("gmg_telemetry", m_multigridTelemetry);
+  pp.query("gmg_telem_file", m_multigridTelemetryFile);
+
   pp.get("gmg_min_cells", m_minCellsBottom);
   pp.get("gmg_drop_order", m_domainDropOrder);
   pp.get("gmg_bc_order", m_multigridBcOrder);
@@ -121,12 +153,18 @@ FieldSolverMultigrid::parseMultigridSettings()
     if (str == "bicgstab") {
       m_bottomSolverType = BottomSolverType::BiCGStab;
     }
+    else if (str == "pbicgstab") {
+      m_bottomSolverType = BottomSolverType::PipelinedBiCGStab;
+    }
     else if (str == "gmres") {
       m_bottomSolverType = BottomSolverType::GMRES;
     }
+    else if (str == "custom") {
+      m_bottomSolverType = BottomSolverType::Custom;
+    }
     else {
       MayDay::Error(
-        "FieldSolverMultigrid::parseMultigridSettings() - logic bust, you've specified one parameter and I expected either 'bicgstab' or 'gmres'");
+        "FieldSolverMultigrid::parseMultigridSettings() - logic bust, you've specified one parameter and I expected 'bicgstab', 'pbicgstab', 'gmres', or 'custom'");
     }
   }
   else if (num == 2) {
@@ -144,7 +182,7 @@ FieldSolverMultigrid::parseMultigridSettings()
   }
   else {
     MayDay::Error(
-      "FieldSolverMultigrid::parseMultigridSettings() - logic bust in bottom solver. You must specify ' = bicgstab', ' = gmres', or ' = simple <number>'");
+      "FieldSolverMultigrid::parseMultigridSettings() - logic bust in bottom solver. You must specify ' = bicgstab', ' = gmres', ' = custom', or ' = simple <number>'");
   }
 
   // Get a string for the multigrid smoother. This must either be "jacobi", "red_black", or "multi_color".
@@ -167,9 +205,16 @@ FieldSolverMultigrid::parseMultigridSettings()
   if (str == "vcycle") {
     m_multigridType = MultigridType::VCycle;
   }
+  else if (str == "wcycle") {
+    m_multigridType = MultigridType::WCycle;
+  }
   else {
     MayDay::Error(
-      "FieldSolverMultigrid::parseMultigridSettings - unsupported multigrid cycle type requested. Only vcycle supported for now. ");
+      "FieldSolverMultigrid::parseMultigridSettings - unsupported multigrid cycle type requested. Expected 'vcycle' or 'wcycle'");
+  }
+
+  if (m_multigridSmoothGrowth <= 0.0) {
+    MayDay::Error("FieldSolverMultigrid::parseMultigridSettings - 'gmg_smooth_growth' must be > 0");
   }
 
   // No lower than 2.
@@ -186,6 +231,10 @@ FieldSolverMultigrid::parseMultigridSettings()
   CH_assert(m_multigridBcWeight >= 0);
   CH_assert(m_multigridJumpOrder > 0);
   CH_assert(m_multigridJumpWeight >= 0);
+
+  if (m_multigridInnerTolerance > 0.0 && m_multigridOuterIterations < 1) {
+    MayDay::Error("FieldSolverMultigrid::parseMultigridSettings - 'gmg_outer_iter' must be > 0");
+  }
 }
 
 void
@@ -214,19 +263,149 @@ FieldSolverMultigrid::parseJumpBC()
   }
 }
 
+void
+FieldSolverMultigrid::parseSuperposition()
+{
+  CH_TIME("FieldSolverMultigrid::parseSuperposition()");
+  if (m_verbosity > 5) {
+    pout() << "FieldSolverMultigrid::parseSuperposition()" << endl;
+  }
+
+  ParmParse pp(m_className.c_str());
+
+  m_superposition = false;
+  pp.query("superposition", m_superposition);
+
+  // The saturation charge makes the surface charge a part of the solution, which does not superpose.
+  if (m_superposition && m_jumpBcType == JumpBCType::SaturationCharge) {
+    MayDay::Error("FieldSolverMultigrid::parseSuperposition -- superposition can not be used with saturation_charge");
+  }
+}
+
 bool
 FieldSolverMultigrid::solve(MFAMRCellData&       a_phi,
                             const MFAMRCellData& a_rho,
                             const EBAMRIVData&   a_sigma,
                             const bool           a_zeroPhi)
 {
-  CH_TIMERS("FieldSolverMultigrid::solve");
-  CH_TIMER("FieldSolverMultigrid::solve::alloc_temps", t1);
-  CH_TIMER("FieldSolverMultigrid::solve::set_temps", t2);
+  CH_TIME("FieldSolverMultigrid::solve");
   if (m_verbosity > 5) {
     pout() << "FieldSolverMultigrid::solve(MFAMRCellData, MFAMRCellData, EBAMRIVData, bool)" << endl;
   }
 
+  CH_assert(m_isVoltageSet);
+
+  bool converged = false;
+
+  if (m_superposition) {
+    converged = this->solveSuperposition(a_phi, a_rho, a_sigma, a_zeroPhi);
+  }
+  else {
+    converged = this->solveMultigrid(a_phi, a_rho, a_sigma, a_zeroPhi);
+  }
+
+  this->computeElectricField(m_electricField, a_phi);
+
+  // If we are also solving for the saturation charge we get that solution from the factory (it can be a free parameter in the Helmholtz solve).
+  if (m_jumpBcType == JumpBCType::SaturationCharge) {
+    const EBAMRIVData& factorySigma = m_helmholtzOpFactory->getSigma();
+    DataOps::copy(m_sigma, factorySigma);
+    DataOps::scale(m_sigma, Units::eps0);
+
+    m_amr->conservativeAverage(m_sigma, m_realm, phase::gas);
+  }
+
+  return converged;
+}
+
+bool
+FieldSolverMultigrid::solveSuperposition(MFAMRCellData&       a_phi,
+                                         const MFAMRCellData& a_rho,
+                                         const EBAMRIVData&   a_sigma,
+                                         const bool           a_zeroPhi)
+{
+  CH_TIME("FieldSolverMultigrid::solveSuperposition");
+  if (m_verbosity > 5) {
+    pout() << "FieldSolverMultigrid::solveSuperposition(MFAMRCellData, MFAMRCellData, EBAMRIVData, bool)" << endl;
+  }
+
+  // TLDR: The Poisson equation is linear so if the boundary conditions scale with the voltage, the solution is
+  //       phi = V(t) * phiL + phiS where phiL is the solution for V = 1 without space and surface charges, and phiS is
+  //       the solution for V = 0 with the space and surface charges. phiL only changes when the grids or permittivities
+  //       change so we cache it, and solve only for phiS using its previous value as initial guess. We do this by
+  //       temporarily replacing m_voltage, which the boundary condition functions read when they are evaluated.
+  if (m_laplacePotential.size() == 0) {
+    m_amr->allocate(m_laplacePotential, m_realm, m_nComp);
+
+    DataOps::setValue(m_laplacePotential, 0.0);
+
+    m_hasLaplacePotential = false;
+  }
+
+  if (m_spaceChargePotential.size() == 0) {
+    m_amr->allocate(m_spaceChargePotential, m_realm, m_nComp);
+
+    DataOps::setValue(m_spaceChargePotential, 0.0);
+  }
+
+  const std::function<Real(const Real a_time)> voltage = m_voltage;
+
+  bool converged = true;
+
+  if (!m_hasLaplacePotential) {
+    MFAMRCellData zeroRho;
+    EBAMRIVData   zeroSigma;
+
+    m_amr->allocate(zeroRho, m_realm, m_nComp);
+    m_amr->allocate(zeroSigma, m_realm, phase::gas, m_nComp);
+
+    DataOps::setValue(zeroRho, 0.0);
+    DataOps::setValue(zeroSigma, 0.0);
+
+    m_voltage = [](const Real a_time) -> Real {
+      return 1.0;
+    };
+
+    converged = this->solveMultigrid(m_laplacePotential, zeroRho, zeroSigma, false);
+
+    m_hasLaplacePotential = converged;
+
+    if (!converged) {
+      MayDay::Warning("FieldSolverMultigrid::solveSuperposition -- could not solve for the unit-voltage potential");
+    }
+  }
+
+  m_voltage = [](const Real a_time) -> Real {
+    return 0.0;
+  };
+
+  converged = this->solveMultigrid(m_spaceChargePotential, a_rho, a_sigma, a_zeroPhi) && converged;
+
+  m_voltage = voltage;
+
+  // Superpose the solutions.
+  DataOps::copy(a_phi, m_spaceChargePotential);
+  DataOps::incr(a_phi, m_laplacePotential, m_voltage(m_time));
+
+  m_amr->conservativeAverage(a_phi, m_realm);
+  m_amr->interpGhostPwl(a_phi, m_realm);
+
+  return converged;
+}
+
+bool
+FieldSolverMultigrid::solveMultigrid(MFAMRCellData&       a_phi,
+                                     const MFAMRCellData& a_rho,
+                                     const EBAMRIVData&   a_sigma,
+                                     const bool           a_zeroPhi)
+{
+  CH_TIMERS("FieldSolverMultigrid::solveMultigrid");
+  CH_TIMER("FieldSolverMultigrid::solveMultigrid::alloc_temps", t1);
+  CH_TIMER("FieldSolverMultigrid::solveMultigrid::set_temps", t2);
+  if (m_verbosity > 5) {
+    pout() << "FieldSolverMultigrid::solveMultigrid(MFAMRCellData, MFAMRCellData, EBAMRIVData, bool)" << endl;
+  }
+
   // TLDR: This is the main solve routine. The operator factory was set up as kappa*L(phi) = -kappa*div(eps*grad(phi))
   //       which we use to solve the Poisson equation div(eps*grad(phi)) = -rho/eps0.
   //
@@ -240,11 +419,19 @@ FieldSolverMultigrid::solve(MFAMRCellData&       a_phi,
 
   bool converged = false;
 
+  // The surface charge only enters the operators through the jump condition on dielectric interfaces. Single-phase
+  // problems (no dielectrics) have no such interfaces, so we skip the surface charge scaling and the jump update.
+  const bool needJump = m_multifluidIndexSpace->numPhases() > 1 || m_jumpBcType == JumpBCType::SaturationCharge;
+
   // Set up multigrid solver if it is not already done.
   if (!m_isSolverSetup) {
     this->setupSolver();
   }
 
+  if (m_multigridTelemetry) {
+    m_telemetry.startSolve(m_className, m_time);
+  }
+
   // Define temporaries; the incoming data might need to be scaled but we don't want to
   // alter it directly.
   CH_START(t1);
@@ -254,7 +441,9 @@ FieldSolverMultigrid::solve(MFAMRCellData&       a_phi,
 
   m_amr->allocate(zero, m_realm, m_nComp);
   m_amr->allocate(kappaRhoByEps0, m_realm, m_nComp);
-  m_amr->allocate(sigmaByEps0, m_realm, phase::gas, m_nComp);
+  if (needJump) {
+    m_amr->allocate(sigmaByEps0, m_realm, phase::gas, m_nComp);
+  }
   CH_STOP(t1);
 
   // Scale data as appropriate.
@@ -277,12 +466,16 @@ FieldSolverMultigrid::solve(MFAMRCellData&       a_phi,
   m_amr->interpGhost(kappaRhoByEps0, m_realm);
 
   // Do the scaled surface charge
-  DataOps::copy(sigmaByEps0, a_sigma);
-  DataOps::scale(sigmaByEps0, 1. / (Units::eps0));
+  if (needJump) {
+    DataOps::copy(sigmaByEps0, a_sigma);
+    DataOps::scale(sigmaByEps0, 1. / (Units::eps0));
+  }
   CH_STOP(t2);
 
   // Factory needs knowledge of the new surface charge -- it passes this data by reference to the multigrid operators (MFHelmholtzOps).
-  m_helmholtzOpFactory->setJump(sigmaByEps0, 1.0);
+  if (needJump) {
+    m_helmholtzOpFactory->setJump(sigmaByEps0, 1.0);
+  }
 
   // Aliasing, because Chombo is not too smart about smart pointers.
   Vector<LevelData<MFCellFAB>*> phi; // Raw pointers of a_phi
@@ -306,43 +499,177 @@ FieldSolverMultigrid::solve(MFAMRCellData&       a_phi,
   // This is the residue rho - L(phi=0)
   const Real zeroResid = m_multigridSolver->computeAMRResidual(zer, rhs, finestLevel, 0);
 
-  // Convergence criterion.
-  const Real convergedResid = zeroResid * m_multigridExitTolerance;
+  if (m_multigridTelemetry) {
+    m_telemetry.addResidual(phiResid);
+  }
+
+  // Convergence criterion. With a warm-start tolerance we also accept the solution once the residual of the initial guess
+  // has been reduced by m_multigridWarmStartTolerance. This loosens the tolerance in steps where the right-hand side changed
+  // a lot, but never beyond m_multigridMaxExitTolerance.
+  Real exitTolerance = m_multigridExitTolerance;
+
+  if (m_multigridWarmStartTolerance > 0.0 && !a_zeroPhi && zeroResid > 0.0) {
+    const Real maxTolerance = std::max(m_multigridExitTolerance, m_multigridMaxExitTolerance);
+
+    exitTolerance = std::max(exitTolerance, m_multigridWarmStartTolerance * phiResid / zeroResid);
+    exitTolerance = std::min(exitTolerance, maxTolerance);
+  }
+
+  const Real convergedResid = zeroResid * exitTolerance;
+
+  if (m_multigridVerbosity > 0) {
+    pout() << "FieldSolverMultigrid::solve - initial residual = " << phiResid / std::max(zeroResid, 1.E-99)
+           << " (relative), exit tolerance = " << exitTolerance << endl;
+  }
 
   // If the residue rho - L(phi) is too large then we must get a new solution.
-  if (phiResid > convergedResid) {
+  if (phiResid > convergedResid && m_multigridInnerTolerance > exitTolerance) {
+
+    // Defect correction. Each inner solve reduces the current residual by m_multigridInnerTolerance, after which the residual of the
+    // full problem is recomputed and the solve is restarted.
+    Real resid   = a_zeroPhi ? zeroResid : phiResid;
+    bool zeroPhi = a_zeroPhi;
+
+    for (int outer = 0; outer < m_multigridOuterIterations && !converged; outer++) {
+      m_multigridSolver->m_eps               = std::max(m_multigridInnerTolerance, convergedResid / resid);
+      m_multigridSolver->m_convergenceMetric = resid;
+      m_multigridSolver->solveNoInitResid(phi, res, rhs, finestLevel, coarsestLevel, zeroPhi);
+
+      zeroPhi = false;
+      resid   = m_multigridSolver->computeAMRResidual(phi, rhs, finestLevel, 0);
+
+      if (m_multigridTelemetry) {
+        m_telemetry.addResidual(resid);
+      }
+
+      if (m_multigridVerbosity > 0) {
+        pout() << "FieldSolverMultigrid::solve - outer iteration = " << outer
+               << ", residual = " << resid / std::max(zeroResid, 1.E-99) << " (relative)" << endl;
+      }
+
+      converged = resid <= convergedResid;
+    }
+
+    m_multigridSolver->m_eps = m_multigridExitTolerance;
+  }
+  else if (phiResid > convergedResid) {
+    m_multigridSolver->m_eps               = exitTolerance;
     m_multigridSolver->m_convergenceMetric = zeroResid;
     m_multigridSolver->solveNoInitResid(phi, res, rhs, finestLevel, coarsestLevel, a_zeroPhi);
+    m_multigridSolver->m_eps = m_multigridExitTolerance;
 
     const int status = m_multigridSolver->m_exitStatus; // 1 => Initial norm sufficiently reduced
     if (status == 1 || status == 8) {                   // 8 => Norm sufficiently small
       converged = true;
     }
+
+    if (m_multigridTelemetry) {
+      m_telemetry.addResidual(m_multigridSolver->computeAMRResidual(phi, rhs, finestLevel, 0));
+    }
   }
   else {
     converged = true;
   }
 
+  // Convergence report. This costs an extra residual computation so we only do it if asked for.
+  if (m_multigridVerbosity > 0) {
+    const Real finalResid = m_multigridSolver->computeAMRResidual(phi, rhs, finestLevel, 0);
+
+    pout() << "FieldSolverMultigrid::solve - final residual = " << finalResid / std::max(zeroResid, 1.E-99)
+           << " (relative), reduction = " << finalResid / std::max(phiResid, 1.E-99) << ", converged = " << converged
+           << endl;
+  }
+
   m_multigridSolver->revert(phi, rhs, finestLevel, 0);
 
   // Coarsen/update ghosts before computing the field.
   m_amr->conservativeAverage(a_phi, m_realm);
   m_amr->interpGhostPwl(a_phi, m_realm);
 
-  this->computeElectricField(m_electricField, a_phi);
-
-  // If we are also solving for the saturation charge we get that solution from the factory (it can be a free parameter in the Helmholtz solve).
-  if (m_jumpBcType == JumpBCType::SaturationCharge) {
-    const EBAMRIVData& factorySigma = m_helmholtzOpFactory->getSigma();
-    DataOps::copy(m_sigma, factorySigma);
-    DataOps::scale(m_sigma, Units::eps0);
+  if (m_multigridTelemetry) {
+    m_telemetry.stopSolve(converged);
 
-    m_amr->conservativeAverage(m_sigma, m_realm, phase::gas);
+    if (m_multigridTelemetryFile != "none") {
+      m_telemetry.writeCSV(m_multigridTelemetryFile);
+    }
   }
 
   return converged;
 }
 
+const MultigridTelemetry&
+FieldSolverMultigrid::getMultigridTelemetry() const noexcept
+{
+  return m_telemetry;
+}
+
+Real
+FieldSolverMultigrid::timeMultigridCycles(const int a_numCycles)
+{
+  CH_TIME("FieldSolverMultigrid::timeMultigridCycles");
+  if (m_verbosity > 5) {
+    pout() << "FieldSolverMultigrid::timeMultigridCycles" << endl;
+  }
+
+  CH_assert(a_numCycles > 0);
+
+  if (!m_isSolverSetup) {
+    this->setupSolver();
+  }
+
+  // TLDR: AMRMultiGrid does not report how many cycles it ran, so we time a fixed number of cycles instead. Setting the
+  //       minimum and maximum number of iterations to a_numCycles bypasses the convergence and hang checks. The data is
+  //       temporary, and the solver parameters are restored afterwards.
+  MFAMRCellData phi;
+  MFAMRCellData rhs;
+  MFAMRCellData res;
+
+  m_amr->allocate(phi, m_realm, m_nComp);
+  m_amr->allocate(rhs, m_realm, m_nComp);
+  m_amr->allocate(res, m_realm, m_nComp);
+
+  DataOps::setValue(phi, 0.0);
+  DataOps::setValue(rhs, 1.0);
+  DataOps::setValue(res, 0.0);
+
+  Vector<LevelData<MFCellFAB>*> phiAlias;
+  Vector<LevelData<MFCellFAB>*> rhsAlias;
+  Vector<LevelData<MFCellFAB>*> resAlias;
+
+  m_amr->alias(phiAlias, phi);
+  m_amr->alias(rhsAlias, rhs);
+  m_amr->alias(resAlias, res);
+
+  const int finestLevel = m_amr->getFinestLevel();
+
+  const int  minIterations = m_multigridSolver->m_imin;
+  const int  maxIterations = m_multigridSolver->m_iterMax;
+  const Real eps           = m_multigridSolver->m_eps;
+  const Real metric        = m_multigridSolver->m_convergenceMetric;
+
+  m_multigridSolver->m_imin              = a_numCycles;
+  m_multigridSolver->m_iterMax           = a_numCycles;
+  m_multigridSolver->m_eps               = 0.0;
+  m_multigridSolver->m_convergenceMetric = 0.0;
+
+  ParallelOps::barrier();
+  const Real startTime = Timer::wallClock();
+
+  m_multigridSolver->solveNoInitResid(phiAlias, resAlias, rhsAlias, finestLevel, 0, true);
+
+  ParallelOps::barrier();
+  const Real stopTime = Timer::wallClock();
+
+  m_multigridSolver->m_imin              = minIterations;
+  m_multigridSolver->m_iterMax           = maxIterations;
+  m_multigridSolver->m_eps               = eps;
+  m_multigridSolver->m_convergenceMetric = metric;
+
+  m_multigridSolver->revert(phiAlias, rhsAlias, finestLevel, 0);
+
+  return ParallelOps::max(stopTime - startTime) / a_numCycles;
+}
+
 void
 FieldSolverMultigrid::preRegrid(const int a_lbase, const int a_oldFinestLevel)
 {
@@ -353,6 +680,19 @@ FieldSolverMultigrid::preRegrid(const int a_lbase, const int a_oldFinestLevel)
 
   FieldSolver::preRegrid(a_lbase, a_oldFinestLevel);
 
+  // Back up the superposition potentials so that they can be used as initial guesses on the new grids.
+  if (m_laplacePotential.size() > 0) {
+    m_amr->allocate(m_laplaceCache, m_realm, m_nComp);
+    m_amr->copyData(m_laplaceCache, m_laplacePotential);
+  }
+  if (m_spaceChargePotential.size() > 0) {
+    m_amr->allocate(m_spaceChargeCache, m_realm, m_nComp);
+    m_amr->copyData(m_spaceChargeCache, m_spaceChargePotential);
+  }
+
+  m_laplacePotential.clear();
+  m_spaceChargePotential.clear();
+
   m_multigridSolver.freeMem();
   m_helmholtzOpFactory.freeMem();
 }
@@ -367,7 +707,34 @@ FieldSolverMultigrid::regrid(const int a_lmin, const int a_oldFinestLevel, const
 
   FieldSolver::regrid(a_lmin, a_oldFinestLevel, a_newFinestLevel);
 
-  m_isSolverSetup = false;
+  // Interpolate the superposition potentials. The unit-voltage potential is only an initial guess on the new grids, so
+  // it is solved for again in the next solve.
+  const EBCoarseToFineInterp::Type interpType = m_regridSlopes ? EBCoarseToFineInterp::Type::ConservativeMinMod
+                                                               : EBCoarseToFineInterp::Type::ConservativePWC;
+
+  if (m_laplaceCache.size() > 0) {
+    m_amr->allocate(m_laplacePotential, m_realm, m_nComp);
+    m_amr->interpToNewGrids(m_laplacePotential, m_laplaceCache, a_lmin, a_oldFinestLevel, a_newFinestLevel, interpType);
+    m_amr->conservativeAverage(m_laplacePotential, m_realm);
+    m_amr->interpGhost(m_laplacePotential, m_realm);
+  }
+  if (m_spaceChargeCache.size() > 0) {
+    m_amr->allocate(m_spaceChargePotential, m_realm, m_nComp);
+    m_amr->interpToNewGrids(m_spaceChargePotential,
+                            m_spaceChargeCache,
+                            a_lmin,
+                            a_oldFinestLevel,
+                            a_newFinestLevel,
+                            interpType);
+    m_amr->conservativeAverage(m_spaceChargePotential, m_realm);
+    m_amr->interpGhost(m_spaceChargePotential, m_realm);
+  }
+
+  m_laplaceCache.clear();
+  m_spaceChargeCache.clear();
+
+  m_hasLaplacePotential = false;
+  m_isSolverSetup       = false;
 }
 
 void
@@ -404,12 +771,37 @@ FieldSolverMultigrid::setupSolver()
     pout() << "FieldSolverMultigrid::setupSolver()" << endl;
   }
 
-  this->setupHelmholtzFactory(); // Set up the operator factory
-  this->setupMultigrid();        // Set up the AMR multigrid solver
+  // If the grids have not changed since the last setup, the operators (and their EB, domain, and jump stencils) are still
+  // valid and we only need to update the coefficients. The factory holds pointers to the permittivities, so the deeper
+  // multigrid levels are updated through setSolverPermittivities. Custom bottom solvers are always redefined since they
+  // might have assembled a matrix.
+  const bool reuseOperators = m_reuseOperators && m_isSolverSetup && m_bottomSolverType != BottomSolverType::Custom;
+
+  if (reuseOperators) {
+    this->setSolverPermittivities(m_permittivityCell, m_permittivityFace, m_permittivityEB);
+  }
+  else {
+    this->setupHelmholtzFactory(); // Set up the operator factory
+    this->setupMultigrid();        // Set up the AMR multigrid solver
+  }
 
   m_isSolverSetup = true;
 }
 
+void
+FieldSolverMultigrid::setBottomSolver(const RefCountedPtr<LinearSolver<LevelData<MFCellFAB>>>& a_bottomSolver) noexcept
+{
+  CH_TIME("FieldSolverMultigrid::setBottomSolver");
+  if (m_verbosity > 5) {
+    pout() << "FieldSolverMultigrid::setBottomSolver" << endl;
+  }
+
+  m_customBottomSolver = a_bottomSolver;
+
+  // The multigrid solver holds a pointer to the old bottom solver.
+  m_isSolverSetup = false;
+}
+
 void
 FieldSolverMultigrid::setSolverPermittivities(const MFAMRCellData& a_permittivityCell,
                                               const MFAMRFluxData& a_permittivityFace,
@@ -424,6 +816,9 @@ FieldSolverMultigrid::setSolverPermittivities(const MFAMRCellData& a_permittivit
     MayDay::Error("FieldSolverMultigrid::setSolverPermittivities -- must set up solver first!");
   }
 
+  // The unit-voltage potential depends on the permittivities.
+  m_hasLaplacePotential = false;
+
   // Get the AMR operators and update the coefficients.
   Vector<AMRLevelOp<LevelData<MFCellFAB>>*>& operatorsAMR = m_multigridSolver->getAMROperators();
 
@@ -657,7 +1052,12 @@ FieldSolverMultigrid::setupHelmholtzFactory()
                              bottomDomain,
                              m_multigridJumpOrder,
                              m_multigridJumpWeight,
-                             m_amr->getMaxBoxSize()));
+                             m_amr->getMaxBoxSize(),
+                             MFHelmholtzOpFactory::AmrLevelGrids(),
+                             m_amr->getMultigridLevelCache(m_realm)));
+
+  m_helmholtzOpFactory->setSmoothingGrowth(m_multigridSmoothGrowth);
+  m_helmholtzOpFactory->setTelemetry(m_multigridTelemetry ? m_telemetry.getTimer() : RefCountedPtr<Timer>());
 }
 
 void
@@ -684,11 +1084,25 @@ FieldSolverMultigrid::setupMultigrid()
 
     break;
   }
+  case BottomSolverType::PipelinedBiCGStab: {
+    bottomSolver = &m_pipelinedBicgstab;
+
+    break;
+  }
   case BottomSolverType::GMRES: {
     bottomSolver = &m_gmres;
 
     break;
   }
+  case BottomSolverType::Custom: {
+    if (m_customBottomSolver.isNull()) {
+      MayDay::Error("FieldSolverMultigrid::setupMultigrid - 'gmg_bottom_solver = custom' but no bottom solver was set");
+    }
+
+    bottomSolver = &(*m_customBottomSolver);
+
+    break;
+  }
   default: {
     MayDay::Error("FieldSolverMultigrid::setupMultigrid - logic bust in bottom solver");
 
@@ -104,9 +104,22 @@ EBHelmholtzOp::EBHelmholtzOp(const Location::Cell                             a_
   m_profile    = false;
   m_interval   = Interval(m_comp, m_comp);
 
+  m_constantCoefficients = false;
+  m_constAcoef           = 0.0;
+  m_constBcoef           = 0.0;
+  m_smootherHalo         = 1;
+  m_deepHalo             = 1;
+  m_overlapExchange      = false;
+  m_offloadCells         = 4096;
+
   ParmParse pp("EBHelmholtzOp");
   pp.query("reflux_free", m_refluxFree);
   pp.query("profile", m_profile);
+  pp.query("smoother_halo", m_smootherHalo);
+  pp.query("overlap_exchange", m_overlapExchange);
+  pp.query("offload_cells", m_offloadCells);
+
+  m_smootherHalo = std::max(1, m_smootherHalo);
 
   m_timer = Timer("EBHelmholtzOp");
 
@@ -170,6 +183,41 @@ EBHelmholtzOp::setAcoAndBco(const RefCountedPtr<LevelData<EBCellFAB>>&       a_A
   this->defineStencils();
 }
 
+void
+EBHelmholtzOp::setConstantCoefficients(const Real a_Acoef, const Real a_Bcoef) noexcept
+{
+  CH_TIME("EBHelmholtzOp::setConstantCoefficients");
+
+  m_constantCoefficients = true;
+  m_constAcoef           = a_Acoef;
+  m_constBcoef           = a_Bcoef;
+}
+
+void
+EBHelmholtzOp::setTelemetry(const RefCountedPtr<Timer>& a_timer, const std::string a_level) noexcept
+{
+  CH_TIME("EBHelmholtzOp::setTelemetry");
+
+  m_telemetryTimer = a_timer;
+  m_telemetryLevel = a_level;
+}
+
+void
+EBHelmholtzOp::startTelemetryEvent(const char* a_event) const noexcept
+{
+  if (!m_telemetryTimer.isNull()) {
+    m_telemetryTimer->startEvent(m_telemetryLevel + "/" + a_event);
+  }
+}
+
+void
+EBHelmholtzOp::stopTelemetryEvent(const char* a_event) const noexcept
+{
+  if (!m_telemetryTimer.isNull()) {
+    m_telemetryTimer->stopEvent(m_telemetryLevel + "/" + a_event);
+  }
+}
+
 const RefCountedPtr<LevelData<EBCellFAB>>&
 EBHelmholtzOp::getAcoef()
 {
@@ -280,7 +328,7 @@ EBHelmholtzOp::defineStencils()
   EBCellFactory cellFact(ebisl);
   EBFluxFactory fluxFact(ebisl);
 
-  m_relCoef.define(dbl, m_nComp, IntVect::Zero, cellFact);
+  m_relCoef.define(dbl, m_nComp, (m_smootherHalo > 1) ? m_smootherHalo * IntVect::Unit : IntVect::Zero, cellFact);
 
   m_vofIterIrreg.define(dbl);
   m_vofIterMulti.define(dbl);
@@ -473,10 +521,138 @@ EBHelmholtzOp::defineStencils()
   }
   CH_STOP(t2);
 
+  // Check if we can use the deep-halo smoother. This must happen before computing the relaxation coefficient since it exchanges
+  // the coefficients.
+  this->defineDeepHalo();
+
+  // Find the boxes where we can use the constant-coefficient kernel.
+  this->defineRegularKernels();
+
   // Compute relaxation weights.
   this->computeDiagWeight();
   this->computeRelaxationCoefficient();
   this->makeAggStencil();
+
+  if (MemoryTracker::isEnabled()) {
+    m_stencilMemory = MemoryTracker::track("Stencils/EBHelmholtzOp", MemoryTracker::getBytes(m_relaxStencils));
+  }
+}
+
+void
+EBHelmholtzOp::defineRegularKernels()
+{
+  CH_TIME("EBHelmholtzOp::defineRegularKernels");
+
+  // TLDR: The regular kernel reads the A-coefficient in the cells and the B-coefficient on the faces of the grid box. If all
+  //       of these are the same we can use the kernel for constant coefficients, which gives the same result.
+  const DisjointBoxLayout& dbl = m_eblg.getDBL();
+  const DataIterator&      dit = dbl.dataIterator();
+
+  m_constantBox.define(dbl);
+  m_boxCoefficients.define(dbl);
+
+  const int nbox = dit.size();
+#pragma omp parallel for schedule(runtime)
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex& din     = dit[mybox];
+    const Box        cellBox = dbl[din];
+
+    const FArrayBox& aco = (*m_Acoef)[din].getFArrayBox();
+
+    const Real A = aco(cellBox.smallEnd(), m_comp);
+    const Real B = (*m_Bcoef)[din][0].getFArrayBox()(cellBox.smallEnd(), m_comp);
+
+    bool isConstant = true;
+
+    auto checkA = [&](const IntVect& iv) -> void {
+      isConstant = isConstant && (aco(iv, m_comp) == A);
+    };
+
+    BoxLoops::loop(cellBox, checkA);
+
+    for (int dir = 0; dir < SpaceDim && isConstant; dir++) {
+      const FArrayBox& bco = (*m_Bcoef)[din][dir].getFArrayBox();
+
+      auto checkB = [&](const IntVect& iv) -> void {
+        isConstant = isConstant && (bco(iv, m_comp) == B);
+      };
+
+      BoxLoops::loop(surroundingNodes(cellBox, dir), checkB);
+    }
+
+    m_constantBox[din]     = isConstant;
+    m_boxCoefficients[din] = std::make_pair(A, B);
+  }
+}
+
+void
+EBHelmholtzOp::defineDeepHalo()
+{
+  CH_TIME("EBHelmholtzOp::defineDeepHalo()");
+
+  m_deepHalo = 1;
+
+  // Ghost cells on the coarse-fine interface are interpolated from the coarse level and the fine cells next to the interface,
+  // so we can't update them locally. This leaves the coarsest AMR level and the multigrid levels below it.
+  if (m_smootherHalo <= 1 || m_hasCoar || m_smoother != Smoother::GauSaiRedBlack) {
+    return;
+  }
+
+  const DisjointBoxLayout& dbl    = m_eblg.getDBL();
+  const EBISLayout&        ebisl  = m_eblg.getEBISL();
+  const ProblemDomain&     domain = m_eblg.getDomain();
+
+  // Halo depth is limited by the ghost cells in the data that the kernels read in the halo.
+  int depth = m_smootherHalo;
+  for (int dir = 0; dir < SpaceDim; dir++) {
+    depth = std::min(depth, m_ghostPhi[dir]);
+    depth = std::min(depth, m_Acoef->ghostVect()[dir]);
+    depth = std::min(depth, m_Bcoef->ghostVect()[dir]);
+  }
+
+  if (depth <= 1) {
+    return;
+  }
+
+  // Every cell in the halo (inside the domain) must be a valid cell on this level.
+  long long numCells = 0LL;
+  for (LayoutIterator lit = dbl.layoutIterator(); lit.ok(); ++lit) {
+    numCells += dbl[lit()].numPts();
+  }
+
+  if (numCells != domain.domainBox().numPts()) {
+    return;
+  }
+
+  // No cut-cells in the halo.
+  int isRegular = 1;
+
+  const DataIterator& dit = dbl.dataIterator();
+
+  const int nbox = dit.size();
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex& din = dit[mybox];
+
+    Box haloBox = grow(dbl[din], depth);
+    haloBox &= domain;
+
+    const EBISBox& ebisbox = ebisl[din];
+
+    for (BoxIterator bit(haloBox); bit.ok() && isRegular == 1; ++bit) {
+      if (!(ebisbox.isRegular(bit()))) {
+        isRegular = 0;
+      }
+    }
+  }
+
+  if (ParallelOps::min(isRegular) == 0) {
+    return;
+  }
+
+  m_deepHalo = depth;
+
+  m_Acoef->exchange();
+  m_Bcoef->exchange();
 }
 
 void
@@ -732,6 +908,8 @@ EBHelmholtzOp::restrictResidual(LevelData<EBCellFAB>&       a_resCoar,
 {
   CH_TIME("EBHelmholtzOp::restrictResidual(LD<EBCellFAB>, LD<EBCellFAB>, LD<EBCellFAB>)");
 
+  this->startTelemetryEvent("restrict");
+
   // Compute the residual on this level first. Make a temporary for that.
   LevelData<EBCellFAB> res;
   this->create(res, a_phi);
@@ -740,6 +918,8 @@ EBHelmholtzOp::restrictResidual(LevelData<EBCellFAB>&       a_resCoar,
 
   // Restrict it onto the coarse level.
   m_restrictOpMG.restrictResidual(a_resCoar, res, m_interval);
+
+  this->stopTelemetryEvent("restrict");
 }
 
 void
@@ -747,7 +927,9 @@ EBHelmholtzOp::prolongIncrement(LevelData<EBCellFAB>& a_phi, const LevelData<EBC
 {
   CH_TIME("EBHelmholtzOp::prolongIncrement(LD<EBCellFAB>, LD<EBCellFAB>)");
 
+  this->startTelemetryEvent("prolong");
   m_prolongOpMG.prolongResidual(a_phi, a_correctCoarse, m_interval);
+  this->stopTelemetryEvent("prolong");
 }
 
 int
@@ -827,7 +1009,9 @@ EBHelmholtzOp::refluxFreeAMROperator(LevelData<EBCellFAB>&             a_Lphi,
   if (m_doExchange) {
     LevelData<EBCellFAB>& phi = (LevelData<EBCellFAB>&)a_phi;
 
+    this->startTelemetryEvent("exchange");
     phi.exchange(m_exchangeCopier);
+    this->stopTelemetryEvent("exchange");
   }
   if (m_hasCoar && m_doInterpCF) {
     this->inhomogeneousCFInterp((LevelData<EBCellFAB>&)a_phi, a_phiCoar);
@@ -846,7 +1030,9 @@ EBHelmholtzOp::refluxFreeAMROperator(LevelData<EBCellFAB>&             a_Lphi,
 
     LevelData<EBCellFAB>& phiFine = (LevelData<EBCellFAB>&)a_phiFine;
 
+    this->startTelemetryEvent("exchange");
     phiFine.exchange(m_exchangeCopierFine);
+    this->stopTelemetryEvent("exchange");
     fineOp->inhomogeneousCFInterp(phiFine, a_phi);
 
     fineOp->computeFlux(a_phiFine);
@@ -1116,6 +1302,8 @@ EBHelmholtzOp::applyOp(LevelData<EBCellFAB>&             a_Lphi,
 {
   CH_TIME("EBHelmholtzOp::applyOp(level, full)");
 
+  this->startTelemetryEvent("apply");
+
   // TLDR: We are computing L(phi) on a level, and there's possibly a coarser level here as well. If there is,
   //       we need to recompute the ghost cells.
 
@@ -1123,8 +1311,54 @@ EBHelmholtzOp::applyOp(LevelData<EBCellFAB>&             a_Lphi,
   // do a local copy, but that can end up being expensive since this is called on every relaxation.
   LevelData<EBCellFAB>& phi = (LevelData<EBCellFAB>&)a_phi;
 
+  const DisjointBoxLayout& dbl = a_Lphi.disjointBoxLayout();
+  const DataIterator&      dit = dbl.dataIterator();
+
+  const int nbox = dit.size();
+
+  // With overlapped exchanges we apply the operator in the patch interiors while the ghost cells are being exchanged, and then
+  // do the rest of the patch once the exchange and coarse-fine interpolation are done.
+  if (m_doExchange && m_overlapExchange) {
+    phi.exchangeBegin(m_exchangeCopier);
+
+#pragma omp parallel for schedule(runtime) if (BoxLoops::threadOverBoxes(nbox))
+    for (int mybox = 0; mybox < nbox; mybox++) {
+      const DataIndex& din = dit[mybox];
+
+      this->applyOpInterior(a_Lphi[din], phi[din], (*m_Acoef)[din], (*m_Bcoef)[din], dbl[din], din);
+    }
+
+    this->startTelemetryEvent("exchange");
+    phi.exchangeEnd();
+    this->stopTelemetryEvent("exchange");
+
+    if (m_hasCoar && m_doInterpCF) {
+      this->interpolateCF(phi, a_phiCoar, a_homogeneousCFBC);
+    }
+
+#pragma omp parallel for schedule(runtime) if (BoxLoops::threadOverBoxes(nbox))
+    for (int mybox = 0; mybox < nbox; mybox++) {
+      const DataIndex& din = dit[mybox];
+
+      this->applyOpBoundary(a_Lphi[din],
+                            phi[din],
+                            (*m_Acoef)[din],
+                            (*m_Bcoef)[din],
+                            (*m_BcoefIrreg)[din],
+                            dbl[din],
+                            din,
+                            a_homogeneousPhysBC);
+    }
+
+    this->stopTelemetryEvent("apply");
+
+    return;
+  }
+
   if (m_doExchange) {
+    this->startTelemetryEvent("exchange");
     phi.exchange(m_exchangeCopier);
+    this->stopTelemetryEvent("exchange");
   }
 
   if (m_hasCoar && m_doInterpCF) {
@@ -1132,11 +1366,7 @@ EBHelmholtzOp::applyOp(LevelData<EBCellFAB>&             a_Lphi,
   }
 
   // Apply operator in each kernel.
-  const DisjointBoxLayout& dbl = a_Lphi.disjointBoxLayout();
-  const DataIterator&      dit = dbl.dataIterator();
-
-  const int nbox = dit.size();
-#pragma omp parallel for schedule(runtime)
+#pragma omp parallel for schedule(runtime) if (BoxLoops::threadOverBoxes(nbox))
   for (int mybox = 0; mybox < nbox; mybox++) {
     const DataIndex& din = dit[mybox];
 
@@ -1149,6 +1379,8 @@ EBHelmholtzOp::applyOp(LevelData<EBCellFAB>&             a_Lphi,
                   din,
                   a_homogeneousPhysBC);
   }
+
+  this->stopTelemetryEvent("apply");
 }
 
 void
@@ -1204,6 +1436,22 @@ EBHelmholtzOp::applyOpRegular(EBCellFAB&             a_Lphi,
   this->applyDomainFlux(a_phi, a_Bcoef, a_cellBox, a_dit, a_homogeneousPhysBC);
   CH_STOP(t1);
 
+  // Launch the kernel.
+  CH_START(t2);
+  this->applyOpRegularKernel(a_Lphi, a_phi, a_Acoef, a_Bcoef, a_cellBox, a_dit);
+  CH_STOP(t2);
+}
+
+void
+EBHelmholtzOp::applyOpRegularKernel(EBCellFAB&       a_Lphi,
+                                    const EBCellFAB& a_phi,
+                                    const EBCellFAB& a_Acoef,
+                                    const EBFluxFAB& a_Bcoef,
+                                    const Box&       a_kernelBox,
+                                    const DataIndex& a_dit) const noexcept
+{
+  CH_TIME("EBHelmholtzOp::applyOpRegularKernel");
+
   FArrayBox&       Lphi = a_Lphi.getFArrayBox();
   const FArrayBox& phi  = a_phi.getFArrayBox();
   const FArrayBox& aco  = a_Acoef.getFArrayBox();
@@ -1229,10 +1477,307 @@ EBHelmholtzOp::applyOpRegular(EBCellFAB&             a_Lphi,
                                 );
   };
 
-  // Launch the kernel.
-  CH_START(t2);
-  BoxLoops::loop(a_cellBox, kernel);
-  CH_STOP(t2);
+  // Large kernel boxes go to the accelerator if we have one.
+#ifdef CD_USE_OFFLOAD
+  const bool offload = a_kernelBox.numPts() >= m_offloadCells;
+#else
+  constexpr bool offload = false;
+#endif
+
+  // Use the kernel with scalar coefficients if we can, which does not read the coefficient fields. Per-box constant coefficients
+  // were only checked inside the grid box, so kernel boxes that extend into the halo use the general kernel.
+  if (m_constantCoefficients) {
+    if (offload) {
+      this->applyOpRegularOffload(Lphi,
+                                  phi,
+                                  a_Acoef,
+                                  a_Bcoef,
+                                  true,
+                                  m_alpha * m_constAcoef,
+                                  factor * m_constBcoef,
+                                  a_kernelBox);
+    }
+    else {
+      this->applyOpRegularConstant(Lphi, phi, m_alpha * m_constAcoef, factor * m_constBcoef, a_kernelBox);
+    }
+  }
+  else if (m_constantBox[a_dit] && m_eblg.getDBL()[a_dit].contains(a_kernelBox)) {
+    const std::pair<Real, Real>& coef = m_boxCoefficients[a_dit];
+
+    if (offload) {
+      this->applyOpRegularOffload(Lphi,
+                                  phi,
+                                  a_Acoef,
+                                  a_Bcoef,
+                                  true,
+                                  m_alpha * coef.first,
+                                  factor * coef.second,
+                                  a_kernelBox);
+    }
+    else {
+      this->applyOpRegularConstant(Lphi, phi, m_alpha * coef.first, factor * coef.second, a_kernelBox);
+    }
+  }
+  else if (offload) {
+    this->applyOpRegularOffload(Lphi, phi, a_Acoef, a_Bcoef, false, m_alpha, factor, a_kernelBox);
+  }
+  else {
+    BoxLoops::loopTiled(a_kernelBox, kernel);
+  }
+}
+
+void
+EBHelmholtzOp::applyOpRegularConstant(FArrayBox&       a_Lphi,
+                                      const FArrayBox& a_phi,
+                                      const Real       a_diag,
+                                      const Real       a_factor,
+                                      const Box&       a_kernelBox) const noexcept
+{
+  CH_TIME("EBHelmholtzOp::applyOpRegularConstant");
+
+  // TLDR: This is the same kernel as for variable coefficients, but with scalar coefficients. We index the data directly
+  //       so that the inner loop is a unit-stride loop over plain arrays which the compiler can vectorize.
+  const Box& phiBox  = a_phi.box();
+  const Box& LphiBox = a_Lphi.box();
+
+  const int phiStrideY  = phiBox.size(0);
+  const int LphiStrideY = LphiBox.size(0);
+#if CH_SPACEDIM == 3
+  const int phiStrideZ  = phiStrideY * phiBox.size(1);
+  const int LphiStrideZ = LphiStrideY * LphiBox.size(1);
+#endif
+
+  const Real* const phiData  = a_phi.dataPtr(m_comp);
+  Real* const       LphiData = a_Lphi.dataPtr(m_comp);
+
+  const IntVect lo = a_kernelBox.smallEnd();
+  const IntVect hi = a_kernelBox.bigEnd();
+  const int     nx = a_kernelBox.size(0);
+
+#if CH_SPACEDIM == 3
+  for (int k = lo[2]; k <= hi[2]; k++) {
+#endif
+    for (int j = lo[1]; j <= hi[1]; j++) {
+      const int phiOffset = D_TERM((lo[0] - phiBox.smallEnd(0)), +(j - phiBox.smallEnd(1)) * phiStrideY,
+                                   +(k - phiBox.smallEnd(2)) * phiStrideZ);
+      const int LphiOffset = D_TERM((lo[0] - LphiBox.smallEnd(0)), +(j - LphiBox.smallEnd(1)) * LphiStrideY,
+                                    +(k - LphiBox.smallEnd(2)) * LphiStrideZ);
+
+      const Real* const p = phiData + phiOffset;
+      Real* const       L = LphiData + LphiOffset;
+
+      CD_PRAGMA_SIMD
+      for (int i = 0; i < nx; i++) {
+        L[i] = a_diag * p[i] + a_factor * (p[i + 1] + p[i - 1] + p[i + phiStrideY] + p[i - phiStrideY]
+#if CH_SPACEDIM == 3
+                                           + p[i + phiStrideZ] + p[i - phiStrideZ]
+#endif
+                                           - 2.0 * SpaceDim * p[i]);
+      }
+    }
+#if CH_SPACEDIM == 3
+  }
+#endif
+}
+
+void
+EBHelmholtzOp::applyOpRegularOffload(FArrayBox&       a_Lphi,
+                                     const FArrayBox& a_phi,
+                                     const EBCellFAB& a_Acoef,
+                                     const EBFluxFAB& a_Bcoef,
+                                     const bool       a_constant,
+                                     const Real       a_diag,
+                                     const Real       a_factor,
+                                     const Box&       a_kernelBox) const noexcept
+{
+  CH_TIME("EBHelmholtzOp::applyOpRegularOffload");
+
+  // TLDR: This is the same kernel as applyOpRegularKernel and applyOpRegularConstant, but written with raw arrays and
+  //       strides so it can run in an OpenMP target region. The data is copied to the device and back for each call
+  //       since the exchanges, coarse-fine interpolation, and cut-cell stencils all work on host memory.
+  const bool constant = a_constant;
+  const Real diag     = a_diag;
+  const Real factor   = a_factor;
+
+  // Box corners and strides for each array.
+  auto strides = [](const Box& a_box, IntVect& a_lo, int& a_strideY, int& a_strideZ) -> void {
+    a_lo      = a_box.smallEnd();
+    a_strideY = a_box.size(0);
+    a_strideZ = (SpaceDim == 3) ? a_strideY * a_box.size(1) : 0;
+  };
+
+  IntVect phiLo, LphiLo, acoLo, bcoLo[SpaceDim];
+  int     phiSy, phiSz, LphiSy, LphiSz, acoSy, acoSz, bcoSy[SpaceDim], bcoSz[SpaceDim];
+
+  strides(a_phi.box(), phiLo, phiSy, phiSz);
+  strides(a_Lphi.box(), LphiLo, LphiSy, LphiSz);
+  strides(a_Acoef.getFArrayBox().box(), acoLo, acoSy, acoSz);
+  for (int dir = 0; dir < SpaceDim; dir++) {
+    strides(a_Bcoef[dir].getFArrayBox().box(), bcoLo[dir], bcoSy[dir], bcoSz[dir]);
+  }
+
+  const Real* const phi  = a_phi.dataPtr(m_comp);
+  Real* const       Lphi = a_Lphi.dataPtr(m_comp);
+  const Real* const aco  = a_Acoef.getFArrayBox().dataPtr(m_comp);
+  D_TERM(const Real* const bcoX = a_Bcoef[0].getFArrayBox().dataPtr(m_comp);
+         , const Real* const bcoY = a_Bcoef[1].getFArrayBox().dataPtr(m_comp);
+         , const Real* const bcoZ = a_Bcoef[2].getFArrayBox().dataPtr(m_comp);)
+
+  // Only the constant-coefficient kernel skips copying the coefficients to the device.
+  const long phiSize  = a_phi.box().numPts();
+  const long LphiSize = a_Lphi.box().numPts();
+  const long acoSize  = constant ? 0 : a_Acoef.getFArrayBox().box().numPts();
+  D_TERM(const long bcoXSize = constant ? 0 : a_Bcoef[0].getFArrayBox().box().numPts();
+         , const long bcoYSize = constant ? 0 : a_Bcoef[1].getFArrayBox().box().numPts();
+         , const long bcoZSize = constant ? 0 : a_Bcoef[2].getFArrayBox().box().numPts();)
+
+  const int D_DECL(iLo = a_kernelBox.smallEnd(0), jLo = a_kernelBox.smallEnd(1), kLo = a_kernelBox.smallEnd(2));
+  const int D_DECL(iHi = a_kernelBox.bigEnd(0), jHi = a_kernelBox.bigEnd(1), kHi = a_kernelBox.bigEnd(2));
+
+  // Flattened indices. The high face of cell (i,j,k) in direction dir is at the next index in that direction.
+  const int D_DECL(pLo0 = phiLo[0], pLo1 = phiLo[1], pLo2 = phiLo[2]);
+  const int D_DECL(lLo0 = LphiLo[0], lLo1 = LphiLo[1], lLo2 = LphiLo[2]);
+  const int D_DECL(aLo0 = acoLo[0], aLo1 = acoLo[1], aLo2 = acoLo[2]);
+  const int D_DECL(xLo0 = bcoLo[0][0], xLo1 = bcoLo[0][1], xLo2 = bcoLo[0][2]);
+  const int D_DECL(yLo0 = bcoLo[1][0], yLo1 = bcoLo[1][1], yLo2 = bcoLo[1][2]);
+#if CH_SPACEDIM == 3
+  const int D_DECL(zLo0 = bcoLo[2][0], zLo1 = bcoLo[2][1], zLo2 = bcoLo[2][2]);
+#endif
+  const int xSy = bcoSy[0];
+  const int ySy = bcoSy[1];
+#if CH_SPACEDIM == 3
+  const int xSz = bcoSz[0];
+  const int ySz = bcoSz[1];
+  const int zSy = bcoSy[2];
+  const int zSz = bcoSz[2];
+#endif
+
+#ifdef CD_USE_OFFLOAD
+#pragma omp target teams distribute parallel for collapse(CH_SPACEDIM) map(to : phi[0 : phiSize], aco[0 : acoSize])    \
+  map(to : D_DECL(bcoX[0 : bcoXSize], bcoY[0 : bcoYSize], bcoZ[0 : bcoZSize])) map(tofrom : Lphi[0 : LphiSize])
+#endif
+#if CH_SPACEDIM == 3
+  for (int k = kLo; k <= kHi; k++) {
+#endif
+    for (int j = jLo; j <= jHi; j++) {
+      for (int i = iLo; i <= iHi; i++) {
+        const int p = D_TERM((i - pLo0), +(j - pLo1) * phiSy, +(k - pLo2) * phiSz);
+        const int L = D_TERM((i - lLo0), +(j - lLo1) * LphiSy, +(k - lLo2) * LphiSz);
+
+        if (constant) {
+          Lphi[L] = diag * phi[p] + factor * (phi[p + 1] + phi[p - 1] + phi[p + phiSy] + phi[p - phiSy]
+#if CH_SPACEDIM == 3
+                                              + phi[p + phiSz] + phi[p - phiSz]
+#endif
+                                              - 2.0 * SpaceDim * phi[p]);
+        }
+        else {
+          const int a = D_TERM((i - aLo0), +(j - aLo1) * acoSy, +(k - aLo2) * acoSz);
+          const int x = D_TERM((i - xLo0), +(j - xLo1) * xSy, +(k - xLo2) * xSz);
+          const int y = D_TERM((i - yLo0), +(j - yLo1) * ySy, +(k - yLo2) * ySz);
+#if CH_SPACEDIM == 3
+          const int z = D_TERM((i - zLo0), +(j - zLo1) * zSy, +(k - zLo2) * zSz);
+#endif
+
+          Lphi[L] = diag * aco[a] * phi[p] +
+                    factor * (bcoX[x + 1] * (phi[p + 1] - phi[p]) - bcoX[x] * (phi[p] - phi[p - 1]) +
+                              bcoY[y + ySy] * (phi[p + phiSy] - phi[p]) - bcoY[y] * (phi[p] - phi[p - phiSy])
+#if CH_SPACEDIM == 3
+                              + bcoZ[z + zSz] * (phi[p + phiSz] - phi[p]) - bcoZ[z] * (phi[p] - phi[p - phiSz])
+#endif
+                             );
+        }
+      }
+    }
+#if CH_SPACEDIM == 3
+  }
+#endif
+}
+
+void
+EBHelmholtzOp::applyOpInterior(EBCellFAB&       a_Lphi,
+                               const EBCellFAB& a_phi,
+                               const EBCellFAB& a_Acoef,
+                               const EBFluxFAB& a_Bcoef,
+                               const Box&       a_cellBox,
+                               const DataIndex& a_dit) const noexcept
+{
+  CH_TIME("EBHelmholtzOp::applyOpInterior(patch)");
+
+  // TLDR: The regular stencil in the grid box shrunk by one cell only reaches valid cells in the box, so this can be done before the
+  //       ghost cells are filled. The cut-cells are done in applyOpBoundary because their stencils can reach further.
+  const EBISBox& ebisbox = m_eblg.getEBISL()[a_dit];
+
+  const Box interior = grow(a_cellBox, -1);
+
+  if (!ebisbox.isAllCovered() && !interior.isEmpty()) {
+    this->applyOpRegularKernel(a_Lphi, a_phi, a_Acoef, a_Bcoef, interior, a_dit);
+  }
+}
+
+void
+EBHelmholtzOp::applyOpBoundary(EBCellFAB&             a_Lphi,
+                               EBCellFAB&             a_phi,
+                               const EBCellFAB&       a_Acoef,
+                               const EBFluxFAB&       a_Bcoef,
+                               const BaseIVFAB<Real>& a_BcoefIrreg,
+                               const Box&             a_cellBox,
+                               const DataIndex&       a_dit,
+                               const bool             a_homogeneousPhysBC) const noexcept
+{
+  CH_TIME("EBHelmholtzOp::applyOpBoundary(patch)");
+
+  // TLDR: This does what applyOp does, but the regular kernel is only applied on the outer layer of cells in the box.
+  const EBISBox& ebisbox = m_eblg.getEBISL()[a_dit];
+
+  if (!ebisbox.isAllCovered()) {
+    this->applyDomainFlux(a_phi, a_Bcoef, a_cellBox, a_dit, a_homogeneousPhysBC);
+
+    const Vector<Box> boundaryLayer = this->getBoundaryLayer(a_cellBox);
+
+    for (int i = 0; i < boundaryLayer.size(); i++) {
+      this->applyOpRegularKernel(a_Lphi, a_phi, a_Acoef, a_Bcoef, boundaryLayer[i], a_dit);
+    }
+
+    this->applyOpIrregular(a_Lphi,
+                           a_phi,
+                           a_Acoef,
+                           a_Bcoef,
+                           a_BcoefIrreg,
+                           m_alphaDiagWeight[a_dit],
+                           a_cellBox,
+                           a_dit,
+                           a_homogeneousPhysBC);
+  }
+}
+
+Vector<Box>
+EBHelmholtzOp::getBoundaryLayer(const Box& a_cellBox) const noexcept
+{
+  CH_TIME("EBHelmholtzOp::getBoundaryLayer");
+
+  Vector<Box> boundaryLayer;
+
+  // Peel off the lo and hi slabs in each direction. What remains after the last direction is the interior.
+  Box remainder = a_cellBox;
+
+  for (int dir = 0; dir < SpaceDim && !remainder.isEmpty(); dir++) {
+    Box loSlab = remainder;
+    loSlab.setBig(dir, remainder.smallEnd(dir));
+
+    boundaryLayer.push_back(loSlab);
+
+    if (remainder.bigEnd(dir) > remainder.smallEnd(dir)) {
+      Box hiSlab = remainder;
+      hiSlab.setSmall(dir, remainder.bigEnd(dir));
+
+      boundaryLayer.push_back(hiSlab);
+    }
+
+    remainder.grow(dir, -1);
+  }
+
+  return boundaryLayer;
 }
 
 void
@@ -1538,6 +2083,18 @@ EBHelmholtzOp::homogeneousCFInterp(LevelData<EBCellFAB>& a_phi)
   }
 }
 
+void
+EBHelmholtzOp::homogeneousCFInterp(EBCellFAB& a_phi, const DataIndex& a_din)
+{
+  // TLDR: This is the patch version of homogeneousCFInterp. It only writes to the ghost cells of a_phi on the
+  //       refinement boundary, and it only reads from a_phi itself (the coarse data is zero). The smoothers can
+  //       therefore call this inside their own loop over patches, directly before relaxing the patch, rather than
+  //       doing a separate pass over all the patches. No timer here since this is called inside OpenMP loops.
+  if (m_hasCoar) {
+    m_interpolator->coarseFineInterpH(a_phi, m_interval, a_din);
+  }
+}
+
 void
 EBHelmholtzOp::inhomogeneousCFInterp(LevelData<EBCellFAB>& a_phiFine, const LevelData<EBCellFAB>& a_phiCoar)
 {
@@ -1583,6 +2140,7 @@ EBHelmholtzOp::relax(LevelData<EBCellFAB>& a_correction, const LevelData<EBCellF
   CH_TIME("EBHelmholtzOp::relax(LD<EBCellFAB>, LD<EBCellFAB>, int)");
 
   // This function performs relaxation steps on the correction. User can switch between different kernels.
+  this->startTelemetryEvent("smooth");
 
   switch (m_smoother) {
   case Smoother::NoRelax: {
@@ -1609,6 +2167,8 @@ EBHelmholtzOp::relax(LevelData<EBCellFAB>& a_correction, const LevelData<EBCellF
     break;
   }
   }
+
+  this->stopTelemetryEvent("smooth");
 }
 
 void
@@ -1629,16 +2189,62 @@ EBHelmholtzOp::relaxPointJacobi(LevelData<EBCellFAB>&       a_correction,
   const int                nbox = dit.size();
 
   for (int iter = 0; iter < a_iterations; iter++) {
+    if (m_doExchange && m_overlapExchange) {
+
+      // Compute L(corr) in the patch interiors while the exchange is in flight. The update must wait until L(corr) is known
+      // everywhere, since the boundary cells need the old values in the interior.
+      a_correction.exchangeBegin(m_exchangeCopier);
+
+#pragma omp parallel for schedule(runtime)
+      for (int mybox = 0; mybox < nbox; mybox++) {
+        const DataIndex& din = dit[mybox];
+
+        this->applyOpInterior(Lcorr[din], a_correction[din], (*m_Acoef)[din], (*m_Bcoef)[din], dbl[din], din);
+      }
+
+      this->startTelemetryEvent("exchange");
+      a_correction.exchangeEnd();
+      this->stopTelemetryEvent("exchange");
+
+#pragma omp parallel for schedule(runtime)
+      for (int mybox = 0; mybox < nbox; mybox++) {
+        const DataIndex& din = dit[mybox];
+
+        this->homogeneousCFInterp(a_correction[din], din);
+
+        if (!(m_eblg.getEBISL()[din].isAllCovered())) {
+          this->applyOpBoundary(Lcorr[din],
+                                a_correction[din],
+                                (*m_Acoef)[din],
+                                (*m_Bcoef)[din],
+                                (*m_BcoefIrreg)[din],
+                                dbl[din],
+                                din,
+                                true);
+
+          Lcorr[din] -= a_residual[din];
+          Lcorr[din] *= m_relCoef[din];
+          Lcorr[din] *= 0.5;
+          a_correction[din] -= Lcorr[din];
+        }
+      }
+
+      continue;
+    }
+
     if (m_doExchange) {
+      this->startTelemetryEvent("exchange");
       a_correction.exchange(m_exchangeCopier);
+      this->stopTelemetryEvent("exchange");
     }
 
-    this->homogeneousCFInterp(a_correction);
-
+    // The ghost cells are interpolated in the same pass as the relaxation.
 #pragma omp parallel for schedule(runtime)
     for (int mybox = 0; mybox < nbox; mybox++) {
       const DataIndex& din = dit[mybox];
 
+      this->homogeneousCFInterp(a_correction[din], din);
+
       this->pointJacobiKernel(Lcorr[din],
                               a_correction[din],
                               a_residual[din],
@@ -1692,6 +2298,12 @@ EBHelmholtzOp::relaxGSRedBlack(LevelData<EBCellFAB>&       a_correction,
   LevelData<EBCellFAB> Lcorr;
   this->create(Lcorr, a_residual);
 
+  if (m_deepHalo > 1) {
+    this->relaxGSRedBlackDeepHalo(a_correction, a_residual, a_iterations);
+
+    return;
+  }
+
   const DisjointBoxLayout& dbl = m_eblg.getDBL();
   const DataIterator&      dit = dbl.dataIterator();
 
@@ -1699,17 +2311,78 @@ EBHelmholtzOp::relaxGSRedBlack(LevelData<EBCellFAB>&       a_correction,
 
     // First do "red" cells, then "black" cells. Note that ghost cell interpolation and exchanges are required between the colors.
     for (int redBlack = 0; redBlack <= 1; redBlack++) {
+      const int nbox = dit.size();
+
+      if (m_doExchange && m_overlapExchange) {
+
+        // Compute L(corr) in the patch interiors while the exchange is in flight, and update the cells of this color once L(corr)
+        // is known everywhere.
+        a_correction.exchangeBegin(m_exchangeCopier);
+
+#pragma omp parallel for schedule(runtime) if (BoxLoops::threadOverBoxes(nbox))
+        for (int mybox = 0; mybox < nbox; mybox++) {
+          const DataIndex& din = dit[mybox];
+
+          this->applyOpInterior(Lcorr[din], a_correction[din], (*m_Acoef)[din], (*m_Bcoef)[din], dbl[din], din);
+        }
+
+        this->startTelemetryEvent("exchange");
+        a_correction.exchangeEnd();
+        this->stopTelemetryEvent("exchange");
+
+        const bool fuseInterpCF = BoxLoops::threadOverBoxes(nbox);
+
+        if (!fuseInterpCF) {
+          this->homogeneousCFInterp(a_correction);
+        }
+
+#pragma omp parallel for schedule(runtime) if (fuseInterpCF)
+        for (int mybox = 0; mybox < nbox; mybox++) {
+          const DataIndex& din = dit[mybox];
+
+          if (fuseInterpCF) {
+            this->homogeneousCFInterp(a_correction[din], din);
+          }
+
+          if (!(m_eblg.getEBISL()[din].isAllCovered())) {
+            this->applyOpBoundary(Lcorr[din],
+                                  a_correction[din],
+                                  (*m_Acoef)[din],
+                                  (*m_Bcoef)[din],
+                                  (*m_BcoefIrreg)[din],
+                                  dbl[din],
+                                  din,
+                                  true);
+
+            this->gauSaiRedBlackUpdate(Lcorr[din], a_correction[din], a_residual[din], dbl[din], din, redBlack);
+          }
+        }
+
+        continue;
+      }
+
       if (m_doExchange) {
+        this->startTelemetryEvent("exchange");
         a_correction.exchange(m_exchangeCopier);
+        this->stopTelemetryEvent("exchange");
       }
 
-      this->homogeneousCFInterp(a_correction);
+      // Interpolate the ghost cells in the same pass as the relaxation if we thread over the patches. Otherwise the
+      // kernels are threaded within each patch, and we interpolate all patches first.
+      const bool fuseInterpCF = BoxLoops::threadOverBoxes(nbox);
 
-      const int nbox = dit.size();
-#pragma omp parallel for schedule(runtime)
+      if (!fuseInterpCF) {
+        this->homogeneousCFInterp(a_correction);
+      }
+
+#pragma omp parallel for schedule(runtime) if (fuseInterpCF)
       for (int mybox = 0; mybox < nbox; mybox++) {
         const DataIndex& din = dit[mybox];
 
+        if (fuseInterpCF) {
+          this->homogeneousCFInterp(a_correction[din], din);
+        }
+
         this->gauSaiRedBlackKernel(Lcorr[din],
                                    a_correction[din],
                                    a_residual[din],
@@ -1724,6 +2397,75 @@ EBHelmholtzOp::relaxGSRedBlack(LevelData<EBCellFAB>&       a_correction,
   }
 }
 
+void
+EBHelmholtzOp::relaxGSRedBlackDeepHalo(LevelData<EBCellFAB>&       a_correction,
+                                       const LevelData<EBCellFAB>& a_residual,
+                                       const int                   a_iterations)
+{
+  CH_TIME("EBHelmholtzOp::relaxGSRedBlackDeepHalo(LD<EBCellFAB>, LD<EBCellFAB>, int)");
+
+  CH_assert(m_deepHalo > 1);
+  CH_assert(!m_hasCoar);
+
+  // TLDR: After an exchange of m_deepHalo ghost cells we can do m_deepHalo colour sweeps locally. A sweep on one colour only reads
+  //       cells of the other colour, so if the first sweep updates the cells in the patch grown by m_deepHalo - 1, the next sweep
+  //       can update the cells in the patch grown by m_deepHalo - 2 and so on. The last sweep before the next exchange is on the
+  //       patch itself. This trades redundant work in the halo for fewer exchanges. Since the sweeps also touch ghost cells
+  //       we need the residual in the ghost cells as well.
+
+  LevelData<EBCellFAB> Lcorr;
+  LevelData<EBCellFAB> residual;
+
+  this->create(Lcorr, a_correction);
+  this->create(residual, a_correction);
+
+  a_residual.copyTo(residual);
+  this->startTelemetryEvent("exchange");
+  residual.exchange(m_exchangeCopier);
+  this->stopTelemetryEvent("exchange");
+
+  const DisjointBoxLayout& dbl    = m_eblg.getDBL();
+  const DataIterator&      dit    = dbl.dataIterator();
+  const ProblemDomain&     domain = m_eblg.getDomain();
+
+  const int nbox          = dit.size();
+  const int numHalfSweeps = 2 * a_iterations;
+
+  int sweep = 0;
+  while (sweep < numHalfSweeps) {
+    if (m_doExchange) {
+      this->startTelemetryEvent("exchange");
+      a_correction.exchange(m_exchangeCopier);
+      this->stopTelemetryEvent("exchange");
+    }
+
+    const int numLocalSweeps = std::min(m_deepHalo, numHalfSweeps - sweep);
+
+    for (int localSweep = 0; localSweep < numLocalSweeps; localSweep++, sweep++) {
+      const int redBlack = sweep % 2;
+      const int growth   = numLocalSweeps - 1 - localSweep;
+
+#pragma omp parallel for schedule(runtime) if (BoxLoops::threadOverBoxes(nbox))
+      for (int mybox = 0; mybox < nbox; mybox++) {
+        const DataIndex& din = dit[mybox];
+
+        Box sweepBox = grow(dbl[din], growth);
+        sweepBox &= domain;
+
+        this->gauSaiRedBlackKernel(Lcorr[din],
+                                   a_correction[din],
+                                   residual[din],
+                                   (*m_Acoef)[din],
+                                   (*m_Bcoef)[din],
+                                   (*m_BcoefIrreg)[din],
+                                   sweepBox,
+                                   din,
+                                   redBlack);
+      }
+    }
+  }
+}
+
 void
 EBHelmholtzOp::gauSaiRedBlackKernel(EBCellFAB&             a_Lcorr,
                                     EBCellFAB&             a_corr,
@@ -1735,18 +2477,34 @@ EBHelmholtzOp::gauSaiRedBlackKernel(EBCellFAB&             a_Lcorr,
                                     const DataIndex&       a_dit,
                                     const int&             a_redBlack) const noexcept
 {
-  CH_TIMERS("EBHelmholtzOp::gauSaiRedBlackKernel");
-  CH_TIMER("EBHelmholtzOp::regular_cells", t1);
-  CH_TIMER("EBHelmholtzOp::irregular_cells", t2);
+  CH_TIME("EBHelmholtzOp::gauSaiRedBlackKernel");
 
   // This is the kernel for computing phi^(k+1) = phi^k - (res - L(phi))/|diag(L)| with a red-black pattern. Here, "red" cells are encoded by a_redBlack=0.
 
-  const EBISBox&   ebisbox = m_eblg.getEBISL()[a_dit];
-  const EBCellFAB& relCoef = m_relCoef[a_dit];
+  const EBISBox& ebisbox = m_eblg.getEBISL()[a_dit];
 
   if (!ebisbox.isAllCovered()) {
     this->applyOp(a_Lcorr, a_corr, a_Acoef, a_Bcoef, a_BcoefIrreg, a_cellBox, a_dit, true);
+    this->gauSaiRedBlackUpdate(a_Lcorr, a_corr, a_resid, a_cellBox, a_dit, a_redBlack);
+  }
+}
+
+void
+EBHelmholtzOp::gauSaiRedBlackUpdate(const EBCellFAB& a_Lcorr,
+                                    EBCellFAB&       a_corr,
+                                    const EBCellFAB& a_resid,
+                                    const Box&       a_cellBox,
+                                    const DataIndex& a_dit,
+                                    const int&       a_redBlack) const noexcept
+{
+  CH_TIMERS("EBHelmholtzOp::gauSaiRedBlackUpdate");
+  CH_TIMER("EBHelmholtzOp::regular_cells", t1);
+  CH_TIMER("EBHelmholtzOp::irregular_cells", t2);
+
+  const EBISBox&   ebisbox = m_eblg.getEBISL()[a_dit];
+  const EBCellFAB& relCoef = m_relCoef[a_dit];
 
+  if (!ebisbox.isAllCovered()) {
     BaseFab<Real>&       phiReg  = a_corr.getSingleValuedFAB();
     const BaseFab<Real>& LphiReg = a_Lcorr.getSingleValuedFAB();
     const BaseFab<Real>& rhsReg  = a_resid.getSingleValuedFAB();
@@ -1776,7 +2534,7 @@ EBHelmholtzOp::gauSaiRedBlackKernel(EBCellFAB&             a_Lcorr,
 
     // Launch the kernels over their respective domains.
     CH_START(t1);
-    BoxLoops::loop(a_cellBox, regularKernel);
+    BoxLoops::loopTiled(a_cellBox, regularKernel);
     CH_STOP(t1);
 
     CH_START(t2);
@@ -1807,16 +2565,18 @@ EBHelmholtzOp::relaxGSMultiColor(LevelData<EBCellFAB>&       a_correction,
   for (int iter = 0; iter < a_iterations; iter++) {
     for (int icolor = 0; icolor < m_colors.size(); icolor++) {
       if (m_doExchange) {
+        this->startTelemetryEvent("exchange");
         a_correction.exchange(m_exchangeCopier);
+        this->stopTelemetryEvent("exchange");
       }
 
-      this->homogeneousCFInterp(a_correction);
-
       const int nbox = dit.size();
 #pragma omp parallel for schedule(runtime)
       for (int mybox = 0; mybox < nbox; mybox++) {
         const DataIndex& din = dit[mybox];
 
+        this->homogeneousCFInterp(a_correction[din], din);
+
         this->gauSaiMultiColorKernel(Lcorr[din],
                                      a_correction[din],
                                      a_residual[din],
@@ -2015,6 +2775,11 @@ EBHelmholtzOp::computeRelaxationCoefficient()
 
     BoxLoops::loop(m_vofIterStenc[din], irregularKernel);
   }
+
+  // The deep-halo smoother also relaxes the ghost cells.
+  if (m_deepHalo > 1) {
+    m_relCoef.exchange();
+  }
 }
 
 void
@@ -2279,7 +3044,9 @@ EBHelmholtzOp::reflux(LevelData<EBCellFAB>&             a_Lphi,
 
   EBHelmholtzOp&        finerOp = (EBHelmholtzOp&)(a_finerOp);
   LevelData<EBCellFAB>& phiFine = (LevelData<EBCellFAB>&)a_phiFine;
+  this->startTelemetryEvent("exchange");
   phiFine.exchange(m_exchangeCopierFine);
+  this->stopTelemetryEvent("exchange");
   finerOp.inhomogeneousCFInterp(phiFine, a_phi);
 
   this->allocateFlux();
@@ -42,7 +42,8 @@ EBHelmholtzOpFactory::EBHelmholtzOpFactory(const Location::Cell    a_dataLocatio
                                            const Smoother&         a_smoother,
                                            const ProblemDomain&    a_bottomDomain,
                                            const int&              a_mgBlockingFactor,
-                                           const AmrLevelGrids&    a_deeperLevelGrids)
+                                           const AmrLevelGrids&    a_deeperLevelGrids,
+                                           const LevelCache&       a_levelCache)
 {
   CH_TIME("EBHelmholtzOpFactory::EBHelmholtzOpFactory(...)");
 
@@ -74,9 +75,19 @@ EBHelmholtzOpFactory::EBHelmholtzOpFactory(const Location::Cell    a_dataLocatio
   m_bottomDomain     = a_bottomDomain;
   m_mgBlockingFactor = a_mgBlockingFactor;
   m_deeperLevelGrids = a_deeperLevelGrids;
+  m_levelCache       = a_levelCache;
 
   m_numAmrLevels = m_amrLevelGrids.size();
 
+  m_agglomerationCells = 0;
+
+  ParmParse pp("EBHelmholtzOpFactory");
+  pp.query("agglomerate_cells", m_agglomerationCells);
+
+  m_constantCoefficients = false;
+  m_constAcoef           = 0.0;
+  m_constBcoef           = 0.0;
+
   // Asking multigrid to do the bottom solve at a refined AMR level is classified as bad input.
   if (this->isFiner(m_bottomDomain, m_amrLevelGrids[0]->getDomain())) {
     MayDay::Error("EBHelmholtzOpFactory -- bottomsolver domain can't be larger than the base AMR domain!");
@@ -345,13 +356,57 @@ EBHelmholtzOpFactory::isFiner(const ProblemDomain& A, const ProblemDomain& B) co
   return A.domainBox().numPts() > B.domainBox().numPts();
 }
 
+int
+EBHelmholtzOpFactory::getNumAgglomeratedRanks(const ProblemDomain& a_coarDomain) const noexcept
+{
+  CH_TIME("EBHelmholtzOpFactory::getNumAgglomeratedRanks");
+
+  // TLDR: Deep multigrid levels have few cells. If we spread them over all ranks every rank takes part in every exchange even
+  //       though there is hardly any work to do. Distribute them over the lowest ranks instead, which are usually on the same node,
+  //       and leave the rest of the ranks without boxes.
+  int numRanks = numProc();
+
+  if (m_agglomerationCells > 0) {
+    const long long numCells = a_coarDomain.domainBox().numPts();
+
+    numRanks = (int)std::max(1LL, std::min((long long)numProc(), numCells / (long long)m_agglomerationCells));
+  }
+
+  return numRanks;
+}
+
 bool
 EBHelmholtzOpFactory::getCoarserLayout(EBLevelGrid&       a_coarEblg,
                                        const EBLevelGrid& a_fineEblg,
                                        const int          a_refRat,
                                        const int          a_blockingFactor) const
 {
-  CH_TIME("EBHelmholtzOpFactory::getCoarserLayout(EBLevelGrid, EBLevelGrid, int, int)");
+  CH_TIME("EBHelmholtzOpFactory::getCoarserLayout");
+
+  if (m_levelCache.isNull()) {
+    return this->buildCoarserLayout(a_coarEblg, a_fineEblg, a_refRat, a_blockingFactor);
+  }
+
+  auto builder = [&](EBLevelGrid& a_coarGrid) -> bool {
+    return this->buildCoarserLayout(a_coarGrid, a_fineEblg, a_refRat, a_blockingFactor);
+  };
+
+  return m_levelCache->getCoarsening(a_coarEblg,
+                                     a_fineEblg,
+                                     a_refRat,
+                                     a_blockingFactor,
+                                     m_ghostPhi.max(),
+                                     m_agglomerationCells,
+                                     builder);
+}
+
+bool
+EBHelmholtzOpFactory::buildCoarserLayout(EBLevelGrid&       a_coarEblg,
+                                         const EBLevelGrid& a_fineEblg,
+                                         const int          a_refRat,
+                                         const int          a_blockingFactor) const
+{
+  CH_TIME("EBHelmholtzOpFactory::buildCoarserLayout(EBLevelGrid, EBLevelGrid, int, int)");
 
   bool hasCoarser = false;
 
@@ -387,7 +442,7 @@ EBHelmholtzOpFactory::getCoarserLayout(EBLevelGrid&       a_coarEblg,
 
           domainSplit(coarDomain, boxes, a_blockingFactor);
           mortonOrdering(boxes);
-          LoadBalance(procs, boxes);
+          LoadBalance(procs, boxes, this->getNumAgglomeratedRanks(coarDomain));
 
           coarDbl.define(boxes, procs, coarDomain);
 
@@ -542,6 +597,16 @@ EBHelmholtzOpFactory::MGnewOp(const ProblemDomain& a_fineDomain, int a_depth, bo
                              m_ghostPhi,
                              m_ghostRhs,
                              m_smoother);
+
+    if (m_constantCoefficients) {
+      mgOp->setConstantCoefficients(m_constAcoef, m_constBcoef);
+    }
+
+    if (!m_telemetryTimer.isNull()) {
+      const bool isBottom = (amrLevel == 0) && !hasMGObjects;
+
+      mgOp->setTelemetry(m_telemetryTimer, MultigridTelemetry::getLevelName(amrLevel, a_depth, isBottom));
+    }
   }
 
   return mgOp;
@@ -624,6 +689,14 @@ EBHelmholtzOpFactory::AMRnewOp(const ProblemDomain& a_domain)
                          m_ghostRhs,
                          m_smoother);
 
+  if (m_constantCoefficients) {
+    op->setConstantCoefficients(m_constAcoef, m_constBcoef);
+  }
+
+  if (!m_telemetryTimer.isNull()) {
+    op->setTelemetry(m_telemetryTimer, MultigridTelemetry::getLevelName(amrLevel, 0, false));
+  }
+
   return op;
 }
 
@@ -650,6 +723,41 @@ EBHelmholtzOpFactory::refToFiner(const ProblemDomain& a_domain) const
   return ref;
 }
 
+void
+EBHelmholtzOpFactory::setConstantCoefficients(const Real a_Acoef, const Real a_Bcoef) noexcept
+{
+  CH_TIME("EBHelmholtzOpFactory::setConstantCoefficients");
+
+  m_constantCoefficients = true;
+  m_constAcoef           = a_Acoef;
+  m_constBcoef           = a_Bcoef;
+}
+
+void
+EBHelmholtzOpFactory::setTelemetry(const RefCountedPtr<Timer>& a_timer) noexcept
+{
+  CH_TIME("EBHelmholtzOpFactory::setTelemetry");
+
+  m_telemetryTimer = a_timer;
+}
+
+EBHelmholtzOpFactory::AmrLevelGrids
+EBHelmholtzOpFactory::getDeeperLevelGrids() const noexcept
+{
+  CH_TIME("EBHelmholtzOpFactory::getDeeperLevelGrids");
+
+  AmrLevelGrids deeperLevelGrids;
+
+  // Recall that m_mgLevelGrids[0][0] is the coarsest AMR level itself.
+  if (m_numAmrLevels > 0 && m_hasMgLevels[0]) {
+    for (int i = 1; i < m_mgLevelGrids[0].size(); i++) {
+      deeperLevelGrids.push_back(m_mgLevelGrids[0][i]);
+    }
+  }
+
+  return deeperLevelGrids;
+}
+
 int
 EBHelmholtzOpFactory::findAmrLevel(const ProblemDomain& a_domain) const
 {
@@ -455,7 +455,10 @@ MFHelmholtzJumpBC::defineIterators()
       const EBGraph&   ebgraph  = ebisbox.getEBGraph();
       const IntVectSet allIrreg = ebisbox.getIrregIVS(box);
 
-      m_ivs[din] = m_mflg.interfaceRegion(dbl[din], din);
+      // Single-phase problems have no interface cells, so don't bother computing the interface region.
+      if (m_multiPhase) {
+        m_ivs[din] = m_mflg.interfaceRegion(dbl[din], din);
+      }
 
       IntVectSet singlePhaseCells = allIrreg;
       IntVectSet multiPhaseCells  = IntVectSet();
@@ -551,7 +554,7 @@ MFHelmholtzJumpBC::matchBC(LevelData<BaseIVFAB<Real>>& a_jump,
   }
 }
 
-inline void
+void
 MFHelmholtzJumpBC::matchBC(BaseIVFAB<Real>& a_jump,
                            const MFCellFAB& a_phi,
                            const bool       a_homogeneousPhysBC,
@@ -576,6 +579,11 @@ MFHelmholtzJumpBC::matchBC(BaseIVFAB<Real>& a_jump,
   //       this term has already been multiplied into the stencil weights, which is the reason why we only do the stencil apply below (without dividing
   //       by the above factor).
 
+  // Patches without any interface cells have nothing to match.
+  if (m_ivs[a_dit].isEmpty()) {
+    return;
+  }
+
   CH_START(t1);
   constexpr int vofComp     = 0;
   constexpr int firstPhase  = 0;
@@ -71,7 +71,8 @@ MFHelmholtzOp::MFHelmholtzOp(const Location::Cell                             a_
   m_multifluid   = m_numPhases > 1;
   m_hasMGObjects = a_hasMGObjects;
   m_refToCoar    = a_refToCoar;
-  m_smoother     = a_relaxType;
+  m_smoother        = a_relaxType;
+  m_smoothingFactor = 1.0;
   m_hasCoar      = a_hasCoar;
   m_hasFine      = a_hasFine;
   m_Acoef        = a_Acoef;
@@ -202,6 +203,29 @@ MFHelmholtzOp::MFHelmholtzOp(const Location::Cell                             a_
 
     m_helmOps.insert({iphase, oper});
   }
+
+  // Find the phases that have cells in each grid patch. Patches that are entirely covered by one of the phases are
+  // only relaxed on the other phase.
+  const DisjointBoxLayout& dbl = m_mflg.getGrids();
+  const DataIterator&      dit = dbl.dataIterator();
+
+  m_activePhases.define(dbl);
+
+  const int nbox = dit.size();
+
+#pragma omp parallel for schedule(runtime)
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex& din = dit[mybox];
+
+    for (const auto& op : m_helmOps) {
+      const int      iphase  = op.first;
+      const EBISBox& ebisBox = m_mflg.getEBLevelGrid(iphase).getEBISL()[din];
+
+      if (!(ebisBox.isAllCovered())) {
+        m_activePhases[din].emplace_back(iphase);
+      }
+    }
+  }
 }
 
 MFHelmholtzOp::~MFHelmholtzOp()
@@ -416,69 +440,122 @@ MFHelmholtzOp::dotProduct(const LevelData<MFCellFAB>& a_lhs, const LevelData<MFC
 {
   CH_TIME("MFHelmholtzOp::dotProduct)");
 
-  Real sumKappaXY = 0.0;
-  Real sumVolume  = 0.0;
+  Vector<Real>         dotProd;
+  ParallelOps::Request request;
 
-  const DisjointBoxLayout& dbl  = a_lhs.disjointBoxLayout();
+  this->dotProductsBegin(dotProd, request, {&a_lhs}, {&a_rhs});
+  this->dotProductsEnd(dotProd, request);
+
+  return dotProd[0];
+}
+
+void
+MFHelmholtzOp::dotProductsBegin(Vector<Real>&                                   a_dotProducts,
+                                ParallelOps::Request&                           a_request,
+                                const std::vector<const LevelData<MFCellFAB>*>& a_lhs,
+                                const std::vector<const LevelData<MFCellFAB>*>& a_rhs) const noexcept
+{
+  CH_TIME("MFHelmholtzOp::dotProductsBegin");
+
+  CH_assert(a_lhs.size() == a_rhs.size());
+  CH_assert(a_lhs.size() > 0);
+
+  // TLDR: The dot products are volume-weighted averages, so we compute the sums of kappa*x*y for each product and the total
+  //       volume in the last slot of the buffer. All of it goes into the same reduction.
+  const int numProducts = a_lhs.size();
+
+  a_dotProducts.resize(numProducts + 1);
+  for (int k = 0; k <= numProducts; k++) {
+    a_dotProducts[k] = 0.0;
+  }
+
+  const DisjointBoxLayout& dbl  = a_lhs[0]->disjointBoxLayout();
   const DataIterator&      dit  = dbl.dataIterator();
   const int                nbox = dit.size();
 
-#pragma omp parallel for schedule(runtime) reduction(+ : sumKappaXY, sumVolume)
-  for (int mybox = 0; mybox < nbox; mybox++) {
-    const DataIndex& din     = dit[mybox];
-    const Box        cellBox = dbl[din];
-    const MFCellFAB& lhs     = a_lhs[din];
+#pragma omp parallel
+  {
+    Vector<Real> localSums(numProducts + 1, 0.0);
 
-    for (int i = 0; i < lhs.numPhases(); i++) {
-      const EBCellFAB& X = a_lhs[din].getPhase(i);
-      const EBCellFAB& Y = a_rhs[din].getPhase(i);
+#pragma omp for schedule(runtime)
+    for (int mybox = 0; mybox < nbox; mybox++) {
+      const DataIndex& din     = dit[mybox];
+      const Box        cellBox = dbl[din];
 
-      const FArrayBox& regX = X.getFArrayBox();
-      const FArrayBox& regY = Y.getFArrayBox();
+      for (int i = 0; i < (*a_lhs[0])[din].numPhases(); i++) {
+        const EBISBox& ebisbox = (*a_lhs[0])[din].getPhase(i).getEBISBox();
+        const EBGraph& ebgraph = ebisbox.getEBGraph();
 
-      const EBISBox& ebisbox = X.getEBISBox();
-      const EBGraph& ebgraph = ebisbox.getEBGraph();
+        for (int k = 0; k < numProducts; k++) {
+          const EBCellFAB& X = (*a_lhs[k])[din].getPhase(i);
+          const EBCellFAB& Y = (*a_rhs[k])[din].getPhase(i);
 
-      auto regularKernel = [&](const IntVect& iv) -> void {
-        if (ebisbox.isRegular(iv)) {
-          sumKappaXY += regX(iv, 0) * regY(iv, 0);
-          sumVolume += 1.0;
-        }
-      };
+          const FArrayBox& regX = X.getFArrayBox();
+          const FArrayBox& regY = Y.getFArrayBox();
 
-      auto irregularKernel = [&](const VolIndex& vof) -> void {
-        const Real kappa = ebisbox.volFrac(vof);
+          // Only count the volume once.
+          const Real volumeWeight = (k == 0) ? 1.0 : 0.0;
 
-        sumKappaXY += (kappa * X(vof, 0)) * (kappa * Y(vof, 0));
-        sumVolume += kappa;
-      };
+          Real& sumKappaXY = localSums[k];
+          Real& sumVolume  = localSums[numProducts];
 
-      const bool isCovered   = ebisbox.isAllCovered();
-      const bool isRegular   = ebisbox.isAllRegular();
-      const bool isIrregular = !isCovered && !isRegular;
+          auto regularKernel = [&](const IntVect& iv) -> void {
+            if (ebisbox.isRegular(iv)) {
+              sumKappaXY += regX(iv, 0) * regY(iv, 0);
+              sumVolume += volumeWeight;
+            }
+          };
 
-      if (isIrregular) {
-        VoFIterator vofit(ebisbox.getIrregIVS(cellBox), ebgraph);
+          auto irregularKernel = [&](const VolIndex& vof) -> void {
+            const Real kappa = ebisbox.volFrac(vof);
 
-        BoxLoops::loop(cellBox, regularKernel);
-        BoxLoops::loop(vofit, irregularKernel);
+            sumKappaXY += (kappa * X(vof, 0)) * (kappa * Y(vof, 0));
+            sumVolume += volumeWeight * kappa;
+          };
+
+          const bool isCovered   = ebisbox.isAllCovered();
+          const bool isRegular   = ebisbox.isAllRegular();
+          const bool isIrregular = !isCovered && !isRegular;
+
+          if (isIrregular) {
+            VoFIterator vofit(ebisbox.getIrregIVS(cellBox), ebgraph);
+
+            BoxLoops::loop(cellBox, regularKernel);
+            BoxLoops::loop(vofit, irregularKernel);
+          }
+          else if (isCovered) {
+            BoxLoops::loop(cellBox, regularKernel);
+          }
+        }
       }
-      else if (isCovered) {
-        BoxLoops::loop(cellBox, regularKernel);
+    }
+
+#pragma omp critical
+    {
+      for (int k = 0; k <= numProducts; k++) {
+        a_dotProducts[k] += localSums[k];
       }
     }
   }
 
-  sumKappaXY = ParallelOps::sum(sumKappaXY);
-  sumVolume  = ParallelOps::sum(sumVolume);
+  ParallelOps::vectorSumBegin(a_dotProducts, a_request);
+}
+
+void
+MFHelmholtzOp::dotProductsEnd(Vector<Real>& a_dotProducts, ParallelOps::Request& a_request) const noexcept
+{
+  CH_TIME("MFHelmholtzOp::dotProductsEnd");
+
+  ParallelOps::vectorSumEnd(a_request);
 
-  Real dotProd = 0.0;
+  const int  numProducts = a_dotProducts.size() - 1;
+  const Real sumVolume   = a_dotProducts[numProducts];
 
-  if (sumVolume > 0.0) {
-    dotProd = sumKappaXY / sumVolume;
+  for (int k = 0; k < numProducts; k++) {
+    a_dotProducts[k] = (sumVolume > 0.0) ? a_dotProducts[k] / sumVolume : 0.0;
   }
 
-  return dotProd;
+  a_dotProducts.resize(numProducts);
 }
 
 void
@@ -569,11 +646,12 @@ MFHelmholtzOp::applyOp(LevelData<MFCellFAB>&             a_Lphi,
 {
   CH_TIME("MFHelmholtzOp::applyOp");
 
+  this->startTelemetryEvent("apply");
+
   // We need updated ghost cells since both the operator stencil and the "jump" stencil
-  // reach into ghost regions.
+  // reach into ghost regions. The jump BC is matched on each patch below.
   this->exchangeGhost(a_phi);
   this->interpolateCF(a_phi, a_phiCoar, a_homogeneousCFBC);
-  this->updateJumpBC(a_phi, a_homogeneousPhysBC);
 
   // Now apply the operator on each patch.
   const DisjointBoxLayout& dbl = m_mflg.getGrids();
@@ -587,6 +665,11 @@ MFHelmholtzOp::applyOp(LevelData<MFCellFAB>&             a_Lphi,
 
     const Box cellBox = dbl[din];
 
+    // Match the jump BC on this patch. This only uses data in this patch so it can be done together with the operator.
+    if (m_multifluid) {
+      m_jumpBC->matchBC((*m_jump)[din], a_phi[din], a_homogeneousPhysBC, din);
+    }
+
     for (auto& op : m_helmOps) {
       const int iphase = op.first;
 
@@ -601,6 +684,8 @@ MFHelmholtzOp::applyOp(LevelData<MFCellFAB>&             a_Lphi,
       op.second->applyOp(Lph, phi, Acoef, Bcoef, BcoefIrreg, cellBox, din, a_homogeneousPhysBC);
     }
   }
+
+  this->stopTelemetryEvent("apply");
 }
 
 void
@@ -695,7 +780,9 @@ MFHelmholtzOp::updateJumpBC(const LevelData<MFCellFAB>& a_phi, const bool a_homo
 {
   CH_TIME("MFHelmholtzOp::updateJumpBC");
 
-  m_jumpBC->matchBC(*m_jump, a_phi, a_homogeneousPhysBC);
+  if (m_multifluid) {
+    m_jumpBC->matchBC(*m_jump, a_phi, a_homogeneousPhysBC);
+  }
 }
 
 void
@@ -709,7 +796,28 @@ MFHelmholtzOp::exchangeGhost(const LevelData<MFCellFAB>& a_phi) const
 
   LevelData<MFCellFAB>& phi = (LevelData<MFCellFAB>&)a_phi;
 
+  this->startTelemetryEvent("exchange");
   phi.exchange(m_exchangeCopier);
+  this->stopTelemetryEvent("exchange");
+}
+
+void
+MFHelmholtzOp::setSmoothingFactor(const Real a_factor) noexcept
+{
+  CH_TIME("MFHelmholtzOp::setSmoothingFactor");
+
+  CH_assert(a_factor > 0.0);
+
+  m_smoothingFactor = a_factor;
+}
+
+void
+MFHelmholtzOp::setTelemetry(const RefCountedPtr<Timer>& a_timer, const std::string a_level) noexcept
+{
+  CH_TIME("MFHelmholtzOp::setTelemetry");
+
+  m_telemetryTimer = a_timer;
+  m_telemetryLevel = a_level;
 }
 
 void
@@ -717,7 +825,13 @@ MFHelmholtzOp::relax(LevelData<MFCellFAB>& a_correction, const LevelData<MFCellF
 {
   CH_TIME("MFHelmholtzOp::relax");
 
-  // This function performs relaxation. The user can switch between various kernels.
+  // This function performs relaxation. The user can switch between various kernels. On deep multigrid levels the number
+  // of relaxations can be scaled up.
+  if (m_smoothingFactor != 1.0 && a_iterations > 0) {
+    a_iterations = std::max(1, (int)std::lround(a_iterations * m_smoothingFactor));
+  }
+
+  this->startTelemetryEvent("smooth");
 
   switch (m_smoother) {
   case Smoother::PointJacobi: {
@@ -741,6 +855,8 @@ MFHelmholtzOp::relax(LevelData<MFCellFAB>& a_correction, const LevelData<MFCellF
     break;
   }
   };
+
+  this->stopTelemetryEvent("smooth");
 }
 
 void
@@ -766,10 +882,9 @@ MFHelmholtzOp::relaxPointJacobi(LevelData<MFCellFAB>&       a_correction,
 
   for (int i = 0; i < a_iterations; i++) {
 
-    // Fill/interpolate ghost cells and match the BC.
+    // Fill/interpolate ghost cells. The jump BC is matched on each patch below.
     this->exchangeGhost(a_correction);
     this->interpolateCF(a_correction, nullptr, homogeneousCFBC);
-    this->updateJumpBC(a_correction, homogeneousPhysBC);
 
     // Do relaxation on each patch.
 #pragma omp parallel for schedule(runtime)
@@ -778,8 +893,13 @@ MFHelmholtzOp::relaxPointJacobi(LevelData<MFCellFAB>&       a_correction,
 
       const Box cellBox = dbl[din];
 
-      for (auto& op : m_helmOps) {
-        const int iphase = op.first;
+      // Match the jump BC on this patch and relax the phases that have cells in this patch.
+      if (m_multifluid) {
+        m_jumpBC->matchBC((*m_jump)[din], a_correction[din], homogeneousPhysBC, din);
+      }
+
+      for (const int iphase : m_activePhases[din]) {
+        const RefCountedPtr<EBHelmholtzOp>& op = m_helmOps.at(iphase);
 
         EBCellFAB&       Lph = Lcorr[din].getPhase(iphase);
         EBCellFAB&       phi = a_correction[din].getPhase(iphase);
@@ -789,7 +909,7 @@ MFHelmholtzOp::relaxPointJacobi(LevelData<MFCellFAB>&       a_correction,
         const EBFluxFAB&       Bcoef      = (*m_Bcoef)[din].getPhase(iphase);
         const BaseIVFAB<Real>& BcoefIrreg = *(*m_BcoefIrreg)[din].getPhasePtr(iphase);
 
-        op.second->pointJacobiKernel(Lph, phi, res, Acoef, Bcoef, BcoefIrreg, cellBox, din);
+        op->pointJacobiKernel(Lph, phi, res, Acoef, Bcoef, BcoefIrreg, cellBox, din);
       }
     }
   }
@@ -821,10 +941,9 @@ MFHelmholtzOp::relaxGSRedBlack(LevelData<MFCellFAB>&       a_correction,
   for (int i = 0; i < a_iterations; i++) {
     for (int redBlack = 0; redBlack <= 1; redBlack++) {
 
-      // Fill/interpolate ghost cells and match the BC.
+      // Fill/interpolate ghost cells. The jump BC is matched on each patch below.
       this->exchangeGhost(a_correction);
       this->interpolateCF(a_correction, nullptr, homogeneousCFBC);
-      this->updateJumpBC(a_correction, homogeneousPhysBC);
 
       // Do relaxation on each patch.
 #pragma omp parallel for schedule(runtime)
@@ -832,8 +951,13 @@ MFHelmholtzOp::relaxGSRedBlack(LevelData<MFCellFAB>&       a_correction,
         const DataIndex& din     = dit[mybox];
         const Box        cellBox = dbl[din];
 
-        for (auto& op : m_helmOps) {
-          const int iphase = op.first;
+        // Match the jump BC on this patch and relax the phases that have cells in this patch.
+        if (m_multifluid) {
+          m_jumpBC->matchBC((*m_jump)[din], a_correction[din], homogeneousPhysBC, din);
+        }
+
+        for (const int iphase : m_activePhases[din]) {
+          const RefCountedPtr<EBHelmholtzOp>& op = m_helmOps.at(iphase);
 
           EBCellFAB&       Lph = Lcorr[din].getPhase(iphase);
           EBCellFAB&       phi = a_correction[din].getPhase(iphase);
@@ -843,7 +967,7 @@ MFHelmholtzOp::relaxGSRedBlack(LevelData<MFCellFAB>&       a_correction,
           const EBFluxFAB&       Bcoef      = (*m_Bcoef)[din].getPhase(iphase);
           const BaseIVFAB<Real>& BcoefIrreg = *(*m_BcoefIrreg)[din].getPhasePtr(iphase);
 
-          op.second->gauSaiRedBlackKernel(Lph, phi, res, Acoef, Bcoef, BcoefIrreg, cellBox, din, redBlack);
+          op->gauSaiRedBlackKernel(Lph, phi, res, Acoef, Bcoef, BcoefIrreg, cellBox, din, redBlack);
         }
       }
     }
@@ -878,10 +1002,9 @@ MFHelmholtzOp::relaxGSMultiColor(LevelData<MFCellFAB>&       a_correction,
 
     for (int icolor = 0; icolor < m_colors.size(); icolor++) {
 
-      // Fill/interpolate ghost cells and match the BC.
+      // Fill/interpolate ghost cells. The jump BC is matched on each patch below.
       this->exchangeGhost(a_correction);
       this->interpolateCF(a_correction, nullptr, homogeneousCFBC);
-      this->updateJumpBC(a_correction, homogeneousPhysBC);
 
       // Do relaxation on each patch
 #pragma omp parallel for schedule(runtime)
@@ -890,8 +1013,13 @@ MFHelmholtzOp::relaxGSMultiColor(LevelData<MFCellFAB>&       a_correction,
 
         const Box cellBox = dbl[din];
 
-        for (auto& op : m_helmOps) {
-          const int iphase = op.first;
+        // Match the jump BC on this patch and relax the phases that have cells in this patch.
+        if (m_multifluid) {
+          m_jumpBC->matchBC((*m_jump)[din], a_correction[din], homogeneousPhysBC, din);
+        }
+
+        for (const int iphase : m_activePhases[din]) {
+          const RefCountedPtr<EBHelmholtzOp>& op = m_helmOps.at(iphase);
 
           EBCellFAB&       Lph = Lcorr[din].getPhase(iphase);
           EBCellFAB&       phi = a_correction[din].getPhase(iphase);
@@ -901,7 +1029,7 @@ MFHelmholtzOp::relaxGSMultiColor(LevelData<MFCellFAB>&       a_correction,
           const EBFluxFAB&       Bcoef      = (*m_Bcoef)[din].getPhase(iphase);
           const BaseIVFAB<Real>& BcoefIrreg = *(*m_BcoefIrreg)[din].getPhasePtr(iphase);
 
-          op.second->gauSaiMultiColorKernel(Lph, phi, res, Acoef, Bcoef, BcoefIrreg, cellBox, din, m_colors[icolor]);
+          op->gauSaiMultiColorKernel(Lph, phi, res, Acoef, Bcoef, BcoefIrreg, cellBox, din, m_colors[icolor]);
         }
       }
     }
@@ -917,6 +1045,8 @@ MFHelmholtzOp::restrictResidual(LevelData<MFCellFAB>&       a_resCoar,
 
   constexpr bool homogeneousPhysBC = true;
 
+  this->startTelemetryEvent("restrict");
+
   // EBHelmholtzOp::restrictResidual will call applyOp so we need to update the boundary condition
   // on multiphase cells first.
   this->exchangeGhost(a_phi);
@@ -933,6 +1063,8 @@ MFHelmholtzOp::restrictResidual(LevelData<MFCellFAB>&       a_resCoar,
 
     op.second->restrictResidual(resCoar, phi, rhs);
   }
+
+  this->stopTelemetryEvent("restrict");
 }
 
 void
@@ -940,6 +1072,8 @@ MFHelmholtzOp::prolongIncrement(LevelData<MFCellFAB>& a_phi, const LevelData<MFC
 {
   CH_TIME("MFHelmholtzOp::prolongIncrement");
 
+  this->startTelemetryEvent("prolong");
+
   for (auto& op : m_helmOps) {
     LevelData<EBCellFAB> phi;
     LevelData<EBCellFAB> correctCoarse;
@@ -949,6 +1083,8 @@ MFHelmholtzOp::prolongIncrement(LevelData<MFCellFAB>& a_phi, const LevelData<MFC
 
     op.second->prolongIncrement(phi, correctCoarse);
   }
+
+  this->stopTelemetryEvent("prolong");
 }
 
 void
@@ -51,7 +51,8 @@ MFHelmholtzOpFactory::MFHelmholtzOpFactory(const MFIS&             a_mfis,
                                            const int&              a_jumpOrder,
                                            const int&              a_jumpWeight,
                                            const int&              a_blockingFactor,
-                                           const AmrLevelGrids&    a_deeperLevelGrids)
+                                           const AmrLevelGrids&    a_deeperLevelGrids,
+                                           const LevelCache&       a_levelCache)
 {
   CH_TIME("MFHelmholtzOpFactory::MFHelmholtzOpFactory()");
 
@@ -89,9 +90,16 @@ MFHelmholtzOpFactory::MFHelmholtzOpFactory(const MFIS&             a_mfis,
   m_mgBlockingFactor = a_blockingFactor;
 
   m_deeperLevelGrids = a_deeperLevelGrids;
+  m_levelCache       = a_levelCache;
 
   m_numAmrLevels = m_amrLevelGrids.size();
 
+  m_agglomerationCells = 0;
+  m_smoothingGrowth    = 1.0;
+
+  ParmParse pp("MFHelmholtzOpFactory");
+  pp.query("agglomerate_cells", m_agglomerationCells);
+
   // Asking multigrid to do the bottom solve at a refined AMR level is classified as bad input.
   if (this->isFiner(m_bottomDomain, m_amrLevelGrids[0].getDomain())) {
     MayDay::Abort("MFHelmholtzOpFactory -- bottomsolver domain can't be larger than the base AMR domain!");
@@ -486,13 +494,57 @@ MFHelmholtzOpFactory::coarsenCoefficients(LevelData<MFCellFAB>&         a_coarAc
   }
 }
 
+int
+MFHelmholtzOpFactory::getNumAgglomeratedRanks(const ProblemDomain& a_coarDomain) const noexcept
+{
+  CH_TIME("MFHelmholtzOpFactory::getNumAgglomeratedRanks");
+
+  // TLDR: Deep multigrid levels have few cells. If we spread them over all ranks every rank takes part in every exchange even
+  //       though there is hardly any work to do. Distribute them over the lowest ranks instead, which are usually on the same node,
+  //       and leave the rest of the ranks without boxes.
+  int numRanks = numProc();
+
+  if (m_agglomerationCells > 0) {
+    const long long numCells = a_coarDomain.domainBox().numPts();
+
+    numRanks = (int)std::max(1LL, std::min((long long)numProc(), numCells / (long long)m_agglomerationCells));
+  }
+
+  return numRanks;
+}
+
 bool
 MFHelmholtzOpFactory::getCoarserLayout(MFLevelGrid&       a_coarMflg,
                                        const MFLevelGrid& a_fineMflg,
                                        const int          a_refRat,
                                        const int          a_blockingFactor) const
 {
-  CH_TIME("MFHelmholtzOpFactory::getCoarserLayout(MFLevelGrid, MFLevelGrid, int, int)");
+  CH_TIME("MFHelmholtzOpFactory::getCoarserLayout");
+
+  if (m_levelCache.isNull()) {
+    return this->buildCoarserLayout(a_coarMflg, a_fineMflg, a_refRat, a_blockingFactor);
+  }
+
+  auto builder = [&](MFLevelGrid& a_coarGrid) -> bool {
+    return this->buildCoarserLayout(a_coarGrid, a_fineMflg, a_refRat, a_blockingFactor);
+  };
+
+  return m_levelCache->getCoarsening(a_coarMflg,
+                                     a_fineMflg,
+                                     a_refRat,
+                                     a_blockingFactor,
+                                     m_ghostPhi.max(),
+                                     m_agglomerationCells,
+                                     builder);
+}
+
+bool
+MFHelmholtzOpFactory::buildCoarserLayout(MFLevelGrid&       a_coarMflg,
+                                         const MFLevelGrid& a_fineMflg,
+                                         const int          a_refRat,
+                                         const int          a_blockingFactor) const
+{
+  CH_TIME("MFHelmholtzOpFactory::buildCoarserLayout(MFLevelGrid, MFLevelGrid, int, int)");
 
   CH_assert(a_blockingFactor % 2 == 0);
   CH_assert(a_blockingFactor >= 2);
@@ -531,7 +583,7 @@ MFHelmholtzOpFactory::getCoarserLayout(MFLevelGrid&       a_coarMflg,
 
           domainSplit(coarDomain, boxes, block);
           mortonOrdering(boxes);
-          LoadBalance(procs, boxes);
+          LoadBalance(procs, boxes, this->getNumAgglomeratedRanks(coarDomain));
 
           coarDbl.define(boxes, procs, coarDomain);
 
@@ -559,6 +611,24 @@ MFHelmholtzOpFactory::getCoarserLayout(MFLevelGrid&       a_coarMflg,
   return hasCoarser;
 }
 
+void
+MFHelmholtzOpFactory::setSmoothingGrowth(const Real a_growth) noexcept
+{
+  CH_TIME("MFHelmholtzOpFactory::setSmoothingGrowth");
+
+  CH_assert(a_growth > 0.0);
+
+  m_smoothingGrowth = a_growth;
+}
+
+void
+MFHelmholtzOpFactory::setTelemetry(const RefCountedPtr<Timer>& a_timer) noexcept
+{
+  CH_TIME("MFHelmholtzOpFactory::setTelemetry");
+
+  m_telemetryTimer = a_timer;
+}
+
 MFHelmholtzOp*
 MFHelmholtzOpFactory::MGnewOp(const ProblemDomain& a_fineDomain, int a_depth, bool a_homogeneousOnly)
 {
@@ -696,6 +766,16 @@ MFHelmholtzOpFactory::MGnewOp(const ProblemDomain& a_fineDomain, int a_depth, bo
                              m_smoother);
 
     mgOp->setJump(jump);
+
+    if (a_depth > 0 && m_smoothingGrowth != 1.0) {
+      mgOp->setSmoothingFactor(std::pow(m_smoothingGrowth, a_depth));
+    }
+
+    if (!m_telemetryTimer.isNull()) {
+      const bool isBottom = (amrLevel == 0) && !hasMGObjects;
+
+      mgOp->setTelemetry(m_telemetryTimer, MultigridTelemetry::getLevelName(amrLevel, a_depth, isBottom));
+    }
   }
 
   return mgOp;
@@ -780,6 +860,10 @@ MFHelmholtzOpFactory::AMRnewOp(const ProblemDomain& a_domain)
   // Give the operator access by reference to the jump data.
   op->setJump(m_amrJump[amrLevel]);
 
+  if (!m_telemetryTimer.isNull()) {
+    op->setTelemetry(m_telemetryTimer, MultigridTelemetry::getLevelName(amrLevel, 0, false));
+  }
+
   return op;
 }
 
@@ -0,0 +1,233 @@
+/* chombo-discharge
+ * Copyright © 2026 SINTEF Energy Research.
+ * Please refer to Copyright.txt and LICENSE in the chombo-discharge root directory.
+ */
+
+/*!
+  @file   CD_MFPipelinedBiCGStabSolver.cpp
+  @brief  Implementation of CD_MFPipelinedBiCGStabSolver.H
+  @author Robert Marskar
+*/
+
+// Chombo includes
+#include <CH_Timer.H>
+
+// Our includes
+#include <CD_MFPipelinedBiCGStabSolver.H>
+#include <CD_ParallelOps.H>
+#include <CD_NamespaceHeader.H>
+
+MFPipelinedBiCGStabSolver::MFPipelinedBiCGStabSolver() noexcept
+{
+  m_op          = nullptr;
+  m_homogeneous = false;
+  m_imax        = 80;
+  m_numRestarts = 5;
+  m_verbosity   = 0;
+  m_eps         = 1.E-6;
+  m_small       = 1.E-30;
+}
+
+MFPipelinedBiCGStabSolver::~MFPipelinedBiCGStabSolver() noexcept
+{}
+
+void
+MFPipelinedBiCGStabSolver::setHomogeneous(bool a_homogeneous)
+{
+  m_homogeneous = a_homogeneous;
+}
+
+void
+MFPipelinedBiCGStabSolver::define(LinearOp<LevelData<MFCellFAB>>* a_operator, bool a_homogeneous)
+{
+  CH_TIME("MFPipelinedBiCGStabSolver::define");
+
+  m_op = dynamic_cast<MFHelmholtzOp*>(a_operator);
+
+  if (m_op == nullptr) {
+    MayDay::Error("MFPipelinedBiCGStabSolver::define -- operator must be an MFHelmholtzOp");
+  }
+
+  m_homogeneous = a_homogeneous;
+}
+
+void
+MFPipelinedBiCGStabSolver::applyPreconditionedOp(LevelData<MFCellFAB>&       a_Lphi,
+                                                 const LevelData<MFCellFAB>& a_phi,
+                                                 LevelData<MFCellFAB>&       a_scratch) noexcept
+{
+  CH_TIME("MFPipelinedBiCGStabSolver::applyPreconditionedOp");
+
+  m_op->setToZero(a_scratch);
+  m_op->preCond(a_scratch, a_phi);
+  m_op->applyOp(a_Lphi, a_scratch, true);
+}
+
+void
+MFPipelinedBiCGStabSolver::solve(LevelData<MFCellFAB>& a_phi, const LevelData<MFCellFAB>& a_rhs)
+{
+  CH_TIME("MFPipelinedBiCGStabSolver::solve");
+
+  CH_assert(m_op != nullptr);
+
+  // TLDR: Vector names follow Cools and Vanroose. With A' = A*M^(-1) the recurrences maintain s = A'p, w = A'r, z = A's,
+  //       t = A'w, y = A'q, and v = A'z. The solution update is accumulated in u and x = x0 + M^(-1)u is computed when we
+  //       restart or exit.
+  LevelData<MFCellFAB> r;
+  LevelData<MFCellFAB> rhat;
+  LevelData<MFCellFAB> w;
+  LevelData<MFCellFAB> t;
+  LevelData<MFCellFAB> p;
+  LevelData<MFCellFAB> s;
+  LevelData<MFCellFAB> z;
+  LevelData<MFCellFAB> q;
+  LevelData<MFCellFAB> y;
+  LevelData<MFCellFAB> v;
+  LevelData<MFCellFAB> u;
+  LevelData<MFCellFAB> scratch;
+
+  m_op->create(r, a_rhs);
+  m_op->create(rhat, a_rhs);
+  m_op->create(w, a_rhs);
+  m_op->create(t, a_rhs);
+  m_op->create(p, a_rhs);
+  m_op->create(s, a_rhs);
+  m_op->create(z, a_rhs);
+  m_op->create(q, a_rhs);
+  m_op->create(y, a_rhs);
+  m_op->create(v, a_rhs);
+  m_op->create(u, a_rhs);
+  m_op->create(scratch, a_phi);
+
+  Vector<Real>          dots;
+  ParallelOps::Request request;
+
+  Real initialNorm = 0.0;
+  Real residNorm   = 0.0;
+
+  int  iter      = 0;
+  int  restarts  = 0;
+  bool converged = false;
+
+  while (!converged && iter < m_imax && restarts <= m_numRestarts) {
+
+    // Start from the true residual.
+    m_op->residual(r, a_phi, a_rhs, m_homogeneous);
+    m_op->assign(rhat, r);
+    m_op->setToZero(u);
+    m_op->setToZero(p);
+    m_op->setToZero(s);
+    m_op->setToZero(z);
+    m_op->setToZero(v);
+
+    this->applyPreconditionedOp(w, r, scratch);
+
+    m_op->dotProductsBegin(dots, request, {&rhat, &rhat, &r}, {&r, &w, &r});
+    this->applyPreconditionedOp(t, w, scratch);
+    m_op->dotProductsEnd(dots, request);
+
+    Real rho   = dots[0];
+    Real alpha = (std::abs(dots[1]) > m_small) ? rho / dots[1] : 0.0;
+    Real beta  = 0.0;
+    Real omega = 0.0;
+
+    residNorm = sqrt(std::abs(dots[2]));
+    if (restarts == 0) {
+      initialNorm = residNorm;
+    }
+
+    if (m_verbosity > 4) {
+      pout() << "      MFPipelinedBiCGStabSolver:: restart = " << restarts << ", relative residual = "
+             << ((initialNorm > 0.0) ? residNorm / initialNorm : 0.0) << endl;
+    }
+
+    converged = (residNorm <= m_eps * initialNorm);
+
+    while (!converged && iter < m_imax) {
+      iter++;
+
+      // p = r + beta*(p - omega*s), and similarly for s and z.
+      m_op->incr(p, s, -omega);
+      m_op->scale(p, beta);
+      m_op->incr(p, r, 1.0);
+
+      m_op->incr(s, z, -omega);
+      m_op->scale(s, beta);
+      m_op->incr(s, w, 1.0);
+
+      m_op->incr(z, v, -omega);
+      m_op->scale(z, beta);
+      m_op->incr(z, t, 1.0);
+
+      m_op->axby(q, r, s, 1.0, -alpha);
+      m_op->axby(y, w, z, 1.0, -alpha);
+
+      // First fused reduction, overlapped with v = A'z.
+      m_op->dotProductsBegin(dots, request, {&q, &y}, {&y, &y});
+      this->applyPreconditionedOp(v, z, scratch);
+      m_op->dotProductsEnd(dots, request);
+
+      if (std::abs(dots[1]) <= m_small) {
+        m_op->incr(u, p, alpha);
+
+        break;
+      }
+
+      omega = dots[0] / dots[1];
+
+      m_op->incr(u, p, alpha);
+      m_op->incr(u, q, omega);
+
+      m_op->axby(r, q, y, 1.0, -omega);
+      m_op->axby(w, y, t, 1.0, -omega);
+      m_op->incr(w, v, omega * alpha);
+
+      // Second fused reduction, overlapped with t = A'w.
+      m_op->dotProductsBegin(dots, request, {&rhat, &rhat, &rhat, &rhat, &r}, {&r, &w, &s, &z, &r});
+      this->applyPreconditionedOp(t, w, scratch);
+      m_op->dotProductsEnd(dots, request);
+
+      residNorm = sqrt(std::abs(dots[4]));
+      converged = (residNorm <= m_eps * initialNorm);
+
+      if (m_verbosity > 4) {
+        pout() << "      MFPipelinedBiCGStabSolver:: iteration = " << iter
+               << ", relative residual = " << residNorm / initialNorm << endl;
+      }
+
+      if (converged) {
+        break;
+      }
+
+      // Breakdown checks. If the recurrences break down we restart from the current solution.
+      const Real rhoNew = dots[0];
+      if (std::abs(rhoNew) <= m_small || std::abs(omega) <= m_small) {
+        break;
+      }
+
+      beta = (alpha / omega) * (rhoNew / rho);
+
+      const Real denom = dots[1] + beta * dots[2] - beta * omega * dots[3];
+      if (std::abs(denom) <= m_small) {
+        break;
+      }
+
+      alpha = rhoNew / denom;
+      rho   = rhoNew;
+    }
+
+    // Fold the update into the solution, x = x + M^(-1)u.
+    m_op->setToZero(scratch);
+    m_op->preCond(scratch, u);
+    m_op->incr(a_phi, scratch, 1.0);
+
+    restarts++;
+  }
+
+  if (m_verbosity > 4) {
+    pout() << "      MFPipelinedBiCGStabSolver:: iterations = " << iter << ", restarts = " << restarts - 1
+           << ", converged = " << converged << endl;
+  }
+}
+
+#include <CD_NamespaceFooter.H>
@@ -0,0 +1,181 @@
+/* chombo-discharge
+ * Copyright © 2026 SINTEF Energy Research.
+ * Please refer to Copyright.txt and LICENSE in the chombo-discharge root directory.
+ */
+
+/*!
+  @file   CD_MultigridTelemetry.cpp
+  @brief  Implementation of CD_MultigridTelemetry.H
+  @author Robert Marskar
+*/
+
+// Std includes
+#include <fstream>
+
+// Chombo includes
+#include <SPMD.H>
+#include <CH_Timer.H>
+
+// Our includes
+#include <CD_MultigridTelemetry.H>
+#include <CD_NamespaceHeader.H>
+
+const std::string MultigridTelemetry::s_solveEvent = "solve";
+
+MultigridTelemetry::MultigridTelemetry() noexcept
+{
+  m_solverName = "MultigridTelemetry";
+  m_timer      = RefCountedPtr<Timer>(new Timer(m_solverName));
+  m_numSolves  = 0;
+  m_time       = 0.0;
+  m_solveTime  = 0.0;
+  m_converged  = false;
+
+  m_residualHistory.resize(0);
+  m_events.resize(0);
+}
+
+MultigridTelemetry::~MultigridTelemetry() noexcept
+{}
+
+std::string
+MultigridTelemetry::getLevelName(const int a_amrLevel, const int a_depth, const bool a_isBottom) noexcept
+{
+  if (a_isBottom) {
+    return "bottom";
+  }
+
+  std::string name = "L" + std::to_string(a_amrLevel);
+
+  if (a_depth > 0) {
+    name += ".mg" + std::to_string(a_depth);
+  }
+
+  return name;
+}
+
+const RefCountedPtr<Timer>&
+MultigridTelemetry::getTimer() const noexcept
+{
+  return m_timer;
+}
+
+void
+MultigridTelemetry::startSolve(const std::string a_solverName, const Real a_time) noexcept
+{
+  CH_TIME("MultigridTelemetry::startSolve");
+
+  m_solverName = a_solverName;
+  m_time       = a_time;
+  m_solveTime  = 0.0;
+  m_converged  = false;
+
+  m_residualHistory.resize(0);
+  m_events.resize(0);
+
+  m_timer->clear();
+  m_timer->startEvent(s_solveEvent);
+}
+
+void
+MultigridTelemetry::addResidual(const Real a_residual) noexcept
+{
+  m_residualHistory.emplace_back(a_residual);
+}
+
+void
+MultigridTelemetry::stopSolve(const bool a_converged) noexcept
+{
+  CH_TIME("MultigridTelemetry::stopSolve");
+
+  m_timer->stopEvent(s_solveEvent);
+
+  m_converged = a_converged;
+  m_events    = m_timer->getFinishedEvents(false);
+
+  // Pull the total time out of the event list.
+  for (auto it = m_events.begin(); it != m_events.end(); ++it) {
+    if (it->first == s_solveEvent) {
+      m_solveTime = it->second;
+
+      m_events.erase(it);
+
+      break;
+    }
+  }
+
+  m_numSolves++;
+}
+
+void
+MultigridTelemetry::writeCSV(const std::string a_fileName) const noexcept
+{
+  CH_TIME("MultigridTelemetry::writeCSV");
+
+#ifdef CH_MPI
+  if (procID() != 0) {
+    return;
+  }
+#endif
+
+  std::ofstream f;
+  f.open(a_fileName, std::ios_base::app);
+
+  if (f.tellp() == 0) {
+    f << "# solver,solve,time,converged,num_residuals,initial_residual,final_residual,solve_time,event,event_time\n";
+  }
+
+  const Real initialResidual = m_residualHistory.size() > 0 ? m_residualHistory.front() : 0.0;
+  const Real finalResidual   = m_residualHistory.size() > 0 ? m_residualHistory.back() : 0.0;
+
+  // The first row is the total solve time, so there is always at least one row per solve.
+  std::vector<std::pair<std::string, Real>> rows;
+
+  rows.emplace_back(s_solveEvent, m_solveTime);
+  rows.insert(rows.end(), m_events.begin(), m_events.end());
+
+  for (const auto& e : rows) {
+    f << m_solverName << "," << m_numSolves << "," << m_time << "," << m_converged << "," << m_residualHistory.size() << ","
+      << initialResidual << "," << finalResidual << "," << m_solveTime << "," << e.first << "," << e.second << "\n";
+  }
+
+  f.close();
+}
+
+int
+MultigridTelemetry::getNumSolves() const noexcept
+{
+  return m_numSolves;
+}
+
+Real
+MultigridTelemetry::getTime() const noexcept
+{
+  return m_time;
+}
+
+Real
+MultigridTelemetry::getSolveTime() const noexcept
+{
+  return m_solveTime;
+}
+
+bool
+MultigridTelemetry::isConverged() const noexcept
+{
+  return m_converged;
+}
+
+const std::vector<Real>&
+MultigridTelemetry::getResidualHistory() const noexcept
+{
+  return m_residualHistory;
+}
+
+const std::vector<std::pair<std::string, Real>>&
+MultigridTelemetry::getEvents() const noexcept
+{
+  return m_events;
+}
+
+#include <CD_NamespaceFooter.H>
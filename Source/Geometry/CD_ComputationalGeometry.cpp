@@ -9,7 +9,17 @@
   @author Robert Marskar
 */
 
+// Std includes
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <sys/stat.h>
+
 // Chombo includes
+#include <ParmParse.H>
+#include <BoxIterator.H>
 #include <MFIndexSpace.H>
 #include <IntersectionIF.H>
 #include <UnionIF.H>
@@ -24,6 +34,7 @@
 #include <CD_NewIntersectionIF.H>
 #include <CD_ScanShop.H>
 #include <CD_MemoryReport.H>
+#include <CD_ParallelOps.H>
 #include <CD_NamespaceHeader.H>
 
 ComputationalGeometry::ComputationalGeometry()
@@ -39,6 +50,9 @@ ComputationalGeometry::ComputationalGeometry()
   m_useScanShop = false;
   m_scanDomain  = ProblemDomain();
 
+  m_cacheDirectory = "";
+  m_profile        = false;
+
   m_multifluidIndexSpace = RefCountedPtr<MultiFluidIndexSpace>(new MultiFluidIndexSpace());
 }
 
@@ -68,6 +82,22 @@ ComputationalGeometry::useChomboShop()
   m_scanDomain  = ProblemDomain();
 }
 
+void
+ComputationalGeometry::useGeometryCache(const std::string a_cacheDirectory)
+{
+  CH_TIME("ComputationalGeometry::useGeometryCache(std::string)");
+
+  m_cacheDirectory = a_cacheDirectory;
+}
+
+void
+ComputationalGeometry::setProfile(const bool a_profile)
+{
+  CH_TIME("ComputationalGeometry::setProfile(bool)");
+
+  m_profile = a_profile;
+}
+
 const Vector<Dielectric>&
 ComputationalGeometry::getDielectrics() const
 {
@@ -169,16 +199,107 @@ ComputationalGeometry::buildGeometries(const ProblemDomain a_finestDomain,
   this->buildGasGeometry(geoServices[phase::gas], a_finestDomain, a_probLo, a_finestDx);
   this->buildSolidGeometry(geoServices[phase::solid], a_finestDomain, a_probLo, a_finestDx);
 
-  // Define the multifluid index space.
+  // Define the multifluid index space. If we use the geometry cache we look for EBIndexSpaces that were generated with
+  // the same geometry and grid settings. If they exist we read them from file, and otherwise we generate them and write
+  // them to the cache.
   const bool useDistributedData = m_useScanShop;
 
-  m_multifluidIndexSpace->define(a_finestDomain.domainBox(), // Define MF
-                                 a_probLo,
-                                 a_finestDx,
-                                 geoServices,
-                                 useDistributedData,
-                                 a_nCellMax,
-                                 a_maxCoarsen);
+  bool readFromCache = false;
+
+#ifdef CH_USE_HDF5
+  std::string gasFile;
+  std::string solidFile;
+
+  if (!(m_cacheDirectory.empty())) {
+    const std::string hash = this->computeGeometryHash(a_finestDomain,
+                                                       a_probLo,
+                                                       a_finestDx,
+                                                       a_nCellMax,
+                                                       a_maxGhostEB,
+                                                       a_maxCoarsen);
+
+    const bool hasSolid = geoServices[phase::solid] != nullptr;
+
+    gasFile   = m_cacheDirectory + "/ebis-" + hash + "-gas.hdf5";
+    solidFile = hasSolid ? m_cacheDirectory + "/ebis-" + hash + "-solid.hdf5" : "";
+
+    // Master rank checks if the files exist and tells everyone else.
+    int foundFiles = 0;
+
+    if (procID() == 0) {
+      struct stat buffer;
+
+      foundFiles = (stat(gasFile.c_str(), &buffer) == 0) ? 1 : 0;
+
+      if (hasSolid && stat(solidFile.c_str(), &buffer) != 0) {
+        foundFiles = 0;
+      }
+    }
+
+    readFromCache = ParallelOps::max(foundFiles) > 0;
+
+    if (readFromCache) {
+      pout() << "ComputationalGeometry::buildGeometries - reading EBIS from cache '" << gasFile << "'" << endl;
+
+      m_multifluidIndexSpace->define(gasFile, solidFile, a_maxCoarsen);
+    }
+  }
+#endif
+
+  if (!readFromCache) {
+    Real peakBefore    = 0.0;
+    Real unfreedBefore = 0.0;
+    Real minPeak       = 0.0;
+    Real minUnfreed    = 0.0;
+
+    if (m_profile) {
+      MemoryReport::getMaxMinMemoryUsage(peakBefore, minPeak, unfreedBefore, minUnfreed);
+    }
+
+    m_multifluidIndexSpace->define(a_finestDomain.domainBox(), // Define MF
+                                   a_probLo,
+                                   a_finestDx,
+                                   geoServices,
+                                   useDistributedData,
+                                   a_nCellMax,
+                                   a_maxCoarsen);
+
+    if (m_useScanShop) {
+      static_cast<ScanShop*>(geoServices[phase::gas])->printLevelReport("Gas phase geometry generation");
+
+      if (geoServices[phase::solid] != nullptr) {
+        static_cast<ScanShop*>(geoServices[phase::solid])->printLevelReport("Solid phase geometry generation");
+      }
+    }
+
+    if (m_profile) {
+      Real peakAfter    = 0.0;
+      Real unfreedAfter = 0.0;
+
+      MemoryReport::getMaxMinMemoryUsage(peakAfter, minPeak, unfreedAfter, minUnfreed);
+
+      pout() << "ComputationalGeometry::buildGeometries - EBIS memory (max over ranks): "
+             << "unfreed = " << unfreedAfter - unfreedBefore << " MB, peak = " << peakAfter - peakBefore << " MB" << endl;
+    }
+
+#ifdef CH_USE_HDF5
+    if (!(m_cacheDirectory.empty())) {
+      pout() << "ComputationalGeometry::buildGeometries - writing EBIS to cache '" << gasFile << "'" << endl;
+
+      if (procID() == 0) {
+        const std::string cmd = "mkdir -p " + m_cacheDirectory;
+
+        if (system(cmd.c_str()) != 0) {
+          std::cout << "ComputationalGeometry::buildGeometries - master could not create cache directory" << std::endl;
+        }
+      }
+
+      ParallelOps::barrier();
+
+      m_multifluidIndexSpace->writeEBIS(gasFile, solidFile);
+    }
+#endif
+  }
 
   // Delete temps.
   for (int i = 0; i < 2; i++) {
@@ -188,6 +309,108 @@ ComputationalGeometry::buildGeometries(const ProblemDomain a_finestDomain,
   }
 }
 
+std::string
+ComputationalGeometry::computeGeometryHash(const ProblemDomain a_finestDomain,
+                                           const RealVect      a_probLo,
+                                           const Real          a_finestDx,
+                                           const int           a_nCellMax,
+                                           const int           a_maxGhostEB,
+                                           const int           a_maxCoarsen) const
+{
+  CH_TIME("ComputationalGeometry::computeGeometryHash");
+
+  // TLDR: We use 64-bit FNV-1a hashing of everything that goes into the EBIS generation. This is the grid settings and
+  //       the geometry generation method, the implicit functions which we sample on a coarsened version of the
+  //       finest domain, and the contents of files that are referenced in the input script (this catches changes
+  //       to e.g. surface meshes that are finer than the sampling).
+  std::uint64_t hash = 14695981039346656037ULL;
+
+  auto hashBytes = [&hash](const void* a_data, const size_t a_numBytes) -> void {
+    const unsigned char* bytes = static_cast<const unsigned char*>(a_data);
+
+    for (size_t i = 0; i < a_numBytes; i++) {
+      hash ^= static_cast<std::uint64_t>(bytes[i]);
+      hash *= 1099511628211ULL;
+    }
+  };
+
+  auto hashInt  = [&hashBytes](const int a_value) -> void { hashBytes(&a_value, sizeof(int)); };
+  auto hashReal = [&hashBytes](const Real a_value) -> void { hashBytes(&a_value, sizeof(Real)); };
+
+  // Grid settings and geometry generation method. The scan domain is not included because it only affects the
+  // speed of the EBIS generation and not the result.
+  const Box domainBox = a_finestDomain.domainBox();
+  for (int dir = 0; dir < SpaceDim; dir++) {
+    hashInt(domainBox.smallEnd(dir));
+    hashInt(domainBox.bigEnd(dir));
+    hashInt(a_finestDomain.isPeriodic(dir) ? 1 : 0);
+    hashReal(a_probLo[dir]);
+  }
+
+  hashReal(a_finestDx);
+  hashReal(s_thresh);
+  hashInt(a_nCellMax);
+  hashInt(a_maxGhostEB);
+  hashInt(a_maxCoarsen);
+  hashInt(m_useScanShop ? 1 : 0);
+
+  // Sample the implicit functions in the cell centers of a coarsened version of the finest domain.
+  Box  sampleBox = domainBox;
+  Real sampleDx  = a_finestDx;
+  while (sampleBox.longside() > s_hashSamples && sampleBox.coarsenable(2)) {
+    sampleBox.coarsen(2);
+    sampleDx *= 2.0;
+  }
+
+  for (int iphase = 0; iphase < phase::numPhases; iphase++) {
+    const RefCountedPtr<BaseIF>& implicitFunction = (iphase == phase::gas) ? m_implicitFunctionGas
+                                                                           : m_implicitFunctionSolid;
+
+    hashInt(implicitFunction.isNull() ? 0 : 1);
+
+    if (!(implicitFunction.isNull())) {
+      for (BoxIterator bit(sampleBox); bit.ok(); ++bit) {
+        const RealVect pos = a_probLo + (0.5 * RealVect::Unit + RealVect(bit())) * sampleDx;
+
+        hashReal(implicitFunction->value(pos));
+      }
+    }
+  }
+
+  // Hash the contents of all regular files that are referenced in the input script.
+  std::stringstream table;
+  ParmParse::dumpTable(table);
+
+  std::string token;
+  while (table >> token) {
+    for (char& c : token) {
+      if (c == '[' || c == ']' || c == '"' || c == ',' || c == ':' || c == '=') {
+        c = ' ';
+      }
+    }
+
+    std::stringstream subTokens(token);
+    std::string       fileName;
+
+    while (subTokens >> fileName) {
+      struct stat buffer;
+
+      if (stat(fileName.c_str(), &buffer) == 0 && S_ISREG(buffer.st_mode)) {
+        std::ifstream     file(fileName, std::ios::binary);
+        const std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        hashBytes(fileName.data(), fileName.size());
+        hashBytes(content.data(), content.size());
+      }
+    }
+  }
+
+  char hex[17];
+  std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(hash));
+
+  return std::string(hex);
+}
+
 void
 ComputationalGeometry::buildGasGeometry(GeometryService*&   a_geoserver,
                                         const ProblemDomain a_finestDomain,
@@ -221,6 +444,10 @@ ComputationalGeometry::buildGasGeometry(GeometryService*&   a_geoserver,
 
     scanShop->setProfileFileName("ScanShopReportGasPhase.dat");
 
+    if (m_profile) {
+      scanShop->setProfile(true);
+    }
+
     a_geoserver = static_cast<GeometryService*>(scanShop);
   }
   else { // Chombo geometry generation
@@ -286,6 +513,10 @@ ComputationalGeometry::buildSolidGeometry(GeometryService*&   a_geoserver,
 
       scanShop->setProfileFileName("ScanShopReportSolidPhase.dat");
 
+      if (m_profile) {
+        scanShop->setProfile(true);
+      }
+
       a_geoserver = static_cast<GeometryService*>(scanShop);
     }
     else { // Chombo geometry generation
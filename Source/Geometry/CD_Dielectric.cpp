@@ -100,4 +100,14 @@ Dielectric::getPermittivity(const RealVect a_pos) const
   return ret;
 }
 
+bool
+Dielectric::isConstantPermittivity() const
+{
+  CH_TIME("Dielectric::isConstantPermittivity()");
+
+  CH_assert(m_isDefined);
+
+  return m_useConstant;
+}
+
 #include <CD_NamespaceFooter.H>
@@ -11,6 +11,7 @@
 
 // Std includes
 #include <chrono>
+#include <cmath>
 
 // Chombo includes
 #include <BRMeshRefine.H>
@@ -19,6 +20,7 @@
 // Our includes
 #include <CD_ScanShop.H>
 #include <CD_LoadBalancing.H>
+#include <CD_ParallelOps.H>
 #include <CD_NamespaceHeader.H>
 
 ScanShop::ScanShop(const BaseIF&       a_localGeom,
@@ -36,10 +38,13 @@ ScanShop::ScanShop(const BaseIF&       a_localGeom,
 
   m_baseIF       = &a_localGeom;
   m_hasScanLevel = false;
-  m_profile      = false;
-  m_ebGhost      = a_ebGhost;
-  m_fileName     = "ScanShopReport.dat";
-  m_boxSorting   = BoxSorting::Morton;
+  m_profile        = false;
+  m_numEvaluations = 0LL;
+  m_ebGhost        = a_ebGhost;
+  m_fileName       = "ScanShopReport.dat";
+  m_boxSorting     = BoxSorting::Morton;
+  m_loadBlockSize  = 0;
+  m_cutCellWeight  = 10.0;
 
   // EBISLevel doesn't give resolution, origin, and problem domains through makeGrids, so we
   // need to construct these here, and then extract the proper resolution when we actually call makeGrids
@@ -51,6 +56,8 @@ ScanShop::ScanShop(const BaseIF&       a_localGeom,
   std::string str;
   pp.query("profile", m_profile);
   pp.query("box_sorting", str);
+  pp.query("load_block_size", m_loadBlockSize);
+  pp.query("cut_cell_weight", m_cutCellWeight);
 
   if (str == "none") {
     m_boxSorting = BoxSorting::None;
@@ -61,6 +68,9 @@ ScanShop::ScanShop(const BaseIF&       a_localGeom,
   else if (str == "morton") {
     m_boxSorting = BoxSorting::Morton;
   }
+  else if (str == "hilbert") {
+    m_boxSorting = BoxSorting::Hilbert;
+  }
   else if (str == "shuffle") {
     m_boxSorting = BoxSorting::Shuffle;
   }
@@ -86,6 +96,47 @@ ScanShop::setProfileFileName(const std::string a_fileName)
   m_timer = Timer(m_fileName);
 }
 
+void
+ScanShop::setProfile(const bool a_profile) noexcept
+{
+  m_profile = a_profile;
+}
+
+void
+ScanShop::printLevelReport(const std::string a_header) const
+{
+  CH_TIME("ScanShop::printLevelReport");
+
+  if (m_profile) {
+    pout() << a_header << endl;
+
+    // Coarsest level first.
+    for (int lvl = m_domains.size() - 1; lvl >= 0; lvl--) {
+      if (m_hasThisLevel[lvl]) {
+        const LevelProfile& prof = m_levelProfiles[lvl];
+
+        const long long numEvaluations = ParallelOps::sum(prof.numEvaluations);
+
+        const Real maxScanTime      = ParallelOps::max(prof.scanTime);
+        const Real avgScanTime      = ParallelOps::average(prof.scanTime);
+        const Real maxFillGraphTime = ParallelOps::max(prof.fillGraphTime);
+        const Real avgFillGraphTime = ParallelOps::average(prof.fillGraphTime);
+
+        pout() << "ScanShop::printLevelReport  domain = " << m_domains[lvl] << ":" << endl
+               << "\t Covered  boxes            = " << prof.numCoveredBoxes << endl
+               << "\t Regular  boxes            = " << prof.numRegularBoxes << endl
+               << "\t Cut-cell boxes            = " << prof.numCutCellBoxes << endl
+               << "\t Cut-cell box cells        = " << prof.numCutCellBoxCells << endl
+               << "\t Implicit function evals   = " << numEvaluations << endl
+               << "\t Scan time (max/avg)       = " << maxScanTime << " / " << avgScanTime << endl
+               << "\t Fill graph time (max/avg) = " << maxFillGraphTime << " / " << avgFillGraphTime << endl
+               << "\t Cut-cell load imbalance   = " << prof.loadImbalance << endl
+               << endl;
+      }
+    }
+  }
+}
+
 void
 ScanShop::makeDomains(const Real          a_dx,
                       const RealVect      a_probLo,
@@ -127,6 +178,7 @@ ScanShop::makeDomains(const Real          a_dx,
   m_grids.resize(m_domains.size());
   m_boxMap.resize(m_domains.size());
   m_hasThisLevel.resize(m_domains.size(), false);
+  m_levelProfiles.resize(m_domains.size());
 }
 
 void
@@ -214,19 +266,24 @@ ScanShop::buildCoarseLevel(const int a_level, const int a_maxGridSize)
   // 2.
   DisjointBoxLayout dbl(boxes, procs, m_domains[a_level]);
 
-  Vector<Box> coveredBoxes;
-  Vector<Box> cutCellBoxes;
-  Vector<Box> regularBoxes;
+  Vector<Box>  coveredBoxes;
+  Vector<Box>  cutCellBoxes;
+  Vector<Box>  regularBoxes;
+  Vector<long> cutCellLoads;
 
   const DataIterator& dit = dbl.dataIterator();
 
+  const long long numEvaluations = m_numEvaluations;
+  const Real      t0             = Timer::wallClock();
+
   const int nbox = dit.size();
 #pragma omp parallel
   {
 
-    Vector<Box> localCoveredBoxes;
-    Vector<Box> localCutCellBoxes;
-    Vector<Box> localRegularBoxes;
+    Vector<Box>  localCoveredBoxes;
+    Vector<Box>  localCutCellBoxes;
+    Vector<Box>  localRegularBoxes;
+    Vector<long> localCutCellLoads;
 
 #pragma omp for schedule(runtime)
     for (int mybox = 0; mybox < nbox; mybox++) {
@@ -246,6 +303,7 @@ ScanShop::buildCoarseLevel(const int a_level, const int a_maxGridSize)
       }
       else if (!isRegular && !isCovered) {
         localCutCellBoxes.push_back(box);
+        localCutCellLoads.push_back(this->getCutCellLoad(box, a_level));
       }
       else {
         MayDay::Error("ScanShop::buildCoarseLevel - logic bust");
@@ -257,10 +315,14 @@ ScanShop::buildCoarseLevel(const int a_level, const int a_maxGridSize)
       coveredBoxes.append(localCoveredBoxes);
       cutCellBoxes.append(localCutCellBoxes);
       regularBoxes.append(localRegularBoxes);
+      cutCellLoads.append(localCutCellLoads);
     }
   }
 
-  this->defineLevel(coveredBoxes, regularBoxes, cutCellBoxes, a_level);
+  m_levelProfiles[a_level].scanTime       = Timer::wallClock() - t0;
+  m_levelProfiles[a_level].numEvaluations = m_numEvaluations - numEvaluations;
+
+  this->defineLevel(coveredBoxes, regularBoxes, cutCellBoxes, cutCellLoads, a_level);
 
   m_hasThisLevel[a_level] = true;
 }
@@ -281,17 +343,22 @@ ScanShop::buildFinerLevels(const int a_coarserLevel, const int a_maxGridSize)
     const DisjointBoxLayout& dblCoar = m_grids[coarLvl];
     const DataIterator&      dit     = dblCoar.dataIterator();
 
-    Vector<Box> coveredBoxes;
-    Vector<Box> regularBoxes;
-    Vector<Box> cutCellBoxes;
+    Vector<Box>  coveredBoxes;
+    Vector<Box>  regularBoxes;
+    Vector<Box>  cutCellBoxes;
+    Vector<long> cutCellLoads;
+
+    const long long numEvaluations = m_numEvaluations;
+    const Real      t0             = Timer::wallClock();
 
     const int nbox = dit.size();
 #pragma omp parallel
     {
 
-      Vector<Box> localCoveredBoxes;
-      Vector<Box> localRegularBoxes;
-      Vector<Box> localCutCellBoxes;
+      Vector<Box>  localCoveredBoxes;
+      Vector<Box>  localRegularBoxes;
+      Vector<Box>  localCutCellBoxes;
+      Vector<long> localCutCellLoads;
 
 #pragma omp for schedule(runtime)
       for (int mybox = 0; mybox < nbox; mybox++) {
@@ -326,6 +393,7 @@ ScanShop::buildFinerLevels(const int a_coarserLevel, const int a_maxGridSize)
             }
             else if (!isRegular && !isCovered) {
               localCutCellBoxes.push_back(box);
+              localCutCellLoads.push_back(this->getCutCellLoad(box, fineLvl));
             }
             else {
               MayDay::Error("ScanShop::buildFinerLevels - logic bust!");
@@ -339,12 +407,16 @@ ScanShop::buildFinerLevels(const int a_coarserLevel, const int a_maxGridSize)
         coveredBoxes.append(localCoveredBoxes);
         cutCellBoxes.append(localCutCellBoxes);
         regularBoxes.append(localRegularBoxes);
+        cutCellLoads.append(localCutCellLoads);
       }
     }
     m_timer.stopEvent("Fine from coar");
 
+    m_levelProfiles[fineLvl].scanTime       = Timer::wallClock() - t0;
+    m_levelProfiles[fineLvl].numEvaluations = m_numEvaluations - numEvaluations;
+
     m_timer.startEvent("Define level");
-    this->defineLevel(coveredBoxes, regularBoxes, cutCellBoxes, fineLvl);
+    this->defineLevel(coveredBoxes, regularBoxes, cutCellBoxes, cutCellLoads, fineLvl);
     m_timer.stopEvent("Define level");
 
     m_hasThisLevel[fineLvl] = true;
@@ -354,11 +426,39 @@ ScanShop::buildFinerLevels(const int a_coarserLevel, const int a_maxGridSize)
   }
 }
 
+long
+ScanShop::getCutCellLoad(const Box a_box, const int a_level) const
+{
+  CH_TIME("ScanShop::getCutCellLoad");
+
+  long load = a_box.numPts();
+
+  if (m_loadBlockSize > 0) {
+    Vector<Box> blocks;
+    domainSplit(a_box, blocks, m_loadBlockSize, m_loadBlockSize);
+
+    long cutCells = 0L;
+    for (const auto& block : blocks.stdVector()) {
+      const Box grownBlock = grow(block, 1) & m_domains[a_level];
+
+      if (!(ScanShop::isRegular(grownBlock, m_probLo, m_dx[a_level])) &&
+          !(ScanShop::isCovered(grownBlock, m_probLo, m_dx[a_level]))) {
+        cutCells += block.numPts();
+      }
+    }
+
+    load += std::lround(m_cutCellWeight * cutCells);
+  }
+
+  return load;
+}
+
 void
-ScanShop::defineLevel(Vector<Box>& a_coveredBoxes,
-                      Vector<Box>& a_regularBoxes,
-                      Vector<Box>& a_cutCellBoxes,
-                      const int    a_level)
+ScanShop::defineLevel(Vector<Box>&  a_coveredBoxes,
+                      Vector<Box>&  a_regularBoxes,
+                      Vector<Box>&  a_cutCellBoxes,
+                      Vector<long>& a_cutCellLoads,
+                      const int     a_level)
 {
   CH_TIME("ScanShop::defineLevel");
 
@@ -367,6 +467,7 @@ ScanShop::defineLevel(Vector<Box>& a_coveredBoxes,
   LoadBalancing::gatherBoxes(a_coveredBoxes);
   LoadBalancing::gatherBoxes(a_regularBoxes);
   LoadBalancing::gatherBoxes(a_cutCellBoxes);
+  LoadBalancing::gatherLoads(a_cutCellLoads);
   m_timer.stopEvent("Gather boxes");
 
   // This is needed because when we join the regular and covered boxes onto the same "load" when we sort them, but we need to have
@@ -387,14 +488,14 @@ ScanShop::defineLevel(Vector<Box>& a_coveredBoxes,
 
   //   LoadBalancing::sort(  reguCovBoxes, reguCovTypes, m_boxSorting); Don't need to sort these, I think.
   // We don't need to track the "type" for cut-cell boxes because this call only sorts one type of box.
-  LoadBalancing::sort(a_cutCellBoxes, m_boxSorting);
+  LoadBalancing::sort(a_cutCellBoxes, a_cutCellLoads, m_boxSorting);
   m_timer.stopEvent("Sort boxes");
 
   // Load balance the boxes - we do not care about accumulated load imbalance across levels here. If it becomes
   // a problem (never has been in the past) we can easily add accumulated load factor.
   m_timer.startEvent("Make balance");
   const Vector<long> reguCovLoads(reguCovBoxes.size(), 1L);
-  const Vector<long> cutCellLoads(a_cutCellBoxes.size(), 1L);
+  const Vector<long> cutCellLoads = (m_loadBlockSize > 0) ? a_cutCellLoads : Vector<long>(a_cutCellBoxes.size(), 1L);
 
   Vector<int> reguCovProcs;
   Vector<int> cutCellProcs;
@@ -409,6 +510,27 @@ ScanShop::defineLevel(Vector<Box>& a_coveredBoxes,
   LoadBalancing::makeBalance(cutCellProcs, rankLoads2, cutCellLoads, a_cutCellBoxes);
   m_timer.stopEvent("Make balance");
 
+  // Profiling data. The boxes were gathered above, so these are global numbers.
+  LevelProfile& prof = m_levelProfiles[a_level];
+
+  prof.numCoveredBoxes    = a_coveredBoxes.size();
+  prof.numRegularBoxes    = a_regularBoxes.size();
+  prof.numCutCellBoxes    = a_cutCellBoxes.size();
+  prof.numCutCellBoxCells = 0LL;
+
+  for (int i = 0; i < a_cutCellBoxes.size(); i++) {
+    prof.numCutCellBoxCells += a_cutCellBoxes[i].numPts();
+  }
+
+  Real maxLoad = 0.0;
+  Real sumLoad = 0.0;
+  for (const auto& rankLoad : rankLoads2.getLoads()) {
+    maxLoad = std::max(maxLoad, rankLoad.second);
+    sumLoad += rankLoad.second;
+  }
+
+  prof.loadImbalance = (sumLoad > 0.0) ? maxLoad * numProc() / sumLoad : 1.0;
+
   // We load balanced the regular/covered and cut-cell regions independently, but now we need to create a box-to-rank map
   // that is usable by Chombo's DisjointBoxLayout.
   m_timer.startEvent("Vector append");
@@ -473,15 +595,19 @@ ScanShop::defineLevel(Vector<Box>& a_coveredBoxes,
     }
   }
 
-  if (m_profile) {
-    pout() << "ScanShop::defineLevel  domain = " << m_domains[a_level] << ":" << endl
-           << "\t Covered  boxes = " << a_coveredBoxes.size() << endl
-           << "\t Regular  boxes = " << a_regularBoxes.size() << endl
-           << "\t Cut-cell boxes = " << a_cutCellBoxes.size() << endl
-           << endl;
+  m_timer.stopEvent("Set box types");
+}
+
+int
+ScanShop::findLevel(const ProblemDomain& a_domain) const noexcept
+{
+  for (int lvl = 0; lvl < m_domains.size(); lvl++) {
+    if (m_domains[lvl].domainBox() == a_domain.domainBox()) {
+      return lvl;
+    }
   }
 
-  m_timer.stopEvent("Set box types");
+  return -1;
 }
 
 GeometryService::InOut
@@ -543,10 +669,18 @@ ScanShop::fillGraph(BaseFab<int>&        a_regIrregCovered,
     m_timer.startEvent("Fill graph");
   }
 
+  const Real t0 = Timer::wallClock();
+
   GeometryShop::fillGraph(a_regIrregCovered, a_nodes, a_validRegion, a_ghostRegion, a_domain, a_probLo, a_dx, a_di);
 
   if (m_profile) {
     m_timer.stopEvent("Fill graph");
+
+    const int lvl = this->findLevel(a_domain);
+
+    if (lvl >= 0) {
+      m_levelProfiles[lvl].fillGraphTime += Timer::wallClock() - t0;
+    }
   }
 }
 
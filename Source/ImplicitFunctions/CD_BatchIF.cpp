@@ -0,0 +1,34 @@
+/* chombo-discharge
+ * Copyright © 2026 SINTEF Energy Research.
+ * Please refer to Copyright.txt and LICENSE in the chombo-discharge root directory.
+ */
+
+/*!
+  @file   CD_BatchIF.cpp
+  @brief  Implementation of CD_BatchIF.H
+  @author Robert Marskar
+*/
+
+// Our includes
+#include <CD_BatchIF.H>
+#include <CD_NamespaceHeader.H>
+
+void
+BatchIF::evaluate(const BaseIF&   a_implicitFunction,
+                  const RealVect* a_points,
+                  Real*           a_values,
+                  const size_t    a_numPoints) noexcept
+{
+  const BatchIF* batchIF = dynamic_cast<const BatchIF*>(&a_implicitFunction);
+
+  if (batchIF != nullptr) {
+    batchIF->values(a_points, a_values, a_numPoints);
+  }
+  else {
+    for (size_t i = 0; i < a_numPoints; i++) {
+      a_values[i] = a_implicitFunction.value(a_points[i]);
+    }
+  }
+}
+
+#include <CD_NamespaceFooter.H>
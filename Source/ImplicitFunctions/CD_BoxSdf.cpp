@@ -59,6 +59,15 @@ BoxSdf::value(const RealVect& a_pos) const
   return retval;
 }
 
+void
+BoxSdf::values(const RealVect* a_points, Real* a_values, const size_t a_numPoints) const
+{
+  // Qualified call, which is resolved at compile time so that the loop can be inlined and vectorized.
+  for (size_t i = 0; i < a_numPoints; i++) {
+    a_values[i] = BoxSdf::value(a_points[i]);
+  }
+}
+
 BaseIF*
 BoxSdf::newImplicitFunction() const
 {
@@ -83,6 +83,15 @@ CylinderSdf::value(const RealVect& a_point) const
   return retval;
 }
 
+void
+CylinderSdf::values(const RealVect* a_points, Real* a_values, const size_t a_numPoints) const
+{
+  // Qualified call, which is resolved at compile time so that the loop can be inlined and vectorized.
+  for (size_t i = 0; i < a_numPoints; i++) {
+    a_values[i] = CylinderSdf::value(a_points[i]);
+  }
+}
+
 BaseIF*
 CylinderSdf::newImplicitFunction() const
 {
@@ -0,0 +1,128 @@
+/* chombo-discharge
+ * Copyright © 2026 SINTEF Energy Research.
+ * Please refer to Copyright.txt and LICENSE in the chombo-discharge root directory.
+ */
+
+/*!
+  @file   CD_FastIntersectionIF.cpp
+  @brief  Implementation of CD_FastIntersectionIF.H
+  @author Robert Marskar
+*/
+
+// Std includes
+#include <limits>
+#include <vector>
+
+// Chombo includes
+#include <CH_Timer.H>
+
+// Our includes
+#include <CD_FastIntersectionIF.H>
+#include <CD_NamespaceHeader.H>
+
+constexpr size_t FastIntersectionIF::K;
+
+FastIntersectionIF::Primitive::Primitive(const RefCountedPtr<BaseIF>& a_impFunc) noexcept
+{
+  m_impFunc = a_impFunc;
+}
+
+FastIntersectionIF::Primitive::~Primitive() noexcept
+{}
+
+Real
+FastIntersectionIF::Primitive::value(const EBGeometry::Vec3T<Real>& a_point) const noexcept
+{
+  const RealVect point = RealVect(D_DECL(a_point[0], a_point[1], a_point[2]));
+
+  return -m_impFunc->value(point);
+}
+
+FastIntersectionIF::FastIntersectionIF(const Vector<BaseIF*>&                      a_impFuncs,
+                                       const Vector<std::pair<RealVect, RealVect>>& a_boundingBoxes,
+                                       const Real                                  a_zCoord)
+{
+  CH_TIME("FastIntersectionIF::FastIntersectionIF(full)");
+
+  using AABB = EBGeometry::BoundingVolumes::AABBT<Real>;
+  using Vec3 = EBGeometry::Vec3T<Real>;
+
+  if (a_impFuncs.size() != a_boundingBoxes.size()) {
+    MayDay::Error("FastIntersectionIF::FastIntersectionIF - need one bounding box per implicit function");
+  }
+
+  m_zCoord = a_zCoord;
+
+  std::vector<std::shared_ptr<Primitive>> primitives;
+  std::vector<AABB>                       boundingVolumes;
+
+  for (int i = 0; i < a_impFuncs.size(); i++) {
+    if (a_impFuncs[i] == nullptr) {
+      MayDay::Error("FastIntersectionIF::FastIntersectionIF - implicit function can not be nullptr");
+    }
+
+    const RefCountedPtr<BaseIF> impFunc = RefCountedPtr<BaseIF>(a_impFuncs[i]->newImplicitFunction());
+
+    const Vec3 lo = this->toVec3(a_boundingBoxes[i].first);
+    const Vec3 hi = this->toVec3(a_boundingBoxes[i].second);
+
+    primitives.emplace_back(std::make_shared<Primitive>(impFunc));
+    boundingVolumes.emplace_back(AABB(lo, hi));
+  }
+
+  if (primitives.size() > 0) {
+    m_fastUnion = EBGeometry::FastUnion<Real, Primitive, AABB, K>(primitives, boundingVolumes);
+  }
+  else {
+    m_fastUnion = nullptr;
+  }
+}
+
+FastIntersectionIF::FastIntersectionIF(const FastIntersectionIF& a_inputIF)
+{
+  CH_TIME("FastIntersectionIF::FastIntersectionIF(other)");
+
+  m_fastUnion = a_inputIF.m_fastUnion;
+  m_zCoord    = a_inputIF.m_zCoord;
+}
+
+FastIntersectionIF::~FastIntersectionIF()
+{}
+
+inline EBGeometry::Vec3T<Real>
+FastIntersectionIF::toVec3(const RealVect& a_point) const noexcept
+{
+#if CH_SPACEDIM == 2
+  return EBGeometry::Vec3T<Real>(a_point[0], a_point[1], m_zCoord);
+#else
+  return EBGeometry::Vec3T<Real>(a_point[0], a_point[1], a_point[2]);
+#endif
+}
+
+Real
+FastIntersectionIF::value(const RealVect& a_point) const
+{
+  Real ret = -std::numeric_limits<Real>::max();
+
+  if (m_fastUnion != nullptr) {
+    ret = -m_fastUnion->value(this->toVec3(a_point));
+  }
+
+  return ret;
+}
+
+void
+FastIntersectionIF::values(const RealVect* a_points, Real* a_values, const size_t a_numPoints) const
+{
+  for (size_t i = 0; i < a_numPoints; i++) {
+    a_values[i] = FastIntersectionIF::value(a_points[i]);
+  }
+}
+
+BaseIF*
+FastIntersectionIF::newImplicitFunction() const
+{
+  return static_cast<BaseIF*>(new FastIntersectionIF(*this));
+}
+
+#include <CD_NamespaceFooter.H>
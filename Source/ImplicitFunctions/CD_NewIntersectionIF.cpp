@@ -10,7 +10,9 @@
 */
 
 // Std includes
+#include <algorithm>
 #include <limits>
+#include <vector>
 
 // Our includes
 #include <CD_NewIntersectionIF.H>
@@ -75,6 +77,31 @@ NewIntersectionIF::value(const RealVect& a_point) const
   return retval;
 }
 
+void
+NewIntersectionIF::values(const RealVect* a_points, Real* a_values, const size_t a_numPoints) const
+{
+
+  // TLDR: Evaluate each of the implicit functions on the full batch and keep the maximum value.
+  if (m_numFuncs > 0) {
+    BatchIF::evaluate(*m_impFuncs[0], a_points, a_values, a_numPoints);
+
+    std::vector<Real> cur(a_numPoints);
+
+    for (int ifunc = 1; ifunc < m_numFuncs; ifunc++) {
+      BatchIF::evaluate(*m_impFuncs[ifunc], a_points, cur.data(), a_numPoints);
+
+      for (size_t i = 0; i < a_numPoints; i++) {
+        a_values[i] = std::max(a_values[i], cur[i]);
+      }
+    }
+  }
+  else {
+    for (size_t i = 0; i < a_numPoints; i++) {
+      a_values[i] = -std::numeric_limits<Real>::max();
+    }
+  }
+}
+
 BaseIF*
 NewIntersectionIF::newImplicitFunction() const
 {
@@ -9,6 +9,12 @@
   @author Robert Marskar
 */
 
+// Std includes
+#include <cmath>
+
+// Chombo includes
+#include <CH_Timer.H>
+
 // Our includes
 #include <CD_PerlinSdf.H>
 #include <CD_NamespaceHeader.H>
@@ -28,6 +34,7 @@ PerlinSdf::PerlinSdf(const Real     a_noiseAmp,
   m_noiseFreq   = a_noiseFreq;
   m_persistence = a_persistence;
   m_octaves     = a_octaves;
+  m_tabulated   = false;
 
   // Use Ken Perlin's original permutation table
   for (int i = 0; i < 256; i++) {
@@ -49,6 +56,12 @@ PerlinSdf::PerlinSdf(const PerlinSdf& a_inputIF)
   m_persistence = a_inputIF.m_persistence;
   m_octaves     = a_inputIF.m_octaves;
 
+  m_tabulated    = a_inputIF.m_tabulated;
+  m_latticeLo    = a_inputIF.m_latticeLo;
+  m_latticeDx    = a_inputIF.m_latticeDx;
+  m_latticeCells = a_inputIF.m_latticeCells;
+  m_lattice      = a_inputIF.m_lattice;
+
   for (int i = 0; i < 256; i++) {
     p[i]       = a_inputIF.p[i];
     p[i + 256] = a_inputIF.p[i + 256];
@@ -61,7 +74,22 @@ PerlinSdf::~PerlinSdf()
 Real
 PerlinSdf::value(const RealVect& a_pos) const
 {
-  return this->octaveNoise(a_pos);
+  Real ret;
+
+  if (!(m_tabulated && this->latticeNoise(a_pos, ret))) {
+    ret = this->octaveNoise(a_pos);
+  }
+
+  return ret;
+}
+
+void
+PerlinSdf::values(const RealVect* a_points, Real* a_values, const size_t a_numPoints) const
+{
+  // Qualified call, which is resolved at compile time so that the loop can be inlined and vectorized.
+  for (size_t i = 0; i < a_numPoints; i++) {
+    a_values[i] = PerlinSdf::value(a_points[i]);
+  }
 }
 
 BaseIF*
@@ -70,6 +98,90 @@ PerlinSdf::newImplicitFunction() const
   return static_cast<BaseIF*>(new PerlinSdf(*this));
 }
 
+void
+PerlinSdf::tabulate(const RealVect& a_lo, const RealVect& a_hi, const Real a_dx)
+{
+  CH_TIME("PerlinSdf::tabulate");
+
+  CH_assert(a_dx > 0.0);
+
+  m_tabulated = false;
+  m_latticeLo = a_lo;
+  m_latticeDx = a_dx;
+
+  size_t numNodes = 1;
+  for (int dir = 0; dir < SpaceDim; dir++) {
+    m_latticeCells[dir] = std::max(1, (int)std::ceil((a_hi[dir] - a_lo[dir]) / a_dx));
+
+    numNodes *= m_latticeCells[dir] + 1;
+  }
+
+  // Copies made before this call share the old lattice, so allocate a new one rather than overwriting it.
+  m_lattice = RefCountedPtr<std::vector<Real>>(new std::vector<Real>(numNodes));
+
+  std::vector<Real>& lattice = *m_lattice;
+
+#pragma omp parallel for schedule(runtime)
+  for (long long node = 0; node < (long long)numNodes; node++) {
+    long long idx = node;
+
+    RealVect pos;
+    for (int dir = 0; dir < SpaceDim; dir++) {
+      const long long numDirNodes = m_latticeCells[dir] + 1;
+
+      pos[dir] = m_latticeLo[dir] + (idx % numDirNodes) * m_latticeDx;
+
+      idx /= numDirNodes;
+    }
+
+    lattice[node] = this->octaveNoise(pos);
+  }
+
+  m_tabulated = true;
+}
+
+bool
+PerlinSdf::latticeNoise(const RealVect& a_pos, Real& a_noise) const noexcept
+{
+  const std::vector<Real>& lattice = *m_lattice;
+
+  // Cell index and interpolation weights in each direction.
+  int  cell[SpaceDim];
+  Real w[SpaceDim];
+
+  for (int dir = 0; dir < SpaceDim; dir++) {
+    const Real s = (a_pos[dir] - m_latticeLo[dir]) / m_latticeDx;
+
+    if (s < 0.0 || s > m_latticeCells[dir]) {
+      return false;
+    }
+
+    cell[dir] = std::min((int)s, m_latticeCells[dir] - 1);
+    w[dir]    = s - cell[dir];
+  }
+
+  // Weighted sum over the 2^SpaceDim corners of the cell.
+  a_noise = 0.0;
+
+  for (int corner = 0; corner < (1 << SpaceDim); corner++) {
+    Real   weight = 1.0;
+    size_t node   = 0;
+    size_t stride = 1;
+
+    for (int dir = 0; dir < SpaceDim; dir++) {
+      const int hi = (corner >> dir) & 1;
+
+      weight *= hi ? w[dir] : 1.0 - w[dir];
+      node += (cell[dir] + hi) * stride;
+      stride *= m_latticeCells[dir] + 1;
+    }
+
+    a_noise += weight * lattice[node];
+  }
+
+  return true;
+}
+
 int
 PerlinSdf::random(const int i)
 {
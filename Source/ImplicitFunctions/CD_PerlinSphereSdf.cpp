@@ -9,6 +9,9 @@
   @author Robert Marskar
 */
 
+// Chombo includes
+#include <CH_Timer.H>
+
 // Our includes
 #include <CD_PerlinSphereSdf.H>
 #include <CD_NamespaceHeader.H>
@@ -27,7 +30,7 @@ PerlinSphereSdf::PerlinSphereSdf(const Real&     a_rad,
   m_rad      = a_rad - a_noiseAmp;
   m_center   = a_center;
   m_inside   = a_inside;
-  m_perlinIF = RefCountedPtr<BaseIF>(new PerlinSdf(a_noiseAmp, a_noiseFreq, a_persistence, a_octaves, a_reseed));
+  m_perlinIF = RefCountedPtr<PerlinSdf>(new PerlinSdf(a_noiseAmp, a_noiseFreq, a_persistence, a_octaves, a_reseed));
 }
 
 PerlinSphereSdf::PerlinSphereSdf(const PerlinSphereSdf& a_inputIF)
@@ -94,4 +97,15 @@ PerlinSphereSdf::newImplicitFunction() const
   return static_cast<BaseIF*>(new PerlinSphereSdf(*this));
 }
 
+void
+PerlinSphereSdf::tabulateNoise(const Real a_dx)
+{
+  CH_TIME("PerlinSphereSdf::tabulateNoise");
+
+  // The noise is sampled on the unperturbed sphere, relative to the center. Pad by one lattice cell.
+  const RealVect hi = (m_rad + a_dx) * RealVect::Unit;
+
+  m_perlinIF->tabulate(-hi, hi, a_dx);
+}
+
 #include <CD_NamespaceFooter.H>
@@ -18,6 +18,7 @@
 #include <CD_RodIF.H>
 #include <CD_SphereSdf.H>
 #include <CD_CylinderSdf.H>
+#include <CD_NewIntersectionIF.H>
 #include <CD_NamespaceHeader.H>
 
 RodIF::RodIF(const RealVect& a_center1, const RealVect& a_center2, const Real& a_radius, const bool& a_fluidInside)
@@ -36,7 +37,7 @@ RodIF::RodIF(const RealVect& a_center1, const RealVect& a_center2, const Real& a
   isects.push_back(static_cast<BaseIF*>(new SphereSdf(c2, a_radius, a_fluidInside)));
 
   // Build the rod
-  m_baseif = RefCountedPtr<BaseIF>(new IntersectionIF(isects));
+  m_baseif = RefCountedPtr<BaseIF>(new NewIntersectionIF(isects));
 
   // Delete everything we allocated so far
   for (int i = 0; i < isects.size(); i++) {
@@ -55,6 +56,12 @@ RodIF::value(const RealVect& a_point) const
   return m_baseif->value(a_point);
 }
 
+void
+RodIF::values(const RealVect* a_points, Real* a_values, const size_t a_numPoints) const
+{
+  BatchIF::evaluate(*m_baseif, a_points, a_values, a_numPoints);
+}
+
 BaseIF*
 RodIF::newImplicitFunction() const
 {
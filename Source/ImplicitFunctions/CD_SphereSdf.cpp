@@ -45,6 +45,15 @@ SphereSdf::value(const RealVect& a_point) const
   return retval;
 }
 
+void
+SphereSdf::values(const RealVect* a_points, Real* a_values, const size_t a_numPoints) const
+{
+  // Qualified call, which is resolved at compile time so that the loop can be inlined and vectorized.
+  for (size_t i = 0; i < a_numPoints; i++) {
+    a_values[i] = SphereSdf::value(a_points[i]);
+  }
+}
+
 BaseIF*
 SphereSdf::newImplicitFunction() const
 {
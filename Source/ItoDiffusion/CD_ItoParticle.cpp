@@ -13,7 +13,14 @@
 #include <CD_ItoParticle.H>
 #include <CD_NamespaceHeader.H>
 
-std::vector<std::string> ItoParticle::s_realVariables = {"weight", "mobility", "diffusion", "energy", "tmpReal"};
-std::vector<std::string> ItoParticle::s_vectVariables = {"oldPos", "velocity", "tmpVect"};
+std::vector<std::string> ItoParticleStorage<Real, Real, Real, Real>::s_realVariables = {"weight",
+                                                                                     "mobility",
+                                                                                     "diffusion",
+                                                                                     "energy",
+                                                                                     "tmpReal"};
+
+std::vector<std::string> ItoParticleStorage<Real, Real, Real, Real>::s_vectVariables = {"oldPos",
+                                                                                     "velocity",
+                                                                                     "tmpVect"};
 
 #include <CD_NamespaceFooter.H>
@@ -11,6 +11,7 @@
 
 // Std includes
 #include <chrono>
+#include <cstdint>
 
 // Chombo includes
 #include <CH_Timer.H>
@@ -27,7 +28,9 @@
 #include <CD_ParticleOps.H>
 #include <CD_ParticleManagement.H>
 #include <CD_BoxLoops.H>
+#include <CD_BoxCosts.H>
 #include <CD_Random.H>
+#include <CD_DischargeIO.H>
 #include <CD_NamespaceHeader.H>
 
 constexpr int ItoSolver::m_comp;
@@ -309,6 +312,25 @@ ItoSolver::parseDeposition()
 
   pp.get("irr_ngp_deposition", m_forceIrregDepositionNGP);
   pp.get("irr_ngp_interp", m_forceIrregInterpolationNGP);
+
+  m_threadedDeposition = false;
+  pp.query("threaded_deposition", m_threadedDeposition);
+
+  // Particle sorting within patches. Optional argument.
+  str = "none";
+  pp.query("sort_particles", str);
+  if (str == "none") {
+    m_particleSorting = ParticleSorting::None;
+  }
+  else if (str == "cell") {
+    m_particleSorting = ParticleSorting::Cell;
+  }
+  else if (str == "morton") {
+    m_particleSorting = ParticleSorting::Morton;
+  }
+  else {
+    MayDay::Error("ItoSolver::parseDeposition - unknown particle sorting requested, use 'none', 'cell', or 'morton'");
+  }
 }
 
 void
@@ -335,6 +357,9 @@ ItoSolver::parseIntersectionEB()
   else {
     MayDay::Error("ItoSolver::parseIntersectionEB -- logic bust");
   }
+
+  m_intersectionBand = false;
+  pp.query("intersection_band", m_intersectionBand);
 }
 
 void
@@ -382,9 +407,18 @@ ItoSolver::parseCheckpointing()
   else if (str == "numbers") {
     m_checkpointing = WhichCheckpoint::Numbers;
   }
+  else if (str == "compressed") {
+    m_checkpointing = WhichCheckpoint::Compressed;
+  }
   else {
     MayDay::Abort("ItoSolver::parseCheckpointing - unknown checkpointing method requested");
   }
+
+  m_checkpointCompression = 1;
+  pp.query("checkpoint_deflate", m_checkpointCompression);
+  if (m_checkpointCompression < 0 || m_checkpointCompression > 9) {
+    MayDay::Abort("ItoSolver::parseCheckpointing - 'checkpoint_deflate' must be between 0 and 9");
+  }
 }
 
 void
@@ -414,12 +448,33 @@ ItoSolver::parseParticleMerger()
       this->reinitializeParticles(a_particles, a_cellInfo, a_ppc);
     };
   }
+  else if (str == "energy_groups") {
+    m_particleMerger = [this](List<ItoParticle>& a_particles, const CellInfo& a_cellInfo, const int a_ppc) {
+      this->makeSuperparticlesEnergyGroups(a_particles, a_cellInfo, a_ppc);
+    };
+  }
   else if (str == "external") {
     // Do nothing, because the user will set the merger algorithm through setParticleMerger
   }
   else {
     MayDay::Abort("ItoSolver::parseParticleMerger - unknown particle merging algorithm requested");
   }
+
+  m_mergeHysteresis = 1.0;
+
+  pp.query("merge_hysteresis", m_mergeHysteresis);
+
+  if (m_mergeHysteresis < 1.0) {
+    MayDay::Error("ItoSolver::parseParticleMerger - 'merge_hysteresis' must be >= 1");
+  }
+
+  m_mergeEnergyGroups = 4;
+
+  pp.query("merge_energy_groups", m_mergeEnergyGroups);
+
+  if (m_mergeEnergyGroups < 1) {
+    MayDay::Error("ItoSolver::parseParticleMerger - 'merge_energy_groups' must be >= 1");
+  }
 }
 
 EBIntersection
@@ -497,9 +552,13 @@ ItoSolver::registerOperators() const
     m_amr->registerOperator(s_noncons_div, m_realm, m_phase);
     m_amr->registerOperator(s_particle_mesh, m_realm, m_phase);
     m_amr->registerOperator(s_eb_multigrid, m_realm, m_phase);
+    m_amr->registerOperator(s_covered_mask, m_realm, m_phase);
     if (m_useRedistribution) {
       m_amr->registerOperator(s_eb_redist, m_realm, m_phase);
     }
+    if (m_intersectionBand) {
+      m_amr->registerOperator(s_levelset, m_realm, m_phase);
+    }
 
     // Register mask for CIC deposition.
     m_amr->registerMask(s_particle_halo, m_haloBuffer, m_realm);
@@ -555,11 +614,12 @@ ItoSolver::initialData()
   // TLDR: This function will fetch the initial particles from the species and deposit them on the mesh. In most cases the various MPI ranks
   //       will have drawn a different set of initial particles (the only sane way to do it) and so those particles are put directly in
   //       the 'bulk' particle container. After that we remove the particles that fell inside the EB and deposit the particles on the mesh.
+  //
+  //       Note that addParticles already sends the particles to the ranks and patches that own them, so no remap is needed.
 
   ParticleContainer<ItoParticle>& bulkParticles = m_particleContainers.at(WhichContainer::Bulk);
   bulkParticles.clearParticles();
   bulkParticles.addParticles(m_species->getInitialParticles());
-  bulkParticles.remap();
 
   constexpr Real tolerance = 0.0;
 
@@ -635,7 +695,7 @@ ItoSolver::removeCoveredParticles(ParticleContainer<ItoParticle>& a_particles,
 
   switch (a_representation) {
   case EBRepresentation::ImplicitFunction: {
-    m_amr->removeCoveredParticlesIF(a_particles, m_phase, a_tol);
+    m_amr->removeCoveredParticlesIF(a_particles, m_phase, a_tol, m_intersectionBand);
 
     break;
   }
@@ -699,7 +759,7 @@ ItoSolver::transferCoveredParticles(ParticleContainer<ItoParticle>& a_particlesF
 
   switch (a_representation) {
   case EBRepresentation::ImplicitFunction: {
-    m_amr->transferCoveredParticlesIF(a_particlesFrom, a_particlesTo, m_phase, a_tol);
+    m_amr->transferCoveredParticlesIF(a_particlesFrom, a_particlesTo, m_phase, a_tol, m_intersectionBand);
 
     break;
   }
@@ -781,7 +841,8 @@ ItoSolver::intersectParticles(ParticleContainer<ItoParticle>&         a_particle
   CH_assert(!a_ebParticles.isOrganizedByCell());
   CH_assert(!a_domainParticles.isOrganizedByCell());
 
-  constexpr Real tolerance = 0.0;
+  // Ray-casting tolerance. This must be positive since ray-marching towards the EB never reaches it exactly.
+  const Real tolerance = 1.E-3 * m_amr->getFinestDx();
 
   switch (a_ebIntersection) {
   case EBIntersection::Raycast: {
@@ -791,7 +852,8 @@ ItoSolver::intersectParticles(ParticleContainer<ItoParticle>&         a_particle
                                        m_phase,
                                        tolerance,
                                        a_deleteParticles,
-                                       a_nonDeletionModifier);
+                                       a_nonDeletionModifier,
+                                       m_intersectionBand);
 
     break;
   }
@@ -802,7 +864,8 @@ ItoSolver::intersectParticles(ParticleContainer<ItoParticle>&         a_particle
                                       m_phase,
                                       m_bisectionStep,
                                       a_deleteParticles,
-                                      a_nonDeletionModifier);
+                                      a_nonDeletionModifier,
+                                      m_intersectionBand);
 
     break;
   }
@@ -835,6 +898,10 @@ ItoSolver::regrid(const int a_lmin, const int a_oldFinestLevel, const int a_newF
   m_amr->allocate(m_depositionNC, m_realm, m_phase, ncomp);
   m_amr->allocate(m_massDiff, m_realm, m_phase, ncomp);
 
+  // Particle counts for merging hysteresis. Negative values mean that the cell is always merged.
+  m_amr->allocate(m_mergeCounts, m_realm, m_phase, ncomp);
+  DataOps::setValue(m_mergeCounts, -1.0);
+
   // Only allocate memory for velocity if we actually have a mobile solver
   if (m_isMobile) {
     m_amr->allocate(m_mobilityFunction, m_realm, m_phase, ncomp); //
@@ -894,6 +961,10 @@ ItoSolver::allocate()
   m_amr->allocate(m_depositionNC, m_realm, m_phase, ncomp);
   m_amr->allocate(m_massDiff, m_realm, m_phase, ncomp);
 
+  // Particle counts for merging hysteresis. Negative values mean that the cell is always merged.
+  m_amr->allocate(m_mergeCounts, m_realm, m_phase, ncomp);
+  DataOps::setValue(m_mergeCounts, -1.0);
+
   // Only allocate memory for velocity if we actually have a mobile solver
   if (m_isMobile) {
     m_amr->allocate(m_mobilityFunction, m_realm, m_phase, ncomp); //
@@ -922,6 +993,19 @@ ItoSolver::allocate()
   for (auto& container : m_particleContainers) {
     m_amr->allocate(container.second, m_realm);
   }
+
+  // The particle memory changes every time step, so it is registered as a probe which is evaluated when the memory tracker
+  // is sampled.
+  m_particleMemory = MemoryTracker::track("Particles/" + m_name, [this]() -> long long {
+    long long numParticles = 0LL;
+
+    for (const auto& container : m_particleContainers) {
+      numParticles += container.second.getNumberOfValidParticlesLocal();
+      numParticles += container.second.getNumberOfOutcastParticlesLocal();
+    }
+
+    return numParticles * sizeof(ItoParticle);
+  });
 }
 
 #ifdef CH_USE_HDF5
@@ -948,6 +1032,11 @@ ItoSolver::writeCheckpointLevel(HDF5Handle& a_handle, const int a_level) const
 
     break;
   }
+  case WhichCheckpoint::Compressed: {
+    this->writeCheckPointLevelCompressed(a_handle, a_level);
+
+    break;
+  }
   default: {
     MayDay::Error("ItoSolver::writeCheckpointLevel -- logic bust");
 
@@ -1007,6 +1096,158 @@ ItoSolver::writeCheckPointLevelParticles(HDF5Handle& a_handle, const int a_level
 }
 #endif
 
+#ifdef CH_USE_HDF5
+void
+ItoSolver::writeCheckPointLevelCompressed(HDF5Handle& a_handle, const int a_level) const
+{
+  CH_TIME("ItoSolver::writeCheckPointLevelCompressed");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::writeCheckPointLevelCompressed" << endl;
+  }
+
+  // TLDR: This routine writes the particle weight, position, and energy in a compact format. The particle positions are stored as
+  //       fixed-point numbers relative to the lower-left corner of the grid patch, with 16 bits for the fractional position inside a cell
+  //       and 16 bits for the cell. The particles are written to a set of one-dimensional datasets, ordered by the grid patches. Each rank
+  //       writes its patches at offsets computed from the number of particles in the preceding patches, so the datasets can be written
+  //       collectively.
+
+  // I call this _particlesC to distinguish it from the other checkpointing methods.
+  const std::string str = m_name + "_particlesC";
+
+  constexpr Real quantization = 65536.0;
+
+  const DisjointBoxLayout& dbl    = m_amr->getGrids(m_realm)[a_level];
+  const DataIterator&      dit    = dbl.dataIterator();
+  const Real               dx     = m_amr->getDx()[a_level];
+  const RealVect           probLo = m_amr->getProbLo();
+
+  const ParticleContainer<ItoParticle>& particles = this->getParticles(WhichContainer::Bulk);
+
+  // Number of particles in each grid patch, and the position of each patch in the datasets.
+  Vector<long long> patchParticles(dbl.size(), 0LL);
+
+  const int nbox = dit.size();
+
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex& din = dit[mybox];
+
+    patchParticles[din.intCode()] = particles[a_level][din].numItems();
+  }
+
+  ParallelOps::vectorSum(patchParticles);
+
+  std::vector<unsigned long long> patchOffsets(dbl.size() + 1, 0ULL);
+  for (int i = 0; i < dbl.size(); i++) {
+    patchOffsets[i + 1] = patchOffsets[i] + patchParticles[i];
+  }
+
+  const unsigned long long numParticles = patchOffsets[dbl.size()];
+
+  // Pack the particles on this rank, in the order of the patches in the layout. Also check if all the weights can be represented in
+  // single precision.
+  std::vector<std::pair<unsigned long long, unsigned long long>> particleRanges;
+  std::vector<std::pair<unsigned long long, unsigned long long>> positionRanges;
+
+  std::vector<uint32_t> positions;
+  std::vector<double>   weights;
+  std::vector<float>    energies;
+
+  int singleWeights = 1;
+
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex& din = dit[mybox];
+
+    const Box      cellBox = dbl[din];
+    const RealVect boxLo   = probLo + RealVect(cellBox.smallEnd()) * dx;
+    const IntVect  boxSize = cellBox.size();
+
+    const unsigned long long offset = patchOffsets[din.intCode()];
+    const unsigned long long count  = patchParticles[din.intCode()];
+
+    particleRanges.emplace_back(offset, count);
+    positionRanges.emplace_back(SpaceDim * offset, SpaceDim * count);
+
+    for (ListIterator<ItoParticle> lit(particles[a_level][din].listItems()); lit.ok(); ++lit) {
+      const ItoParticle& p = lit();
+
+      for (int dir = 0; dir < SpaceDim; dir++) {
+        CH_assert(boxSize[dir] <= 65536);
+
+        const double qMax = quantization * boxSize[dir] - 1.0;
+        const double q    = std::floor(quantization * (p.position()[dir] - boxLo[dir]) / dx);
+
+        positions.emplace_back(static_cast<uint32_t>(std::min(qMax, std::max(0.0, q))));
+      }
+
+      weights.emplace_back(p.weight());
+      energies.emplace_back(static_cast<float>(p.energy()));
+
+      if (static_cast<double>(static_cast<float>(p.weight())) != p.weight()) {
+        singleWeights = 0;
+      }
+    }
+  }
+
+  singleWeights = ParallelOps::min(singleWeights);
+
+  // Write the number of particles per patch from the master rank. It is used for finding the patch offsets when reading the file.
+  std::vector<std::pair<unsigned long long, unsigned long long>> patchRange;
+  if (procID() == 0) {
+    patchRange.emplace_back(0ULL, dbl.size());
+  }
+
+  DischargeIO::writeDataset(a_handle,
+                            str + "_patches",
+                            H5T_STD_I64LE,
+                            H5T_NATIVE_LLONG,
+                            dbl.size(),
+                            patchRange,
+                            &patchParticles[0],
+                            0);
+
+  DischargeIO::writeDataset(a_handle,
+                            str + "_positions",
+                            H5T_STD_U32LE,
+                            H5T_NATIVE_UINT32,
+                            SpaceDim * numParticles,
+                            positionRanges,
+                            positions.data(),
+                            m_checkpointCompression);
+
+  if (singleWeights > 0) {
+    const std::vector<float> weightsFloat(weights.begin(), weights.end());
+
+    DischargeIO::writeDataset(a_handle,
+                              str + "_weights",
+                              H5T_IEEE_F32LE,
+                              H5T_NATIVE_FLOAT,
+                              numParticles,
+                              particleRanges,
+                              weightsFloat.data(),
+                              m_checkpointCompression);
+  }
+  else {
+    DischargeIO::writeDataset(a_handle,
+                              str + "_weights",
+                              H5T_IEEE_F64LE,
+                              H5T_NATIVE_DOUBLE,
+                              numParticles,
+                              particleRanges,
+                              weights.data(),
+                              m_checkpointCompression);
+  }
+
+  DischargeIO::writeDataset(a_handle,
+                            str + "_energies",
+                            H5T_IEEE_F32LE,
+                            H5T_NATIVE_FLOAT,
+                            numParticles,
+                            particleRanges,
+                            energies.data(),
+                            m_checkpointCompression);
+}
+#endif
+
 #ifdef CH_USE_HDF5
 void
 ItoSolver::writeCheckPointLevelFluid(HDF5Handle& a_handle, const int a_level) const
@@ -1100,6 +1341,11 @@ ItoSolver::readCheckpointLevel(HDF5Handle& a_handle, const int a_level)
 
     break;
   }
+  case WhichCheckpoint::Compressed: {
+    this->readCheckpointLevelCompressed(a_handle, a_level);
+
+    break;
+  }
   default: {
     MayDay::Error("ItoSolver::readCheckpointLevel -- logic bust");
 
@@ -1164,6 +1410,96 @@ ItoSolver::readCheckpointLevelParticles(HDF5Handle& a_handle, const int a_level)
 }
 #endif
 
+#ifdef CH_USE_HDF5
+void
+ItoSolver::readCheckpointLevelCompressed(HDF5Handle& a_handle, const int a_level)
+{
+  CH_TIME("ItoSolver::readCheckpointLevelCompressed");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::readCheckpointLevelCompressed" << endl;
+  }
+
+  // TLDR: This is the reverse of writeCheckPointLevelCompressed. We first read the number of particles per patch, which gives the offset of
+  //       each patch in the datasets. Each rank then reads the particles in its own patches and decodes the particle positions.
+
+  ParticleContainer<ItoParticle>& particles = m_particleContainers.at(WhichContainer::Bulk);
+
+  CH_assert(m_checkpointing == WhichCheckpoint::Compressed);
+  CH_assert(!particles.isOrganizedByCell());
+
+  const std::string str = m_name + "_particlesC";
+
+  constexpr Real quantization = 65536.0;
+
+  const DisjointBoxLayout& dbl    = m_amr->getGrids(m_realm)[a_level];
+  const DataIterator&      dit    = dbl.dataIterator();
+  const Real               dx     = m_amr->getDx()[a_level];
+  const RealVect           probLo = m_amr->getProbLo();
+
+  // Every rank reads the number of particles in all the patches.
+  std::vector<long long> patchParticles(dbl.size(), 0LL);
+
+  std::vector<std::pair<unsigned long long, unsigned long long>> patchRange;
+  patchRange.emplace_back(0ULL, dbl.size());
+
+  DischargeIO::readDataset(a_handle, str + "_patches", H5T_NATIVE_LLONG, patchRange, patchParticles.data());
+
+  std::vector<unsigned long long> patchOffsets(dbl.size() + 1, 0ULL);
+  for (int i = 0; i < dbl.size(); i++) {
+    patchOffsets[i + 1] = patchOffsets[i] + patchParticles[i];
+  }
+
+  // Figure out which parts of the datasets this rank reads.
+  std::vector<std::pair<unsigned long long, unsigned long long>> particleRanges;
+  std::vector<std::pair<unsigned long long, unsigned long long>> positionRanges;
+
+  unsigned long long numLocalParticles = 0ULL;
+
+  const int nbox = dit.size();
+
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex& din = dit[mybox];
+
+    const unsigned long long offset = patchOffsets[din.intCode()];
+    const unsigned long long count  = patchParticles[din.intCode()];
+
+    particleRanges.emplace_back(offset, count);
+    positionRanges.emplace_back(SpaceDim * offset, SpaceDim * count);
+
+    numLocalParticles += count;
+  }
+
+  std::vector<uint32_t> positions(SpaceDim * numLocalParticles);
+  std::vector<double>   weights(numLocalParticles);
+  std::vector<float>    energies(numLocalParticles);
+
+  // Note that the weights might be stored in single precision -- HDF5 converts them to double when reading.
+  DischargeIO::readDataset(a_handle, str + "_positions", H5T_NATIVE_UINT32, positionRanges, positions.data());
+  DischargeIO::readDataset(a_handle, str + "_weights", H5T_NATIVE_DOUBLE, particleRanges, weights.data());
+  DischargeIO::readDataset(a_handle, str + "_energies", H5T_NATIVE_FLOAT, particleRanges, energies.data());
+
+  // Instantiate the particles.
+  unsigned long long k = 0ULL;
+
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex& din = dit[mybox];
+
+    const RealVect boxLo = probLo + RealVect(dbl[din].smallEnd()) * dx;
+
+    List<ItoParticle>& itoParticles = particles[a_level][din].listItems();
+
+    for (long long i = 0; i < patchParticles[din.intCode()]; i++, k++) {
+      RealVect pos;
+      for (int dir = 0; dir < SpaceDim; dir++) {
+        pos[dir] = boxLo[dir] + (positions[SpaceDim * k + dir] + 0.5) * dx / quantization;
+      }
+
+      itoParticles.append(ItoParticle(weights[k], pos, RealVect::Zero, 0.0, 0.0, energies[k]));
+    }
+  }
+}
+#endif
+
 #ifdef CH_USE_HDF5
 void
 ItoSolver::readCheckpointLevelFluid(HDF5Handle& a_handle, const int a_level)
@@ -1674,23 +2010,12 @@ ItoSolver::computeAverageMobility(EBAMRCellData& a_phi, ParticleContainer<ItoPar
     pout() << m_name + "::computeAverageMobility(EBAMRCellData, ParticleContainer)" << endl;
   }
 
-  CH_assert(a_phi[0]->nComp() == 1);
-  CH_assert(!a_particles.isOrganizedByCell());
-
-  EBAMRCellData weight;
-  m_amr->allocate(weight, m_realm, m_phase, m_nComp);
-
-  // Deposit weight*mu and weight
-  this->depositParticles<ItoParticle, &ItoParticle::conductivity>(a_phi,
-                                                                  a_particles,
-                                                                  m_deposition,
-                                                                  m_coarseFineDeposition);
-  this->depositParticles<ItoParticle, &ItoParticle::weight>(weight, a_particles, m_deposition, m_coarseFineDeposition);
-
-  // Make averageMobility = weight*mu/weight. If there is no weight then set the value to zero.
-  constexpr Real zero = 0.0;
+  // Deposit weight*mu and weight in the same pass, and make the average = weight*mu/weight.
+  auto weightedField = [](const ItoParticle& a_particle) -> Real {
+    return a_particle.conductivity();
+  };
 
-  DataOps::divideFallback(a_phi, weight, zero);
+  this->computeWeightedAverage(a_phi, a_particles, weightedField);
 }
 
 void
@@ -1701,23 +2026,12 @@ ItoSolver::computeAverageDiffusion(EBAMRCellData& a_phi, ParticleContainer<ItoPa
     pout() << m_name + "::computeAverageDiffusion(EBAMRCellData, ParticleContainer)" << endl;
   }
 
-  CH_assert(a_phi[0]->nComp() == 1);
-  CH_assert(!a_particles.isOrganizedByCell());
-
-  EBAMRCellData weight;
-  m_amr->allocate(weight, m_realm, m_phase, m_nComp);
-
-  // Deposit weight*D and weight
-  this->depositParticles<ItoParticle, &ItoParticle::diffusivity>(a_phi,
-                                                                 a_particles,
-                                                                 m_deposition,
-                                                                 m_coarseFineDeposition);
-  this->depositParticles<ItoParticle, &ItoParticle::weight>(weight, a_particles, m_deposition, m_coarseFineDeposition);
-
-  // Make average diffusion coefficient = weight*D/weight. If there is no weight then set the value to zero.
-  constexpr Real zero = 0.0;
+  // Deposit weight*D and weight in the same pass, and make the average = weight*D/weight.
+  auto weightedField = [](const ItoParticle& a_particle) -> Real {
+    return a_particle.diffusivity();
+  };
 
-  DataOps::divideFallback(a_phi, weight, zero);
+  this->computeWeightedAverage(a_phi, a_particles, weightedField);
 }
 
 void
@@ -1728,24 +2042,12 @@ ItoSolver::computeAverageEnergy(EBAMRCellData& a_phi, ParticleContainer<ItoParti
     pout() << m_name + "::computeAverageEnergy(EBAMRCellData, ParticleContainer)" << endl;
   }
 
-  CH_assert(a_phi[0]->nComp() == 1);
-  CH_assert(!a_particles.isOrganizedByCell());
-
-  // Need scratch storage to deposit into
-  EBAMRCellData weight;
-  m_amr->allocate(weight, m_realm, m_phase, m_nComp);
-
-  // Deposit weight*energy and weight
-  this->depositParticles<ItoParticle, &ItoParticle::totalEnergy>(a_phi,
-                                                                 a_particles,
-                                                                 m_deposition,
-                                                                 m_coarseFineDeposition);
-  this->depositParticles<ItoParticle, &ItoParticle::weight>(weight, a_particles, m_deposition, m_coarseFineDeposition);
-
-  // Make average energy = weight*energy/weight. If there is no weight then set the value to zero.
-  constexpr Real zero = 0.0;
+  // Deposit weight*energy and weight in the same pass, and make the average = weight*energy/weight.
+  auto weightedField = [](const ItoParticle& a_particle) -> Real {
+    return a_particle.totalEnergy();
+  };
 
-  DataOps::divideFallback(a_phi, weight, zero);
+  this->computeWeightedAverage(a_phi, a_particles, weightedField);
 }
 
 void
@@ -1795,23 +2097,7 @@ ItoSolver::redistributeAMR(EBAMRCellData& a_phi) const
     this->depositNonConservative(m_depositionNC, a_phi);    // Compute m_depositionNC = sum(kappa*Wc)/sum(kappa)
     this->depositHybrid(a_phi, m_massDiff, m_depositionNC); // Compute hybrid deposition, including mass differnce
 
-    Vector<RefCountedPtr<EBFluxRedistribution>>& redistOps = m_amr->getRedistributionOp(m_realm, m_phase);
-    for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
-      const Real     scale     = 1.0;
-      const Interval variables = Interval(0, 0);
-      const bool     hasCoar   = lvl > 0;
-      const bool     hasFine   = lvl < m_amr->getFinestLevel();
-
-      if (hasCoar) {
-        redistOps[lvl]->redistributeCoar(*a_phi[lvl - 1], *m_massDiff[lvl], scale, variables);
-      }
-
-      redistOps[lvl]->redistributeLevel(*a_phi[lvl], *m_massDiff[lvl], scale, variables);
-
-      if (hasFine) {
-        redistOps[lvl]->redistributeFine(*a_phi[lvl + 1], *m_massDiff[lvl], scale, variables);
-      }
-    }
+    m_amr->redistribute(a_phi, m_massDiff, m_realm, m_phase, Interval(0, 0));
   }
 }
 
@@ -2102,6 +2388,10 @@ ItoSolver::interpolateVelocities(const int a_lvl, const DataIndex& a_dit)
     pout() << m_name + "::interpolateVelocities" << endl;
   }
 
+  // Particle kernels do not go through BoxLoops, so time the whole patch.
+  const BoxCosts::Scope     costScope(m_realm, a_lvl, m_amr->getGrids(m_realm)[a_lvl][a_dit]);
+  const BoxCosts::LoopTimer costTimer;
+
   ParticleContainer<ItoParticle>& particles = m_particleContainers.at(WhichContainer::Bulk);
 
   EBAMRParticleMesh& particleMesh = m_amr->getParticleMesh(m_realm, m_phase);
@@ -2182,6 +2472,10 @@ ItoSolver::interpolateMobilities(const int a_lvl, const DataIndex& a_dit, const
     pout() << m_name + "::interpolateMobilities(lvl, patch)" << endl;
   }
 
+  // Particle kernels do not go through BoxLoops, so time the whole patch.
+  const BoxCosts::Scope     costScope(m_realm, a_lvl, m_amr->getGrids(m_realm)[a_lvl][a_dit]);
+  const BoxCosts::LoopTimer costTimer;
+
   CH_assert(m_isMobile);
 
   switch (m_mobilityInterp) {
@@ -2367,6 +2661,10 @@ ItoSolver::interpolateDiffusion(const int a_lvl, const DataIndex& a_dit)
     pout() << m_name + "::interpolateDiffusion" << endl;
   }
 
+  // Particle kernels do not go through BoxLoops, so time the whole patch.
+  const BoxCosts::Scope     costScope(m_realm, a_lvl, m_amr->getGrids(m_realm)[a_lvl][a_dit]);
+  const BoxCosts::LoopTimer costTimer;
+
   if (m_isDiffusive) {
 
     // These are the particles that will be interpolated.
@@ -2389,6 +2687,131 @@ ItoSolver::interpolateDiffusion(const int a_lvl, const DataIndex& a_dit)
   }
 }
 
+void
+ItoSolver::interpolateTransportCoefficients()
+{
+  CH_TIME("ItoSolver::interpolateTransportCoefficients()");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::interpolateTransportCoefficients()" << endl;
+  }
+
+  if (m_isMobile || m_isDiffusive) {
+    for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
+      const DisjointBoxLayout& dbl = m_amr->getGrids(m_realm)[lvl];
+      const DataIterator&      dit = dbl.dataIterator();
+
+      const int nbox = dit.size();
+
+#pragma omp parallel for schedule(runtime)
+      for (int mybox = 0; mybox < nbox; mybox++) {
+        const DataIndex& din = dit[mybox];
+
+        this->interpolateTransportCoefficients(lvl, din);
+      }
+    }
+  }
+}
+
+void
+ItoSolver::interpolateTransportCoefficients(const int a_lvl, const DataIndex& a_dit) noexcept
+{
+  CH_TIME("ItoSolver::interpolateTransportCoefficients(lvl, patch)");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::interpolateTransportCoefficients(lvl, patch)" << endl;
+  }
+
+  // TLDR: We copy the velocity function V, the mobility function mu, and the diffusion function D into one
+  //       multi-component scratch field and interpolate all of them to the particles in one go. With
+  //       mobility_interp = velocity we also store |V| and mu*|V| so that the mobility can be computed as
+  //       mu(Xp) = [mu*|V|](Xp)/|V|(Xp), just like interpolateMobilitiesVelocity does. Note that particle-mesh
+  //       interpolation only uses the regular data holders, so we only fill those.
+
+  // Particle kernels do not go through BoxLoops, so time the whole patch.
+  const BoxCosts::Scope     costScope(m_realm, a_lvl, m_amr->getGrids(m_realm)[a_lvl][a_dit]);
+  const BoxCosts::LoopTimer costTimer;
+
+  CH_assert(m_isMobile || m_isDiffusive);
+
+  const bool interpSpeed = m_isMobile && (m_mobilityInterp == WhichMobilityInterpolation::Velocity);
+
+  // Component layout of the scratch field.
+  int numComp   = 0;
+  int veloComp  = -1;
+  int muComp    = -1;
+  int speedComp = -1;
+  int dcoComp   = -1;
+
+  if (m_isMobile) {
+    veloComp = numComp;
+    numComp += SpaceDim;
+    muComp = numComp++;
+
+    if (interpSpeed) {
+      speedComp = numComp++;
+    }
+  }
+  if (m_isDiffusive) {
+    dcoComp = numComp++;
+  }
+
+  const EBCellFAB& templateData = m_isMobile ? (*m_velocityFunction[a_lvl])[a_dit]
+                                             : (*m_diffusionFunction[a_lvl])[a_dit];
+  const Box        fieldBox     = templateData.box();
+
+  EBCellFAB meshFields(templateData.getEBISBox(), fieldBox, numComp);
+  meshFields.setVal(0.0);
+
+  FArrayBox& meshFieldsFAB = meshFields.getFArrayBox();
+
+  if (m_isMobile) {
+    meshFieldsFAB.copy((*m_velocityFunction[a_lvl])[a_dit].getFArrayBox(), 0, veloComp, SpaceDim);
+    meshFieldsFAB.copy((*m_mobilityFunction[a_lvl])[a_dit].getFArrayBox(), 0, muComp, 1);
+
+    if (interpSpeed) {
+      auto speedKernel = [&](const IntVect& iv) -> void {
+        Real speed = 0.0;
+        for (int dir = 0; dir < SpaceDim; dir++) {
+          speed += meshFieldsFAB(iv, veloComp + dir) * meshFieldsFAB(iv, veloComp + dir);
+        }
+        speed = std::sqrt(speed);
+
+        meshFieldsFAB(iv, speedComp) = speed;
+        meshFieldsFAB(iv, muComp) *= speed;
+      };
+
+      BoxLoops::loop(fieldBox, speedKernel);
+    }
+  }
+  if (m_isDiffusive) {
+    meshFieldsFAB.copy((*m_diffusionFunction[a_lvl])[a_dit].getFArrayBox(), 0, dcoComp, 1);
+  }
+
+  ParticleContainer<ItoParticle>& particles    = m_particleContainers.at(WhichContainer::Bulk);
+  List<ItoParticle>&              particleList = particles[a_lvl][a_dit].listItems();
+
+  const EBParticleMesh& meshInterp = m_amr->getParticleMesh(m_realm, m_phase).getEBParticleMesh(a_lvl, a_dit);
+
+  // Set the particle fields from the interpolated values.
+  auto setFields = [&](ItoParticle& p, const Real* a_values) -> void {
+    if (m_isMobile) {
+      Real mu = a_values[muComp];
+
+      if (interpSpeed) {
+        mu *= 1. / a_values[speedComp];
+      }
+
+      p.mobility() = mu;
+      p.velocity() = RealVect(D_DECL(a_values[veloComp], a_values[veloComp + 1], a_values[veloComp + 2]));
+      p.velocity() *= p.mobility();
+    }
+    if (m_isDiffusive) {
+      p.diffusion() = a_values[dcoComp];
+    }
+  };
+
+  meshInterp.interpolateFields(particleList, meshFields, m_deposition, m_forceIrregInterpolationNGP, setFields);
+}
+
 void
 ItoSolver::updateDiffusion()
 {
@@ -2439,30 +2862,30 @@ ItoSolver::updateDiffusion(const int a_level, const DataIndex a_dit)
 }
 
 Real
-ItoSolver::computeDt() const
+ItoSolver::computeDt(const bool a_localOnly) const
 {
-  CH_TIME("ItoSolver::computeDt()");
+  CH_TIME("ItoSolver::computeDt(bool)");
   if (m_verbosity > 5) {
-    pout() << m_name + "::computeDt()" << endl;
+    pout() << m_name + "::computeDt(bool)" << endl;
   }
 
   Real dt = std::numeric_limits<Real>::max();
 
   for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
-    const Real levelDt = this->computeDt(lvl);
+    const Real levelDt = this->computeDt(lvl, true);
 
     dt = std::min(dt, levelDt);
   }
 
-  return dt;
+  return a_localOnly ? dt : ParallelOps::min(dt);
 }
 
 Real
-ItoSolver::computeDt(const int a_lvl) const
+ItoSolver::computeDt(const int a_lvl, const bool a_localOnly) const
 {
-  CH_TIME("ItoSolver::computeDt(int)");
+  CH_TIME("ItoSolver::computeDt(int, bool)");
   if (m_verbosity > 5) {
-    pout() << m_name + "::computeDt(int)" << endl;
+    pout() << m_name + "::computeDt(int, bool)" << endl;
   }
 
   Real dt = std::numeric_limits<Real>::max();
@@ -2482,7 +2905,7 @@ ItoSolver::computeDt(const int a_lvl) const
     dt = std::min(dt, patchDt);
   }
 
-  return ParallelOps::min(dt);
+  return a_localOnly ? dt : ParallelOps::min(dt);
 }
 
 Real
@@ -2563,11 +2986,11 @@ ItoSolver::computeDt(const int a_lvl, const DataIndex& a_dit) const
 }
 
 Real
-ItoSolver::computeHopDt(const Real a_maxCellsToMove) const
+ItoSolver::computeHopDt(const Real a_maxCellsToMove, const bool a_localOnly) const
 {
-  CH_TIME("ItoSolver::computeHopDt(Real)");
+  CH_TIME("ItoSolver::computeHopDt(Real, bool)");
   if (m_verbosity > 5) {
-    pout() << m_name + "::computeHopDt(Real)" << endl;
+    pout() << m_name + "::computeHopDt(Real, bool)" << endl;
   }
 
   CH_assert(a_maxCellsToMove > 0.0);
@@ -2579,20 +3002,20 @@ ItoSolver::computeHopDt(const Real a_maxCellsToMove) const
 
   // Compute time steps for each grid level.
   for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
-    const Real levelDt = this->computeHopDt(a_maxCellsToMove, lvl);
+    const Real levelDt = this->computeHopDt(a_maxCellsToMove, lvl, true);
 
     dt = std::min(dt, levelDt);
   }
 
-  return dt;
+  return a_localOnly ? dt : ParallelOps::min(dt);
 }
 
 Real
-ItoSolver::computeHopDt(const Real a_maxCellsToMove, const int a_lvl) const
+ItoSolver::computeHopDt(const Real a_maxCellsToMove, const int a_lvl, const bool a_localOnly) const
 {
-  CH_TIME("ItoSolver::computeHopDt(Real, int)");
+  CH_TIME("ItoSolver::computeHopDt(Real, int, bool)");
   if (m_verbosity > 5) {
-    pout() << m_name + "::computeHopDt(Real, int)" << endl;
+    pout() << m_name + "::computeHopDt(Real, int, bool)" << endl;
   }
 
   CH_assert(a_maxCellsToMove > 0.0);
@@ -2617,7 +3040,7 @@ ItoSolver::computeHopDt(const Real a_maxCellsToMove, const int a_lvl) const
     dt = std::min(dt, patchDt);
   }
 
-  return ParallelOps::min(dt);
+  return a_localOnly ? dt : ParallelOps::min(dt);
 }
 
 Real
@@ -2722,11 +3145,11 @@ ItoSolver::computeHopDt(const Real a_maxCellsToMove, const int a_lvl, const Data
 }
 
 Real
-ItoSolver::computeAdvectiveDt() const
+ItoSolver::computeAdvectiveDt(const bool a_localOnly) const
 {
-  CH_TIME("ItoSolver::computeAdvectiveDt");
+  CH_TIME("ItoSolver::computeAdvectiveDt(bool)");
   if (m_verbosity > 5) {
-    pout() << m_name + "::computeAdvectiveDt()" << endl;
+    pout() << m_name + "::computeAdvectiveDt(bool)" << endl;
   }
 
   // TLDR: We compute dt = dx/vMax for every particle.
@@ -2734,20 +3157,20 @@ ItoSolver::computeAdvectiveDt() const
   Real dt = std::numeric_limits<Real>::max();
 
   for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
-    const Real levelDt = this->computeAdvectiveDt(lvl);
+    const Real levelDt = this->computeAdvectiveDt(lvl, true);
 
     dt = std::min(levelDt, dt);
   }
 
-  return dt;
+  return a_localOnly ? dt : ParallelOps::min(dt);
 }
 
 Real
-ItoSolver::computeAdvectiveDt(const int a_lvl) const
+ItoSolver::computeAdvectiveDt(const int a_lvl, const bool a_localOnly) const
 {
-  CH_TIME("ItoSolver::computeAdvectiveDt(int)");
+  CH_TIME("ItoSolver::computeAdvectiveDt(int, bool)");
   if (m_verbosity > 5) {
-    pout() << m_name + "::computeAdvectiveDt(int)" << endl;
+    pout() << m_name + "::computeAdvectiveDt(int, bool)" << endl;
   }
 
   CH_assert(a_lvl >= 0);
@@ -2771,7 +3194,7 @@ ItoSolver::computeAdvectiveDt(const int a_lvl) const
     dt = std::min(dt, patchDt);
   }
 
-  return ParallelOps::min(dt);
+  return a_localOnly ? dt : ParallelOps::min(dt);
 }
 
 Real
@@ -2810,11 +3233,11 @@ ItoSolver::computeAdvectiveDt(const int a_lvl, const DataIndex& a_dit) const
 }
 
 Real
-ItoSolver::computeDiffusiveDt() const
+ItoSolver::computeDiffusiveDt(const bool a_localOnly) const
 {
-  CH_TIME("ItoSolver::computeDiffusiveDt()");
+  CH_TIME("ItoSolver::computeDiffusiveDt(bool)");
   if (m_verbosity > 5) {
-    pout() << m_name + "::computeDiffusiveDt()" << endl;
+    pout() << m_name + "::computeDiffusiveDt(bool)" << endl;
   }
 
   // TLDR: Compute dt = dx*dx/(2*D) on each grid patchon every grid level.
@@ -2822,20 +3245,20 @@ ItoSolver::computeDiffusiveDt() const
   Real dt = std::numeric_limits<Real>::max();
 
   for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
-    const Real levelDt = this->computeDiffusiveDt(lvl);
+    const Real levelDt = this->computeDiffusiveDt(lvl, true);
 
     dt = std::min(dt, levelDt);
   }
 
-  return dt;
+  return a_localOnly ? dt : ParallelOps::min(dt);
 }
 
 Real
-ItoSolver::computeDiffusiveDt(const int a_lvl) const
+ItoSolver::computeDiffusiveDt(const int a_lvl, const bool a_localOnly) const
 {
-  CH_TIME("ItoSolver::computeDiffusiveDt(int)");
+  CH_TIME("ItoSolver::computeDiffusiveDt(int, bool)");
   if (m_verbosity > 5) {
-    pout() << m_name + "::computeDiffusiveDt(int)" << endl;
+    pout() << m_name + "::computeDiffusiveDt(int, bool)" << endl;
   }
 
   CH_assert(a_lvl >= 0);
@@ -2858,7 +3281,7 @@ ItoSolver::computeDiffusiveDt(const int a_lvl) const
     dt = std::min(dt, patchDt);
   }
 
-  return ParallelOps::min(dt);
+  return a_localOnly ? dt : ParallelOps::min(dt);
 }
 
 Real
@@ -2931,6 +3354,10 @@ ItoSolver::remap(const WhichContainer a_container)
   ParticleContainer<ItoParticle>& particles = this->getParticles(a_container);
 
   particles.remap();
+
+  if (a_container == WhichContainer::Bulk && m_particleSorting != ParticleSorting::None) {
+    particles.sortParticles(m_particleSorting);
+  }
 }
 
 DepositionType
@@ -3055,14 +3482,38 @@ ItoSolver::makeSuperparticles(const WhichContainer a_container,
   const Real     dx      = m_amr->getDx()[a_level];
   const EBISBox& ebisbox = m_amr->getEBISLayout(m_realm, m_phase)[a_level][a_dit];
 
+  // TLDR: With merging hysteresis we only re-merge cells where the particle count grew beyond the hysteresis factor, or
+  //       where the particle count dropped since the last merge (in which case the merger might want to split particles).
+  //       The particle counts after the last merge are stored in m_mergeCounts. Empty cells are reset so that they are
+  //       always merged once they are populated again. This is only done for the bulk particles.
+  const bool useHysteresis = (m_mergeHysteresis > 1.0) && (a_container == WhichContainer::Bulk);
+  const Real maxParticles  = m_mergeHysteresis * a_particlesPerCell;
+
+  BaseFab<Real>& mergeCounts = (*m_mergeCounts[a_level])[a_dit].getSingleValuedFAB();
+
+  auto mergeCell = [&](List<ItoParticle>& a_cellParticles, const IntVect& a_iv, const CellInfo& a_cellInfo) -> void {
+    const int numParticles = a_cellParticles.length();
+
+    if (numParticles > 0) {
+      const Real prevParticles = mergeCounts(a_iv, 0);
+
+      if (!useHysteresis || prevParticles < 0.0 || numParticles > maxParticles || numParticles < prevParticles) {
+        m_particleMerger(a_cellParticles, a_cellInfo, a_particlesPerCell);
+
+        mergeCounts(a_iv, 0) = a_cellParticles.length();
+      }
+    }
+    else {
+      mergeCounts(a_iv, 0) = -1.0;
+    }
+  };
+
   // Kernel for particle merging in regular cells
   auto regularKernel = [&](const IntVect& iv) -> void {
     if (ebisbox.isRegular(iv)) {
       List<ItoParticle>& particles = cellParticles(iv, m_comp);
 
-      if (particles.length() > 0) {
-        m_particleMerger(particles, CellInfo(iv, dx), a_particlesPerCell);
-      }
+      mergeCell(particles, iv, CellInfo(iv, dx));
     }
   };
 
@@ -3072,15 +3523,11 @@ ItoSolver::makeSuperparticles(const WhichContainer a_container,
 
     List<ItoParticle>& particles = cellParticles(iv, m_comp);
 
-    if (particles.length() > 0) {
-      const Real      kappa         = ebisbox.volFrac(vof);
-      const RealVect& bndryCentroid = ebisbox.bndryCentroid(vof);
-      const RealVect& bndryNormal   = ebisbox.normal(vof);
+    const Real      kappa         = ebisbox.volFrac(vof);
+    const RealVect& bndryCentroid = ebisbox.bndryCentroid(vof);
+    const RealVect& bndryNormal   = ebisbox.normal(vof);
 
-      CellInfo cellInfo(iv, dx, kappa, bndryCentroid, bndryNormal);
-
-      m_particleMerger(particles, cellInfo, a_particlesPerCell);
-    }
+    mergeCell(particles, iv, CellInfo(iv, dx, kappa, bndryCentroid, bndryNormal));
   };
 
   // Iteration space.
@@ -3110,14 +3557,16 @@ ItoSolver::makeSuperparticlesEqualWeightKD(List<ItoParticle>& a_particles,
   CH_TIMER("ItoSolver::makeSuperparticlesEqualWeightKD::build_kd", t2);
   CH_TIMER("ItoSolver::makeSuperparticlesEqualWeightKD::merge_particles", t3);
 
-  using PType        = NonCommParticle<2, 1>;
-  using Node         = KDNode<PType>;
-  using ParticleList = KDNode<PType>::ParticleList;
+  using PType = NonCommParticle<2, 1>;
+
+  // Buffers are reused between calls in order to avoid memory allocations in every cell.
+  static thread_local std::vector<PType>                     particles;
+  static thread_local std::vector<size_t>                    indices;
+  static thread_local std::vector<std::pair<size_t, size_t>> leaves;
 
   // 1. Make the input list into a vector of particles with a smaller memory footprint.
   CH_START(t1);
-  Real         W = 0.0;
-  ParticleList particles;
+  particles.clear();
   for (ListIterator<ItoParticle> lit(a_particles); lit.ok(); ++lit) {
     PType p;
 
@@ -3125,8 +3574,6 @@ ItoSolver::makeSuperparticlesEqualWeightKD(List<ItoParticle>& a_particles,
     p.template real<1>() = lit().energy();
     p.template vect<0>() = lit().position();
 
-    W += lit().weight();
-
     particles.emplace_back(p);
   }
   CH_STOP(t1);
@@ -3137,12 +3584,15 @@ ItoSolver::makeSuperparticlesEqualWeightKD(List<ItoParticle>& a_particles,
     p2.template real<1>() = p0.template real<1>();
   };
 
-  // 2. Build KD-tree.
-  const std::vector<std::shared_ptr<Node>> leaves = ParticleManagement::
-    recursivePartitionAndSplitEqualWeightKD<PType, &PType::template real<0>, &PType::template vect<0>>(
-      particles,
-      a_ppc,
-      particleReconcile);
+  // 2. Partition the particles in-place using an equal-weight KD partitioning.
+  CH_START(t2);
+  ParticleManagement::recursivePartitionAndSplitEqualWeightKD<PType, &PType::template real<0>, &PType::template vect<0>>(
+    particles,
+    indices,
+    leaves,
+    a_ppc,
+    particleReconcile);
+  CH_STOP(t2);
 
   // Merge leaves into new particles.
   CH_START(t3);
@@ -3153,7 +3603,9 @@ ItoSolver::makeSuperparticlesEqualWeightKD(List<ItoParticle>& a_particles,
     Real     e = 0.0;
     RealVect x = RealVect::Zero;
 
-    for (const auto& p : l->getParticles()) {
+    for (size_t i = l.first; i < l.second; i++) {
+      const PType& p = particles[indices[i]];
+
       w += p.template real<0>();
       x += p.template real<0>() * p.template vect<0>();
       e += p.template real<0>() * p.template real<1>();
@@ -3214,6 +3666,178 @@ ItoSolver::reinitializeParticles(List<ItoParticle>& a_particles,
   }
 }
 
+void
+ItoSolver::makeSuperparticlesEnergyGroups(List<ItoParticle>& a_particles,
+                                          const CellInfo&    a_cellInfo,
+                                          const int          a_ppc) const noexcept
+{
+  CH_TIMERS("ItoSolver::makeSuperparticlesEnergyGroups");
+  CH_TIMER("ItoSolver::makeSuperparticlesEnergyGroups::populate_list", t1);
+  CH_TIMER("ItoSolver::makeSuperparticlesEnergyGroups::bin_particles", t2);
+  CH_TIMER("ItoSolver::makeSuperparticlesEnergyGroups::merge_particles", t3);
+
+  // This algorithm does not split particles, so there is nothing to do if we already have few enough particles.
+  if (a_ppc <= 0 || a_particles.length() <= a_ppc) {
+    return;
+  }
+
+  using PType = NonCommParticle<2, 1>;
+
+  // Buffers are reused between calls in order to avoid memory allocations in every cell.
+  static thread_local std::vector<PType> particles;
+  static thread_local std::vector<PType> sortedParticles;
+  static thread_local std::vector<int>   keys;
+  static thread_local std::vector<int>   offsets;
+  static thread_local std::vector<int>   cursors;
+
+  // 1. Make the input list into a vector of particles with a smaller memory footprint and find the energy range.
+  CH_START(t1);
+  particles.clear();
+
+  Real minEnergy = std::numeric_limits<Real>::max();
+  Real maxEnergy = -std::numeric_limits<Real>::max();
+
+  for (ListIterator<ItoParticle> lit(a_particles); lit.ok(); ++lit) {
+    PType p;
+
+    p.template real<0>() = lit().weight();
+    p.template real<1>() = lit().energy();
+    p.template vect<0>() = lit().position();
+
+    minEnergy = std::min(minEnergy, p.template real<1>());
+    maxEnergy = std::max(maxEnergy, p.template real<1>());
+
+    particles.emplace_back(p);
+  }
+  CH_STOP(t1);
+
+  // 2. Counting sort of the particles into energy groups, and into cell octants within each group. We never use more
+  //    groups than the target number of particles so that every non-empty group can receive at least one particle.
+  CH_START(t2);
+  const int      numGroups   = std::max(1, std::min(m_mergeEnergyGroups, a_ppc));
+  const int      numOctants  = 1 << SpaceDim;
+  const int      numKeys     = numGroups * numOctants;
+  const Real     energyRange = maxEnergy - minEnergy;
+  const RealVect cellCenter  = m_amr->getProbLo() +
+                              a_cellInfo.getDx() * (RealVect(a_cellInfo.getGridIndex()) + 0.5 * RealVect::Unit);
+
+  keys.resize(particles.size());
+  offsets.assign(numKeys + 1, 0);
+
+  for (size_t i = 0; i < particles.size(); i++) {
+    const PType&    p = particles[i];
+    const RealVect& x = p.template vect<0>();
+
+    int group = 0;
+    if (energyRange > 0.0) {
+      group = std::min(numGroups - 1, int(numGroups * (p.template real<1>() - minEnergy) / energyRange));
+    }
+
+    int octant = 0;
+    for (int dir = 0; dir < SpaceDim; dir++) {
+      if (x[dir] > cellCenter[dir]) {
+        octant += 1 << dir;
+      }
+    }
+
+    keys[i] = group * numOctants + octant;
+
+    offsets[keys[i] + 1]++;
+  }
+
+  for (int k = 0; k < numKeys; k++) {
+    offsets[k + 1] += offsets[k];
+  }
+
+  cursors.assign(offsets.begin(), offsets.end() - 1);
+  sortedParticles.resize(particles.size());
+
+  for (size_t i = 0; i < particles.size(); i++) {
+    sortedParticles[cursors[keys[i]]++] = particles[i];
+  }
+  CH_STOP(t2);
+
+  // 3. Distribute the target number of particles over the non-empty groups. Each group gets at least one particle,
+  //    and the remaining ones are distributed according to the group weights.
+  CH_START(t3);
+  Real totalWeight    = 0.0;
+  int  nonEmptyGroups = 0;
+
+  for (int g = 0; g < numGroups; g++) {
+    const int begin = offsets[g * numOctants];
+    const int end   = offsets[(g + 1) * numOctants];
+
+    if (end > begin) {
+      nonEmptyGroups++;
+    }
+
+    for (int i = begin; i < end; i++) {
+      totalWeight += sortedParticles[i].template real<0>();
+    }
+  }
+
+  const int remainingParticles = a_ppc - nonEmptyGroups;
+
+  // 4. Merge each group into superparticles with approximately equal weights. The particles are visited in octant order
+  //    so that merged subsets are spatially compact.
+  a_particles.clear();
+
+  for (int g = 0; g < numGroups; g++) {
+    const int begin = offsets[g * numOctants];
+    const int end   = offsets[(g + 1) * numOctants];
+
+    if (end == begin) {
+      continue;
+    }
+
+    Real groupWeight = 0.0;
+    for (int i = begin; i < end; i++) {
+      groupWeight += sortedParticles[i].template real<0>();
+    }
+
+    int numMerged = 1;
+    if (totalWeight > 0.0) {
+      numMerged += int(std::floor(remainingParticles * groupWeight / totalWeight));
+    }
+    numMerged = std::min(numMerged, end - begin);
+
+    const Real targetWeight = groupWeight / numMerged;
+
+    Real     cumulativeWeight = 0.0;
+    int      numCreated       = 0;
+    Real     w                = 0.0;
+    Real     e                = 0.0;
+    RealVect x                = RealVect::Zero;
+
+    for (int i = begin; i < end; i++) {
+      const PType& p = sortedParticles[i];
+
+      w += p.template real<0>();
+      x += p.template real<0>() * p.template vect<0>();
+      e += p.template real<0>() * p.template real<1>();
+
+      cumulativeWeight += p.template real<0>();
+
+      const bool lastParticle = (i == end - 1);
+      const bool fullSubset   = (numCreated < numMerged - 1) && (cumulativeWeight >= (numCreated + 1) * targetWeight);
+
+      if ((lastParticle || fullSubset) && w > 0.0) {
+        x *= 1. / w;
+        e *= 1. / w;
+
+        a_particles.add(ItoParticle(w, x, RealVect::Zero, 0.0, 0.0, e));
+
+        numCreated++;
+
+        w = 0.0;
+        e = 0.0;
+        x = RealVect::Zero;
+      }
+    }
+  }
+  CH_STOP(t3);
+}
+
 void
 ItoSolver::clear(const WhichContainer a_container)
 {
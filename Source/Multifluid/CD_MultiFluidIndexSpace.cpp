@@ -11,6 +11,8 @@
 
 // Chombo includes
 #include <AllRegularService.H>
+#include <CH_HDF5.H>
+#include <CH_Timer.H>
 
 // Our includes
 #include <CD_MultiFluidIndexSpace.H>
@@ -61,6 +63,52 @@ MultiFluidIndexSpace::define(const Box&                      a_domain,
   }
 }
 
+#ifdef CH_USE_HDF5
+void
+MultiFluidIndexSpace::define(const std::string a_gasFile, const std::string a_solidFile, int a_maxCoarsenings)
+{
+  CH_TIME("MultiFluidIndexSpace::define(string, string, int)");
+
+  HDF5Handle gasHandle(a_gasFile.c_str(), HDF5Handle::OPEN_RDONLY);
+  m_ebis[phase::gas]->define(gasHandle, a_maxCoarsenings);
+  gasHandle.close();
+
+  MemoryReport::getMaxMinMemoryUsage();
+
+  // The solid phase might not exist.
+  if (a_solidFile.empty()) {
+    m_ebis[phase::solid] = RefCountedPtr<EBIndexSpace>(NULL);
+  }
+  else {
+    if (m_ebis[phase::solid].isNull()) {
+      m_ebis[phase::solid] = RefCountedPtr<EBIndexSpace>(new EBIndexSpace());
+    }
+
+    HDF5Handle solidHandle(a_solidFile.c_str(), HDF5Handle::OPEN_RDONLY);
+    m_ebis[phase::solid]->define(solidHandle, a_maxCoarsenings);
+    solidHandle.close();
+
+    MemoryReport::getMaxMinMemoryUsage();
+  }
+}
+
+void
+MultiFluidIndexSpace::writeEBIS(const std::string a_gasFile, const std::string a_solidFile) const
+{
+  CH_TIME("MultiFluidIndexSpace::writeEBIS");
+
+  HDF5Handle gasHandle(a_gasFile.c_str(), HDF5Handle::CREATE);
+  m_ebis[phase::gas]->write(gasHandle);
+  gasHandle.close();
+
+  if (!(m_ebis[phase::solid].isNull())) {
+    HDF5Handle solidHandle(a_solidFile.c_str(), HDF5Handle::CREATE);
+    m_ebis[phase::solid]->write(solidHandle);
+    solidHandle.close();
+  }
+}
+#endif
+
 const RefCountedPtr<EBIndexSpace>&
 MultiFluidIndexSpace::getEBIndexSpace(const phase::which_phase a_phase) const
 {
@@ -20,7 +20,8 @@ EBAMRParticleMesh::EBAMRParticleMesh()
 {
   CH_TIME("EBAMRParticleMesh::EBAMRParticleMesh()");
 
-  m_isDefined = false;
+  m_isDefined               = false;
+  m_threadedPatchDeposition = false;
 }
 
 EBAMRParticleMesh::EBAMRParticleMesh(const Vector<RefCountedPtr<EBLevelGrid>>& a_eblgs,
@@ -33,6 +34,8 @@ EBAMRParticleMesh::EBAMRParticleMesh(const Vector<RefCountedPtr<EBLevelGrid>>& a
 {
   CH_TIME("EBAMRParticleMesh::EBAMRParticleMesh(full)");
 
+  m_threadedPatchDeposition = false;
+
   this->define(a_eblgs, a_refRat, a_dx, a_probLo, a_ghost, a_maxParticleWidth, a_finestLevel);
 }
 
@@ -183,6 +186,22 @@ EBAMRParticleMesh::defineEBParticleMesh()
   }
 }
 
+void
+EBAMRParticleMesh::setThreadedPatchDeposition(const bool a_threadedPatchDeposition) noexcept
+{
+  CH_TIME("EBAMRParticleMesh::setThreadedPatchDeposition");
+
+  m_threadedPatchDeposition = a_threadedPatchDeposition;
+}
+
+bool
+EBAMRParticleMesh::getThreadedPatchDeposition() const noexcept
+{
+  CH_TIME("EBAMRParticleMesh::getThreadedPatchDeposition");
+
+  return m_threadedPatchDeposition;
+}
+
 const EBParticleMesh&
 EBAMRParticleMesh::getEBParticleMesh(const int a_lvl, const DataIndex& a_dit) const
 {
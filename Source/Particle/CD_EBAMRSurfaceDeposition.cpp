@@ -108,6 +108,7 @@ EBAMRSurfaceDeposition::define(const Vector<RefCountedPtr<EBLevelGrid>>& a_ebGri
   pp.query("verbose", m_verbose);
 
   this->defineBuffers();
+  this->defineCutCellPatches();
   this->defineDataMotion();
   this->defineDepositionStencils();
   this->defineCoarseToFineStencils();
@@ -222,6 +223,33 @@ EBAMRSurfaceDeposition::defineBuffers() noexcept
   CH_STOP(t3);
 }
 
+void
+EBAMRSurfaceDeposition::defineCutCellPatches() noexcept
+{
+  CH_TIME("EBAMRSurfaceDeposition::defineCutCellPatches");
+  if (m_verbose) {
+    pout() << "EBAMRSurfaceDeposition::defineCutCellPatches" << endl;
+  }
+
+  m_cutCellPatches.resize(1 + m_finestLevel);
+
+  for (int lvl = 0; lvl <= m_finestLevel; lvl++) {
+    const DisjointBoxLayout& dbl   = m_ebGrids[lvl]->getDBL();
+    const EBISLayout&        ebisl = m_ebGrids[lvl]->getEBISL();
+
+    m_cutCellPatches[lvl].resize(0);
+
+    for (DataIterator dit(dbl); dit.ok(); ++dit) {
+      const Box      cellBox = dbl[dit()];
+      const EBISBox& ebisbox = ebisl[dit()];
+
+      if (!(ebisbox.getIrregIVS(cellBox).isEmpty())) {
+        m_cutCellPatches[lvl].push_back(dit());
+      }
+    }
+  }
+}
+
 void
 EBAMRSurfaceDeposition::defineDataMotion() noexcept
 {
@@ -285,6 +313,8 @@ EBAMRSurfaceDeposition::defineDepositionStencils() noexcept
 
   CH_START(t1);
   m_depositionStencils.resize(1 + m_finestLevel);
+  m_cutCellVoFs.resize(1 + m_finestLevel);
+  m_binnedData.resize(1 + m_finestLevel);
 
   // Define over valid cut-cells (i.e., cut-cells not covered by a finer grid)
   for (int lvl = 0; lvl <= m_finestLevel; lvl++) {
@@ -294,6 +324,8 @@ EBAMRSurfaceDeposition::defineDepositionStencils() noexcept
 
     m_depositionStencils[lvl] = RefCountedPtr<LayoutData<BaseIVFAB<VoFStencil>>>(
       new LayoutData<BaseIVFAB<VoFStencil>>(dbl));
+    m_cutCellVoFs[lvl] = RefCountedPtr<LayoutData<VoFIterator>>(new LayoutData<VoFIterator>(dbl));
+    m_binnedData[lvl]  = RefCountedPtr<LayoutData<BaseIVFAB<Real>>>(new LayoutData<BaseIVFAB<Real>>(dbl));
 
     const int nbox = dit.size();
 #pragma omp parallel for schedule(runtime)
@@ -306,6 +338,8 @@ EBAMRSurfaceDeposition::defineDepositionStencils() noexcept
       const IntVectSet ivs     = ebisbox.getIrregIVS(box);
 
       (*m_depositionStencils[lvl])[din].define(ivs, ebgraph, 1);
+      (*m_cutCellVoFs[lvl])[din].define(ivs, ebgraph);
+      (*m_binnedData[lvl])[din].define(ivs, ebgraph, 1);
     }
   }
   CH_STOP(t1);
@@ -22,9 +22,6 @@
 #include <CD_BoxLoops.H>
 #include <CD_NamespaceHeader.H>
 
-constexpr int EBCoarseFineParticleMesh::m_comp;
-constexpr int EBCoarseFineParticleMesh::m_nComp;
-
 EBCoarseFineParticleMesh::EBCoarseFineParticleMesh() noexcept
 {
   CH_TIME("EBCoarseFineParticleMesh::EBCoarseFineParticleMesh");
@@ -81,12 +78,56 @@ EBCoarseFineParticleMesh::define(const EBLevelGrid& a_eblgCoar,
   // valid -> valid+ghost
   m_copierFiCoToFineNoGhosts.define(m_eblgFiCo.getDBL(), m_eblgFine.getDBL(), m_eblgFine.getDomain(), m_ghost);
 
-  // Define VoF iterators
+  // Define the halo regions and the VoF iterators. The buffers are allocated when they are needed.
+  this->defineHaloRegions();
   this->defineVoFIterators();
 
+  m_buffersCoFi.clear();
+  m_buffersFiCo.clear();
+
   m_isDefined = true;
 }
 
+void
+EBCoarseFineParticleMesh::defineHaloRegions() noexcept
+{
+  CH_TIME("EBCoarseFineParticleMesh::defineHaloRegions");
+
+  // TLDR: The halo region of a fine-grid patch consists of the ghost cells that are not covered by any other fine-grid
+  //       patch. These are the cells where the fine-level particle clouds hang over the refinement boundary. Ghost
+  //       cells that overlap with other patches hold mass that was already added to the valid region by the exchange.
+
+  const DisjointBoxLayout& dblFine    = m_eblgFine.getDBL();
+  const ProblemDomain&     domainFine = m_eblgFine.getDomain();
+  const DataIterator&      ditFine    = dblFine.dataIterator();
+
+  m_fineHaloBoxes.define(dblFine);
+
+  const int nbox = ditFine.size();
+
+#pragma omp parallel for schedule(runtime)
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex& din = ditFine[mybox];
+
+    Box grownBox = grow(dblFine[din], m_ghost);
+    grownBox &= domainFine;
+
+    IntVectSet halo(grownBox);
+
+    for (LayoutIterator lit = dblFine.layoutIterator(); lit.ok(); ++lit) {
+      const Box& otherBox = dblFine[lit()];
+
+      if (otherBox.intersectsNotEmpty(grownBox)) {
+        halo -= otherBox;
+      }
+    }
+
+    halo.compact();
+
+    m_fineHaloBoxes[din] = halo.boxes();
+  }
+}
+
 void
 EBCoarseFineParticleMesh::defineVoFIterators() noexcept
 {
@@ -129,10 +170,14 @@ EBCoarseFineParticleMesh::defineVoFIterators() noexcept
       Box grownBoxFine = grow(cellBoxFine, m_ghost);
       grownBoxFine &= domainFine;
 
-      // On the fine grid I only want the ghost cells that are irregular.
+      // On the fine grid I only want the ghost cells in the halo region that are irregular.
+      IntVectSet haloIVSFine;
+      for (const auto& haloBox : m_fineHaloBoxes[din]) {
+        haloIVSFine |= haloBox;
+      }
+
       IntVectSet irregIVSFine = ebisBoxFine.getIrregIVS(grownBoxFine);
-      irregIVSFine -= cellBoxFine;
-      irregIVSFine &= domainFine;
+      irregIVSFine &= haloIVSFine;
       m_vofIterFineGhosts[din].define(irregIVSFine, ebgraphFine);
 
       // On the coarse grid I want coarsenings of the irregular ghost cells on the fine level.
@@ -162,59 +207,36 @@ EBCoarseFineParticleMesh::addFineGhostsToCoarse(LevelData<EBCellFAB>&       a_co
   CH_TIME("EBCoarseFineParticleMesh::addFineGhostsToCoarse");
 
   CH_assert(m_isDefined);
-  CH_assert(a_coarData.nComp() == 1);
-  CH_assert(a_fineData.nComp() == 1);
+  CH_assert(a_coarData.nComp() == a_fineData.nComp());
   CH_assert(m_refRat % 2 == 0);
   CH_assert(a_coarData.ghostVect() == m_ghost);
   CH_assert(a_fineData.ghostVect() == m_ghost);
 
-  // TLDR: This routine will take the ghost cells that are in a_fineData and add them to the coarse level. We use buffers for this,
-  //       copying the data from a_fineData to our nifty m_bufferFine buffer holder. The ghost cells in that scratch data are
-  //       coarsened onto yet another buffer. Finally, we add the contents in that buffer to the coarse data.
-
-  const DisjointBoxLayout& dblFine    = m_eblgFine.getDBL();
-  const ProblemDomain&     domainFine = m_eblgFine.getDomain();
-  const EBISLayout&        ebislFine  = m_eblgFine.getEBISL();
+  // TLDR: This routine will take the ghost cells in a_fineData that hang over the refinement boundary (the halo region)
+  //       and add them to the coarse level. The halo cells are coarsened onto a buffer on the coarsened fine grids, and
+  //       we then add the contents in that buffer to the coarse data. Note that ghost cells that overlap with valid
+  //       regions in other fine-grid patches are not part of the halo region; that data was already added to the fine
+  //       level by the level exchange and must not be added to the invalid region of the coarse grid.
 
-  const DisjointBoxLayout& dblCoFi   = m_eblgCoFi.getDBL();
+  const DisjointBoxLayout& dblFine   = m_eblgFine.getDBL();
+  const EBISLayout&        ebislFine = m_eblgFine.getEBISL();
   const EBISLayout&        ebislCoFi = m_eblgCoFi.getEBISL();
-
-  const DataIterator& ditFine = dblFine.dataIterator();
-  const DataIterator& ditCoFi = dblCoFi.dataIterator();
+  const DataIterator&      ditFine   = dblFine.dataIterator();
 
   const int nboxFine = ditFine.size();
-  const int nboxCoFi = ditCoFi.size();
+  const int nComp    = a_fineData.nComp();
 
   const Real factor = 1. / pow(m_refRat, SpaceDim);
 
-  LevelData<EBCellFAB> bufferFine(m_eblgFine.getDBL(), m_nComp, m_ghost, EBCellFactory(m_eblgFine.getEBISL()));
-  LevelData<EBCellFAB> bufferCoFi(m_eblgCoFi.getDBL(), m_nComp, m_ghost, EBCellFactory(m_eblgCoFi.getEBISL()));
+  LevelData<EBCellFAB>& bufferCoFi = this->getBuffer(m_buffersCoFi, m_eblgCoFi, nComp);
 
-  // Copy the fine data to scratch and reset the interior cells. We do this by copying everything to the fine scratch data,
-  // and then set all the valid data in each box to zero. The exchange() operation will then take care of ghost cells that.
-  // overlap with valid regions in different boxes (we could use a NeighborIterator to achieve the same). Note that this is critical
-  // for the result because we essentially end up setting all valid data to zero so we don't accidentally add mass to invalid region
-  // of the coarse grid (i.e., the region underneath the fine grid).
-  a_fineData.localCopyTo(bufferFine);
-#pragma omp parallel for schedule(runtime)
-  for (int mybox = 0; mybox < nboxFine; mybox++) {
-    const DataIndex& din = ditFine[mybox];
-
-    const Box& box = dblFine[din];
-
-    bufferFine[din].setVal(0.0, box, 0, m_nComp);
-  }
-  bufferFine.exchange();
-
-  // Coarsen the fine grid data. We do this by AVERAGING the fine-grid data onto the coarse grid. This actually involves entire patches
-  // and not just individual ghost cells regions, but that's ok because the rest of the data (in the valid fine regions) are set to zero above,
-  // so the coarse data underneath those regions will be zero, also.
+  // Coarsen the fine grid data in the halo region. We do this by AVERAGING the fine-grid data onto the coarse grid.
 #pragma omp parallel for schedule(runtime)
   for (int mybox = 0; mybox < nboxFine; mybox++) {
     const DataIndex& din = ditFine[mybox];
 
     EBCellFAB&       coFiData = bufferCoFi[din];
-    const EBCellFAB& fineData = bufferFine[din];
+    const EBCellFAB& fineData = a_fineData[din];
 
     coFiData.setVal(0.0);
 
@@ -222,16 +244,17 @@ EBCoarseFineParticleMesh::addFineGhostsToCoarse(LevelData<EBCellFAB>&       a_co
     FArrayBox&       coFiDataReg = coFiData.getFArrayBox();
     const FArrayBox& fineDataReg = fineData.getFArrayBox();
 
-    const Box fineBox = fineDataReg.box() & domainFine;
-    for (int comp = 0; comp < m_nComp; comp++) {
+    for (const auto& haloBox : m_fineHaloBoxes[din]) {
+      for (int comp = 0; comp < nComp; comp++) {
 
-      auto regularKernel = [&](const IntVect& ivFine) -> void {
-        const IntVect ivCoar = coarsen(ivFine, m_refRat);
+        auto regularKernel = [&](const IntVect& ivFine) -> void {
+          const IntVect ivCoar = coarsen(ivFine, m_refRat);
 
-        coFiDataReg(ivCoar, comp) += fineDataReg(ivFine, comp) * factor;
-      };
+          coFiDataReg(ivCoar, comp) += fineDataReg(ivFine, comp) * factor;
+        };
 
-      BoxLoops::loop(fineBox, regularKernel);
+        BoxLoops::loop(haloBox, regularKernel);
+      }
     }
 
     // Now do the irregular cells. First reset the coarse cell values and then increment with the fine-grid values.
@@ -242,7 +265,7 @@ EBCoarseFineParticleMesh::addFineGhostsToCoarse(LevelData<EBCellFAB>&       a_co
     auto setCoarData = [&](const VolIndex& fineVof) -> void {
       const VolIndex coarVof = ebislFine.coarsen(fineVof, m_refRat, din);
 
-      for (int comp = 0; comp < m_nComp; comp++) {
+      for (int comp = 0; comp < nComp; comp++) {
         coFiData(coarVof, comp) = 0.0;
       }
     };
@@ -250,7 +273,7 @@ EBCoarseFineParticleMesh::addFineGhostsToCoarse(LevelData<EBCellFAB>&       a_co
     // Add mass from the fine vof to the coarse vof.
     auto addFineToCoar = [&](const VolIndex& fineVof) -> void {
       const VolIndex& coarVof = ebislFine.coarsen(fineVof, m_refRat, din);
-      for (int comp = 0; comp < m_nComp; comp++) {
+      for (int comp = 0; comp < nComp; comp++) {
         coFiData(coarVof, comp) += fineData(fineVof, comp);
       }
     };
@@ -259,7 +282,7 @@ EBCoarseFineParticleMesh::addFineGhostsToCoarse(LevelData<EBCellFAB>&       a_co
     auto scaleCoar = [&](const VolIndex& coarVof) -> void {
       const Vector<VolIndex> fineVofs = ebislCoFi.refine(coarVof, m_refRat, din);
 
-      for (int comp = 0; comp < m_nComp; comp++) {
+      for (int comp = 0; comp < nComp; comp++) {
         coFiData(coarVof, comp) *= 1. / fineVofs.size();
       }
     };
@@ -270,7 +293,7 @@ EBCoarseFineParticleMesh::addFineGhostsToCoarse(LevelData<EBCellFAB>&       a_co
     BoxLoops::loop(vofitCoar, scaleCoar);
   }
 
-  const Interval interv(0, m_nComp - 1);
+  const Interval interv(0, nComp - 1);
 
   bufferCoFi.copyTo(interv, a_coarData, interv, m_copierCoFiToCoarIncludeGhosts, EBAddOp());
 }
@@ -282,12 +305,11 @@ EBCoarseFineParticleMesh::addFiCoDataToFine(LevelData<EBCellFAB>&       a_fineDa
   CH_TIME("EBCoarseFineParticleMesh::addFiCoDataToFine");
 
   CH_assert(m_isDefined);
-  CH_assert(a_fineData.nComp() == 1);
-  CH_assert(a_fiCoData.nComp() == 1);
+  CH_assert(a_fineData.nComp() == a_fiCoData.nComp());
   CH_assert(a_fineData.ghostVect() == m_ghost);
   CH_assert(a_fiCoData.ghostVect() == m_ghost);
 
-  const Interval interv(0, m_nComp - 1);
+  const Interval interv(0, a_fineData.nComp() - 1);
 
   a_fiCoData.copyTo(interv, a_fineData, interv, m_copierFiCoToFineIncludeGhosts, EBAddOp());
 }
@@ -299,8 +321,7 @@ EBCoarseFineParticleMesh::addInvalidCoarseToFine(LevelData<EBCellFAB>&       a_f
   CH_TIME("EBCoarseFineParticleMesh::addInvalidCoarseToFine");
 
   CH_assert(m_isDefined);
-  CH_assert(a_fineData.nComp() == 1);
-  CH_assert(a_coarData.nComp() == 1);
+  CH_assert(a_fineData.nComp() == a_coarData.nComp());
   CH_assert(a_fineData.ghostVect() == m_ghost);
   CH_assert(a_coarData.ghostVect() == m_ghost);
 
@@ -314,10 +335,9 @@ EBCoarseFineParticleMesh::addInvalidCoarseToFine(LevelData<EBCellFAB>&       a_f
   const DisjointBoxLayout& dblCoar   = m_eblgCoar.getDBL();
   const EBISLayout&        ebislCoar = m_eblgCoar.getEBISL();
 
-  const DisjointBoxLayout& dblFiCo   = m_eblgFiCo.getDBL();
-  const EBISLayout&        ebislFiCo = m_eblgFiCo.getEBISL();
+  const int nComp = a_coarData.nComp();
 
-  LevelData<EBCellFAB> bufferFiCo(m_eblgFiCo.getDBL(), m_nComp, m_ghost, EBCellFactory(m_eblgFiCo.getEBISL()));
+  LevelData<EBCellFAB>& bufferFiCo = this->getBuffer(m_buffersFiCo, m_eblgFiCo, nComp);
 
   const DataIterator dit = dblCoar.dataIterator();
 
@@ -344,7 +364,9 @@ EBCoarseFineParticleMesh::addInvalidCoarseToFine(LevelData<EBCellFAB>&       a_f
       auto fineKernel = [&](const IntVect& iv) {
         const IntVect ivFine = m_refRat * ivCoar + iv;
 
-        fiCoDataReg(ivFine, m_comp) = coarDataReg(ivCoar, m_comp);
+        for (int comp = 0; comp < nComp; comp++) {
+          fiCoDataReg(ivFine, comp) = coarDataReg(ivCoar, comp);
+        }
       };
 
       BoxLoops::loop(Box(IntVect::Zero, m_refRat * IntVect::Unit), fineKernel);
@@ -361,8 +383,11 @@ EBCoarseFineParticleMesh::addInvalidCoarseToFine(LevelData<EBCellFAB>&       a_f
       const Vector<VolIndex>& fineVoFs = ebislCoar.refine(coarVoF, m_refRat, din);
 
       for (int ivof = 0; ivof < fineVoFs.size(); ivof++) {
-        const VolIndex& fineVoF   = fineVoFs[ivof];
-        fiCoData(fineVoF, m_comp) = coarData(coarVoF, m_comp);
+        const VolIndex& fineVoF = fineVoFs[ivof];
+
+        for (int comp = 0; comp < nComp; comp++) {
+          fiCoData(fineVoF, comp) = coarData(coarVoF, comp);
+        }
       }
     };
 
@@ -370,7 +395,7 @@ EBCoarseFineParticleMesh::addInvalidCoarseToFine(LevelData<EBCellFAB>&       a_f
   }
 
   // Finally, add the data to the valid region on the fine grid.
-  const Interval interv(0, m_nComp - 1);
+  const Interval interv(0, nComp - 1);
   bufferFiCo.copyTo(interv, a_fineData, interv, m_copierFiCoToFineNoGhosts, EBAddOp());
 }
 
@@ -382,4 +407,33 @@ EBCoarseFineParticleMesh::getEblgFiCo() const
   return m_eblgFiCo;
 }
 
+LevelData<EBCellFAB>&
+EBCoarseFineParticleMesh::getFiCoBuffer(const int a_nComp) const noexcept
+{
+  CH_TIME("EBCoarseFineParticleMesh::getFiCoBuffer");
+
+  CH_assert(m_isDefined);
+
+  return this->getBuffer(m_buffersFiCo, m_eblgFiCo, a_nComp);
+}
+
+LevelData<EBCellFAB>&
+EBCoarseFineParticleMesh::getBuffer(std::map<int, RefCountedPtr<LevelData<EBCellFAB>>>& a_buffers,
+                                    const EBLevelGrid&                                  a_eblg,
+                                    const int                                           a_nComp) const noexcept
+{
+  CH_TIME("EBCoarseFineParticleMesh::getBuffer");
+
+  CH_assert(a_nComp > 0);
+
+  RefCountedPtr<LevelData<EBCellFAB>>& buffer = a_buffers[a_nComp];
+
+  if (buffer.isNull()) {
+    buffer = RefCountedPtr<LevelData<EBCellFAB>>(
+      new LevelData<EBCellFAB>(a_eblg.getDBL(), a_nComp, m_ghost, EBCellFactory(a_eblg.getEBISL())));
+  }
+
+  return *buffer;
+}
+
 #include <CD_NamespaceFooter.H>
@@ -0,0 +1,104 @@
+/* chombo-discharge
+ * Copyright © 2026 SINTEF Energy Research.
+ * Please refer to Copyright.txt and LICENSE in the chombo-discharge root directory.
+ */
+
+/*!
+  @file   CD_ParticleTransportSchema.cpp
+  @brief  Implementation of CD_ParticleTransportSchema.H
+  @author Robert Marskar
+*/
+
+// Chombo includes
+#include <REAL.H>
+
+// Our includes
+#include <CD_ParticleTransportSchema.H>
+#include <CD_NamespaceHeader.H>
+
+ParticleTransportSchema::ParticleTransportSchema() noexcept
+{
+  m_realModes.resize(0);
+  m_vectModes.resize(0);
+}
+
+ParticleTransportSchema::~ParticleTransportSchema() noexcept
+{}
+
+void
+ParticleTransportSchema::setRealMode(const size_t a_index, const Mode a_mode) noexcept
+{
+  if (a_index >= m_realModes.size()) {
+    m_realModes.resize(a_index + 1, Mode::Full);
+  }
+
+  m_realModes[a_index] = a_mode;
+}
+
+void
+ParticleTransportSchema::setVectMode(const size_t a_index, const Mode a_mode) noexcept
+{
+  if (a_index >= m_vectModes.size()) {
+    m_vectModes.resize(a_index + 1, Mode::Full);
+  }
+
+  m_vectModes[a_index] = a_mode;
+}
+
+ParticleTransportSchema::Mode
+ParticleTransportSchema::getRealMode(const size_t a_index) const noexcept
+{
+  return (a_index < m_realModes.size()) ? m_realModes[a_index] : Mode::Full;
+}
+
+ParticleTransportSchema::Mode
+ParticleTransportSchema::getVectMode(const size_t a_index) const noexcept
+{
+  return (a_index < m_vectModes.size()) ? m_vectModes[a_index] : Mode::Full;
+}
+
+bool
+ParticleTransportSchema::isFull() const noexcept
+{
+  for (const auto& m : m_realModes) {
+    if (m != Mode::Full) {
+      return false;
+    }
+  }
+
+  for (const auto& m : m_vectModes) {
+    if (m != Mode::Full) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+size_t
+ParticleTransportSchema::bytes(const Mode a_mode) noexcept
+{
+  size_t ret = 0;
+
+  switch (a_mode) {
+  case Mode::Skip: {
+    ret = 0;
+
+    break;
+  }
+  case Mode::Single: {
+    ret = sizeof(float);
+
+    break;
+  }
+  case Mode::Full: {
+    ret = sizeof(Real);
+
+    break;
+  }
+  }
+
+  return ret;
+}
+
+#include <CD_NamespaceFooter.H>
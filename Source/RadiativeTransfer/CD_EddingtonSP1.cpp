@@ -32,6 +32,9 @@
 constexpr Real EddingtonSP1::m_alpha;
 constexpr Real EddingtonSP1::m_beta;
 
+std::map<std::pair<std::string, phase::which_phase>, std::pair<RefCountedPtr<EBLevelGrid>, EBHelmholtzOpFactory::AmrLevelGrids>>
+  EddingtonSP1::s_sharedMultigridLevels;
+
 Real
 EddingtonSP1::s_defaultDomainBcFunction(const RealVect a_position, const Real a_time)
 {
@@ -49,6 +52,19 @@ EddingtonSP1::EddingtonSP1() : RtSolver()
   m_isSolverSetup = false;
   m_dataLocation  = Location::Cell::Center;
   m_regridSlopes  = true;
+  m_constantKappa = false;
+  m_constKappa    = 0.0;
+
+  m_shareMultigridLevels = true;
+  m_skipTolerance        = 0.0;
+  m_maxSkips             = 5;
+  m_numConsecutiveSkips  = 0;
+  m_hasSolveSource       = false;
+
+  m_warmStart                  = true;
+  m_multigridWarmMinIterations = 1;
+  m_multigridTelemetry         = false;
+  m_multigridTelemetryFile     = "none";
 
   // This fills m_domainBcFunctions with s_defaultDomainBcFunction on every domain side.
   this->setDefaultDomainBcFunctions();
@@ -74,6 +90,9 @@ EddingtonSP1::parseOptions()
   this->parseMultigridSettings(); // Parses solver parameters for geometric multigrid
   this->parseKappaScale();        // Parses kappa-scaling
   this->parseRegridSlopes();      // Slopes on/off when regridding
+  this->parseSkipSolves();        // Skipping solves when the source barely changes
+  this->parseWarmStart();         // Warm-starting stationary solves
+  this->parseConstantKappa();     // Constant-coefficient fast path
 }
 
 void
@@ -89,6 +108,8 @@ EddingtonSP1::parseRuntimeOptions()
   this->parseMultigridSettings(); // Parses solver parameters for geometric multigrid
   this->parseKappaScale();        // Parses kappa-scaling
   this->parseRegridSlopes();      // Slopes on/off when regridding
+  this->parseSkipSolves();        // Skipping solves when the source barely changes
+  this->parseWarmStart();         // Warm-starting stationary solves
 }
 
 void
@@ -355,6 +376,20 @@ EddingtonSP1::parseKappaScale()
   pp.get("kappa_scale", m_kappaScale);
 }
 
+void
+EddingtonSP1::parseConstantKappa()
+{
+  CH_TIME("EddingtonSP1::parseConstantKappa");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::parseConstantKappa" << endl;
+  }
+
+  ParmParse pp(m_className.c_str());
+
+  m_constantKappa = false;
+  pp.query("constant_kappa", m_constantKappa);
+}
+
 void
 EddingtonSP1::parseMultigridSettings()
 {
@@ -371,9 +406,15 @@ EddingtonSP1::parseMultigridSettings()
   pp.get("gmg_exit_tol", m_multigridExitTolerance);
   pp.get("gmg_exit_hang", m_multigridExitHang);
   pp.get("gmg_min_cells", m_minCellsBottom);
+  pp.query("gmg_share_levels", m_shareMultigridLevels);
   pp.get("gmg_ebbc_order", m_multigridBcOrder);
   pp.get("gmg_ebbc_weight", m_multigridBcWeight);
 
+  m_multigridTelemetry     = false;
+  m_multigridTelemetryFile = "none";
+  pp.query("gmg_telemetry", m_multigridTelemetry);
+  pp.query("gmg_telem_file", m_multigridTelemetryFile);
+
   // Fetch the desired bottom solver from the input script. We look for things like EddingtonSP1.gmg_bottom_solver = bicgstab or '= simple <number>'
   // where <number> is the number of relaxation for the smoothing solver.
   const int num = pp.countval("gmg_bottom_solver");
@@ -468,6 +509,44 @@ EddingtonSP1::parseRegridSlopes()
   pp.get("use_regrid_slopes", m_regridSlopes);
 }
 
+void
+EddingtonSP1::parseWarmStart()
+{
+  CH_TIME("EddingtonSP1::parseWarmStart()");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::parseWarmStart()" << endl;
+  }
+
+  ParmParse pp(m_className.c_str());
+
+  pp.query("warm_start", m_warmStart);
+  pp.query("gmg_warm_min_iter", m_multigridWarmMinIterations);
+
+  if (m_multigridWarmMinIterations < 0) {
+    m_multigridWarmMinIterations = m_multigridMinIterations;
+  }
+}
+
+void
+EddingtonSP1::parseSkipSolves()
+{
+  CH_TIME("EddingtonSP1::parseSkipSolves()");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::parseSkipSolves()" << endl;
+  }
+
+  ParmParse pp(m_className.c_str());
+
+  pp.query("skip_tolerance", m_skipTolerance);
+  pp.query("max_skips", m_maxSkips);
+
+  if (m_skipTolerance <= 0.0) {
+    m_hasSolveSource = false;
+
+    m_solveSource.clear();
+  }
+}
+
 void
 EddingtonSP1::preRegrid(const int a_base, const int a_oldFinestLevel)
 {
@@ -521,6 +600,9 @@ EddingtonSP1::deallocate()
   m_phi.clear();
   m_source.clear();
   m_resid.clear();
+  m_solveSource.clear();
+
+  m_hasSolveSource = false;
 }
 
 void
@@ -539,9 +621,17 @@ EddingtonSP1::regrid(const int a_lmin, const int a_oldFinestLevel, const int a_n
   const EBCoarseToFineInterp::Type interpType = m_regridSlopes ? EBCoarseToFineInterp::Type::ConservativeMinMod
                                                                : EBCoarseToFineInterp::Type::ConservativePWC;
 
-  // Regrid phi and source
-  m_amr->interpToNewGrids(m_phi, m_cachePhi, m_phase, a_lmin, a_oldFinestLevel, a_newFinestLevel, interpType);
-  m_amr->interpToNewGrids(m_source, m_cacheSrc, m_phase, a_lmin, a_oldFinestLevel, a_newFinestLevel, interpType);
+  // Regrid phi and source with a single aggregated copy per level.
+  Vector<EBAMRCellData*> newData;
+  Vector<EBAMRCellData*> oldData;
+
+  newData.push_back(&m_phi);
+  newData.push_back(&m_source);
+
+  oldData.push_back(&m_cachePhi);
+  oldData.push_back(&m_cacheSrc);
+
+  m_amr->interpToNewGrids(newData, oldData, m_phase, a_lmin, a_oldFinestLevel, a_newFinestLevel, interpType);
 
   // Coarsen and update ghost cells.
   m_amr->conservativeAverage(m_phi, m_realm, m_phase);
@@ -549,6 +639,15 @@ EddingtonSP1::regrid(const int a_lmin, const int a_oldFinestLevel, const int a_n
 
   m_isSolverSetup = false;
 
+  // The source from the last solve lives on the old grids.
+  m_hasSolveSource      = false;
+  m_numConsecutiveSkips = 0;
+
+  m_solveSource.clear();
+
+  // Release the old multigrid levels, the first solver that is set up on the new grids makes new ones.
+  s_sharedMultigridLevels.erase(std::make_pair(m_realm, m_phase));
+
   // Deallocate the scratch data.
   m_cachePhi.clear();
   m_cacheSrc.clear();
@@ -598,6 +697,18 @@ EddingtonSP1::advance(const Real a_dt, EBAMRCellData& a_phi, const EBAMRCellData
     this->setupSolver();
   }
 
+  // The source has barely changed since the last solve, so the last solution is still good.
+  if (this->canSkipSolve(a_phi, a_source)) {
+    m_numSkippedSolves++;
+    m_numConsecutiveSkips++;
+
+    return true;
+  }
+
+  if (m_multigridTelemetry) {
+    m_telemetry.startSolve(m_name, m_time);
+  }
+
   EBAMRCellData zero;
   EBAMRCellData scaledSource;
 
@@ -630,19 +741,37 @@ EddingtonSP1::advance(const Real a_dt, EBAMRCellData& a_phi, const EBAMRCellData
     const int coarsestLevel = 0;
     const int finestLevel   = m_amr->getFinestLevel();
 
-    // Compute the residual and determine if we must enter multigrid.
+    // Without warm-starting we always start from zero.
+    const bool zeroPhi = a_zeroPhi || !m_warmStart;
+    if (zeroPhi) {
+      DataOps::setValue(a_phi, 0.0);
+    }
+
+    // Compute the residual and determine if we must enter multigrid. Note that the convergence metric is the residual for
+    // phi = 0, so a good initial guess will usually exit after a V-cycle or two. The minimum number of iterations would
+    // prevent that, so we use a separate one for warm-started solves.
     const Real phiResid  = m_multigridSolver->computeAMRResidual(phi, rhs, finestLevel, coarsestLevel);
     const Real zeroResid = m_multigridSolver->computeAMRResidual(zer, rhs, finestLevel, coarsestLevel);
 
+    if (m_multigridTelemetry) {
+      m_telemetry.addResidual(phiResid);
+    }
+
     if (phiResid > zeroResid * m_multigridExitTolerance) {
       // Residual is too large, solve.
       m_multigridSolver->m_convergenceMetric = zeroResid;
-      m_multigridSolver->solveNoInitResid(phi, res, rhs, finestLevel, coarsestLevel, a_zeroPhi);
+      m_multigridSolver->m_imin = zeroPhi ? m_multigridMinIterations : m_multigridWarmMinIterations;
+      m_multigridSolver->solveNoInitResid(phi, res, rhs, finestLevel, coarsestLevel, zeroPhi);
+      m_multigridSolver->m_imin = m_multigridMinIterations;
 
       const int status = m_multigridSolver->m_exitStatus; // 1 => Initial norm sufficiently reduced
       if (status == 1 || status == 8 || status == 9) {    // 8 => Norm sufficiently small
         converged = true;
       }
+
+      if (m_multigridTelemetry) {
+        m_telemetry.addResidual(m_multigridSolver->computeAMRResidual(phi, rhs, finestLevel, coarsestLevel));
+      }
     }
     else {
       // Solution is already good enough
@@ -666,9 +795,65 @@ EddingtonSP1::advance(const Real a_dt, EBAMRCellData& a_phi, const EBAMRCellData
   m_amr->conservativeAverage(a_phi, m_realm, m_phase);
   m_amr->interpGhost(a_phi, m_realm, m_phase);
 
+  m_numSolves++;
+  m_numConsecutiveSkips = 0;
+
+  if (m_multigridTelemetry) {
+    m_telemetry.stopSolve(converged);
+
+    if (m_multigridTelemetryFile != "none") {
+      m_telemetry.writeCSV(m_multigridTelemetryFile);
+    }
+  }
+
+  // Store the source so the next advance can check if it needs to solve.
+  if (m_stationary && m_skipTolerance > 0.0) {
+    if (!m_hasSolveSource) {
+      m_amr->allocate(m_solveSource, m_realm, m_phase, m_nComp);
+    }
+
+    DataOps::copy(m_solveSource, a_source);
+
+    m_hasSolveSource = converged;
+  }
+
   return converged;
 }
 
+bool
+EddingtonSP1::canSkipSolve(const EBAMRCellData& a_phi, const EBAMRCellData& a_source) const noexcept
+{
+  CH_TIME("EddingtonSP1::canSkipSolve");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::canSkipSolve" << endl;
+  }
+
+  bool canSkip = false;
+
+  if (m_stationary && m_skipTolerance > 0.0 && m_hasSolveSource && m_numConsecutiveSkips < m_maxSkips &&
+      &a_phi == &m_phi) {
+    EBAMRCellData delta;
+
+    m_amr->allocate(delta, m_realm, m_phase, m_nComp);
+
+    DataOps::copy(delta, a_source);
+    DataOps::incr(delta, m_solveSource, -1.0);
+
+    // Squared L2 norms.
+    Real deltaNorm  = 0.0;
+    Real sourceNorm = 0.0;
+
+    for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
+      deltaNorm += DataOps::norm(*delta[lvl], 2);
+      sourceNorm += DataOps::norm(*m_solveSource[lvl], 2);
+    }
+
+    canSkip = deltaNorm <= m_skipTolerance * m_skipTolerance * sourceNorm;
+  }
+
+  return canSkip;
+}
+
 void
 EddingtonSP1::advanceEuler(EBAMRCellData&       a_phi,
                            const EBAMRCellData& a_source,
@@ -735,6 +920,12 @@ EddingtonSP1::advanceEuler(EBAMRCellData&       a_phi,
   m_multigridSolver->solve(newPhi, eulerRHS, finestLevel, coarsestLevel, a_zeroPhi);
 }
 
+const MultigridTelemetry&
+EddingtonSP1::getMultigridTelemetry() const noexcept
+{
+  return m_telemetry;
+}
+
 void
 EddingtonSP1::setupSolver()
 {
@@ -758,6 +949,18 @@ EddingtonSP1::setHelmholtzCoefficients()
     pout() << m_name + "::setHelmholtzCoefficients" << endl;
   }
 
+  // With constant kappa we don't need to evaluate the absorption coefficient everywhere, so just set the values. This also
+  // fills the ghost faces.
+  if (m_constantKappa) {
+    m_constKappa = m_rtSpecies->getAbsorptionCoefficient(0.5 * (m_amr->getProbLo() + m_amr->getProbHi()));
+
+    DataOps::setValue(m_helmAco, m_constKappa);
+    DataOps::setValue(m_helmBco, 1. / (3.0 * m_constKappa));
+    DataOps::setValue(m_helmBcoIrreg, 1. / (3.0 * m_constKappa));
+
+    return;
+  }
+
   // This loop fills aco with kappa and bco_irreg with 1./kappa
   for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
     const DisjointBoxLayout& dbl = m_amr->getGrids(m_realm)[lvl];
@@ -946,6 +1149,20 @@ EddingtonSP1::setupHelmholtzFactory()
     break;
   }
 
+  // Other SP1 solvers on this realm and phase may already have coarsened the base AMR level for multigrid. The coarsening only
+  // depends on the grids, so we can reuse those levels as long as the coarsest AMR level has not changed.
+  EBHelmholtzOpFactory::AmrLevelGrids deeperLevelGrids;
+
+  const std::pair<std::string, phase::which_phase> sharedKey(m_realm, m_phase);
+
+  if (m_shareMultigridLevels) {
+    const auto it = s_sharedMultigridLevels.find(sharedKey);
+
+    if (it != s_sharedMultigridLevels.end() && it->second.first == levelGrids[0]) {
+      deeperLevelGrids = it->second.second;
+    }
+  }
+
   // Set up the operator
   m_helmholtzOpFactory = RefCountedPtr<EBHelmholtzOpFactory>(new EBHelmholtzOpFactory(m_dataLocation,
                                                                                       m_alpha,
@@ -966,7 +1183,26 @@ EddingtonSP1::setupHelmholtzFactory()
                                                                                       ghostRhs,
                                                                                       m_multigridRelaxMethod,
                                                                                       bottomDomain,
-                                                                                      m_amr->getMaxBoxSize()));
+                                                                                      m_amr->getMaxBoxSize(),
+                                                                                      deeperLevelGrids,
+                                                                                      m_amr->getMultigridLevelCache(m_realm)));
+
+  if (m_constantKappa) {
+    m_helmholtzOpFactory->setConstantCoefficients(m_constKappa, 1. / (3.0 * m_constKappa));
+  }
+
+  m_helmholtzOpFactory->setTelemetry(m_multigridTelemetry ? m_telemetry.getTimer() : RefCountedPtr<Timer>());
+
+  // Keep the deepest hierarchy available for the other solvers.
+  if (m_shareMultigridLevels) {
+    const EBHelmholtzOpFactory::AmrLevelGrids factoryLevelGrids = m_helmholtzOpFactory->getDeeperLevelGrids();
+
+    auto& shared = s_sharedMultigridLevels[sharedKey];
+
+    if (shared.first != levelGrids[0] || factoryLevelGrids.size() > shared.second.size()) {
+      shared = std::make_pair(levelGrids[0], factoryLevelGrids);
+    }
+  }
 }
 
 void
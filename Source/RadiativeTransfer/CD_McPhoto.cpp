@@ -27,6 +27,9 @@
 #include <CD_PointParticle.H>
 #include <CD_ParticleOps.H>
 #include <CD_Random.H>
+#include <CD_ParallelOps.H>
+#include <CD_DischargeIO.H>
+#include <CD_Timer.H>
 #include <CD_NamespaceHeader.H>
 
 McPhoto::McPhoto()
@@ -36,8 +39,24 @@ McPhoto::McPhoto()
   m_name      = "McPhoto";
   m_className = "McPhoto";
 
-  m_stationary    = false;
-  m_dirtySampling = false;
+  m_stationary       = false;
+  m_dirtySampling    = false;
+  m_directDeposition = false;
+  m_kernelRadius     = 0;
+  m_kernelSamples    = 100000;
+  m_kernelKappa      = 0.0;
+  m_batchedTransport = false;
+  m_levelImportance  = 1.0;
+  m_hasImportance    = false;
+
+  m_numGeneratedPhotons  = 0LL;
+  m_numBulkAbsorbed      = 0LL;
+  m_numEBAbsorbed        = 0LL;
+  m_numDomainAbsorbed    = 0LL;
+  m_numIntersectionTests = 0LL;
+  m_timeGenerate         = 0.0;
+  m_timeTransport        = 0.0;
+  m_timeDeposit          = 0.0;
 }
 
 McPhoto::~McPhoto()
@@ -97,16 +116,62 @@ McPhoto::advance(const Real a_dt, EBAMRCellData& a_phi, const EBAMRCellData& a_s
       ParticleContainer<Photon> scratchPhotons;
       m_amr->allocate(scratchPhotons, m_realm);
 
+      // With direct deposition most of the photons are NGP-binned on the mesh during the advance and never make it into the
+      // bulk photons. Only the ones that land outside the patch they started in are remapped and deposited.
+      const bool directDeposition = m_directDeposition && m_deposition == DepositionType::NGP;
+
+      EBAMRCellData directPhi;
+      if (directDeposition) {
+        m_amr->allocate(directPhi, m_realm, m_phase, 1);
+      }
+
+      // Photons that are absorbed within the kernel radius go directly on the mesh, the remaining ones are shifted to the kernel
+      // radius after they are generated.
+      if (m_kernelRadius > 0) {
+        this->kernelAbsorption(a_phi, numPhysPhotonsPacket);
+      }
+
       for (int i = 0; i < m_numSamplingPackets; i++) {
         const size_t maxPhotonsPerCell = (i == 0) ? maxPhotonsPerPacket + remainder : maxPhotonsPerPacket;
 
         const EBAMRCellData& numPhysPhotons = m_amr->slice(numPhysPhotonsPacket, Interval(i, i));
 
         this->generateComputationalPhotons(m_photons, numPhysPhotons, maxPhotonsPerCell);
-        this->advancePhotonsInstantaneous(scratchPhotons, m_ebPhotons, m_domainPhotons, m_photons);
+
+        if (m_kernelRadius > 0) {
+          this->shiftKernelPhotons(m_photons);
+        }
 
         // Absorb the bulk photons on the mesh.
-        this->depositPhotons<Photon, &Photon::weight>(phi, scratchPhotons, m_deposition);
+        if (directDeposition) {
+          DataOps::setValue(directPhi, 0.0);
+
+          this->advancePhotonsInstantaneous(scratchPhotons, m_ebPhotons, m_domainPhotons, m_photons, &directPhi);
+
+          const Real startDeposit = Timer::wallClock();
+
+          for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
+            directPhi[lvl]->exchange();
+          }
+
+          this->depositKappaConservative<Photon, &Photon::weight>(phi,
+                                                                  scratchPhotons,
+                                                                  m_deposition,
+                                                                  m_coarseFineDeposition);
+          DataOps::incr(phi, directPhi, 1.0);
+          this->depositFinalize(phi);
+
+          m_timeDeposit += Timer::wallClock() - startDeposit;
+        }
+        else {
+          this->advancePhotonsInstantaneous(scratchPhotons, m_ebPhotons, m_domainPhotons, m_photons);
+
+          const Real startDeposit = Timer::wallClock();
+
+          this->depositPhotons<Photon, &Photon::weight>(phi, scratchPhotons, m_deposition);
+
+          m_timeDeposit += Timer::wallClock() - startDeposit;
+        }
         DataOps::incr(a_phi, phi, 1.0);
 
         // Store the photons that were absorbed.
@@ -118,7 +183,12 @@ McPhoto::advance(const Real a_dt, EBAMRCellData& a_phi, const EBAMRCellData& a_s
       this->generateComputationalPhotons(m_photons, numPhysPhotonsTotal, m_maxPhotonsGeneratedPerCell);
       this->advancePhotonsTransient(m_bulkPhotons, m_ebPhotons, m_domainPhotons, m_photons, a_dt);
       this->remap(m_photons);
+
+      const Real startDeposit = Timer::wallClock();
+
       this->depositPhotons<Photon, &Photon::weight>(a_phi, m_bulkPhotons, m_deposition);
+
+      m_timeDeposit += Timer::wallClock() - startDeposit;
     }
   }
   else {
@@ -149,6 +219,46 @@ McPhoto::isInstantaneous()
   return m_instantaneous;
 }
 
+void
+McPhoto::printStepReport() noexcept
+{
+  CH_TIME("McPhoto::printStepReport");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::printStepReport" << endl;
+  }
+
+  const long long numGenerated = ParallelOps::sum(m_numGeneratedPhotons);
+  const long long numBulk      = ParallelOps::sum(m_numBulkAbsorbed);
+  const long long numEB        = ParallelOps::sum(m_numEBAbsorbed);
+  const long long numDomain    = ParallelOps::sum(m_numDomainAbsorbed);
+  const long long numTests     = ParallelOps::sum(m_numIntersectionTests);
+
+  const Real timeGenerate  = ParallelOps::max(m_timeGenerate);
+  const Real timeTransport = ParallelOps::max(m_timeTransport);
+  const Real timeDeposit   = ParallelOps::max(m_timeDeposit);
+
+  // Nothing happened since the last report.
+  if (numGenerated + numBulk + numEB + numDomain > 0LL) {
+    const std::string whitespace = "                                   ";
+
+    pout() << whitespace + "rte   = " << m_name << ": " << DischargeIO::numberFmt(numGenerated) << " generated, "
+           << DischargeIO::numberFmt(numBulk) << " bulk, " << DischargeIO::numberFmt(numEB) << " EB, "
+           << DischargeIO::numberFmt(numDomain) << " domain, " << DischargeIO::numberFmt(numTests)
+           << " intersection tests" << endl
+           << whitespace + "rte   = " << m_name << ": " << timeGenerate << " s (generate), " << timeTransport
+           << " s (transport), " << timeDeposit << " s (deposit)" << endl;
+  }
+
+  m_numGeneratedPhotons  = 0LL;
+  m_numBulkAbsorbed      = 0LL;
+  m_numEBAbsorbed        = 0LL;
+  m_numDomainAbsorbed    = 0LL;
+  m_numIntersectionTests = 0LL;
+  m_timeGenerate         = 0.0;
+  m_timeTransport        = 0.0;
+  m_timeDeposit          = 0.0;
+}
+
 void
 McPhoto::parseOptions()
 {
@@ -171,6 +281,7 @@ McPhoto::parseOptions()
   this->parseInstantaneous();
   this->parseDivergenceComputation();
   this->parseDirtySampling();
+  this->parseKernelAbsorption();
 }
 
 void
@@ -192,6 +303,7 @@ McPhoto::parseRuntimeOptions()
   this->parseInstantaneous();
   this->parseDivergenceComputation();
   this->parseDirtySampling();
+  this->parseKernelAbsorption();
 }
 
 void
@@ -222,6 +334,32 @@ McPhoto::parseDirtySampling()
   pp.query("dirty_sampling", m_dirtySampling);
 }
 
+void
+McPhoto::parseKernelAbsorption()
+{
+  CH_TIME("McPhoto::parseKernelAbsorption");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::parseKernelAbsorption" << endl;
+  }
+
+  ParmParse pp(m_className.c_str());
+
+  const int oldRadius  = m_kernelRadius;
+  const int oldSamples = m_kernelSamples;
+
+  pp.query("kernel_radius", m_kernelRadius);
+  pp.query("kernel_samples", m_kernelSamples);
+
+  if (m_kernelSamples <= 0) {
+    MayDay::Error("McPhoto::parseKernelAbsorption -- 'kernel_samples' must be > 0");
+  }
+
+  // Kernels are computed on the next advance.
+  if (m_kernelRadius != oldRadius || m_kernelSamples != oldSamples) {
+    m_absorptionKernels.resize(0);
+  }
+}
+
 void
 McPhoto::parseDivergenceComputation()
 {
@@ -246,6 +384,9 @@ McPhoto::parseInstantaneous()
   ParmParse pp(m_className.c_str());
 
   pp.get("instantaneous", m_instantaneous);
+
+  m_batchedTransport = false;
+  pp.query("batched_transport", m_batchedTransport);
 }
 
 void
@@ -273,6 +414,13 @@ McPhoto::parsePseudoPhotons()
   if (m_numSamplingPackets <= 0) {
     m_numSamplingPackets = 1;
   }
+
+  m_levelImportance = 1.0;
+  pp.query("level_importance", m_levelImportance);
+
+  if (m_levelImportance <= 0.0) {
+    MayDay::Error("McPhoto::parsePseudoPhotons -- 'level_importance' must be > 0");
+  }
 }
 
 void
@@ -344,6 +492,9 @@ McPhoto::parseIntersectionEB()
   pp.get("intersection_alg", str);
   pp.get("bisect_step", m_bisectStep);
 
+  m_intersectionBand = false;
+  pp.query("intersection_band", m_intersectionBand);
+
   if (str == "raycast") {
     m_intersectionEB = IntersectionEB::Raycast;
   }
@@ -396,6 +547,9 @@ McPhoto::parseDeposition()
   else {
     MayDay::Error("McPhoto::parseDeposition - unknown coarse-fine deposition method requested.");
   }
+
+  m_directDeposition = false;
+  pp.query("direct_deposition", m_directDeposition);
 }
 
 void
@@ -597,6 +751,9 @@ McPhoto::regrid(const int a_lmin, const int a_oldFinestLevel, const int a_newFin
   m_amr->remapToNewGrids(m_domainPhotons, a_lmin, a_newFinestLevel);
   m_amr->remapToNewGrids(m_sourcePhotons, a_lmin, a_newFinestLevel);
 
+  // The importance map lives on the old grids.
+  this->unsetImportance();
+
   // Deposit
   this->depositPhotons();
 }
@@ -703,6 +860,10 @@ McPhoto::registerOperators()
     m_amr->registerOperator(s_particle_mesh, m_realm, m_phase);
     m_amr->registerOperator(s_noncons_div, m_realm, m_phase);
 
+    if (m_intersectionBand) {
+      m_amr->registerOperator(s_levelset, m_realm, m_phase);
+    }
+
     // For CIC deposition
     m_amr->registerMask(s_particle_halo, m_haloBuffer, m_realm);
   }
@@ -1018,6 +1179,34 @@ McPhoto::drawPhotons(const Real a_source, const Real a_volume, const Real a_dt)
   return numPhysicalPhotons;
 }
 
+void
+McPhoto::setImportance(const EBAMRCellData& a_importance)
+{
+  CH_TIME("McPhoto::setImportance");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::setImportance" << endl;
+  }
+
+  m_amr->allocate(m_importance, m_realm, m_phase, 1);
+
+  DataOps::copy(m_importance, a_importance);
+
+  m_hasImportance = true;
+}
+
+void
+McPhoto::unsetImportance() noexcept
+{
+  CH_TIME("McPhoto::unsetImportance");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::unsetImportance" << endl;
+  }
+
+  m_importance.clear();
+
+  m_hasImportance = false;
+}
+
 void
 McPhoto::generateComputationalPhotons(ParticleContainer<Photon>& a_photons,
                                       const EBAMRCellData&       a_numPhysPhotons,
@@ -1030,16 +1219,25 @@ McPhoto::generateComputationalPhotons(ParticleContainer<Photon>& a_photons,
 
   CH_assert(a_numPhysPhotons[0]->nComp() == 1);
 
+  const Real startTime = Timer::wallClock();
+
+  long long numGenerated = 0LL;
+
+  // If we generate physical photons there is no budget to distribute.
+  const bool useImportance = (m_hasImportance || m_levelImportance != 1.0) &&
+                             a_maxPhotonsPerCell < std::numeric_limits<size_t>::max();
+
   for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
-    const DisjointBoxLayout& dbl    = m_amr->getGrids(m_realm)[lvl];
-    const DataIterator&      dit    = dbl.dataIterator();
-    const EBISLayout&        ebisl  = m_amr->getEBISLayout(m_realm, m_phase)[lvl];
-    const RealVect           probLo = m_amr->getProbLo();
-    const Real               dx     = m_amr->getDx()[lvl];
+    const DisjointBoxLayout& dbl         = m_amr->getGrids(m_realm)[lvl];
+    const DataIterator&      dit         = dbl.dataIterator();
+    const EBISLayout&        ebisl       = m_amr->getEBISLayout(m_realm, m_phase)[lvl];
+    const RealVect           probLo      = m_amr->getProbLo();
+    const Real               dx          = m_amr->getDx()[lvl];
+    const Real               levelBudget = a_maxPhotonsPerCell * std::pow(m_levelImportance, lvl);
 
     const int nbox = dit.size();
 
-#pragma omp parallel for schedule(runtime)
+#pragma omp parallel for schedule(runtime) reduction(+ : numGenerated)
     for (int mybox = 0; mybox < nbox; mybox++) {
       const DataIndex& din = dit[mybox];
 
@@ -1052,6 +1250,20 @@ McPhoto::generateComputationalPhotons(ParticleContainer<Photon>& a_photons,
 
       List<Photon>& photons = a_photons[lvl][din].listItems();
 
+      const EBCellFAB* importance = m_hasImportance ? &((*m_importance[lvl])[din]) : nullptr;
+
+      // Computational photon budget in a cell. Never less than one photon, since the photon weights must add up to the
+      // number of physical photons.
+      auto getMaxPhotons = [&](const VolIndex& a_vof) -> size_t {
+        if (!useImportance) {
+          return a_maxPhotonsPerCell;
+        }
+
+        const Real imp = (importance != nullptr) ? std::max((Real)0.0, (*importance)(a_vof, 0)) : 1.0;
+
+        return std::max((size_t)1, (size_t)std::llround(levelBudget * imp));
+      };
+
       // Regular cells. Note that we make superphotons if we have to. Also, only draw photons in valid cells,
       // grids that are covered by finer grids don't draw photons.
       auto regularKernel = [&](const IntVect& iv) -> void {
@@ -1060,8 +1272,11 @@ McPhoto::generateComputationalPhotons(ParticleContainer<Photon>& a_photons,
           const size_t num = numPhysPhotonsReg(iv, 0);
 
           if (num > 0) {
-            const std::vector<size_t> photonWeights = ParticleManagement::partitionParticleWeights(num,
-                                                                                                   a_maxPhotonsPerCell);
+            const size_t maxPhotons = getMaxPhotons(VolIndex(iv, 0));
+
+            const std::vector<size_t> photonWeights = ParticleManagement::partitionParticleWeights(num, maxPhotons);
+
+            numGenerated += photonWeights.size();
 
             const RealVect lo = probLo + RealVect(iv) * dx;
             const RealVect hi = lo + RealVect::Unit * dx;
@@ -1090,8 +1305,11 @@ McPhoto::generateComputationalPhotons(ParticleContainer<Photon>& a_photons,
           const size_t num = numPhysPhotons(vof, 0);
 
           if (num > 0) {
-            const std::vector<size_t> photonWeights = ParticleManagement::partitionParticleWeights(num,
-                                                                                                   a_maxPhotonsPerCell);
+            const size_t maxPhotons = getMaxPhotons(vof);
+
+            const std::vector<size_t> photonWeights = ParticleManagement::partitionParticleWeights(num, maxPhotons);
+
+            numGenerated += photonWeights.size();
 
             // These are needed when drawing photon starting positions within cut-cells -- we compute the
             // minimum bounding box when we draw the position within the valid region of the cut-cell.
@@ -1127,6 +1345,9 @@ McPhoto::generateComputationalPhotons(ParticleContainer<Photon>& a_photons,
       BoxLoops::loop(vofit, irregularKernel);
     }
   }
+
+  m_numGeneratedPhotons += numGenerated;
+  m_timeGenerate += Timer::wallClock() - startTime;
 }
 
 void
@@ -1358,6 +1579,264 @@ McPhoto::depositHybrid(EBAMRCellData&     a_depositionH,
   }
 }
 
+void
+McPhoto::depositFinalize(EBAMRCellData& a_phi) const noexcept
+{
+  CH_TIME("McPhoto::depositFinalize");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::depositFinalize" << endl;
+  }
+
+  // Compute m_depositionNC = sum(kappa*Wc)/sum(kappa)
+  this->depositNonConservative(m_depositionNC, a_phi);
+
+  // Compute hybrid deposition, including mass differnce
+  this->depositHybrid(a_phi, m_massDiff, m_depositionNC);
+
+  // Redistribute
+  if (m_blendConservation) {
+    m_amr->redistribute(a_phi, m_massDiff, m_realm, m_phase, Interval(0, 0));
+  }
+
+  // Average down and interpolate
+  m_amr->conservativeAverage(a_phi, m_realm, m_phase);
+  m_amr->interpGhost(a_phi, m_realm, m_phase);
+}
+
+void
+McPhoto::computeAbsorptionKernels() noexcept
+{
+  CH_TIME("McPhoto::computeAbsorptionKernels");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::computeAbsorptionKernels" << endl;
+  }
+
+  CH_assert(m_kernelRadius > 0);
+
+  const int finestLevel = m_amr->getFinestLevel();
+  const int numComputed = m_absorptionKernels.size();
+
+  if (numComputed > finestLevel) {
+    return;
+  }
+
+  // The kernel is computed for the absorption coefficient in the middle of the domain. Cells where the absorption coefficient
+  // is different do not use the kernel.
+  if (numComputed == 0) {
+    m_kernelKappa = m_rtSpecies->getAbsorptionCoefficient(0.5 * (m_amr->getProbLo() + m_amr->getProbHi()));
+  }
+
+  const int  R        = m_kernelRadius;
+  const int  W        = 2 * R + 1;
+  const Box  kernelBox(-R * IntVect::Unit, R * IntVect::Unit);
+  const auto rankSamp = ParallelOps::partition(m_kernelSamples);
+  const int  numSamp  = rankSamp.second - rankSamp.first + 1;
+
+  int kernelSize = 1;
+  for (int dir = 0; dir < SpaceDim; dir++) {
+    kernelSize *= W;
+  }
+
+  m_absorptionKernels.resize(finestLevel + 1);
+
+  for (int lvl = numComputed; lvl <= finestLevel; lvl++) {
+    const Real dx       = m_amr->getDx()[lvl];
+    const Real nearFrac = 1.0 - std::exp(-m_kernelKappa * R * dx);
+
+    Vector<Real> kernel(kernelSize, 0.0);
+
+    // Sample photons that start in the cell [0,1]^SpaceDim (in units of dx) and that are absorbed within the kernel radius. The
+    // path length is drawn from the exponential distribution truncated to [0, R*dx].
+    for (int i = 0; i < numSamp; i++) {
+      RealVect x0;
+      for (int dir = 0; dir < SpaceDim; dir++) {
+        x0[dir] = Random::getUniformReal01();
+      }
+
+      const RealVect direction = Random::getDirection();
+      const Real     pathLen   = -std::log(1.0 - Random::getUniformReal01() * nearFrac) / m_kernelKappa;
+      const RealVect x1        = x0 + direction * pathLen / dx;
+
+      int idx    = 0;
+      int stride = 1;
+      for (int dir = 0; dir < SpaceDim; dir++) {
+        const int offset = std::min(R, std::max(-R, (int)std::floor(x1[dir])));
+
+        idx += (offset + R) * stride;
+        stride *= W;
+      }
+
+      kernel[idx] += 1.0;
+    }
+
+    ParallelOps::vectorSum(kernel);
+
+    // Store the non-zero entries, normalized such that the kernel sums to the near-field absorption probability.
+    std::vector<std::pair<IntVect, Real>>& levelKernel = m_absorptionKernels[lvl];
+
+    levelKernel.resize(0);
+
+    for (BoxIterator bit(kernelBox); bit.ok(); ++bit) {
+      const IntVect offset = bit();
+
+      int idx    = 0;
+      int stride = 1;
+      for (int dir = 0; dir < SpaceDim; dir++) {
+        idx += (offset[dir] + R) * stride;
+        stride *= W;
+      }
+
+      if (kernel[idx] > 0.0) {
+        levelKernel.emplace_back(offset, kernel[idx] * nearFrac / m_kernelSamples);
+      }
+    }
+  }
+}
+
+bool
+McPhoto::isKernelPatch(const int a_level, const DataIndex& a_din) const noexcept
+{
+  CH_assert(a_level >= 0);
+  CH_assert(a_level <= m_amr->getFinestLevel());
+
+  const EBISBox&       ebisbox    = m_amr->getEBISLayout(m_realm, m_phase)[a_level][a_din];
+  const BaseFab<bool>& validCells = (*m_amr->getValidCells(m_realm)[a_level])[a_din];
+  const Box            cellBox    = m_amr->getGrids(m_realm)[a_level][a_din];
+
+  if (!ebisbox.isAllRegular()) {
+    return false;
+  }
+
+  for (BoxIterator bit(cellBox); bit.ok(); ++bit) {
+    if (!validCells(bit(), 0)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool
+McPhoto::isKernelCell(const IntVect& a_iv, const Box& a_interior, const RealVect& a_probLo, const Real a_dx) const noexcept
+{
+  if (!a_interior.contains(a_iv)) {
+    return false;
+  }
+
+  const RealVect pos   = a_probLo + (RealVect(a_iv) + 0.5 * RealVect::Unit) * a_dx;
+  const Real     kappa = m_rtSpecies->getAbsorptionCoefficient(pos);
+
+  return std::abs(kappa - m_kernelKappa) <= 1.E-10 * std::abs(m_kernelKappa);
+}
+
+void
+McPhoto::kernelAbsorption(EBAMRCellData& a_phi, EBAMRCellData& a_numPhysPhotons) noexcept
+{
+  CH_TIME("McPhoto::kernelAbsorption");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::kernelAbsorption" << endl;
+  }
+
+  CH_assert(m_kernelRadius > 0);
+
+  this->computeAbsorptionKernels();
+
+  const RealVect probLo = m_amr->getProbLo();
+  const int      nComp  = a_numPhysPhotons[0]->nComp();
+
+  for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
+    const DisjointBoxLayout& dbl     = m_amr->getGrids(m_realm)[lvl];
+    const DataIterator&      dit     = dbl.dataIterator();
+    const Real               dx      = m_amr->getDx()[lvl];
+    const Real               invVol  = 1.0 / std::pow(dx, SpaceDim);
+    const Real               farFrac = std::exp(-m_kernelKappa * m_kernelRadius * dx);
+
+    const std::vector<std::pair<IntVect, Real>>& kernel = m_absorptionKernels[lvl];
+
+    const int nbox = dit.size();
+
+#pragma omp parallel for schedule(runtime)
+    for (int mybox = 0; mybox < nbox; mybox++) {
+      const DataIndex& din = dit[mybox];
+
+      Box interior = dbl[din];
+      interior.grow(-m_kernelRadius);
+
+      if (interior.isEmpty() || !(this->isKernelPatch(lvl, din))) {
+        continue;
+      }
+
+      FArrayBox& phi            = (*a_phi[lvl])[din].getFArrayBox();
+      FArrayBox& numPhysPhotons = (*a_numPhysPhotons[lvl])[din].getFArrayBox();
+
+      // Deposit the near-field photons and keep the far-field photons. Note that the patch has no cut-cells.
+      auto regularKernel = [&](const IntVect& iv) -> void {
+        if (this->isKernelCell(iv, interior, probLo, dx)) {
+          for (int comp = 0; comp < nComp; comp++) {
+            const size_t num = numPhysPhotons(iv, comp);
+
+            if (num > 0) {
+              for (const auto& k : kernel) {
+                phi(iv + k.first, 0) += num * k.second * invVol;
+              }
+
+              numPhysPhotons(iv, comp) = Real(Random::getBinomial(num, farFrac));
+            }
+          }
+        }
+      };
+
+      BoxLoops::loop(interior, regularKernel);
+    }
+
+    a_phi[lvl]->exchange();
+  }
+}
+
+void
+McPhoto::shiftKernelPhotons(ParticleContainer<Photon>& a_photons) const noexcept
+{
+  CH_TIME("McPhoto::shiftKernelPhotons");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::shiftKernelPhotons" << endl;
+  }
+
+  CH_assert(m_kernelRadius > 0);
+
+  const RealVect probLo = m_amr->getProbLo();
+
+  for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
+    const DisjointBoxLayout& dbl = m_amr->getGrids(m_realm)[lvl];
+    const DataIterator&      dit = dbl.dataIterator();
+    const Real               dx  = m_amr->getDx()[lvl];
+
+    const int nbox = dit.size();
+
+#pragma omp parallel for schedule(runtime)
+    for (int mybox = 0; mybox < nbox; mybox++) {
+      const DataIndex& din = dit[mybox];
+
+      Box interior = dbl[din];
+      interior.grow(-m_kernelRadius);
+
+      if (interior.isEmpty() || !(this->isKernelPatch(lvl, din))) {
+        continue;
+      }
+
+      // The first part of the path lies inside the patch, which has no EBs, so we can simply move the photon.
+      for (ListIterator<Photon> lit(a_photons[lvl][din].listItems()); lit.ok(); ++lit) {
+        Photon& p = lit();
+
+        const IntVect iv = ParticleOps::getParticleCellIndex(p.position(), probLo, dx);
+
+        if (this->isKernelCell(iv, interior, probLo, dx)) {
+          p.position() += (m_kernelRadius * dx) * p.velocity() / p.velocity().vectorLength();
+        }
+      }
+    }
+  }
+}
+
 void
 McPhoto::depositPhotonsNGP(LevelData<EBCellFAB>&            a_output,
                            const ParticleContainer<Photon>& a_photons,
@@ -1406,7 +1885,8 @@ void
 McPhoto::advancePhotonsInstantaneous(ParticleContainer<Photon>& a_bulkPhotons,
                                      ParticleContainer<Photon>& a_ebPhotons,
                                      ParticleContainer<Photon>& a_domainPhotons,
-                                     ParticleContainer<Photon>& a_photons)
+                                     ParticleContainer<Photon>& a_photons,
+                                     EBAMRCellData*             a_directDeposit)
 {
   CH_TIMERS("McPhoto::advancePhotonsInstantaneous");
   CH_TIMER("McPhoto::advancePhotonsInstantaneous::amr_loop", t1);
@@ -1423,12 +1903,20 @@ McPhoto::advancePhotonsInstantaneous(ParticleContainer<Photon>& a_bulkPhotons,
   //          3. Move the photon to appropriate data holder:
   //                 Path crossed EB   => a_ebPhotons
   //                 Path cross domain => a_domainPhotons
-  //                 Absorbed in bulk  => a_bulkPhotons
+  //                 Absorbed in bulk  => a_bulkPhotons (or binned into a_directDeposit)
   //       }
   //
   //       Remap a_bulkPhotons, a_ebPhotons, a_domainPhotons
 
   CH_START(t1);
+  const Real startTime = Timer::wallClock();
+
+  // Counters for the step report.
+  long long numBulk   = 0LL;
+  long long numEB     = 0LL;
+  long long numDomain = 0LL;
+  long long numTests  = 0LL;
+
   // Low and high corners
   const RealVect probLo = m_amr->getProbLo();
   const RealVect probHi = m_amr->getProbHi();
@@ -1441,48 +1929,137 @@ McPhoto::advancePhotonsInstantaneous(ParticleContainer<Photon>& a_bulkPhotons,
   // This is the implicit function used for intersection tests
   const RefCountedPtr<BaseIF>& impFunc = m_computationalGeometry->getImplicitFunction(m_phase);
 
+  // Level-set on the mesh, used for skipping the EB intersection test for photons that are far away from the EB.
+  const EBAMRFAB* levelset = (m_intersectionBand && !impFunc.isNull()) ? &(m_amr->getLevelset(m_realm, m_phase))
+                                                                      : nullptr;
+
+  // Half the cell diagonal in units of dx, i.e. the largest distance between a point in a cell and the cell center.
+  const Real halfDiagonal = 0.5 * sqrt(1.0 * SpaceDim);
+
+  // Photons on the particle halo need special coarse-fine treatment, so they are never deposited directly.
+  const AMRMask* haloMask = nullptr;
+  if (a_directDeposit != nullptr && m_coarseFineDeposition != CoarseFineDeposition::Interp) {
+    haloMask = &(m_amr->getMask(s_particle_halo, m_haloBuffer, m_realm));
+  }
+
   for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
-    const DisjointBoxLayout& dbl = m_amr->getGrids(m_realm)[lvl];
-    const DataIterator&      dit = dbl.dataIterator();
-    const Real               dx  = m_amr->getDx()[lvl];
+    const DisjointBoxLayout& dbl    = m_amr->getGrids(m_realm)[lvl];
+    const DataIterator&      dit    = dbl.dataIterator();
+    const Real               dx     = m_amr->getDx()[lvl];
+    const Real               invVol = 1.0 / std::pow(dx, SpaceDim);
 
     const int nbox = dit.size();
 
-#pragma omp parallel for schedule(runtime)
+#pragma omp parallel for schedule(runtime) reduction(+ : numBulk, numEB, numDomain, numTests)
     for (int mybox = 0; mybox < nbox; mybox++) {
       const DataIndex& din = dit[mybox];
 
+      const Box cellBox = dbl[din];
+
       List<Photon>& bulkPhotons = a_bulkPhotons[lvl][din].listItems();
       List<Photon>& ebPhotons   = a_ebPhotons[lvl][din].listItems();
       List<Photon>& domPhotons  = a_domainPhotons[lvl][din].listItems();
       List<Photon>& allPhotons  = a_photons[lvl][din].listItems();
 
-      // Iterate over the Photons that will be moved.
-      for (ListIterator<Photon> lit(allPhotons); lit.ok(); ++lit) {
-        Photon& p = lit();
+      const FArrayBox* lsf = (levelset != nullptr) ? &((*(*levelset)[lvl])[din]) : nullptr;
+
+      // Data holders for direct deposition.
+      FArrayBox*           directPhi  = nullptr;
+      const BaseFab<bool>* validCells = nullptr;
+      const BaseFab<bool>* halo       = nullptr;
+
+      if (a_directDeposit != nullptr) {
+        directPhi  = &((*(*a_directDeposit)[lvl])[din].getFArrayBox());
+        validCells = &((*m_amr->getValidCells(m_realm)[lvl])[din]);
+
+        if (haloMask != nullptr && !(*haloMask)[lvl].isNull()) {
+          halo = &((*(*haloMask)[lvl])[din]);
+        }
+      }
 
-        // Draw a new random absorption position
-        const RealVect& oldPos    = p.position();
-        const RealVect& direction = p.velocity() / (p.velocity().vectorLength());
-        const RealVect  newPos    = oldPos + direction * this->randomExponential(p.kappa());
+      // Absorb a photon in the bulk. Photons that land in a valid cell in this patch are NGP-deposited directly and deleted, the
+      // rest are moved to the bulk photons. Both ::transfer and ::remove increment the iterator.
+      auto absorbInBulk = [&](ListIterator<Photon>& a_lit) -> void {
+        numBulk++;
+
+        if (directPhi != nullptr) {
+          const IntVect iv = ParticleOps::getParticleCellIndex(a_lit().position(), probLo, dx);
+
+          if (cellBox.contains(iv) && (*validCells)(iv, 0) && (halo == nullptr || !(*halo)(iv, 0))) {
+            (*directPhi)(iv, 0) += a_lit().weight() * invVol;
+
+            allPhotons.remove(a_lit);
+
+            return;
+          }
+        }
+
+        bulkPhotons.transfer(a_lit);
+      };
+
+      // With batched transport, the absorption positions and intersection flags are computed for all photons in the patch at once.
+      ParticleSoA<2, 1> batch;
+      std::vector<int>  status;
+
+      if (m_batchedTransport) {
+        std::vector<Real> uniforms(allPhotons.length());
+
+        Random::getUniformReal01(uniforms.data(), uniforms.size());
+
+        batch.pack(allPhotons);
+
+        this->computeInstantaneousPaths(batch, status, uniforms, lsf, !impFunc.isNull(), probLo, probHi, dx);
+      }
+
+      // Iterate over the Photons that will be moved. Every photon is transferred to one of the output lists, which moves the list
+      // node rather than allocating a new one. Note that ::transfer increments the iterator.
+      size_t i = 0;
+      for (ListIterator<Photon> lit(allPhotons); lit.ok(); i++) {
+        Photon& p = lit();
 
         // Check if we should check of different types of boundary intersections. These are cheap initial tests that allow
         // us to skip intersection tests for some photons.
+        const RealVect oldPos = p.position();
+
+        RealVect newPos;
+
         bool checkEB  = false;
         bool checkDom = false;
 
-        if (!impFunc.isNull()) {
-          checkEB = true;
+        if (m_batchedTransport) {
+          newPos   = batch.position(i);
+          checkDom = (status[i] & 1) != 0;
+          checkEB  = (status[i] & 2) != 0;
         }
-        for (int dir = 0; dir < SpaceDim; dir++) {
-          if (newPos[dir] < probLo[dir] || newPos[dir] > probHi[dir]) {
-            checkDom = true;
+        else {
+          // Draw a new random absorption position
+          const RealVect direction = p.velocity() / (p.velocity().vectorLength());
+          const Real     pathLen   = this->randomExponential(p.kappa());
+
+          newPos = oldPos + direction * pathLen;
+
+          if (!impFunc.isNull()) {
+            checkEB = true;
+
+            // Photons that start in a cell whose center is farther away from the EB than the photon travels can not hit the EB.
+            if (lsf != nullptr) {
+              const IntVect iv = ParticleOps::getParticleCellIndex(oldPos, probLo, dx);
+
+              if (lsf->box().contains(iv)) {
+                checkEB = std::abs((*lsf)(iv, 0)) <= pathLen + (halfDiagonal + 1.E-3) * dx;
+              }
+            }
+          }
+          for (int dir = 0; dir < SpaceDim; dir++) {
+            if (newPos[dir] < probLo[dir] || newPos[dir] > probHi[dir]) {
+              checkDom = true;
+            }
           }
         }
 
         if ((!checkEB && !checkDom) || m_transparentEB) {
           p.position() = newPos;
-          bulkPhotons.add(p);
+          absorbInBulk(lit);
         }
         else {
           // Must do an intersection test (with either EB or domain). These tests work such that we parametrize the photon path as
@@ -1503,9 +2080,13 @@ McPhoto::advancePhotonsInstantaneous(ParticleContainer<Photon>& a_bulkPhotons,
           // will have been defined as well.
           if (checkDom) {
             contactDomain = ParticleOps::domainIntersection(oldPos, newPos, probLo, probHi, sDom);
+
+            numTests++;
           }
 
           if (checkEB) {
+            numTests++;
+
             switch (m_intersectionEB) {
             case IntersectionEB::Raycast: {
               contactEB = ParticleOps::ebIntersectionRaycast(impFunc, oldPos, newPos, 1.E-3 * dx, sEB);
@@ -1528,7 +2109,7 @@ McPhoto::advancePhotonsInstantaneous(ParticleContainer<Photon>& a_bulkPhotons,
           // Move the photon to the appropriate data holder
           if (!contactEB && !contactDomain) {
             p.position() = newPos;
-            bulkPhotons.add(p);
+            absorbInBulk(lit);
           }
           else {
             const RealVect path = newPos - oldPos;
@@ -1536,19 +2117,22 @@ McPhoto::advancePhotonsInstantaneous(ParticleContainer<Photon>& a_bulkPhotons,
             if (sEB < sDom) {
               p.position() = oldPos + sEB * path;
 
-              ebPhotons.add(p);
+              ebPhotons.transfer(lit);
+
+              numEB++;
             }
             else {
               p.position() = oldPos + std::max((Real)0.0, sDom - SAFETY) * path;
 
-              domPhotons.add(p);
+              domPhotons.transfer(lit);
+
+              numDomain++;
             }
           }
         }
       }
 
-      // Everything will have been absorbed, but we used ::add rather than ::transfer, so just clear out the starting photons.
-      allPhotons.clear();
+      CH_assert(allPhotons.length() == 0);
     }
   }
   CH_STOP(t1);
@@ -1559,6 +2143,103 @@ McPhoto::advancePhotonsInstantaneous(ParticleContainer<Photon>& a_bulkPhotons,
   a_ebPhotons.remap();
   a_domainPhotons.remap();
   CH_STOP(t2);
+
+  m_numBulkAbsorbed += numBulk;
+  m_numEBAbsorbed += numEB;
+  m_numDomainAbsorbed += numDomain;
+  m_numIntersectionTests += numTests;
+  m_timeTransport += Timer::wallClock() - startTime;
+}
+
+void
+McPhoto::computeInstantaneousPaths(ParticleSoA<2, 1>&       a_photons,
+                                   std::vector<int>&        a_status,
+                                   const std::vector<Real>& a_uniforms,
+                                   const FArrayBox*         a_lsf,
+                                   const bool               a_hasEB,
+                                   const RealVect&          a_probLo,
+                                   const RealVect&          a_probHi,
+                                   const Real               a_dx) const noexcept
+{
+  CH_TIME("McPhoto::computeInstantaneousPaths");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::computeInstantaneousPaths" << endl;
+  }
+
+  const int num = a_photons.size();
+
+  CH_assert(a_uniforms.size() == a_photons.size());
+
+  a_status.resize(num);
+
+  // Raw arrays, which is all the kernel below sees. Photon::kappa() is the second scalar and Photon::velocity() is the first vector.
+  D_TERM(Real* const x = a_photons.positionData(0);, Real* const y = a_photons.positionData(1);,
+         Real* const z = a_photons.positionData(2);)
+  D_TERM(const Real* const vx = a_photons.vectData<0>(0);, const Real* const vy = a_photons.vectData<0>(1);,
+         const Real* const vz = a_photons.vectData<0>(2);)
+
+  const Real* const kappa   = a_photons.realData<1>();
+  const Real* const uniform = a_uniforms.data();
+  int* const        status  = a_status.data();
+
+  const Real D_DECL(xLo = a_probLo[0], yLo = a_probLo[1], zLo = a_probLo[2]);
+  const Real D_DECL(xHi = a_probHi[0], yHi = a_probHi[1], zHi = a_probHi[2]);
+
+  // Level-set data, only used for skipping EB intersection tests for photons that can not reach the EB.
+  const bool        hasLsf  = a_hasEB && (a_lsf != nullptr);
+  const Real* const lsf     = hasLsf ? a_lsf->dataPtr(0) : nullptr;
+  const int         lsfSize = hasLsf ? a_lsf->box().numPts() : 0;
+  const IntVect     lsfLo   = hasLsf ? a_lsf->smallEnd() : IntVect::Zero;
+  const IntVect     lsfHi   = hasLsf ? a_lsf->bigEnd() : -IntVect::Unit;
+  const IntVect     lsfSz   = hasLsf ? a_lsf->box().size() : IntVect::Zero;
+  const Real        band    = (0.5 * sqrt(1.0 * SpaceDim) + 1.E-3) * a_dx;
+
+  const int D_DECL(iLo = lsfLo[0], jLo = lsfLo[1], kLo = lsfLo[2]);
+  const int D_DECL(iHi = lsfHi[0], jHi = lsfHi[1], kHi = lsfHi[2]);
+  D_TERM(const int iSz = lsfSz[0];, , const int jSz = lsfSz[1];)
+
+  const bool hasEB = a_hasEB;
+  const Real dx    = a_dx;
+
+#ifdef CD_USE_OFFLOAD
+#pragma omp target teams distribute parallel for map(tofrom : D_DECL(x[0 : num], y[0 : num], z[0 : num]))                   \
+  map(to : D_DECL(vx[0 : num], vy[0 : num], vz[0 : num]), kappa[0 : num], uniform[0 : num], lsf[0 : lsfSize])                  \
+  map(from : status[0 : num])
+#else
+#pragma omp simd
+#endif
+  for (int i = 0; i < num; i++) {
+    const Real vlen    = sqrt(D_TERM(vx[i] * vx[i], +vy[i] * vy[i], +vz[i] * vz[i]));
+    const Real pathLen = -log(1.0 - uniform[i]) / kappa[i];
+    const Real s       = pathLen / vlen;
+
+    // Cell where the photon starts, used for the level-set lookup.
+    const int D_DECL(ii = (int)floor((x[i] - xLo) / dx), jj = (int)floor((y[i] - yLo) / dx), kk = (int)floor((z[i] - zLo) / dx));
+
+    D_TERM(x[i] += vx[i] * s;, y[i] += vy[i] * s;, z[i] += vz[i] * s;)
+
+    int flag = 0;
+
+    if (D_TERM(x[i] < xLo || x[i] > xHi, || y[i] < yLo || y[i] > yHi, || z[i] < zLo || z[i] > zHi)) {
+      flag |= 1;
+    }
+
+    if (hasEB) {
+      bool checkEB = true;
+
+      if (hasLsf && D_TERM(ii >= iLo && ii <= iHi, &&jj >= jLo && jj <= jHi, &&kk >= kLo && kk <= kHi)) {
+        const int idx = D_TERM((ii - iLo), +(jj - jLo) * iSz, +(kk - kLo) * iSz * jSz);
+
+        checkEB = fabs(lsf[idx]) <= pathLen + band;
+      }
+
+      if (checkEB) {
+        flag |= 2;
+      }
+    }
+
+    status[i] = flag;
+  }
 }
 
 void
@@ -1587,6 +2268,14 @@ McPhoto::advancePhotonsTransient(ParticleContainer<Photon>& a_bulkPhotons,
   //
   //       Remap a_bulkPhotons, a_ebPhotons, a_domainPhotons, a_photons
 
+  const Real startTime = Timer::wallClock();
+
+  // Counters for the step report.
+  long long numBulk   = 0LL;
+  long long numEB     = 0LL;
+  long long numDomain = 0LL;
+  long long numTests  = 0LL;
+
   // Low and high corners
   const RealVect probLo = m_amr->getProbLo();
   const RealVect probHi = m_amr->getProbHi();
@@ -1599,6 +2288,13 @@ McPhoto::advancePhotonsTransient(ParticleContainer<Photon>& a_bulkPhotons,
   // This is the implicit function used for intersection tests
   const RefCountedPtr<BaseIF>& impFunc = m_computationalGeometry->getImplicitFunction(m_phase);
 
+  // Level-set on the mesh, used for skipping the EB intersection test for photons that are far away from the EB.
+  const EBAMRFAB* levelset = (m_intersectionBand && !impFunc.isNull()) ? &(m_amr->getLevelset(m_realm, m_phase))
+                                                                      : nullptr;
+
+  // Half the cell diagonal in units of dx, i.e. the largest distance between a point in a cell and the cell center.
+  const Real halfDiagonal = 0.5 * sqrt(1.0 * SpaceDim);
+
   for (int lvl = 0; lvl <= m_amr->getFinestLevel(); lvl++) {
     const DisjointBoxLayout& dbl = m_amr->getGrids(m_realm)[lvl];
     const DataIterator&      dit = dbl.dataIterator();
@@ -1606,7 +2302,7 @@ McPhoto::advancePhotonsTransient(ParticleContainer<Photon>& a_bulkPhotons,
 
     const int nbox = dit.size();
 
-#pragma omp parallel for schedule(runtime)
+#pragma omp parallel for schedule(runtime) reduction(+ : numBulk, numEB, numDomain, numTests)
     for (int mybox = 0; mybox < nbox; mybox++) {
       const DataIndex& din = dit[mybox];
 
@@ -1615,6 +2311,8 @@ McPhoto::advancePhotonsTransient(ParticleContainer<Photon>& a_bulkPhotons,
       List<Photon>& domPhotons  = a_domainPhotons[lvl][din].listItems();
       List<Photon>& allPhotons  = a_photons[lvl][din].listItems();
 
+      const FArrayBox* lsf = (levelset != nullptr) ? &((*(*levelset)[lvl])[din]) : nullptr;
+
       // Iterate over the photons that will be moved.
       for (ListIterator<Photon> lit(allPhotons); lit.ok(); ++lit) {
         Photon& p = lit();
@@ -1633,6 +2331,15 @@ McPhoto::advancePhotonsTransient(ParticleContainer<Photon>& a_bulkPhotons,
 
         if (!impFunc.isNull()) {
           checkEB = true;
+
+          // Photons that start in a cell whose center is farther away from the EB than the photon travels can not hit the EB.
+          if (lsf != nullptr) {
+            const IntVect iv = ParticleOps::getParticleCellIndex(oldPos, probLo, dx);
+
+            if (lsf->box().contains(iv)) {
+              checkEB = std::abs((*lsf)(iv, 0)) <= pathLen + (halfDiagonal + 1.E-3) * dx;
+            }
+          }
         }
         for (int dir = 0; dir < SpaceDim; dir++) {
           if (newPos[dir] <= probLo[dir] || newPos[dir] >= probHi[dir]) {
@@ -1670,9 +2377,13 @@ McPhoto::advancePhotonsTransient(ParticleContainer<Photon>& a_bulkPhotons,
         if (checkDom) {
           absorbedDomain = ParticleOps::domainIntersection(oldPos, newPos, probLo, probHi, sDomain);
           sDomain        = (absorbedDomain) ? std::max((Real)0.0, sDomain - SAFETY) : sDomain;
+
+          numTests++;
         }
 
         if (checkEB) {
+          numTests++;
+
           switch (m_intersectionEB) {
           case IntersectionEB::Raycast: {
             absorbedEB = ParticleOps::ebIntersectionRaycast(impFunc, oldPos, newPos, 1.E-3 * dx, sEB);
@@ -1706,12 +2417,18 @@ McPhoto::advancePhotonsTransient(ParticleContainer<Photon>& a_bulkPhotons,
           // Now check where it was actually absorbed
           if (absorbedBulk && sBulk < std::min(sEB, sDomain)) {
             bulkPhotons.transfer(lit);
+
+            numBulk++;
           }
           else if (absorbedEB && sEB < std::min(sBulk, sDomain)) {
             ebPhotons.transfer(lit);
+
+            numEB++;
           }
           else if (absorbedDomain && sDomain < std::min(sBulk, sEB)) {
             domPhotons.transfer(lit);
+
+            numDomain++;
           }
           else {
             MayDay::Error("McPhoto::advancePhotonsTransient - logic bust");
@@ -1726,6 +2443,12 @@ McPhoto::advancePhotonsTransient(ParticleContainer<Photon>& a_bulkPhotons,
   a_ebPhotons.remap();
   a_domainPhotons.remap();
   a_photons.remap();
+
+  m_numBulkAbsorbed += numBulk;
+  m_numEBAbsorbed += numEB;
+  m_numDomainAbsorbed += numDomain;
+  m_numIntersectionTests += numTests;
+  m_timeTransport += Timer::wallClock() - startTime;
 }
 
 void
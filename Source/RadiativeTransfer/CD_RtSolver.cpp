@@ -26,9 +26,11 @@ RtSolver::RtSolver()
   CH_TIME("RtSolver::RtSolver");
 
   // Default settings
-  m_verbosity = -1;
-  m_name      = "RtSolver";
-  m_className = "RtSolver";
+  m_verbosity        = -1;
+  m_name             = "RtSolver";
+  m_className        = "RtSolver";
+  m_numSolves        = 0;
+  m_numSkippedSolves = 0;
 }
 
 RtSolver::~RtSolver()
@@ -54,6 +56,27 @@ RtSolver::isStationary()
   return m_stationary;
 }
 
+int
+RtSolver::getNumSolves() const noexcept
+{
+  return m_numSolves;
+}
+
+int
+RtSolver::getNumSkippedSolves() const noexcept
+{
+  return m_numSkippedSolves;
+}
+
+void
+RtSolver::printStepReport() noexcept
+{
+  CH_TIME("RtSolver::printStepReport");
+  if (m_verbosity > 5) {
+    pout() << m_name + "::printStepReport" << endl;
+  }
+}
+
 bool
 RtSolver::advance(const Real a_dt, const bool a_zeroPhi)
 {
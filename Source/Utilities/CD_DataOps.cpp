@@ -497,7 +497,7 @@ DataOps::compute(LevelData<EBCellFAB>& a_data, const std::function<Real(const Re
 
   const int nbox = dit.size();
 
-#pragma omp parallel for schedule(runtime)
+#pragma omp parallel for schedule(runtime) if (BoxLoops::threadOverBoxes(nbox))
   for (int mybox = 0; mybox < nbox; mybox++) {
     const DataIndex& din = dit[mybox];
 
@@ -523,7 +523,7 @@ DataOps::compute(LevelData<EBCellFAB>& a_data, const std::function<Real(const Re
         data(vof, comp) = a_func(tmp(vof, comp));
       };
 
-      BoxLoops::loop(box, regularKernel);
+      BoxLoops::loopTiled(box, regularKernel);
       BoxLoops::loop(vofit, irregularKernel);
     }
   }
@@ -1648,26 +1648,35 @@ DataOps::max(LevelData<EBCellFAB>& a_data, const LevelData<EBCellFAB>& a_data1,
 }
 
 void
-DataOps::getMaxMin(Real& a_max, Real& a_min, EBAMRCellData& a_data, const int a_comp)
+DataOps::getMaxMin(Real& a_max, Real& a_min, EBAMRCellData& a_data, const int a_comp, const bool a_localOnly)
 {
   CH_TIME("DataOps::getMaxMin(EBAMRCellData)");
 
   a_max = -std::numeric_limits<Real>::max();
   a_min = +std::numeric_limits<Real>::max();
 
+  // Levels are computed locally and reduced once at the end.
   for (int lvl = 0; lvl < a_data.size(); lvl++) {
     Real lvlMax = -std::numeric_limits<Real>::max();
     Real lvlMin = +std::numeric_limits<Real>::max();
 
-    DataOps::getMaxMin(lvlMax, lvlMin, *a_data[lvl], a_comp);
+    DataOps::getMaxMin(lvlMax, lvlMin, *a_data[lvl], a_comp, true);
 
     a_max = std::max(a_max, lvlMax);
     a_min = std::min(a_min, lvlMin);
   }
+
+  if (!a_localOnly) {
+    ParallelOps::Reduction reduction;
+
+    reduction.max(a_max);
+    reduction.min(a_min);
+    reduction.reduce();
+  }
 }
 
 void
-DataOps::getMaxMin(Real& a_max, Real& a_min, LevelData<EBCellFAB>& a_data, const int a_comp)
+DataOps::getMaxMin(Real& a_max, Real& a_min, LevelData<EBCellFAB>& a_data, const int a_comp, const bool a_localOnly)
 {
   CH_TIME("DataOps::getMaxMin(LD<EBCellFAB>)");
 
@@ -1708,8 +1717,13 @@ DataOps::getMaxMin(Real& a_max, Real& a_min, LevelData<EBCellFAB>& a_data, const
     BoxLoops::loop(vofit, irregularKernel);
   }
 
-  a_max = ParallelOps::max(a_max);
-  a_min = ParallelOps::min(a_min);
+  if (!a_localOnly) {
+    ParallelOps::Reduction reduction;
+
+    reduction.max(a_max);
+    reduction.min(a_min);
+    reduction.reduce();
+  }
 }
 
 void
@@ -1794,28 +1808,37 @@ DataOps::getMaxMin(Vector<Real>& a_max, Vector<Real>& a_min, Vector<EBAMRCellDat
 }
 
 void
-DataOps::getMaxMinNorm(Real& a_max, Real& a_min, EBAMRCellData& a_data)
+DataOps::getMaxMinNorm(Real& a_max, Real& a_min, EBAMRCellData& a_data, const bool a_localOnly)
 {
-  CH_TIME("DataOps::getMaxMinNorm(EBAMRCellData)");
+  CH_TIME("DataOps::getMaxMinNorm(EBAMRCellData, bool)");
 
   a_max = -std::numeric_limits<Real>::max();
   a_min = std::numeric_limits<Real>::max();
 
+  // Reduce once over the MPI ranks rather than once per level.
   for (int lvl = 0; lvl < a_data.size(); lvl++) {
     Real lvlMax;
     Real lvlMin;
 
-    DataOps::getMaxMinNorm(lvlMax, lvlMin, *a_data[lvl]);
+    DataOps::getMaxMinNorm(lvlMax, lvlMin, *a_data[lvl], true);
 
     a_max = std::max(a_max, lvlMax);
     a_min = std::min(a_min, lvlMin);
   }
+
+  if (!a_localOnly) {
+    ParallelOps::Reduction reduction;
+
+    reduction.max(a_max);
+    reduction.min(a_min);
+    reduction.reduce();
+  }
 }
 
 void
-DataOps::getMaxMinNorm(Real& a_max, Real& a_min, LevelData<EBCellFAB>& a_data)
+DataOps::getMaxMinNorm(Real& a_max, Real& a_min, LevelData<EBCellFAB>& a_data, const bool a_localOnly)
 {
-  CH_TIME("DataOps::LD<EBCelLFAB>");
+  CH_TIME("DataOps::getMaxMinNorm(LD<EBCellFAB>, bool)");
 
   a_max = -std::numeric_limits<Real>::max();
   a_min = std::numeric_limits<Real>::max();
@@ -1879,8 +1902,13 @@ DataOps::getMaxMinNorm(Real& a_max, Real& a_min, LevelData<EBCellFAB>& a_data)
   }
 
   // If running with MPI then we need to reduce the result.
-  a_max = ParallelOps::max(a_max);
-  a_min = ParallelOps::min(a_min);
+  if (!a_localOnly) {
+    ParallelOps::Reduction reduction;
+
+    reduction.max(a_max);
+    reduction.min(a_min);
+    reduction.reduce();
+  }
 }
 
 void
@@ -1939,8 +1967,11 @@ DataOps::getMaxMinNorm(Real& a_max, Real& a_min, LevelData<BaseIVFAB<Real>>& a_d
   }
 
   // If running with MPI then we need to reduce the result.
-  a_max = ParallelOps::max(a_max);
-  a_min = ParallelOps::min(a_min);
+  ParallelOps::Reduction reduction;
+
+  reduction.max(a_max);
+  reduction.min(a_min);
+  reduction.reduce();
 }
 
 void
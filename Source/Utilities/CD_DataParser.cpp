@@ -10,17 +10,113 @@
 */
 
 // Std includes
+#include <algorithm>
 #include <fstream>
 #include <sstream>
+#include <map>
 
 // Chombo includes
 #include <CH_Timer.H>
 #include <REAL.H>
+#include <SPMD.H>
 
 // Our includes
 #include <CD_DataParser.H>
 #include <CD_NamespaceHeader.H>
 
+namespace DataParser {
+
+  /*!
+    @brief Cached file contents, indexed by file name. 
+  */
+  static std::map<std::string, std::string> s_fileCache;
+} // namespace DataParser
+
+bool
+DataParser::cacheFile(const std::string a_fileName)
+{
+  CH_TIME("DataParser::cacheFile");
+
+  // All ranks have the same cache since this routine is collective, so a file that is already cached is never re-broadcast.
+  if (s_fileCache.count(a_fileName) > 0) {
+    return true;
+  }
+
+  int         exists = 0;
+  std::string contents;
+
+  if (procID() == 0) {
+    std::ifstream inputFile(a_fileName);
+
+    if (inputFile.good()) {
+      std::ostringstream oss;
+      oss << inputFile.rdbuf();
+
+      exists   = 1;
+      contents = oss.str();
+    }
+  }
+
+#ifdef CH_MPI
+  long long length = contents.size();
+
+  MPI_Bcast(&exists, 1, MPI_INT, 0, Chombo_MPI::comm);
+  MPI_Bcast(&length, 1, MPI_LONG_LONG, 0, Chombo_MPI::comm);
+
+  contents.resize(length);
+
+  // The MPI count is an int, so broadcast large files in chunks.
+  constexpr long long chunkSize = 1LL << 30;
+
+  for (long long offset = 0; offset < length; offset += chunkSize) {
+    const int count = std::min(chunkSize, length - offset);
+
+    MPI_Bcast(&contents[offset], count, MPI_CHAR, 0, Chombo_MPI::comm);
+  }
+#endif
+
+  if (exists > 0) {
+    s_fileCache.emplace(a_fileName, std::move(contents));
+  }
+
+  return exists > 0;
+}
+
+bool
+DataParser::isCached(const std::string a_fileName)
+{
+  return s_fileCache.count(a_fileName) > 0;
+}
+
+void
+DataParser::clearFileCache()
+{
+  CH_TIME("DataParser::clearFileCache");
+
+  s_fileCache.clear();
+}
+
+std::string
+DataParser::getFileContents(const std::string a_fileName)
+{
+  CH_TIME("DataParser::getFileContents");
+
+  const auto it = s_fileCache.find(a_fileName);
+
+  if (it != s_fileCache.end()) {
+    return it->second;
+  }
+
+  std::ifstream      inputFile(a_fileName);
+  std::ostringstream oss;
+
+  if (inputFile.good()) {
+    oss << inputFile.rdbuf();
+  }
+
+  return oss.str();
+}
+
 LookupTable1D<Real, 1>
 DataParser::simpleFileReadASCII(const std::string       a_fileName,
                                 const int               a_xColumn,
@@ -32,9 +128,9 @@ DataParser::simpleFileReadASCII(const std::string       a_fileName,
   // This is the return table. It will be populated as we read the file.
   LookupTable1D<Real, 1> returnTable;
 
-  // Open an input file stream and start reading lines.
-  std::ifstream inputFile(a_fileName);
-  std::string   line;
+  // Open an input stream and start reading lines. This reads from the file cache if the file has been cached.
+  std::istringstream inputFile(DataParser::getFileContents(a_fileName));
+  std::string        line;
 
   while (std::getline(inputFile, line)) {
 
@@ -90,10 +186,10 @@ DataParser::fractionalFileReadASCII(const std::string       a_fileName,
   // This is the return table. It will be populated as we read the file.
   LookupTable1D<Real, 1> returnTable;
 
-  // Open an input file stream and start reading lines.
-  bool          parseLine = false;
-  std::ifstream inputFile(a_fileName);
-  std::string   line;
+  // Open an input stream and start reading lines. This reads from the file cache if the file has been cached.
+  bool               parseLine = false;
+  std::istringstream inputFile(DataParser::getFileContents(a_fileName));
+  std::string        line;
 
   while (std::getline(inputFile, line)) {
 
@@ -153,9 +249,9 @@ DataParser::readPointParticlesASCII(const std::string       a_fileName,
 {
   CH_TIME("DataParser::readPointParticlesASCII");
 
-  // Open an input file stream and start reading lines.
-  std::ifstream inputFile(a_fileName);
-  std::string   line;
+  // Open an input stream and start reading lines. This reads from the file cache if the file has been cached.
+  std::istringstream inputFile(DataParser::getFileContents(a_fileName));
+  std::string        line;
 
   List<PointParticle> particles;
 
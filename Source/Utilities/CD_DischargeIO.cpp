@@ -11,6 +11,11 @@
 
 // Std includes
 #include <sstream>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <map>
 
 // Chombo includes
 #include <CH_HDF5.H>
@@ -135,17 +140,203 @@ DischargeIO::writeEBHDF5Header(HDF5Handle&                a_handleH5,
 }
 #endif
 
+/*!
+  @brief Round the mantissa of a floating point number to the input number of bits (round-to-nearest).
+  @param[inout] a_value Value to round
+  @param[in]    a_bits  Number of retained mantissa bits
+*/
+template <typename T, typename I, int N>
+static inline void
+roundMantissa(T& a_value, const int a_bits) noexcept
+{
+  static_assert(sizeof(T) == sizeof(I), "roundMantissa -- type sizes do not match");
+
+  const int numDrop = N - a_bits;
+
+  if (numDrop > 0 && std::isfinite(a_value)) {
+    I bits;
+    std::memcpy(&bits, &a_value, sizeof(T));
+
+    const I half = I(1) << (numDrop - 1);
+    const I mask = ~((I(1) << numDrop) - 1);
+
+    bits = (bits + half) & mask;
+
+    std::memcpy(&a_value, &bits, sizeof(T));
+  }
+}
+
+/*!
+  @brief Round the mantissa of a Real
+  @param[inout] a_value Value to round
+  @param[in]    a_bits  Number of retained mantissa bits
+*/
+static inline void
+roundMantissa(Real& a_value, const int a_bits) noexcept
+{
+#ifdef CH_USE_FLOAT
+  roundMantissa<float, uint32_t, 23>(a_value, a_bits);
+#else
+  roundMantissa<double, uint64_t, 52>(a_value, a_bits);
+#endif
+}
+
 #ifdef CH_USE_HDF5
-void
-DischargeIO::writeEBHDF5Level(HDF5Handle&                 a_handleH5,
-                              const LevelData<EBCellFAB>& a_outputData,
-                              const ProblemDomain         a_domain,
-                              const Real                  a_dx,
-                              const Real                  a_dt,
-                              const Real                  a_time,
-                              const int                   a_level,
-                              const int                   a_refRatio,
-                              const int                   a_numGhost) noexcept
+/*!
+  @brief Replacement for Chombo's writeLevel which writes the data set with reduced precision and/or compression.
+  @details This writes the same attributes and data sets as writeLevel, so the files can be read by the same tools. The
+  input data is released box by box while it is packed into the output buffer.
+*/
+static void
+writeLevelCompressed(HDF5Handle&                       a_handleH5,
+                     LevelData<FArrayBox>&             a_levelData,
+                     const ProblemDomain               a_domain,
+                     const Real                        a_dx,
+                     const Real                        a_dt,
+                     const Real                        a_time,
+                     const int                         a_level,
+                     const int                         a_refRatio,
+                     const int                         a_numGhost,
+                     const DischargeIO::PlotPrecision& a_precision) noexcept
+{
+  CH_TIME("DischargeIO::writeLevelCompressed");
+
+  const DisjointBoxLayout& dbl     = a_levelData.disjointBoxLayout();
+  const DataIterator&      dit     = dbl.dataIterator();
+  const IntVect            ghost   = a_numGhost * IntVect::Unit;
+  const int                numComp = a_levelData.nComp();
+  const int                nbox    = dit.size();
+
+  // Global offsets of each box in the data set, and the local ranges in layout order (which is also the DataIterator order).
+  std::vector<long long>                                         offsets(1, 0LL);
+  std::vector<std::pair<unsigned long long, unsigned long long>> ranges;
+
+  for (LayoutIterator lit = dbl.layoutIterator(); lit.ok(); ++lit) {
+    const long long size = grow(dbl[lit()], ghost).numPts() * numComp;
+
+    if (dbl.procID(lit()) == procID()) {
+      ranges.emplace_back(offsets.back(), size);
+    }
+
+    offsets.emplace_back(offsets.back() + size);
+  }
+
+  CH_assert(ranges.size() == (size_t)nbox);
+
+  std::vector<unsigned long long> localOffsets(1, 0ULL);
+  for (const auto& r : ranges) {
+    localOffsets.emplace_back(localOffsets.back() + r.second);
+  }
+
+  // Pack the data, round the mantissas, and release the input.
+  std::vector<Real> buffer(localOffsets.back());
+
+#pragma omp parallel for schedule(runtime)
+  for (int mybox = 0; mybox < nbox; mybox++) {
+    const DataIndex& din = dit[mybox];
+
+    FArrayBox& levelFAB = a_levelData[din];
+
+    const long long numPts = levelFAB.box().numPts();
+
+    CH_assert(numPts * numComp == ranges[mybox].second);
+
+    Real* data = &buffer[localOffsets[mybox]];
+
+    for (int comp = 0; comp < numComp; comp++) {
+      const Real* src  = levelFAB.dataPtr(comp);
+      const int   bits = (comp < a_precision.mantissaBits.size()) ? a_precision.mantissaBits[comp] : 0;
+
+      for (long long i = 0; i < numPts; i++) {
+        data[comp * numPts + i] = src[i];
+
+        if (bits > 0) {
+          roundMantissa(data[comp * numPts + i], bits);
+        }
+      }
+    }
+
+    levelFAB.clear();
+  }
+
+  // Level attributes and the box layout, as in writeLevel.
+  const std::string parentGroup = a_handleH5.getGroup();
+
+  a_handleH5.setGroupToLevel(a_level);
+
+  HDF5HeaderData meta;
+
+  meta.m_int["ref_ratio"]   = a_refRatio;
+  meta.m_real["dx"]         = a_dx;
+  meta.m_real["dt"]         = a_dt;
+  meta.m_real["time"]       = a_time;
+  meta.m_box["prob_domain"] = a_domain.domainBox();
+
+  meta.writeToFile(a_handleH5);
+
+  if (write(a_handleH5, dbl) != 0) {
+    MayDay::Error("DischargeIO::writeLevelCompressed -- error in writing boxes");
+  }
+
+  // Box offsets are written by the master rank.
+  std::vector<std::pair<unsigned long long, unsigned long long>> offsetRanges;
+  if (procID() == 0) {
+    offsetRanges.emplace_back(0ULL, offsets.size());
+  }
+
+  DischargeIO::writeDataset(a_handleH5,
+                            "data:offsets=0",
+                            H5T_NATIVE_LLONG,
+                            H5T_NATIVE_LLONG,
+                            offsets.size(),
+                            offsetRanges,
+                            offsets.data(),
+                            0);
+
+  DischargeIO::writeDataset(a_handleH5,
+                            "data:datatype=0",
+                            a_precision.singlePrecision ? H5T_NATIVE_FLOAT : H5T_NATIVE_REAL,
+                            H5T_NATIVE_REAL,
+                            offsets.back(),
+                            ranges,
+                            buffer.data(),
+                            a_precision.compression);
+
+  HDF5HeaderData info;
+
+  info.m_intvect["ghost"]       = ghost;
+  info.m_intvect["outputGhost"] = ghost;
+  info.m_int["comps"]           = numComp;
+  info.m_string["objectType"]   = "FArrayBox";
+
+  const std::string levelGroup = a_handleH5.getGroup();
+
+  a_handleH5.setGroup(levelGroup + "/data_attributes");
+  info.writeToFile(a_handleH5);
+
+  a_handleH5.setGroup(parentGroup);
+}
+#endif
+
+#ifdef CH_USE_HDF5
+/*!
+  @brief Implementation of DischargeIO::writeEBHDF5Level.
+  @details If a_releaseData is not null it must be the same object as a_outputData, and each box is cleared once it has been
+  converted to the HDF5 layout. If a_region is not empty only the parts of the grid patches that overlap it are written.
+*/
+static void
+writeEBHDF5LevelData(HDF5Handle&                       a_handleH5,
+                     const LevelData<EBCellFAB>&       a_outputData,
+                     LevelData<EBCellFAB>*             a_releaseData,
+                     const ProblemDomain               a_domain,
+                     const Real                        a_dx,
+                     const Real                        a_dt,
+                     const Real                        a_time,
+                     const int                         a_level,
+                     const int                         a_refRatio,
+                     const int                         a_numGhost,
+                     const DischargeIO::PlotPrecision& a_precision,
+                     const Box&                        a_region) noexcept
 {
   CH_TIMERS("DischargeIO::writeEBHDF5Level");
   CH_TIMER("DischargeIO::writeEBHDF5Level::alloc", t1);
@@ -166,7 +357,42 @@ DischargeIO::writeEBHDF5Level(HDF5Handle&                 a_handleH5,
   const int indexDist         = indexNormal + SpaceDim;
   const int numCompTotal      = indexDist + 1;
 
-  const DisjointBoxLayout& dbl = a_outputData.disjointBoxLayout();
+  const DisjointBoxLayout& inputDbl = a_outputData.disjointBoxLayout();
+
+  // Output grids. When writing a region we only keep the (clipped) patches that overlap it, on the same ranks as the input
+  // patches. The output patches are mapped to the input patches through their boxes.
+  DisjointBoxLayout        dbl;
+  std::map<Box, DataIndex> inputIndices;
+
+  if (a_region.isEmpty()) {
+    dbl = inputDbl;
+  }
+  else {
+    Vector<Box> boxes;
+    Vector<int> ranks;
+
+    for (LayoutIterator lit = inputDbl.layoutIterator(); lit.ok(); ++lit) {
+      const Box box = inputDbl[lit()] & a_region;
+
+      if (!box.isEmpty()) {
+        boxes.push_back(box);
+        ranks.push_back(inputDbl.procID(lit()));
+      }
+    }
+
+    dbl.define(boxes, ranks, a_domain);
+
+    for (DataIterator inputDit = inputDbl.dataIterator(); inputDit.ok(); ++inputDit) {
+      const Box box = inputDbl[inputDit()] & a_region;
+
+      if (!box.isEmpty()) {
+        inputIndices.emplace(box, inputDit());
+      }
+      else if (a_releaseData != nullptr) {
+        (*a_releaseData)[inputDit()].clear();
+      }
+    }
+  }
 
   CH_START(t1);
   LevelData<FArrayBox> levelData(dbl, numCompTotal, a_numGhost * IntVect::Unit);
@@ -178,10 +404,11 @@ DischargeIO::writeEBHDF5Level(HDF5Handle&                 a_handleH5,
 
 #pragma omp parallel for schedule(runtime)
   for (int mybox = 0; mybox < nbox; mybox++) {
-    const DataIndex& din = dit[mybox];
+    const DataIndex& din      = dit[mybox];
+    const DataIndex  inputDin = a_region.isEmpty() ? din : inputIndices.at(dbl[din]);
 
     FArrayBox&       levelFAB      = levelData[din];
-    const EBCellFAB& outputData    = a_outputData[din];
+    const EBCellFAB& outputData    = a_outputData[inputDin];
     const FArrayBox& outputDataReg = outputData.getFArrayBox();
     const EBISBox&   ebisbox       = outputData.getEBISBox();
     const Box        outputBox     = levelFAB.box() & a_domain;
@@ -332,6 +559,33 @@ DischargeIO::writeEBHDF5Level(HDF5Handle&                 a_handleH5,
       }
     }
     CH_STOP(t6);
+
+    // Release the input data now that it has been converted.
+    if (a_releaseData != nullptr) {
+      (*a_releaseData)[inputDin].clear();
+    }
+  }
+
+  const bool fullPrecision = !a_precision.singlePrecision && a_precision.compression <= 0 &&
+                             std::none_of(a_precision.mantissaBits.begin(),
+                                          a_precision.mantissaBits.end(),
+                                          [](const int b) -> bool {
+                                            return b > 0;
+                                          });
+
+  if (!fullPrecision) {
+    writeLevelCompressed(a_handleH5,
+                         levelData,
+                         a_domain,
+                         a_dx,
+                         a_dt,
+                         a_time,
+                         a_level,
+                         a_refRatio,
+                         a_numGhost,
+                         a_precision);
+
+    return;
   }
 
   const int success = writeLevel(a_handleH5,
@@ -351,6 +605,63 @@ DischargeIO::writeEBHDF5Level(HDF5Handle&                 a_handleH5,
 }
 #endif
 
+#ifdef CH_USE_HDF5
+void
+DischargeIO::writeEBHDF5Level(HDF5Handle&                 a_handleH5,
+                              const LevelData<EBCellFAB>& a_outputData,
+                              const ProblemDomain         a_domain,
+                              const Real                  a_dx,
+                              const Real                  a_dt,
+                              const Real                  a_time,
+                              const int                   a_level,
+                              const int                   a_refRatio,
+                              const int                   a_numGhost) noexcept
+{
+  writeEBHDF5LevelData(a_handleH5,
+                       a_outputData,
+                       nullptr,
+                       a_domain,
+                       a_dx,
+                       a_dt,
+                       a_time,
+                       a_level,
+                       a_refRatio,
+                       a_numGhost,
+                       DischargeIO::PlotPrecision(),
+                       Box());
+}
+#endif
+
+#ifdef CH_USE_HDF5
+void
+DischargeIO::writeEBHDF5Level(HDF5Handle&           a_handleH5,
+                              LevelData<EBCellFAB>& a_outputData,
+                              const ProblemDomain   a_domain,
+                              const Real            a_dx,
+                              const Real            a_dt,
+                              const Real            a_time,
+                              const int             a_level,
+                              const int             a_refRatio,
+                              const int             a_numGhost,
+                              const bool            a_releaseInput,
+                              const PlotPrecision&  a_precision,
+                              const Box&            a_region) noexcept
+{
+  writeEBHDF5LevelData(a_handleH5,
+                       a_outputData,
+                       a_releaseInput ? &a_outputData : nullptr,
+                       a_domain,
+                       a_dx,
+                       a_dt,
+                       a_time,
+                       a_level,
+                       a_refRatio,
+                       a_numGhost,
+                       a_precision,
+                       a_region);
+}
+#endif
+
 #ifdef CH_USE_HDF5
 void
 DischargeIO::writeEBHDF5(const std::string&                   a_filename,
@@ -396,7 +707,7 @@ DischargeIO::writeEBHDF5(const std::string&                   a_filename,
 
   // Write levfle-by-level
   for (int lvl = 0; lvl < a_numLevels; lvl++) {
-    const int refRat = (lvl < a_numLevels) ? a_refinementRatios[lvl] : 1;
+    const int refRat = (lvl < a_numLevels - 1) ? a_refinementRatios[lvl] : 1;
     DischargeIO::writeEBHDF5Level(handle,
                                   *a_data[lvl],
                                   a_domains[lvl],
@@ -431,4 +742,172 @@ DischargeIO::writeEBHDF5(const EBAMRCellData& a_data, const std::string& a_file)
 }
 #endif
 
+#ifdef CH_USE_HDF5
+void
+DischargeIO::writeDataset(HDF5Handle&                                                           a_handle,
+                          const std::string&                                                    a_name,
+                          const hid_t                                                           a_fileType,
+                          const hid_t                                                           a_memType,
+                          const unsigned long long                                              a_globalSize,
+                          const std::vector<std::pair<unsigned long long, unsigned long long>>& a_ranges,
+                          const void*                                                           a_data,
+                          const int                                                             a_compression) noexcept
+{
+  CH_TIME("DischargeIO::writeDataset");
+
+  CH_assert(a_handle.isOpen());
+  CH_assert(a_compression >= 0 && a_compression <= 9);
+
+  // Maximum number of elements in each chunk when using compression.
+  constexpr hsize_t maxChunkSize = 1 << 16;
+
+  hsize_t dims[1];
+  dims[0] = a_globalSize;
+
+  hid_t fileSpace = H5Screate_simple(1, dims, nullptr);
+
+  // Chunking and compression, if we can.
+  hid_t createProps = H5Pcreate(H5P_DATASET_CREATE);
+
+  if (a_compression > 0 && a_globalSize > 0 && H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0) {
+#if !defined(CH_MPI) || H5_VERSION_GE(1, 10, 2)
+    hsize_t chunk[1];
+    chunk[0] = std::min(maxChunkSize, dims[0]);
+
+    H5Pset_chunk(createProps, 1, chunk);
+    H5Pset_shuffle(createProps);
+    H5Pset_deflate(createProps, a_compression);
+#endif
+  }
+
+  hid_t dataset = H5Dcreate2(a_handle.groupID(), a_name.c_str(), a_fileType, fileSpace, H5P_DEFAULT, createProps, H5P_DEFAULT);
+
+  // Select the local ranges in the file. Adjacent ranges are merged since unions of many hyperslabs can be slow.
+  hsize_t localSize = 0;
+
+  H5Sselect_none(fileSpace);
+
+  for (size_t i = 0; i < a_ranges.size();) {
+    hsize_t start[1];
+    hsize_t count[1];
+
+    start[0] = a_ranges[i].first;
+    count[0] = a_ranges[i].second;
+
+    size_t j = i + 1;
+    while (j < a_ranges.size() && a_ranges[j].first == start[0] + count[0]) {
+      count[0] += a_ranges[j].second;
+
+      j++;
+    }
+
+    if (count[0] > 0) {
+      H5Sselect_hyperslab(fileSpace, (localSize == 0) ? H5S_SELECT_SET : H5S_SELECT_OR, start, nullptr, count, nullptr);
+
+      localSize += count[0];
+    }
+
+    i = j;
+  }
+
+  hsize_t memDims[1];
+  memDims[0] = std::max(localSize, (hsize_t)1);
+
+  hid_t memSpace = H5Screate_simple(1, memDims, nullptr);
+  if (localSize == 0) {
+    H5Sselect_none(memSpace);
+  }
+
+  // Collective write.
+  hid_t transferProps = H5Pcreate(H5P_DATASET_XFER);
+#ifdef CH_MPI
+  H5Pset_dxpl_mpio(transferProps, H5FD_MPIO_COLLECTIVE);
+#endif
+
+  const unsigned long long dummy = 0ULL;
+
+  H5Dwrite(dataset, a_memType, memSpace, fileSpace, transferProps, (localSize > 0) ? a_data : &dummy);
+
+  H5Pclose(transferProps);
+  H5Pclose(createProps);
+  H5Sclose(memSpace);
+  H5Sclose(fileSpace);
+  H5Dclose(dataset);
+}
+#endif
+
+#ifdef CH_USE_HDF5
+void
+DischargeIO::readDataset(HDF5Handle&                                                           a_handle,
+                         const std::string&                                                    a_name,
+                         const hid_t                                                           a_memType,
+                         const std::vector<std::pair<unsigned long long, unsigned long long>>& a_ranges,
+                         void*                                                                 a_data) noexcept
+{
+  CH_TIME("DischargeIO::readDataset");
+
+  CH_assert(a_handle.isOpen());
+
+  hid_t dataset = H5Dopen2(a_handle.groupID(), a_name.c_str(), H5P_DEFAULT);
+  if (dataset < 0) {
+    const std::string err = "DischargeIO::readDataset - could not open dataset '" + a_name + "'";
+
+    MayDay::Error(err.c_str());
+  }
+
+  hid_t fileSpace = H5Dget_space(dataset);
+
+  // Select the local ranges in the file.
+  hsize_t localSize = 0;
+
+  H5Sselect_none(fileSpace);
+
+  for (size_t i = 0; i < a_ranges.size();) {
+    hsize_t start[1];
+    hsize_t count[1];
+
+    start[0] = a_ranges[i].first;
+    count[0] = a_ranges[i].second;
+
+    size_t j = i + 1;
+    while (j < a_ranges.size() && a_ranges[j].first == start[0] + count[0]) {
+      count[0] += a_ranges[j].second;
+
+      j++;
+    }
+
+    if (count[0] > 0) {
+      H5Sselect_hyperslab(fileSpace, (localSize == 0) ? H5S_SELECT_SET : H5S_SELECT_OR, start, nullptr, count, nullptr);
+
+      localSize += count[0];
+    }
+
+    i = j;
+  }
+
+  hsize_t memDims[1];
+  memDims[0] = std::max(localSize, (hsize_t)1);
+
+  hid_t memSpace = H5Screate_simple(1, memDims, nullptr);
+  if (localSize == 0) {
+    H5Sselect_none(memSpace);
+  }
+
+  // Collective read.
+  hid_t transferProps = H5Pcreate(H5P_DATASET_XFER);
+#ifdef CH_MPI
+  H5Pset_dxpl_mpio(transferProps, H5FD_MPIO_COLLECTIVE);
+#endif
+
+  unsigned long long dummy = 0ULL;
+
+  H5Dread(dataset, a_memType, memSpace, fileSpace, transferProps, (localSize > 0) ? a_data : &dummy);
+
+  H5Pclose(transferProps);
+  H5Sclose(memSpace);
+  H5Sclose(fileSpace);
+  H5Dclose(dataset);
+}
+#endif
+
 #include <CD_NamespaceFooter.H>
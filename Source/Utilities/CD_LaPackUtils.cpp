@@ -355,6 +355,145 @@ LaPackUtils::computePseudoInverse(std::vector<float>&       a_linAplus,
   return foundSVD;
 }
 
+/*!
+  @brief Householder QR kernel for LaPackUtils::computePseudoInverseQR. Returns false if the matrix is not tall or
+  if it is close to rank deficient, in which case a_linAplus is not touched.
+*/
+template <typename T>
+static bool
+householderPseudoInverse(std::vector<T>& a_linAplus, const std::vector<T>& a_linA, const int a_M, const int a_N)
+{
+  if (a_M < a_N || a_N < 1) {
+    return false;
+  }
+
+  // QR holds the Householder vectors on and below the diagonal, and the strictly upper part of R above the diagonal.
+  // The diagonal of R is stored separately.
+  std::vector<T> QR(a_linA.begin(), a_linA.begin() + a_M * a_N);
+  std::vector<T> tau(a_N);
+  std::vector<T> diagR(a_N);
+
+  for (int j = 0; j < a_N; j++) {
+    T* v = &QR[j * a_M];
+
+    T norm = 0.0;
+    for (int i = j; i < a_M; i++) {
+      norm += v[i] * v[i];
+    }
+    norm = std::sqrt(norm);
+
+    if (norm == 0.0) {
+      return false;
+    }
+
+    // Reflect column j onto alpha*e_j. The sign is chosen so that there is no cancellation in v_j.
+    const T alpha = (v[j] > 0.0) ? -norm : norm;
+
+    v[j] -= alpha;
+
+    T vv = 0.0;
+    for (int i = j; i < a_M; i++) {
+      vv += v[i] * v[i];
+    }
+
+    tau[j]   = 2.0 / vv;
+    diagR[j] = alpha;
+
+    for (int k = j + 1; k < a_N; k++) {
+      T* c = &QR[k * a_M];
+
+      T dot = 0.0;
+      for (int i = j; i < a_M; i++) {
+        dot += v[i] * c[i];
+      }
+      dot *= tau[j];
+
+      for (int i = j; i < a_M; i++) {
+        c[i] -= dot * v[i];
+      }
+    }
+  }
+
+  // Rank check. The SVD path cuts off singular values below eps * max(M,N) * sigma_max, and the diagonal of R is only
+  // an estimate of those. We use a much more conservative threshold so that anything remotely ill-conditioned goes
+  // through the SVD instead.
+  T maxR = 0.0;
+  T minR = std::numeric_limits<T>::max();
+  for (int j = 0; j < a_N; j++) {
+    maxR = std::max(maxR, std::abs(diagR[j]));
+    minR = std::min(minR, std::abs(diagR[j]));
+  }
+
+  if (minR <= std::sqrt(std::numeric_limits<T>::epsilon()) * maxR) {
+    return false;
+  }
+
+  // Column i of A^+ is R^(-1) * Q^T * e_i. Apply the reflectors to e_i and back-substitute.
+  a_linAplus.resize(a_N * a_M);
+
+  std::vector<T> y(a_M);
+
+  for (int i = 0; i < a_M; i++) {
+    std::fill(y.begin(), y.end(), 0.0);
+    y[i] = 1.0;
+
+    for (int j = 0; j < a_N; j++) {
+      const T* v = &QR[j * a_M];
+
+      T dot = 0.0;
+      for (int r = j; r < a_M; r++) {
+        dot += v[r] * y[r];
+      }
+      dot *= tau[j];
+
+      for (int r = j; r < a_M; r++) {
+        y[r] -= dot * v[r];
+      }
+    }
+
+    for (int n = a_N - 1; n >= 0; n--) {
+      T sum = y[n];
+      for (int k = n + 1; k < a_N; k++) {
+        sum -= QR[k * a_M + n] * y[k];
+      }
+
+      y[n] = sum / diagR[n];
+    }
+
+    for (int n = 0; n < a_N; n++) {
+      a_linAplus[n + i * a_N] = y[n];
+    }
+  }
+
+  return true;
+}
+
+bool
+LaPackUtils::computePseudoInverseQR(std::vector<double>&       a_linAplus,
+                                    const std::vector<double>& a_linA,
+                                    const int&                 a_M,
+                                    const int&                 a_N)
+{
+  if (householderPseudoInverse(a_linAplus, a_linA, a_M, a_N)) {
+    return true;
+  }
+
+  return LaPackUtils::computePseudoInverse(a_linAplus, a_linA, a_M, a_N);
+}
+
+bool
+LaPackUtils::computePseudoInverseQR(std::vector<float>&       a_linAplus,
+                                    const std::vector<float>& a_linA,
+                                    const int&                a_M,
+                                    const int&                a_N)
+{
+  if (householderPseudoInverse(a_linAplus, a_linA, a_M, a_N)) {
+    return true;
+  }
+
+  return LaPackUtils::computePseudoInverse(a_linAplus, a_linA, a_M, a_N);
+}
+
 void
 LaPackUtils::linearizeColumnMajorMatrix(std::vector<double>&                    a_linA,
                                         int&                                    a_M,
@@ -555,8 +555,8 @@ LeastSquares::computeSingleLevelStencils(const IntVectSet&       a_derivs,
       }
     }
 
-    // Compute the pseudo-inverse.
-    const bool foundSVD = LaPackUtils::computePseudoInverse(linAplus.stdVector(), linA.stdVector(), K, M);
+    // Compute the pseudo-inverse. This uses a QR decomposition and falls back to the SVD for rank-deficient systems.
+    const bool foundSVD = LaPackUtils::computePseudoInverseQR(linAplus.stdVector(), linA.stdVector(), K, M);
 
     if (foundSVD) {
       // When we have eliminated rows in the linear system we can't use MultiIndex to map directly, this occurs because
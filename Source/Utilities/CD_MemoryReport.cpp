@@ -121,4 +121,16 @@ MemoryReport::getMemoryUsage(Vector<Real>& a_peak, Vector<Real>& a_unfreed)
 #endif
 }
 
+long long
+MemoryReport::getUnfreedMemory()
+{
+  long long curMemLL  = 0LL;
+  long long peakMemLL = 0LL;
+#ifdef CH_USE_MEMORY_TRACKING
+  overallMemoryUsage(curMemLL, peakMemLL);
+#endif
+
+  return curMemLL;
+}
+
 #include <CD_NamespaceFooter.H>
@@ -0,0 +1,297 @@
+/* chombo-discharge
+ * Copyright © 2026 SINTEF Energy Research.
+ * Please refer to Copyright.txt and LICENSE in the chombo-discharge root directory.
+ */
+
+/*!
+  @file   CD_MemoryTracker.cpp
+  @brief  Implementation of CD_MemoryTracker.H
+  @author Robert Marskar
+*/
+
+// Std includes
+#include <algorithm>
+#include <iomanip>
+#include <set>
+#include <sstream>
+
+// Chombo includes
+#include <CH_Timer.H>
+#include <SPMD.H>
+#include <VoFIterator.H>
+
+// Our includes
+#include <CD_MemoryTracker.H>
+#include <CD_NamespaceHeader.H>
+
+bool                                        MemoryTracker::s_enabled = false;
+std::recursive_mutex                        MemoryTracker::s_mutex;
+std::map<std::string, MemoryTracker::Usage> MemoryTracker::s_usage;
+std::vector<MemoryTracker::Allocation*>     MemoryTracker::s_probes;
+
+MemoryTracker::Allocation::Allocation(const std::string& a_category, const long long a_bytes) noexcept
+{
+  m_category = a_category;
+  m_bytes    = a_bytes;
+
+  MemoryTracker::add(m_category, m_bytes);
+}
+
+MemoryTracker::Allocation::Allocation(const std::string& a_category, const std::function<long long()>& a_probe) noexcept
+{
+  m_category = a_category;
+  m_bytes    = a_probe();
+  m_probe    = a_probe;
+
+  std::lock_guard<std::recursive_mutex> lock(s_mutex);
+
+  MemoryTracker::add(m_category, m_bytes);
+
+  s_probes.emplace_back(this);
+}
+
+MemoryTracker::Allocation::~Allocation() noexcept
+{
+  std::lock_guard<std::recursive_mutex> lock(s_mutex);
+
+  MemoryTracker::add(m_category, -m_bytes);
+
+  if (m_probe) {
+    s_probes.erase(std::remove(s_probes.begin(), s_probes.end(), this), s_probes.end());
+  }
+}
+
+void
+MemoryTracker::Allocation::sample() noexcept
+{
+  if (m_probe) {
+    const long long bytes = m_probe();
+
+    MemoryTracker::add(m_category, bytes - m_bytes);
+
+    m_bytes = bytes;
+  }
+}
+
+void
+MemoryTracker::setEnabled(const bool a_enable) noexcept
+{
+  s_enabled = a_enable;
+}
+
+MemoryTracker::Handle
+MemoryTracker::track(const std::string& a_category, const long long a_bytes) noexcept
+{
+  return s_enabled ? std::make_shared<Allocation>(a_category, a_bytes) : nullptr;
+}
+
+MemoryTracker::Handle
+MemoryTracker::track(const std::string& a_category, const std::function<long long()>& a_probe) noexcept
+{
+  return s_enabled ? std::make_shared<Allocation>(a_category, a_probe) : nullptr;
+}
+
+void
+MemoryTracker::add(const std::string& a_category, const long long a_bytes) noexcept
+{
+  std::lock_guard<std::recursive_mutex> lock(s_mutex);
+
+  Usage& usage = s_usage[a_category];
+
+  usage.current += a_bytes;
+  usage.peak = std::max(usage.peak, usage.current);
+}
+
+void
+MemoryTracker::sample() noexcept
+{
+  CH_TIME("MemoryTracker::sample");
+
+  std::lock_guard<std::recursive_mutex> lock(s_mutex);
+
+  for (auto& probe : s_probes) {
+    probe->sample();
+  }
+}
+
+void
+MemoryTracker::resetHighWater() noexcept
+{
+  CH_TIME("MemoryTracker::resetHighWater");
+
+  std::lock_guard<std::recursive_mutex> lock(s_mutex);
+
+  for (auto& usage : s_usage) {
+    usage.second.peak = usage.second.current;
+  }
+}
+
+long long
+MemoryTracker::getBytes(const LayoutData<BaseIVFAB<VoFStencil>>& a_stencils) noexcept
+{
+  CH_TIME("MemoryTracker::getBytes(LayoutData<BaseIVFAB<VoFStencil>>)");
+
+  constexpr long long bytesPerTerm = sizeof(VolIndex) + sizeof(Real);
+
+  long long bytes = 0LL;
+
+  for (DataIterator dit = a_stencils.dataIterator(); dit.ok(); ++dit) {
+    const BaseIVFAB<VoFStencil>& stencils = a_stencils[dit];
+
+    if (stencils.isDefined()) {
+      for (VoFIterator vofit(stencils.getIVS(), stencils.getEBGraph()); vofit.ok(); ++vofit) {
+        for (int comp = 0; comp < stencils.nComp(); comp++) {
+          bytes += sizeof(VoFStencil) + bytesPerTerm * stencils(vofit(), comp).size();
+        }
+      }
+    }
+  }
+
+  return bytes;
+}
+
+void
+MemoryTracker::report(std::ostream& a_outputStream, const bool a_localReportOnly) noexcept
+{
+  CH_TIME("MemoryTracker::report");
+
+  constexpr Real BytesPerMB = 1024.0 * 1024.0;
+
+  std::vector<std::string> categories;
+  std::vector<long long>   localCurrent;
+  std::vector<long long>   localPeak;
+  {
+    std::lock_guard<std::recursive_mutex> lock(s_mutex);
+
+    for (const auto& usage : s_usage) {
+      categories.emplace_back(usage.first);
+    }
+  }
+
+  // Get the union of the categories on all ranks. The master rank gathers them and broadcasts the union.
+#ifdef CH_MPI
+  if (!a_localReportOnly) {
+    std::string localCategories;
+    for (const auto& c : categories) {
+      localCategories += c + '\n';
+    }
+
+    std::vector<char> sendBuffer(localCategories.begin(), localCategories.end());
+    sendBuffer.push_back('\0');
+
+    int              localLength = localCategories.size();
+    std::vector<int> lengths(numProc(), 0);
+    std::vector<int> displacements(numProc(), 0);
+
+    MPI_Gather(&localLength, 1, MPI_INT, lengths.data(), 1, MPI_INT, 0, Chombo_MPI::comm);
+
+    int totalLength = 0;
+    for (int i = 0; i < numProc(); i++) {
+      displacements[i] = totalLength;
+      totalLength += lengths[i];
+    }
+
+    std::vector<char> recvBuffer(std::max(1, totalLength), '\0');
+    MPI_Gatherv(sendBuffer.data(),
+                localLength,
+                MPI_CHAR,
+                recvBuffer.data(),
+                lengths.data(),
+                displacements.data(),
+                MPI_CHAR,
+                0,
+                Chombo_MPI::comm);
+
+    std::string unionCategories;
+    if (procID() == 0) {
+      std::set<std::string> unique;
+      std::stringstream     ss(std::string(recvBuffer.begin(), recvBuffer.begin() + totalLength));
+      std::string           line;
+      while (std::getline(ss, line)) {
+        unique.insert(line);
+      }
+      for (const auto& c : unique) {
+        unionCategories += c + '\n';
+      }
+    }
+
+    int unionLength = unionCategories.size();
+    MPI_Bcast(&unionLength, 1, MPI_INT, 0, Chombo_MPI::comm);
+
+    std::vector<char> unionBuffer(unionCategories.begin(), unionCategories.end());
+    unionBuffer.resize(std::max(1, unionLength), '\0');
+    MPI_Bcast(unionBuffer.data(), unionLength, MPI_CHAR, 0, Chombo_MPI::comm);
+
+    categories.clear();
+
+    std::stringstream ss(std::string(unionBuffer.begin(), unionBuffer.begin() + unionLength));
+    std::string       line;
+    while (std::getline(ss, line)) {
+      categories.emplace_back(line);
+    }
+  }
+#endif
+
+  const int numCategories = categories.size();
+
+  localCurrent.resize(numCategories, 0LL);
+  localPeak.resize(numCategories, 0LL);
+  {
+    std::lock_guard<std::recursive_mutex> lock(s_mutex);
+
+    for (int i = 0; i < numCategories; i++) {
+      const auto it = s_usage.find(categories[i]);
+
+      if (it != s_usage.end()) {
+        localCurrent[i] = it->second.current;
+        localPeak[i]    = it->second.peak;
+      }
+    }
+  }
+
+  std::vector<long long> maxCurrent = localCurrent;
+  std::vector<long long> maxPeak    = localPeak;
+  std::vector<long long> sumCurrent = localCurrent;
+
+#ifdef CH_MPI
+  if (!a_localReportOnly && numCategories > 0) {
+    MPI_Allreduce(localCurrent.data(), maxCurrent.data(), numCategories, MPI_LONG_LONG, MPI_MAX, Chombo_MPI::comm);
+    MPI_Allreduce(localPeak.data(), maxPeak.data(), numCategories, MPI_LONG_LONG, MPI_MAX, Chombo_MPI::comm);
+    MPI_Allreduce(localCurrent.data(), sumCurrent.data(), numCategories, MPI_LONG_LONG, MPI_SUM, Chombo_MPI::comm);
+  }
+#endif
+
+  // Print the report.
+  std::stringstream report;
+
+  const std::string line =
+    "| -----------------------------------------------------------------------------------------------------|";
+
+  report << line << "\n"
+         << "| Memory tracker report (MB): "
+         << "\n"
+         << line << "\n"
+         << "| " << std::left << std::setw(40) << "Category"
+         << "| " << std::right << std::setw(10) << "Loc."
+         << "| " << std::right << std::setw(10) << "Loc. peak"
+         << "| " << std::right << std::setw(10) << "Max."
+         << "| " << std::right << std::setw(10) << "Max. peak"
+         << "| " << std::right << std::setw(10) << "Total"
+         << "| "
+         << "\n"
+         << line << "\n";
+
+  for (int i = 0; i < numCategories; i++) {
+    report << "| " << std::left << std::setw(40) << categories[i].substr(0, 40) << std::right << std::fixed
+           << std::setprecision(2) << "| " << std::setw(10) << localCurrent[i] / BytesPerMB << "| " << std::setw(10)
+           << localPeak[i] / BytesPerMB << "| " << std::setw(10) << maxCurrent[i] / BytesPerMB << "| " << std::setw(10)
+           << maxPeak[i] / BytesPerMB << "| " << std::setw(10) << sumCurrent[i] / BytesPerMB << "| "
+           << "\n";
+  }
+
+  report << line << "\n";
+
+  a_outputStream << report.str();
+}
+
+#include <CD_NamespaceFooter.H>
@@ -0,0 +1,392 @@
+/* chombo-discharge
+ * Copyright © 2026 SINTEF Energy Research.
+ * Please refer to Copyright.txt and LICENSE in the chombo-discharge root directory.
+ */
+
+/*!
+  @file   CD_Profiler.cpp
+  @brief  Implementation of CD_Profiler.H
+  @author Robert Marskar
+*/
+
+// Std includes
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <set>
+#include <sstream>
+
+// Chombo includes
+#include <CH_Timer.H>
+#ifdef CH_MPI
+#include <SPMD.H>
+#endif
+
+// Our includes
+#include <CD_Profiler.H>
+#include <CD_NamespaceHeader.H>
+
+bool                                               Profiler::s_enabled        = false;
+bool                                               Profiler::s_tracing        = false;
+size_t                                             Profiler::s_maxTraceEvents = 0;
+Profiler::Clock::time_point                        Profiler::s_traceStart     = Profiler::Clock::now();
+std::mutex                                         Profiler::s_mutex;
+std::vector<std::string>                           Profiler::s_eventNames;
+std::vector<std::unique_ptr<Profiler::ThreadData>> Profiler::s_threadData;
+thread_local Profiler::ThreadData*                 Profiler::s_localData = nullptr;
+
+Profiler::EventID
+Profiler::registerEvent(const std::string& a_name) noexcept
+{
+  std::lock_guard<std::mutex> lock(s_mutex);
+
+  for (int i = 0; i < s_eventNames.size(); i++) {
+    if (s_eventNames[i] == a_name) {
+      return i;
+    }
+  }
+
+  s_eventNames.emplace_back(a_name);
+
+  return s_eventNames.size() - 1;
+}
+
+void
+Profiler::setEnabled(const bool a_enable) noexcept
+{
+  s_enabled = a_enable;
+}
+
+Profiler::ThreadData*
+Profiler::createThreadData() noexcept
+{
+  std::lock_guard<std::mutex> lock(s_mutex);
+
+  std::unique_ptr<ThreadData> data(new ThreadData());
+
+  data->nodes.push_back(Node{-1, -1, 0LL, 0.0, std::vector<std::pair<EventID, int>>()});
+  data->current = 0;
+  data->thread  = s_threadData.size();
+
+  s_threadData.emplace_back(std::move(data));
+
+  return s_threadData.back().get();
+}
+
+void
+Profiler::setTracing(const bool a_enable, const int a_rankStride, const size_t a_maxEvents) noexcept
+{
+  CH_TIME("Profiler::setTracing");
+
+#ifdef CH_MPI
+  MPI_Barrier(Chombo_MPI::comm);
+
+  const int rank = procID();
+#else
+  const int rank = 0;
+#endif
+
+  s_tracing        = a_enable && (rank % std::max(1, a_rankStride) == 0);
+  s_maxTraceEvents = a_maxEvents;
+  s_traceStart     = Clock::now();
+}
+
+void
+Profiler::addTraceEvent(const std::string& a_name, const Clock::time_point& a_begin, const Clock::time_point& a_end) noexcept
+{
+  if (s_tracing) {
+    const EventID event = Profiler::registerEvent(a_name);
+    ThreadData&   data  = Profiler::getThreadData();
+
+    if (data.trace.size() < s_maxTraceEvents) {
+      data.trace.push_back(TraceEvent{event, a_begin, a_end});
+    }
+  }
+}
+
+void
+Profiler::writeTrace(const std::string& a_fileName) noexcept
+{
+  CH_TIME("Profiler::writeTrace");
+
+#ifdef CH_MPI
+  const int rank = procID();
+#else
+  const int rank = 0;
+#endif
+
+  // Serialize the events on this rank in the Chrome trace event format. Times are in microseconds.
+  std::stringstream ss;
+  {
+    std::lock_guard<std::mutex> lock(s_mutex);
+
+    for (const auto& data : s_threadData) {
+      for (const auto& e : data->trace) {
+        const Real begin    = std::chrono::duration<Real, std::micro>(e.begin - s_traceStart).count();
+        const Real duration = std::chrono::duration<Real, std::micro>(e.end - e.begin).count();
+
+        std::string name;
+        for (const char c : s_eventNames[e.event]) {
+          if (c == '"' || c == '\\') {
+            name += '\\';
+          }
+          name += c;
+        }
+
+        ss << "{\"name\":\"" << name << "\",\"ph\":\"X\",\"pid\":" << rank << ",\"tid\":" << data->thread
+           << ",\"ts\":" << std::fixed << std::setprecision(3) << begin << ",\"dur\":" << duration << "},\n";
+      }
+    }
+  }
+
+  std::string localEvents = ss.str();
+
+  // Gather the events on the master rank.
+#ifdef CH_MPI
+  std::vector<char> sendBuffer(localEvents.begin(), localEvents.end());
+  sendBuffer.push_back('\0');
+
+  int              localLength = localEvents.size();
+  std::vector<int> lengths(numProc(), 0);
+  std::vector<int> displacements(numProc(), 0);
+
+  MPI_Gather(&localLength, 1, MPI_INT, lengths.data(), 1, MPI_INT, 0, Chombo_MPI::comm);
+
+  int totalLength = 0;
+  for (int i = 0; i < numProc(); i++) {
+    displacements[i] = totalLength;
+    totalLength += lengths[i];
+  }
+
+  std::vector<char> recvBuffer(std::max(1, totalLength), '\0');
+  MPI_Gatherv(sendBuffer.data(),
+              localLength,
+              MPI_CHAR,
+              recvBuffer.data(),
+              lengths.data(),
+              displacements.data(),
+              MPI_CHAR,
+              0,
+              Chombo_MPI::comm);
+
+  const std::string allEvents(recvBuffer.begin(), recvBuffer.begin() + totalLength);
+#else
+  const std::string& allEvents = localEvents;
+#endif
+
+  if (rank == 0) {
+    std::ofstream f(a_fileName, std::ios_base::trunc);
+
+    // Chrome trace files permit a trailing comma in the event list, but not all viewers do.
+    const size_t end = allEvents.rfind(',');
+
+    f << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+      << ((end == std::string::npos) ? std::string() : allEvents.substr(0, end)) << "\n]}\n";
+
+    f.close();
+  }
+}
+
+void
+Profiler::clear() noexcept
+{
+  CH_TIME("Profiler::clear");
+
+  std::lock_guard<std::mutex> lock(s_mutex);
+
+  for (auto& data : s_threadData) {
+    for (auto& node : data->nodes) {
+      node.calls = 0LL;
+      node.time  = 0.0;
+    }
+  }
+}
+
+void
+Profiler::eventReport(std::ostream& a_outputStream, const bool a_localReportOnly) noexcept
+{
+  CH_TIME("Profiler::eventReport");
+
+  // Call paths are stored as the event names separated by a control character. This sorts children directly after their
+  // parent, so iterating through the sorted paths gives a depth-first traversal of the call tree.
+  constexpr char separator = '\x1f';
+
+  // Merge the call trees of all threads.
+  std::map<std::string, std::pair<Real, long long>> localEvents;
+  {
+    std::lock_guard<std::mutex> lock(s_mutex);
+
+    for (const auto& data : s_threadData) {
+      for (int i = 1; i < data->nodes.size(); i++) {
+        std::vector<std::string> names;
+        for (int n = i; n > 0; n = data->nodes[n].parent) {
+          names.emplace_back(s_eventNames[data->nodes[n].event]);
+        }
+
+        std::string path;
+        for (auto it = names.rbegin(); it != names.rend(); ++it) {
+          path += (path.empty() ? "" : std::string(1, separator)) + *it;
+        }
+
+        std::pair<Real, long long>& event = localEvents[path];
+
+        event.first += data->nodes[i].time;
+        event.second += data->nodes[i].calls;
+      }
+    }
+  }
+
+  std::vector<std::string> paths;
+  for (const auto& e : localEvents) {
+    paths.emplace_back(e.first);
+  }
+
+  // Get the union of the call paths on all ranks. The master rank gathers them and broadcasts the union.
+#ifdef CH_MPI
+  if (!a_localReportOnly) {
+    std::string localPaths;
+    for (const auto& p : paths) {
+      localPaths += p + '\n';
+    }
+
+    std::vector<char> sendBuffer(localPaths.begin(), localPaths.end());
+    sendBuffer.push_back('\0');
+
+    int              localLength = localPaths.size();
+    std::vector<int> lengths(numProc(), 0);
+    std::vector<int> displacements(numProc(), 0);
+
+    MPI_Gather(&localLength, 1, MPI_INT, lengths.data(), 1, MPI_INT, 0, Chombo_MPI::comm);
+
+    int totalLength = 0;
+    for (int i = 0; i < numProc(); i++) {
+      displacements[i] = totalLength;
+      totalLength += lengths[i];
+    }
+
+    std::vector<char> recvBuffer(std::max(1, totalLength), '\0');
+    MPI_Gatherv(sendBuffer.data(),
+                localLength,
+                MPI_CHAR,
+                recvBuffer.data(),
+                lengths.data(),
+                displacements.data(),
+                MPI_CHAR,
+                0,
+                Chombo_MPI::comm);
+
+    std::string unionPaths;
+    if (procID() == 0) {
+      std::set<std::string> unique;
+      std::stringstream     ss(std::string(recvBuffer.begin(), recvBuffer.begin() + totalLength));
+      std::string           line;
+      while (std::getline(ss, line)) {
+        unique.insert(line);
+      }
+      for (const auto& p : unique) {
+        unionPaths += p + '\n';
+      }
+    }
+
+    int unionLength = unionPaths.size();
+    MPI_Bcast(&unionLength, 1, MPI_INT, 0, Chombo_MPI::comm);
+
+    std::vector<char> unionBuffer(unionPaths.begin(), unionPaths.end());
+    unionBuffer.resize(std::max(1, unionLength), '\0');
+    MPI_Bcast(unionBuffer.data(), unionLength, MPI_CHAR, 0, Chombo_MPI::comm);
+
+    paths.clear();
+
+    std::stringstream ss(std::string(unionBuffer.begin(), unionBuffer.begin() + unionLength));
+    std::string       line;
+    while (std::getline(ss, line)) {
+      paths.emplace_back(line);
+    }
+  }
+#endif
+
+  // Local times and call counts, and the reductions over the ranks.
+  const int numEvents = paths.size();
+
+  std::vector<Real>      localTimes(numEvents, 0.0);
+  std::vector<long long> localCalls(numEvents, 0LL);
+
+  for (int i = 0; i < numEvents; i++) {
+    const auto it = localEvents.find(paths[i]);
+
+    if (it != localEvents.end()) {
+      localTimes[i] = it->second.first;
+      localCalls[i] = it->second.second;
+    }
+  }
+
+  std::vector<Real> minTimes = localTimes;
+  std::vector<Real> maxTimes = localTimes;
+  std::vector<Real> avgTimes = localTimes;
+
+#ifdef CH_MPI
+  if (!a_localReportOnly && numEvents > 0) {
+    MPI_Allreduce(localTimes.data(), minTimes.data(), numEvents, MPI_CH_REAL, MPI_MIN, Chombo_MPI::comm);
+    MPI_Allreduce(localTimes.data(), maxTimes.data(), numEvents, MPI_CH_REAL, MPI_MAX, Chombo_MPI::comm);
+    MPI_Allreduce(localTimes.data(), avgTimes.data(), numEvents, MPI_CH_REAL, MPI_SUM, Chombo_MPI::comm);
+
+    for (auto& t : avgTimes) {
+      t *= 1.0 / numProc();
+    }
+  }
+#endif
+
+  // Total local time of the top-level events, used for the percentages
+  Real totalTime = 0.0;
+  for (int i = 0; i < numEvents; i++) {
+    if (paths[i].find(separator) == std::string::npos) {
+      totalTime += localTimes[i];
+    }
+  }
+
+  // Print the report.
+  std::stringstream report;
+
+  const std::string line =
+    "| -----------------------------------------------------------------------------------------------------------------|";
+
+  report << line << "\n"
+         << "| Profiler report: "
+         << "\n"
+         << line << "\n"
+         << "| " << std::left << std::setw(40) << "Event"
+         << "| " << std::right << std::setw(10) << "Calls"
+         << "| " << std::right << std::setw(10) << "Loc. (s)"
+         << "| " << std::right << std::setw(8) << "Loc. (%)"
+         << "| " << std::right << std::setw(10) << "Min. (s)"
+         << "| " << std::right << std::setw(10) << "Avg. (s)"
+         << "| " << std::right << std::setw(10) << "Max. (s)"
+         << "| "
+         << "\n"
+         << line << "\n";
+
+  for (int i = 0; i < numEvents; i++) {
+    const int    depth = std::count(paths[i].begin(), paths[i].end(), separator);
+    const size_t last  = paths[i].rfind(separator);
+
+    const std::string event = (last == std::string::npos) ? paths[i] : paths[i].substr(last + 1);
+    const std::string name  = std::string(2 * depth, ' ') + event;
+
+    const Real percentage = (totalTime > 0.0) ? 100.0 * localTimes[i] / totalTime : 0.0;
+
+    report << "| " << std::left << std::setw(40) << name.substr(0, 40) << "| " << std::right << std::setw(10)
+           << localCalls[i] << "| " << std::right << std::setw(10) << std::fixed << std::setprecision(4) << localTimes[i]
+           << "| " << std::right << std::setw(8) << std::fixed << std::setprecision(2) << percentage << "| " << std::right
+           << std::setw(10) << std::fixed << std::setprecision(4) << minTimes[i] << "| " << std::right << std::setw(10)
+           << std::fixed << std::setprecision(4) << avgTimes[i] << "| " << std::right << std::setw(10) << std::fixed
+           << std::setprecision(4) << maxTimes[i] << "| "
+           << "\n";
+  }
+
+  report << line << "\n";
+
+  a_outputStream << report.str();
+}
+
+#include <CD_NamespaceFooter.H>
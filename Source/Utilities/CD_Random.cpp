@@ -18,6 +18,12 @@ thread_local std::uniform_real_distribution<Real> Random::s_uniform01 = std::uni
 thread_local std::uniform_real_distribution<Real> Random::s_uniform11 = std::uniform_real_distribution<Real>(-1.0, 1.0);
 thread_local std::normal_distribution<Real>       Random::s_normal01  = std::normal_distribution<Real>(0.0, 1.0);
 
+thread_local Philox4x32                           Random::s_stream     = Philox4x32(0ULL, 1ULL << 63);
+thread_local Philox4x32                           Random::s_userStream = Philox4x32(0ULL, 0ULL);
+thread_local bool                                 Random::s_useStream  = false;
+
+uint64_t Random::s_streamKey = 0ULL;
+
 bool Random::s_seeded = false;
 
 //std::once_flag once = std::once_flag();